@@ -0,0 +1,446 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "CommandInterpreter.h"
+
+#include <charconv>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Constructor de la clase CommandInterpreter.
+ *
+ * @param pool Pool de hilos con el que se ejecutan las consultas.
+ * @author fabian
+ */
+CommandInterpreter::CommandInterpreter(ThreadPool& pool) : pool(pool) {
+    this->out.reserve(OUTPUT_FLUSH_SIZE + 4096);
+}
+
+/**
+ * @brief Lee de un flujo lo que ya esté disponible, sin esperar a llenar el búfer.
+ *
+ * @param input Archivo o entrada estándar.
+ * @param data Destino de los bytes leídos.
+ * @param size Máximo de bytes a leer.
+ * @return Cantidad de bytes leídos, o 0 al final de la entrada o si la lectura falla.
+ * @author fabian
+ */
+static size_t readAvailable(FILE* input, char* data, const size_t size) {
+#ifdef _WIN32
+    const int read = _read(_fileno(input), data, static_cast<unsigned>(min<size_t>(size, 1u << 30)));
+    return read > 0 ? static_cast<size_t>(read) : 0;
+#else
+    while (true) {
+        const ssize_t read = ::read(fileno(input), data, size);
+        if (read >= 0) return static_cast<size_t>(read);
+        if (errno != EINTR) return 0;
+    }
+#endif
+}
+
+/**
+ * @brief Ejecuta todos los comandos de un flujo de entrada.
+ *
+ * Lee la entrada por bloques grandes, sin copiar cada línea, y acumula la salida en un búfer que se
+ * escribe de una sola vez cada vez que se llena. Cada lectura devuelve lo que ya llegó, aunque no llene el
+ * búfer: las líneas completas se ejecutan y sus resultados se escriben antes de volver a leer, así que un
+ * programa que envía un comando por una tubería y espera su respuesta no se queda esperando.
+ *
+ * @param input Archivo o entrada estándar con los comandos.
+ * @param output Archivo o salida estándar donde se escriben los resultados.
+ * @return Cantidad de comandos ejecutados.
+ * @author fabian
+ */
+long long CommandInterpreter::run(FILE* input, FILE* output) {
+    this->output = output;
+    long long commands = 0;
+
+    vector<char> buffer(1 << 20);
+    size_t pending = 0;
+
+    while (true) {
+        const size_t read = readAvailable(input, buffer.data() + pending, buffer.size() - pending);
+        const size_t available = pending + read;
+        const bool finished = read == 0;
+
+        size_t lineStart = 0;
+        for (size_t i = 0; i < available; i++) {
+            if (buffer[i] != '\n') continue;
+            execute(string_view(buffer.data() + lineStart, i - lineStart));
+            lineStart = i + 1;
+            commands++;
+        }
+
+        if (finished) {
+            if (lineStart < available) {
+                execute(string_view(buffer.data() + lineStart, available - lineStart));
+                commands++;
+            }
+            break;
+        }
+        flush();
+
+        pending = available - lineStart;
+        if (pending == buffer.size()) buffer.resize(buffer.size() * 2);
+        copy(buffer.begin() + static_cast<long>(lineStart), buffer.begin() + static_cast<long>(available), buffer.begin());
+    }
+
+    flush();
+    return commands;
+}
+
+/**
+ * @brief Ejecuta un solo comando y escribe su resultado.
+ *
+ * @param line Línea con el comando y sus campos separados por tabuladores.
+ * @author fabian
+ */
+void CommandInterpreter::execute(string_view line) {
+    ++this->lineNumber;
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+    if (line.empty() || line.front() == '#') return;
+
+    split(line);
+    try {
+        dispatch();
+    } catch (const exception& error) {
+        ++this->errorCount;
+        this->out += "error\t";
+        this->out += to_string(this->lineNumber);
+        this->out += '\t';
+        this->out += error.what();
+        this->out += '\n';
+    }
+
+    if (this->out.size() >= OUTPUT_FLUSH_SIZE) flush();
+}
+
+/**
+ * @brief Obtiene la cantidad de comandos que terminaron con error.
+ *
+ * @return Número de errores.
+ * @author fabian
+ */
+long long CommandInterpreter::getErrorCount() const { return this->errorCount; }
+
+/**
+ * @brief Separa una línea en campos por tabuladores.
+ *
+ * @param line Línea a separar.
+ * @throws runtime_error Si la línea tiene más campos de los permitidos.
+ * @author fabian
+ */
+void CommandInterpreter::split(string_view line) {
+    this->fieldCount = 0;
+    while (this->fieldCount < MAX_FIELDS) {
+        const size_t tab = line.find('\t');
+        this->fields[this->fieldCount++] = line.substr(0, tab);
+        if (tab == string_view::npos) return;
+        line.remove_prefix(tab + 1);
+    }
+    this->fieldCount = MAX_FIELDS + 1;
+}
+
+/**
+ * @brief Ejecuta la operación correspondiente al primer campo de la línea.
+ *
+ * @throws runtime_error Si el comando no existe o sus campos son inválidos.
+ * @author fabian
+ */
+void CommandInterpreter::dispatch() {
+    if (this->fieldCount > MAX_FIELDS) throw runtime_error("Demasiados campos");
+    const string_view command = this->fields[0];
+
+    if (command == "addTask" || command == "addCompletedTask") {
+        auto* task = new Task(text(6), text(3), text(4), text(5), taskType(2));
+        int id;
+        try {
+            id = addTask(integer(1), task, command == "addCompletedTask");
+        } catch (...) {
+            delete task;
+            throw;
+        }
+        this->out += "ok\t";
+        this->out += to_string(id);
+        this->out += '\n';
+        return;
+    }
+
+    if (command == "taskHandle" || command == "subTaskHandle") {
+        const uint64_t handle = command == "taskHandle" ? getTaskHandle(integer(1), integer(2))
+                                                        : getSubTaskHandle(integer(1), integer(2), integer(3));
+        this->out += "ok\t";
+        this->out += to_string(handle);
+        this->out += '\n';
+        return;
+    }
+
+    if (command == "completeTasksBefore" || command == "shiftTasks" || command == "shiftAllTasks") {
+        uint64_t count;
+        if (command == "completeTasksBefore") count = completeTasksBefore(integer(1), text(2));
+        else if (command == "shiftTasks") count = shiftTasks(integer(1), taskType(2), integer(3));
+        else count = shiftAllTasks(taskType(1), integer(2));
+        this->out += "ok\t";
+        this->out += to_string(count);
+        this->out += '\n';
+        return;
+    }
+
+    if (command == "addSubTask") {
+        auto* subTask = new SubTask(text(4), text(5), decimal(3));
+        try {
+            addSubTask(integer(1), integer(2), subTask);
+        } catch (...) {
+            delete subTask;
+            throw;
+        }
+    } else if (command == "completeTask") {
+        completeTask(integer(1), integer(2));
+    } else if (command == "completeSubTask") {
+        completeSubTask(integer(1), integer(2), integer(3));
+    } else if (command == "subTaskProgress") {
+        subTaskProgress(integer(1), integer(2), integer(3), decimal(4));
+    } else if (command == "modifyActiveTask") {
+        modifyActiveTask(integer(1), integer(2), text(3), text(4));
+    } else if (command == "deleteTask") {
+        deleteTask(integer(1), integer(2));
+    } else if (command == "completeTaskHandle") {
+        completeTaskByHandle(integer(1), handle(2));
+    } else if (command == "deleteTaskHandle") {
+        deleteTaskByHandle(integer(1), handle(2));
+    } else if (command == "rescheduleTaskHandle") {
+        rescheduleTaskByHandle(integer(1), handle(2), text(3), text(4));
+    } else if (command == "completeSubTaskHandle") {
+        completeSubTaskByHandle(integer(1), handle(2));
+    } else if (command == "subTaskProgressHandle") {
+        subTaskProgressByHandle(integer(1), handle(2), decimal(3));
+    } else if (command == "addPerson") {
+        addPerson(integer(1), text(2), text(3), integer(4));
+    } else if (command == "deletePerson") {
+        deletePerson(integer(1));
+    } else if (command == "addTaskType") {
+        addTaskType(text(1), text(2));
+    } else if (command == "compact") {
+        if (!compactor) throw runtime_error("No hay registro de mutaciones para compactar");
+        commitMutations();
+        compactor->start();
+    } else if (command == "query") {
+        runQuery();
+        return;
+    } else if (command == "export") {
+        vector<string> args;
+        for (int i = 3; i < this->fieldCount; i++) args.push_back(text(i));
+        const ExportSummary summary = exportReport(text(1), args, text(2), this->pool, this->pool.getThreadCount() > 1);
+        this->out += "ok\t";
+        this->out += to_string(summary.rows);
+        this->out += '\t';
+        this->out += to_string(summary.bytes);
+        this->out += '\n';
+        return;
+    } else {
+        throw runtime_error("Comando desconocido: " + string(command));
+    }
+
+    this->out += "ok\n";
+}
+
+/**
+ * @brief Ejecuta una de las consultas del menú de consultas.
+ *
+ * `query<TAB>n` con los argumentos de cada consulta: el tipo para la 2, el tipo y la fecha para la 4 y
+ * la fecha para la 5. Las consultas 1, 2 y 4 responden `ok<TAB>cedula<TAB>nombre<TAB>cantidad`; las demás
+ * responden `ok<TAB>maximo<TAB>clave...` con todas las claves empatadas en el máximo.
+ *
+ * @throws runtime_error Si la consulta no existe o sus argumentos son inválidos.
+ * @author fabian
+ */
+void CommandInterpreter::runQuery() {
+    switch (integer(1)) {
+        case 1: writePerson(queryMostActiveTasks(people, this->pool)); break;
+        case 2: writePerson(queryMostActiveTasksOfType(people, this->pool, text(2))); break;
+        case 3: writeCounts(queryActiveTaskTypes(people, this->pool)); break;
+        case 4: writePerson(queryMostExpiredTasksOfType(people, this->pool, text(2), date(3))); break;
+        case 5: writeCounts(queryExpiredTaskTypes(people, this->pool, date(2))); break;
+        case 6: writeCounts(queryActiveImportances(people, this->pool)); break;
+        case 7: writeCounts(queryTaskTypesByImportance(people, this->pool, false, "Medio")); break;
+        case 8: writeCounts(queryTaskTypesByImportance(people, this->pool, true, "Alto")); break;
+        default: throw runtime_error("Consulta desconocida");
+    }
+}
+
+/**
+ * @brief Obtiene un campo de la línea actual.
+ *
+ * @param index Posición del campo.
+ * @return El campo.
+ * @throws runtime_error Si la línea no tiene ese campo.
+ * @author fabian
+ */
+string_view CommandInterpreter::field(const int index) const {
+    if (index >= this->fieldCount) throw runtime_error("Faltan campos");
+    return this->fields[index];
+}
+
+/**
+ * @brief Obtiene un campo de texto de la línea actual.
+ *
+ * @param index Posición del campo.
+ * @return El campo como cadena.
+ * @author fabian
+ */
+string CommandInterpreter::text(const int index) const {
+    return string(field(index));
+}
+
+/**
+ * @brief Obtiene un campo entero de la línea actual.
+ *
+ * @param index Posición del campo.
+ * @return El valor del campo.
+ * @throws runtime_error Si el campo no es un entero.
+ * @author fabian
+ */
+int CommandInterpreter::integer(const int index) const {
+    const string_view value = field(index);
+    int result = 0;
+    const auto [end, error] = from_chars(value.data(), value.data() + value.size(), result);
+    if (error != errc() || end != value.data() + value.size()) throw runtime_error("Numero invalido: " + string(value));
+    return result;
+}
+
+/**
+ * @brief Obtiene un campo decimal de la línea actual.
+ *
+ * @param index Posición del campo.
+ * @return El valor del campo.
+ * @throws runtime_error Si el campo no es un número.
+ * @author fabian
+ */
+float CommandInterpreter::decimal(const int index) const {
+    const string_view value = field(index);
+    float result = 0;
+    const auto [end, error] = from_chars(value.data(), value.data() + value.size(), result);
+    if (error != errc() || end != value.data() + value.size()) throw runtime_error("Numero invalido: " + string(value));
+    return result;
+}
+
+/**
+ * @brief Obtiene un campo con un handle de tarea o subtarea de la línea actual.
+ *
+ * @param index Posición del campo.
+ * @return El valor del campo.
+ * @throws runtime_error Si el campo no es un entero sin signo.
+ * @author fabian
+ */
+uint64_t CommandInterpreter::handle(const int index) const {
+    const string_view value = field(index);
+    uint64_t result = 0;
+    const auto [end, error] = from_chars(value.data(), value.data() + value.size(), result);
+    if (error != errc() || end != value.data() + value.size()) throw runtime_error("Numero invalido: " + string(value));
+    return result;
+}
+
+/**
+ * @brief Obtiene un campo de fecha "dd-mm-YYYY" de la línea actual.
+ *
+ * @param index Posición del campo.
+ * @return La fecha.
+ * @throws runtime_error Si el campo no tiene el formato correcto.
+ * @author fabian
+ */
+tm CommandInterpreter::date(const int index) const {
+    tm result = {};
+    if (!parseDate(field(index), result)) throw runtime_error("Formato de fecha incorrecto. (dd-mm-YYYY)");
+    return result;
+}
+
+/**
+ * @brief Obtiene un tipo de tarea a partir de su nombre o de su índice en la lista de tipos.
+ *
+ * @param index Posición del campo.
+ * @return El tipo de tarea.
+ * @throws runtime_error Si el tipo no existe.
+ * @author fabian
+ */
+TaskType* CommandInterpreter::taskType(const int index) const {
+    const string_view value = field(index);
+    TaskType* current = taskTypes.head;
+    if (!current) throw runtime_error("Tipo de tarea no encontrado");
+
+    int position = 0;
+    const bool byIndex = from_chars(value.data(), value.data() + value.size(), position).ec == errc();
+    if (byIndex) {
+        if (position < 0 || position >= taskTypes.getLength()) throw runtime_error("Tipo de tarea no encontrado");
+        return taskTypes.get(position);
+    }
+
+    do {
+        if (current->name == value) return current;
+        current = current->next;
+    } while (current != taskTypes.head);
+    throw runtime_error("Tipo de tarea no encontrado");
+}
+
+/**
+ * @brief Escribe el resultado de una consulta que devuelve una persona.
+ *
+ * @param result Persona encontrada y su conteo.
+ * @author fabian
+ */
+void CommandInterpreter::writePerson(const PersonArgMax& result) {
+    if (!result.person) {
+        this->out += "ok\t-\t-\t0\n";
+        return;
+    }
+    this->out += "ok\t";
+    this->out += to_string(result.person->id);
+    this->out += '\t';
+    this->out += result.person->name;
+    this->out += '\t';
+    this->out += to_string(result.count);
+    this->out += '\n';
+}
+
+/**
+ * @brief Escribe el resultado de una consulta de conteos, con todas las claves empatadas en el máximo.
+ *
+ * @param counts Conteos por clave.
+ * @author fabian
+ */
+void CommandInterpreter::writeCounts(const KeyCounts& counts) {
+    const int maxCount = counts.maxCount();
+    this->out += "ok\t";
+    this->out += to_string(maxCount);
+    if (!counts.entries.empty()) {
+        for (const string& key : counts.keysWithCount(maxCount)) {
+            this->out += '\t';
+            this->out += key;
+        }
+    }
+    this->out += '\n';
+}
+
+/**
+ * @brief Escribe en la salida todo lo acumulado en el búfer.
+ *
+ * Antes espera a que las mutaciones de los comandos ya respondidos estén en el registro de mutaciones, así que
+ * un `ok` nunca se publica antes de que su cambio sea durable y todo un bloque de comandos cuesta una sola
+ * sincronización con el disco. Después, si el registro creció demasiado, inicia una compactación.
+ *
+ * @author fabian
+ */
+void CommandInterpreter::flush() {
+    commitMutations();
+    if (compactor) compactor->maybeStart();
+    if (this->output && !this->out.empty()) fwrite(this->out.data(), 1, this->out.size(), this->output);
+    if (this->output) fflush(this->output);
+    this->out.clear();
+}
@@ -0,0 +1,75 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef COMMANDINTERPRETER_H
+#define COMMANDINTERPRETER_H
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include "../Engine/Operations.h"
+#include "../Engine/Compactor.h"
+#include "../Export/ReportExporter.h"
+#include "../Queries/Queries.h"
+
+/**
+ * @brief Intérprete no interactivo de comandos por líneas.
+ *
+ * Cada línea es un comando con sus campos separados por tabuladores, por ejemplo
+ * `addTask<TAB>208620694<TAB>Estudio<TAB>Alto<TAB>01-09-2024<TAB>12:00:00<TAB>Examenes`.
+ * Por cada comando se escribe una línea que empieza con `ok` o con `error`, seguida de los resultados
+ * separados por tabuladores. Las líneas vacías y las que empiezan con `#` se ignoran.
+ *
+ * `export<TAB>reporte<TAB>archivo[<TAB>argumento]` exporta un reporte (ver `exportReport`) y responde
+ * `ok<TAB>filas<TAB>bytes`.
+ *
+ * `completeTasksBefore<TAB>cedula<TAB>fecha`, `shiftTasks<TAB>cedula<TAB>tipo<TAB>dias` y
+ * `shiftAllTasks<TAB>tipo<TAB>dias` completan o mueven varias tareas a la vez y responden `ok<TAB>cantidad`.
+ *
+ * `taskHandle<TAB>cedula<TAB>id` y `subTaskHandle<TAB>cedula<TAB>id<TAB>indice` responden `ok<TAB>handle`; con él,
+ * `completeTaskHandle`, `deleteTaskHandle`, `rescheduleTaskHandle` (más fecha y hora), `completeSubTaskHandle` y
+ * `subTaskProgressHandle` (más progreso) reciben la cédula y el handle en lugar del ID o el índice.
+ */
+class CommandInterpreter {
+public:
+    explicit CommandInterpreter(ThreadPool& pool);
+
+    long long run(FILE* input, FILE* output);
+    void execute(string_view line);
+
+    [[nodiscard]] long long getErrorCount() const;
+
+private:
+    static constexpr int MAX_FIELDS = 8;
+    static constexpr size_t OUTPUT_FLUSH_SIZE = 1 << 20;
+
+    ThreadPool& pool;
+    string out;
+    FILE* output = nullptr;
+    long long lineNumber = 0;
+    long long errorCount = 0;
+
+    string_view fields[MAX_FIELDS];
+    int fieldCount = 0;
+
+    void split(string_view line);
+    void dispatch();
+    void runQuery();
+
+    [[nodiscard]] string_view field(int index) const;
+    [[nodiscard]] string text(int index) const;
+    [[nodiscard]] int integer(int index) const;
+    [[nodiscard]] float decimal(int index) const;
+    [[nodiscard]] uint64_t handle(int index) const;
+    [[nodiscard]] tm date(int index) const;
+    [[nodiscard]] TaskType* taskType(int index) const;
+
+    void writePerson(const PersonArgMax& result);
+    void writeCounts(const KeyCounts& counts);
+    void flush();
+};
+
+#include "CommandInterpreter.cpp"
+#endif //COMMANDINTERPRETER_H
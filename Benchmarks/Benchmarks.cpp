@@ -0,0 +1,2096 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "Benchmarks.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <unistd.h>
+
+/**
+ * @brief Generador pseudoaleatorio determinista para que todas las corridas usen los mismos datos.
+ */
+struct SyntheticRandom {
+    unsigned long long state = 208620694;
+
+    unsigned next(const unsigned bound) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<unsigned>(state >> 33) % bound;
+    }
+};
+
+/**
+ * @brief Mide el tiempo de ejecución de una función en milisegundos.
+ *
+ * @param function Función a medir.
+ * @return Milisegundos transcurridos.
+ * @author fabian
+ */
+template <class Function>
+double measureMillis(Function function) {
+    const auto start = chrono::steady_clock::now();
+    function();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Crea una tarea sintética con descripción, importancia, fecha y tipo pseudoaleatorios.
+ *
+ * @param random Generador a usar.
+ * @param taskTypes Lista de tipos de tarea de la que se escoge el tipo.
+ * @return Puntero a la nueva tarea.
+ * @author fabian
+ */
+static Task* syntheticTask(SyntheticRandom& random, const TaskTypeList& taskTypes) {
+    static const char* descriptions[] = {
+        "Series", "Examenes", "Gimnasio", "Proyecto", "Barrer", "Cocinar", "Reunion", "Leer", "Correr", "Informe"
+    };
+    static const char* importances[] = {"Alto", "Medio", "Bajo"};
+
+    char date[16];
+    char time[16];
+    snprintf(date, sizeof(date), "%02u-%02u-%04u", random.next(28) + 1, random.next(12) + 1, 2023 + random.next(3));
+    snprintf(time, sizeof(time), "%02u:%02u:00", random.next(24), random.next(60));
+
+    return new Task(descriptions[random.next(10)], importances[random.next(3)], date, time,
+                    taskTypes.get(static_cast<int>(random.next(taskTypes.getLength()))));
+}
+
+/**
+ * @brief Genera un conjunto de datos sintético para pruebas de rendimiento.
+ *
+ * Inserta los cinco tipos de tarea de `cargarDatos()` y `personCount` personas, cada una con
+ * `tasksPerPerson` tareas activas y otras tantas completadas. Las tareas se generan de la última a la primera y
+ * luego se enlazan al final de la lista de activas o se comprimen en el archivo de cada persona, en orden de ID.
+ *
+ * @param people Lista de personas a llenar.
+ * @param taskTypes Lista de tipos de tarea a llenar.
+ * @param personCount Cantidad de personas.
+ * @param tasksPerPerson Cantidad de tareas activas (y completadas) por persona.
+ * @author fabian
+ */
+void generateSyntheticData(PersonList& people, TaskTypeList& taskTypes, const int personCount, const int tasksPerPerson) {
+    if (taskTypes.getLength() == 0) {
+        taskTypes.insert("Estudio", "Tareas y exámenes");
+        taskTypes.insert("Hogar", "Tareas de la casa");
+        taskTypes.insert("Trabajo", "Tareas laborales");
+        taskTypes.insert("Ejercicio", "Actividades físicas");
+        taskTypes.insert("Ocio", "Tiempo libre");
+    }
+
+    static const char* names[] = {"Fabian", "Ana", "Carlos", "Laura", "Jose", "Maria", "Luis", "Sofia"};
+    static const char* lastnames[] = {"Vargas", "Martinez", "Lopez", "Jimenez", "Gonzalez", "Rojas", "Mora"};
+
+    SyntheticRandom random;
+    vector<Task*> activeTasks;
+    vector<Task*> completedTasks;
+    for (int i = personCount - 1; i >= 0; i--) {
+        people.insert(100000000 + i, names[random.next(8)], lastnames[random.next(7)], 18 + static_cast<int>(random.next(50)));
+        Person* person = people.head;
+
+        activeTasks.clear();
+        completedTasks.clear();
+        for (int j = tasksPerPerson; j >= 1; j--) {
+            Task* active = syntheticTask(random, taskTypes);
+            active->id = j;
+            activeTasks.push_back(active);
+
+            Task* completed = syntheticTask(random, taskTypes);
+            completed->id = j;
+            completedTasks.push_back(completed);
+        }
+        Task* last = nullptr;
+        for (auto task = activeTasks.rbegin(); task != activeTasks.rend(); ++task) {
+            last = person->activeTasks.insertAfter(last, *task);
+        }
+        for (auto task = completedTasks.rbegin(); task != completedTasks.rend(); ++task) {
+            person->completedTasks.append(**task);
+            delete *task;
+        }
+    }
+}
+
+/**
+ * @brief Mide cómo escalan las consultas al aumentar la cantidad de hilos.
+ *
+ * Ejecuta las consultas del menú de consultas con 1, 2, 4, ... hasta `maxThreads` hilos y muestra el mejor
+ * tiempo de tres corridas junto con la aceleración respecto a un hilo.
+ *
+ * @param maxThreads Cantidad máxima de hilos a probar.
+ * @param personCount Cantidad de personas del conjunto sintético.
+ * @param tasksPerPerson Cantidad de tareas activas por persona del conjunto sintético.
+ * @author fabian
+ */
+void benchmarkQueryScaling(const int maxThreads, const int personCount, const int tasksPerPerson) {
+    PersonList people;
+    TaskTypeList taskTypes;
+    cout << "Generando " << personCount << " personas con " << tasksPerPerson << " tareas activas y "
+         << tasksPerPerson << " completadas cada una..." << endl;
+    generateSyntheticData(people, taskTypes, personCount, tasksPerPerson);
+
+    tm limit = {};
+    limit.tm_mday = 1;
+    limit.tm_mon = 6;
+    limit.tm_year = 2024 - 1900;
+
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    double baseline = 0;
+    cout << "Hilos\tms\tAceleracion" << endl;
+    for (const int threads : threadCounts) {
+        ThreadPool pool(threads);
+        double best = -1;
+        for (int run = 0; run < 3; run++) {
+            const double elapsed = measureMillis([&] {
+                (void) queryMostActiveTasks(people, pool);
+                (void) queryMostActiveTasksOfType(people, pool, "Estudio");
+                (void) queryActiveTaskTypes(people, pool);
+                (void) queryMostExpiredTasksOfType(people, pool, "Trabajo", limit);
+                (void) queryExpiredTaskTypes(people, pool, limit);
+                (void) queryActiveImportances(people, pool);
+                (void) queryTaskTypesByImportance(people, pool, false, "Medio");
+                (void) queryTaskTypesByImportance(people, pool, true, "Alto");
+                (void) queryTopActivePeople(people, pool, 10);
+            });
+            if (best < 0 || elapsed < best) best = elapsed;
+        }
+        if (threads == 1) baseline = best;
+        printf("%d\t%.1f\t%.2fx\n", threads, best, baseline / best);
+    }
+}
+
+/**
+ * @brief Mide la cantidad de comandos por segundo del modo por lotes.
+ *
+ * Genera un flujo de comandos que inserta personas, tareas y subtareas, modifica el progreso de las
+ * subtareas y completa tareas, y lo ejecuta con CommandInterpreter sobre las listas globales.
+ *
+ * @param pool Pool de hilos para las consultas.
+ * @param personCount Cantidad de personas a insertar.
+ * @param tasksPerPerson Cantidad de tareas a insertar por persona.
+ * @author fabian
+ */
+void benchmarkBatch(ThreadPool& pool, const int personCount, const int tasksPerPerson) {
+    static const char* typeNames[] = {"Estudio", "Hogar", "Trabajo", "Ejercicio", "Ocio"};
+    static const char* importances[] = {"Alto", "Medio", "Bajo"};
+
+    if (taskTypes.getLength() == 0) {
+        for (const char* typeName : typeNames) taskTypes.insert(typeName, "Generado");
+    }
+
+    SyntheticRandom random;
+    string commands;
+    char line[256];
+    long long commandCount = 0;
+    for (int i = 0; i < personCount; i++) {
+        const int id = 300000000 + i;
+        snprintf(line, sizeof(line), "addPerson\t%d\tPersona\tSintetica\t%d\n", id, 18 + i % 50);
+        commands += line;
+        for (int j = 0; j < tasksPerPerson; j++) {
+            snprintf(line, sizeof(line), "addTask\t%d\t%s\t%s\t%02u-%02u-2025\t%02u:00:00\tTarea %d\n", id,
+                     typeNames[j % 5], importances[random.next(3)], random.next(28) + 1, random.next(12) + 1,
+                     random.next(24), j);
+            commands += line;
+        }
+        snprintf(line, sizeof(line), "addSubTask\t%d\t0\t50\tRepaso\tCapitulo 1\n", id);
+        commands += line;
+        snprintf(line, sizeof(line), "subTaskProgress\t%d\t1\t0\t75\n", id);
+        commands += line;
+        snprintf(line, sizeof(line), "modifyActiveTask\t%d\t1\t15-03-2025\t10:00:00\n", id);
+        commands += line;
+        snprintf(line, sizeof(line), "completeTask\t%d\t2\n", id);
+        commands += line;
+        commandCount += tasksPerPerson + 5;
+    }
+    commands += "query\t6\n";
+    commandCount++;
+
+    FILE* input = tmpfile();
+    FILE* output = tmpfile();
+    if (!input || !output) throw runtime_error("No se pudieron crear archivos temporales");
+    fwrite(commands.data(), 1, commands.size(), input);
+    rewind(input);
+
+    CommandInterpreter interpreter(pool);
+    const double elapsed = measureMillis([&] { interpreter.run(input, output); });
+    fclose(input);
+    fclose(output);
+
+    printf("%lld comandos en %.1f ms: %.0f comandos/s, %lld errores\n", commandCount, elapsed,
+           commandCount / (elapsed / 1000.0), interpreter.getErrorCount());
+}
+
+/**
+ * @brief Libera todas las personas de una lista junto con sus tareas y subtareas.
+ *
+ * @param people Lista de personas a vaciar.
+ * @author fabian
+ */
+static void destroyPeople(PersonList& people) {
+    while (people.head) destroyPerson(people.remove(people.head->id));
+}
+
+/**
+ * @brief Mide el tiempo de guardar y cargar una instantánea binaria.
+ *
+ * Genera un conjunto sintético, lo guarda, libera la memoria y lo vuelve a cargar desde el archivo mapeado,
+ * comprobando que se recuperen las mismas cantidades.
+ *
+ * @param pool Pool de hilos para la carga.
+ * @param personCount Cantidad de personas del conjunto sintético.
+ * @param tasksPerPerson Cantidad de tareas activas (y completadas) por persona.
+ * @param path Ruta del archivo de la instantánea.
+ * @author fabian
+ */
+void benchmarkSnapshot(ThreadPool& pool, const int personCount, const int tasksPerPerson, const string& path) {
+    SnapshotSummary saved;
+    {
+        PersonList people;
+        TaskTypeList taskTypes;
+        cout << "Generando " << personCount << " personas con " << 2 * tasksPerPerson << " tareas cada una..." << endl;
+        generateSyntheticData(people, taskTypes, personCount, tasksPerPerson);
+
+        const double elapsed = measureMillis([&] { saved = saveSnapshot(path, people, taskTypes); });
+        printf("Guardar: %llu tareas, %.1f MB en %.1f ms (%.0f MB/s)\n", static_cast<unsigned long long>(saved.tasks),
+               saved.bytes / 1e6, elapsed, saved.bytes / 1e6 / (elapsed / 1000.0));
+        destroyPeople(people);
+    }
+
+    PersonList people;
+    TaskTypeList taskTypes;
+    SnapshotSummary loaded;
+    const double elapsed = measureMillis([&] { loaded = loadSnapshot(path, people, taskTypes, pool); });
+    printf("Cargar: %llu personas, %llu tareas en %.1f ms con %u hilos (%.1f millones de tareas/s)\n",
+           static_cast<unsigned long long>(loaded.persons), static_cast<unsigned long long>(loaded.tasks), elapsed,
+           pool.getThreadCount(), loaded.tasks / 1e6 / (elapsed / 1000.0));
+    if (loaded.persons != saved.persons || loaded.tasks != saved.tasks || loaded.subTasks != saved.subTasks) {
+        cout << "Las cantidades cargadas no coinciden con las guardadas" << endl;
+    }
+    destroyPeople(people);
+    remove(path.c_str());
+}
+
+/**
+ * @brief Aplica una mutación sintética: agrega una tarea o modifica la fecha de la primera tarea de una persona.
+ *
+ * @param random Generador a usar.
+ * @param firstPersonId Cédula de la primera persona; las demás son consecutivas.
+ * @param personCount Cantidad de personas.
+ * @author fabian
+ */
+static void syntheticMutation(SyntheticRandom& random, const int firstPersonId, const int personCount) {
+    static const char* dates[] = {"01-02-2025", "15-03-2025", "30-06-2025", "10-10-2025"};
+    const int personId = firstPersonId + static_cast<int>(random.next(personCount));
+    if (random.next(4) == 0) {
+        modifyActiveTask(personId, 0, dates[random.next(4)], "08:30:00");
+        return;
+    }
+    addTask(personId, syntheticTask(random, taskTypes));
+}
+
+/**
+ * @brief Mide el rendimiento del registro de mutaciones y el tiempo de recuperación.
+ *
+ * Sobre las listas globales, aplica mutaciones registradas de tres formas: un hilo que sincroniza después de cada
+ * mutación, varios hilos que sincronizan después de cada mutación (la confirmación en grupo las junta) y un lote
+ * que sincroniza cada 1000 mutaciones. Al final borra los datos en memoria y los recupera desde el registro.
+ *
+ * @param maxThreads Cantidad máxima de hilos escritores.
+ * @param mutationCount Cantidad de mutaciones de cada fase.
+ * @param path Ruta del archivo del registro.
+ * @author fabian
+ */
+void benchmarkMutationLog(const int maxThreads, const int mutationCount, const string& path) {
+    constexpr int personCount = 1000;
+    clearData();
+    remove(path.c_str());
+    uint64_t totalMutations = 0;
+    {
+        MutationLog log(path);
+        recoverMutations(log, 0);
+        for (const char* typeName : {"Estudio", "Hogar", "Trabajo", "Ejercicio", "Ocio"}) addTaskType(typeName, "Generado");
+        for (int i = 0; i < personCount; i++) {
+            addPerson(400000000 + i, "Persona", "Sintetica", 18 + i % 50);
+            addTask(400000000 + i, new Task("Inicial", "Medio", "01-01-2025", "08:00:00", taskTypes.head));
+        }
+        commitMutations();
+
+        SyntheticRandom random;
+        uint64_t syncs = log.getSyncCount();
+        double elapsed = measureMillis([&] {
+            for (int i = 0; i < mutationCount; i++) {
+                syntheticMutation(random, 400000000, personCount);
+                commitMutations();
+            }
+        });
+        printf("1 hilo, sincronizando cada mutacion: %.0f mutaciones/s, %.1f mutaciones por sincronizacion\n",
+               mutationCount / (elapsed / 1000.0), mutationCount / static_cast<double>(log.getSyncCount() - syncs));
+
+        mutex engineLock;
+        for (int threads = 2; threads <= maxThreads; threads *= 2) {
+            syncs = log.getSyncCount();
+            elapsed = measureMillis([&] {
+                vector<thread> writers;
+                for (int t = 0; t < threads; t++) {
+                    writers.emplace_back([&, t] {
+                        SyntheticRandom threadRandom;
+                        threadRandom.state += t;
+                        for (int i = t; i < mutationCount; i += threads) {
+                            {
+                                lock_guard guard(engineLock);
+                                syntheticMutation(threadRandom, 400000000, personCount);
+                            }
+                            commitMutations();
+                        }
+                    });
+                }
+                for (thread& writer : writers) writer.join();
+            });
+            printf("%d hilos, sincronizando cada mutacion: %.0f mutaciones/s, %.1f mutaciones por sincronizacion\n",
+                   threads, mutationCount / (elapsed / 1000.0),
+                   mutationCount / static_cast<double>(log.getSyncCount() - syncs));
+        }
+
+        elapsed = measureMillis([&] {
+            for (int i = 0; i < mutationCount; i++) {
+                syntheticMutation(random, 400000000, personCount);
+                if (i % 1000 == 999) commitMutations();
+            }
+            commitMutations();
+        });
+        printf("Lote, sincronizando cada 1000 mutaciones: %.0f mutaciones/s\n", mutationCount / (elapsed / 1000.0));
+
+        totalMutations = log.getLastLsn();
+        mutationLog = nullptr;
+    }
+
+    clearData();
+    MutationLog log(path);
+    uint64_t applied = 0;
+    const double elapsed = measureMillis([&] { applied = recoverMutations(log, 0); });
+    mutationLog = nullptr;
+    printf("Recuperacion: %llu mutaciones en %.1f ms (%.1f ms por millon)\n", static_cast<unsigned long long>(applied),
+           elapsed, elapsed / (applied / 1e6));
+    if (applied != totalMutations) cout << "La cantidad recuperada no coincide con la registrada" << endl;
+
+    clearData();
+    remove(path.c_str());
+}
+
+/**
+ * @brief Obtiene un percentil de una lista de latencias.
+ *
+ * @param latencies Latencias en microsegundos; se ordenan.
+ * @param percentile Percentil entre 0 y 100.
+ * @return La latencia del percentil, o 0 si la lista está vacía.
+ * @author fabian
+ */
+static double latencyPercentile(vector<double>& latencies, const double percentile) {
+    if (latencies.empty()) return 0;
+    sort(latencies.begin(), latencies.end());
+    const auto index = static_cast<size_t>(percentile / 100.0 * static_cast<double>(latencies.size() - 1));
+    return latencies[index];
+}
+
+/**
+ * @brief Cuenta las tareas activas y completadas de todas las personas.
+ *
+ * @param people Lista de personas.
+ * @return Cantidad total de tareas.
+ * @author fabian
+ */
+static uint64_t countTasks(const PersonList& people) {
+    uint64_t count = 0;
+    for (const Person* person = people.head; person; person = person->next) {
+        for (const Task* task = person->activeTasks.head; task; task = task->next) ++count;
+        count += static_cast<uint64_t>(person->completedTasks.getLength());
+    }
+    return count;
+}
+
+/**
+ * @brief Mide las pausas y el efecto en la latencia de una compactación en segundo plano.
+ *
+ * Sobre un conjunto sintético en las listas globales, aplica mutaciones registradas (sincronizando cada 100) e
+ * inicia una compactación poco después de empezar. Compara la latencia de las mutaciones durante la compactación
+ * con la del resto, muestra la pausa de inicio y la del recorte del registro, y al final comprueba que la
+ * instantánea más el registro recortado reconstruyan los mismos datos.
+ *
+ * @param pool Pool de hilos para cargar la instantánea.
+ * @param personCount Cantidad de personas del conjunto sintético.
+ * @param tasksPerPerson Cantidad de tareas activas (y completadas) por persona.
+ * @param megabytesPerSecond Límite de escritura de la compactación, o 0 para no limitar.
+ * @param path Ruta de la instantánea; el registro usa `path.wal`.
+ * @author fabian
+ */
+void benchmarkCompaction(ThreadPool& pool, const int personCount, const int tasksPerPerson,
+                         const uint64_t megabytesPerSecond, const string& path) {
+    clearData();
+    remove(path.c_str());
+    remove((path + ".wal").c_str());
+    cout << "Generando " << personCount << " personas con " << 2 * tasksPerPerson << " tareas cada una..." << endl;
+    generateSyntheticData(people, taskTypes, personCount, tasksPerPerson);
+
+    uint64_t expectedTasks;
+    uint64_t logBytesBefore = 0;
+    CompactionStats stats;
+    {
+        MutationLog log(path + ".wal");
+        recoverMutations(log, 0);
+        Compactor logCompactor(path, log, 0, megabytesPerSecond << 20);
+
+        vector<double> idle;
+        vector<double> during;
+        SyntheticRandom random;
+        bool started = false;
+        for (int i = 0; !started || logCompactor.isRunning() || i < 20000; i++) {
+            if (i == 2000) {
+                logBytesBefore = log.getSize();
+                started = logCompactor.start();
+            }
+            const bool compacting = logCompactor.isRunning();
+            const double elapsed = measureMillis([&] {
+                syntheticMutation(random, 100000000, personCount);
+                if (i % 100 == 99) commitMutations();
+            });
+            (compacting ? during : idle).push_back(elapsed * 1000);
+        }
+        commitMutations();
+        logCompactor.wait();
+        stats = logCompactor.getStats();
+        expectedTasks = countTasks(people);
+
+        printf("Compactacion: %.1f ms en total, pausa al iniciar %.2f ms, pausa al recortar el registro %.2f ms\n",
+               stats.lastDurationMillis, stats.lastPauseMillis, stats.lastTruncatePauseMillis);
+        printf("Registro: %.2f MB antes, %.2f MB descartados\n", logBytesBefore / 1e6, stats.lastBytesDiscarded / 1e6);
+        printf("Latencia sin compactar (us): p50 %.1f, p99 %.1f, max %.1f (%zu mutaciones)\n",
+               latencyPercentile(idle, 50), latencyPercentile(idle, 99), latencyPercentile(idle, 100), idle.size());
+        printf("Latencia compactando (us):   p50 %.1f, p99 %.1f, max %.1f (%zu mutaciones)\n",
+               latencyPercentile(during, 50), latencyPercentile(during, 99), latencyPercentile(during, 100), during.size());
+        mutationLog = nullptr;
+    }
+
+    clearData();
+    MutationLog log(path + ".wal");
+    const SnapshotSummary summary = loadSnapshot(path, people, taskTypes, pool);
+    const uint64_t replayed = recoverMutations(log, summary.lastLsn);
+    mutationLog = nullptr;
+    printf("Recuperacion: instantanea hasta el LSN %llu y %llu mutaciones del registro\n",
+           static_cast<unsigned long long>(summary.lastLsn), static_cast<unsigned long long>(replayed));
+    if (countTasks(people) != expectedTasks) cout << "Los datos recuperados no coinciden con los de memoria" << endl;
+
+    clearData();
+    remove(path.c_str());
+    remove((path + ".wal").c_str());
+}
+
+/**
+ * @brief Mide el importador masivo con archivos CSV y JSON por líneas generados al momento.
+ *
+ * Genera `taskCount` tareas repartidas entre `personCount` personas en ambos formatos y las importa con uno y con
+ * `maxThreads` hilos de interpretación, mostrando las tareas por segundo de cada corrida. Antes de cada corrida se
+ * vuelven a crear las personas, sin tareas.
+ *
+ * @param maxThreads Cantidad de hilos de la corrida paralela.
+ * @param personCount Cantidad de personas.
+ * @param taskCount Cantidad de tareas a importar.
+ * @author fabian
+ */
+void benchmarkImport(const unsigned maxThreads, const int personCount, const int taskCount) {
+    static const char* typeNames[] = {"Estudio", "Hogar", "Trabajo", "Ejercicio", "Ocio"};
+    static const char* importances[] = {"Alto", "Medio", "Bajo"};
+
+    SyntheticRandom random;
+    string csv = "cedula,tipo,importancia,fecha,hora,completada,descripcion\n";
+    string jsonLines;
+    char line[256];
+    for (int i = 0; i < taskCount; i++) {
+        const unsigned personId = 100000000 + random.next(personCount);
+        const char* type = typeNames[random.next(5)];
+        const char* importance = importances[random.next(3)];
+        const unsigned day = random.next(28) + 1;
+        const unsigned month = random.next(12) + 1;
+        const unsigned year = 2023 + random.next(3);
+        const unsigned hour = random.next(24);
+        const unsigned completed = random.next(4) == 0;
+
+        snprintf(line, sizeof(line), "%u,%s,%s,%02u-%02u-%04u,%02u:00:00,%u,\"Tarea %d, importada\"\n", personId, type,
+                 importance, day, month, year, hour, completed, i);
+        csv += line;
+        snprintf(line, sizeof(line),
+                 "{\"cedula\":%u,\"tipo\":\"%s\",\"importancia\":\"%s\",\"fecha\":\"%02u-%02u-%04u\","
+                 "\"hora\":\"%02u:00:00\",\"completada\":%s,\"descripcion\":\"Tarea %d\"}\n",
+                 personId, type, importance, day, month, year, hour, completed ? "true" : "false", i);
+        jsonLines += line;
+    }
+
+    ThreadPool pool(maxThreads);
+    for (const auto& [name, format, content] : {tuple{"CSV", ImportFormat::Csv, &csv},
+                                                tuple{"JSON por lineas", ImportFormat::JsonLines, &jsonLines}}) {
+        FILE* input = tmpfile();
+        if (!input) throw runtime_error("No se pudieron crear archivos temporales");
+        fwrite(content->data(), 1, content->size(), input);
+
+        for (const unsigned threads : {1u, maxThreads}) {
+            destroyPeople(people);
+            generateSyntheticData(people, taskTypes, personCount, 0);
+            rewind(input);
+
+            TaskImporter importer(pool, threads);
+            ImportSummary summary;
+            const double elapsed = measureMillis([&] { summary = importer.run(input, format); });
+            printf("%s, %u hilo(s): %lld tareas en %.1f ms (%.1f MB), %.0f tareas/s, %lld errores\n", name, threads,
+                   summary.imported, elapsed, content->size() / 1048576.0, summary.imported / (elapsed / 1000.0),
+                   summary.errors);
+            if (threads == maxThreads) break;
+        }
+        fclose(input);
+    }
+    destroyPeople(people);
+}
+
+/**
+ * @brief Compara la carga de tareas una por una con `addTask` contra la carga por lotes con `addTaskBatch`.
+ *
+ * Crea `taskCount` tareas sintéticas repartidas al azar entre `personCount` personas (una de cada cuatro
+ * completada) y las carga de ambas formas sobre personas recién creadas, mostrando las tareas por segundo de cada
+ * una. La creación de las tareas no se incluye en el tiempo medido.
+ *
+ * @param personCount Cantidad de personas.
+ * @param taskCount Cantidad de tareas a cargar.
+ * @author fabian
+ */
+void benchmarkBulkLoad(const int personCount, const int taskCount) {
+    for (const bool batch : {false, true}) {
+        destroyPeople(people);
+        generateSyntheticData(people, taskTypes, personCount, 0);
+
+        SyntheticRandom random;
+        vector<TaskRecord> records;
+        records.reserve(taskCount);
+        for (int i = 0; i < taskCount; i++) {
+            const int personId = 100000000 + static_cast<int>(random.next(personCount));
+            const bool completed = random.next(4) == 0;
+            records.push_back({personId, completed, syntheticTask(random, taskTypes)});
+        }
+
+        const double elapsed = measureMillis([&] {
+            if (batch) {
+                if (!addTaskBatch(records).empty()) throw runtime_error("Persona no encontrada");
+            } else {
+                for (const TaskRecord& record : records) addTask(record.personId, record.task, record.completed);
+            }
+        });
+        printf("%s: %d tareas en %.1f ms, %.0f tareas/s (%llu en memoria)\n", batch ? "addTaskBatch" : "addTask",
+               taskCount, elapsed, taskCount / (elapsed / 1000.0), static_cast<unsigned long long>(countTasks(people)));
+    }
+    destroyPeople(people);
+}
+
+/**
+ * @brief Compara completar y mover tareas una por una contra las operaciones masivas.
+ *
+ * Sobre un conjunto sintético, completa las tareas activas de cada persona que vencen antes del 01-07-2024 y
+ * mueve 7 días las de tipo Trabajo que quedan: primero con `completeTask` y `modifyActiveTask` por cada tarea, y
+ * luego con `completeTasksBefore` y `shiftTasks` por persona. Muestra el tiempo de cada forma y comprueba que
+ * cambien las mismas tareas.
+ *
+ * @param personCount Cantidad de personas del conjunto sintético.
+ * @param tasksPerPerson Cantidad de tareas activas (y completadas) por persona.
+ * @author fabian
+ */
+void benchmarkBulkUpdates(const int personCount, const int tasksPerPerson) {
+    const string limit = "01-07-2024";
+    tm limitDate = {};
+    parseDate(limit, limitDate);
+    const long limitDay = dayNumber(limitDate);
+
+    uint64_t counts[2][2] = {};
+    for (const bool bulk : {false, true}) {
+        destroyPeople(people);
+        generateSyntheticData(people, taskTypes, personCount, tasksPerPerson);
+        TaskType* work = taskTypes.head;
+        while (work->name != "Trabajo") work = work->next;
+
+        uint64_t& completed = counts[bulk][0];
+        uint64_t& moved = counts[bulk][1];
+        vector<int> taskIds;
+        vector<pair<int, tm>> dates;
+        const double elapsed = measureMillis([&] {
+            for (const Person* person = people.head; person; person = person->next) {
+                const int personId = person->id;
+                if (bulk) {
+                    completed += completeTasksBefore(personId, limit);
+                    moved += shiftTasks(personId, work, 7);
+                    continue;
+                }
+
+                taskIds.clear();
+                for (const Task* task = person->activeTasks.head; task; task = task->next) {
+                    if (dayNumber(task->date) < limitDay) taskIds.push_back(task->id);
+                }
+                for (const int taskId : taskIds) completeTask(personId, taskId);
+                completed += taskIds.size();
+
+                dates.clear();
+                int index = 0;
+                for (const Task* task = person->activeTasks.head; task; task = task->next, index++) {
+                    if (task->type != work) continue;
+                    tm date = task->date;
+                    addDays(date, 7);
+                    dates.emplace_back(index, date);
+                }
+                for (const auto& [taskIndex, date] : dates) {
+                    const Task* task = person->activeTasks.get(taskIndex);
+                    modifyActiveTask(personId, taskIndex, string(formatDate(date).view()),
+                                     string(formatTime(task->time).view()));
+                }
+                moved += dates.size();
+            }
+        });
+        printf("%s: %llu tareas completadas y %llu movidas en %.1f ms\n",
+               bulk ? "completeTasksBefore y shiftTasks" : "completeTask y modifyActiveTask",
+               static_cast<unsigned long long>(completed), static_cast<unsigned long long>(moved), elapsed);
+    }
+    if (counts[0][0] != counts[1][0] || counts[0][1] != counts[1][1]) {
+        cout << "Las operaciones masivas no cambiaron las mismas tareas" << endl;
+    }
+    destroyPeople(people);
+}
+
+/**
+ * @brief Compara completar y borrar tareas por id contra hacerlo por handle.
+ *
+ * Sobre un conjunto sintético, completa una de cada tres tareas activas de cada persona y borra otra de cada tres,
+ * recorriendo cada persona desde su última tarea: primero con `completeTask` y `deleteTask`, que buscan la tarea
+ * por id, y luego con `completeTaskByHandle` y `deleteTaskByHandle`, con handles obtenidos antes de medir. Muestra
+ * el tiempo de cada forma y comprueba que queden las mismas tareas.
+ *
+ * @param personCount Cantidad de personas del conjunto sintético.
+ * @param tasksPerPerson Cantidad de tareas activas (y completadas) por persona.
+ * @author fabian
+ */
+void benchmarkHandles(const int personCount, const int tasksPerPerson) {
+    uint64_t remaining[2] = {};
+    for (const bool byHandle : {false, true}) {
+        destroyPeople(people);
+        generateSyntheticData(people, taskTypes, personCount, tasksPerPerson);
+
+        vector<pair<int, int>> ids;
+        vector<pair<int, uint64_t>> handles;
+        for (const Person* person = people.head; person; person = person->next) {
+            int index = 0;
+            for (const Task* task = person->activeTasks.head; task; task = task->next, index++) {
+                if (index % 3 == 2) continue;
+                if (byHandle) handles.emplace_back(person->id, getTaskHandle(person->id, task->id));
+                else ids.emplace_back(person->id, task->id);
+            }
+        }
+
+        uint64_t changed = 0;
+        const double elapsed = measureMillis([&] {
+            if (byHandle) {
+                for (size_t i = handles.size(); i-- > 0; changed++) {
+                    const auto& [personId, handle] = handles[i];
+                    if (i % 2) deleteTaskByHandle(personId, handle);
+                    else completeTaskByHandle(personId, handle);
+                }
+                return;
+            }
+            for (size_t i = ids.size(); i-- > 0; changed++) {
+                const auto& [personId, taskId] = ids[i];
+                if (i % 2) deleteTask(personId, taskId);
+                else completeTask(personId, taskId);
+            }
+        });
+        remaining[byHandle] = countTasks(people);
+        printf("%s: %llu tareas completadas o borradas en %.1f ms (%llu en memoria)\n",
+               byHandle ? "completeTaskByHandle y deleteTaskByHandle" : "completeTask y deleteTask",
+               static_cast<unsigned long long>(changed), elapsed, static_cast<unsigned long long>(remaining[byHandle]));
+    }
+    if (remaining[0] != remaining[1]) cout << "Los handles no cambiaron las mismas tareas" << endl;
+    destroyPeople(people);
+}
+
+/**
+ * @brief Compara la conversión de fechas y horas con flujos contra las rutinas de DateTime.
+ *
+ * Interpreta y vuelve a formatear `count` fechas y horas, primero con `istringstream`/`get_time` y
+ * `ostringstream`/`put_time`, como se hacía antes en Task, y luego con `parseDate`/`parseTime` y
+ * `formatDate`/`formatTime`. Muestra los nanosegundos por operación de cada camino.
+ *
+ * @param count Cantidad de fechas y horas a convertir.
+ * @author fabian
+ */
+void benchmarkDateTime(const int count) {
+    SyntheticRandom random;
+    vector<string> dates(count);
+    vector<string> times(count);
+    char text[32];
+    for (int i = 0; i < count; i++) {
+        snprintf(text, sizeof(text), "%02u-%02u-%04u", random.next(28) + 1, random.next(12) + 1, 2000 + random.next(50));
+        dates[i] = text;
+        snprintf(text, sizeof(text), "%02u:%02u:%02u", random.next(24), random.next(60), random.next(60));
+        times[i] = text;
+    }
+
+    vector<tm> parsed(count);
+    long long checksum = 0;
+
+    const double streamParse = measureMillis([&] {
+        for (int i = 0; i < count; i++) {
+            tm& value = parsed[i];
+            istringstream dateStream(dates[i]);
+            dateStream >> get_time(&value, "%d-%m-%Y");
+            istringstream timeStream(times[i]);
+            timeStream >> get_time(&value, "%H:%M:%S");
+            checksum += value.tm_mday + value.tm_sec;
+        }
+    });
+    const double streamFormat = measureMillis([&] {
+        for (int i = 0; i < count; i++) {
+            ostringstream out;
+            out << put_time(&parsed[i], "%d-%m-%Y") << put_time(&parsed[i], "%H:%M:%S");
+            checksum += static_cast<long long>(out.str().size());
+        }
+    });
+
+    const double fastParse = measureMillis([&] {
+        for (int i = 0; i < count; i++) {
+            tm& value = parsed[i];
+            if (!parseDate(dates[i], value) || !parseTime(times[i], value)) throw runtime_error("Fecha invalida");
+            checksum += value.tm_mday + value.tm_sec;
+        }
+    });
+    const double fastFormat = measureMillis([&] {
+        char buffer[DATE_TEXT_LENGTH + TIME_TEXT_LENGTH + 2];
+        for (int i = 0; i < count; i++) {
+            const size_t length = formatDate(parsed[i], buffer);
+            checksum += static_cast<long long>(length + formatTime(parsed[i], buffer + length));
+        }
+    });
+
+    const auto nanos = [count](const double millis) { return millis * 1e6 / count; };
+    printf("%-10s %14s %14s\n", "", "flujos (ns)", "DateTime (ns)");
+    printf("%-10s %14.1f %14.1f  (x%.1f)\n", "lectura", nanos(streamParse), nanos(fastParse), streamParse / fastParse);
+    printf("%-10s %14.1f %14.1f  (x%.1f)\n", "escritura", nanos(streamFormat), nanos(fastFormat),
+           streamFormat / fastFormat);
+    printf("(suma de control %lld)\n", checksum);
+}
+
+/**
+ * @brief Copia un archivo con FileWriter y muestra la velocidad, como referencia del ancho de banda del disco.
+ *
+ * @param source Archivo a copiar.
+ * @param destination Copia; se elimina al terminar.
+ * @author fabian
+ */
+static void benchmarkCopy(const string& source, const string& destination) {
+    const MappedFile input(source);
+    const double elapsed = measureMillis([&] {
+        FileWriter file(destination, 64 << 10);
+        for (size_t written = 0; written < input.size(); written += 8 << 20) {
+            file.write(input.data() + written, min<size_t>(8 << 20, input.size() - written));
+        }
+        file.commit();
+    });
+    printf("%-6s %-12s %.1f MB en %.1f ms: %.0f MB/s\n", "disco", "copia", input.size() / 1048576.0, elapsed,
+           input.size() / 1048576.0 / (elapsed / 1000.0));
+    remove(destination.c_str());
+}
+
+/**
+ * @brief Mide la exportación del historial de tareas completadas contra el ancho de banda del disco.
+ *
+ * Genera el conjunto sintético y exporta todas las tareas completadas en CSV, JSON por líneas y formato columnar,
+ * con y sin hilo de escritura. Como referencia del ancho de banda del disco, copia el CSV ya exportado sin
+ * formatear nada. Todas las corridas incluyen la sincronización final con el disco.
+ *
+ * @param pool Pool de hilos.
+ * @param personCount Cantidad de personas.
+ * @param tasksPerPerson Tareas completadas por persona.
+ * @param path Prefijo de los archivos a crear; se eliminan al terminar.
+ * @author fabian
+ */
+void benchmarkExport(ThreadPool& pool, const int personCount, const int tasksPerPerson, const string& path) {
+    generateSyntheticData(people, taskTypes, personCount, tasksPerPerson);
+    printf("%lld tareas completadas\n", static_cast<long long>(personCount) * tasksPerPerson);
+
+    for (const char* extension : {".csv", ".jsonl", ".tcol"}) {
+        for (const bool background : {false, true}) {
+            ExportSummary summary;
+            const double elapsed = measureMillis([&] {
+                summary = exportReport("completadas", {}, path + extension, pool, background);
+            });
+            printf("%-6s %-12s %lld filas, %.1f MB en %.1f ms: %.0f MB/s, %.0f filas/s\n", extension + 1,
+                   background ? "con hilo" : "sin hilo", summary.rows, summary.bytes / 1048576.0, elapsed,
+                   summary.bytes / 1048576.0 / (elapsed / 1000.0), summary.rows / (elapsed / 1000.0));
+        }
+        if (extension[1] == 'c') benchmarkCopy(path + extension, path + ".copia");
+        remove((path + extension).c_str());
+    }
+    destroyPeople(people);
+}
+
+/**
+ * @brief Muestra cuánta memoria ahorra el pool de cadenas con el conjunto sintético.
+ *
+ * Genera el conjunto de datos, muestra los valores distintos y las referencias del pool con la memoria estimada
+ * con y sin él, y mide la consulta de la persona con más tareas activas de un tipo, que compara nombres de tipo
+ * por su entrada en el pool.
+ *
+ * @param pool Pool de hilos para la consulta.
+ * @param personCount Cantidad de personas.
+ * @param tasksPerPerson Cantidad de tareas activas (y completadas) por persona.
+ * @author fabian
+ */
+void benchmarkStringPool(ThreadPool& pool, const int personCount, const int tasksPerPerson) {
+    PersonList people;
+    TaskTypeList taskTypes;
+    const double generation = measureMillis([&] { generateSyntheticData(people, taskTypes, personCount, tasksPerPerson); });
+
+    const StringPoolStats stats = stringPool.getStats();
+    const auto megabytes = [](const size_t bytes) { return static_cast<double>(bytes) / (1 << 20); };
+    printf("generacion: %.0f ms\n", generation);
+    printf("valores distintos: %zu, referencias: %zu\n", stats.distinct, stats.references);
+    printf("memoria de las cadenas: %.1f MB con el pool, %.1f MB sin el pool (ahorro de %.1f MB, %.0f%%)\n",
+           megabytes(stats.pooledBytes), megabytes(stats.plainBytes), megabytes(stats.plainBytes - stats.pooledBytes),
+           100.0 * static_cast<double>(stats.plainBytes - stats.pooledBytes) / static_cast<double>(stats.plainBytes));
+
+    double best = 1e300;
+    int count = 0;
+    for (int run = 0; run < 3; run++) {
+        best = min(best, measureMillis([&] { count = queryMostActiveTasksOfType(people, pool, "Estudio").count; }));
+    }
+    printf("consulta por tipo: %.1f ms (%d tareas)\n", best, count);
+}
+
+/**
+ * @brief Obtiene la memoria residente del proceso.
+ *
+ * @return Bytes residentes según `/proc/self/statm`, o 0 si no se pueden leer.
+ * @author fabian
+ */
+static uint64_t residentBytes() {
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (!statm) return 0;
+    unsigned long long size = 0;
+    unsigned long long resident = 0;
+    const int read = fscanf(statm, "%llu %llu", &size, &resident);
+    fclose(statm);
+    return read == 2 ? resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) : 0;
+}
+
+/**
+ * @brief Compara la memoria y el recorrido de las tareas completadas en el archivo comprimido y en listas enlazadas.
+ *
+ * Crea `personCount` personas y comprime `tasksPerPerson` tareas completadas sintéticas en el archivo de cada una.
+ * Luego descomprime cada archivo en una lista enlazada como las que se usaban antes. Muestra la memoria residente
+ * que agregó cada representación y el tiempo de contar las tareas de importancia Alto recorriendo cada una; en el
+ * archivo se mide el recorrido completo y el que salta bloques con el resumen de importancias.
+ *
+ * @param personCount Cantidad de personas.
+ * @param tasksPerPerson Cantidad de tareas completadas por persona.
+ * @author fabian
+ */
+void benchmarkArchive(const int personCount, const int tasksPerPerson) {
+    PersonList people;
+    TaskTypeList taskTypes;
+    generateSyntheticData(people, taskTypes, personCount, 0);
+
+    SyntheticRandom random;
+    const uint64_t before = residentBytes();
+    const double compression = measureMillis([&] {
+        for (Person* person = people.head; person; person = person->next) {
+            for (int i = 1; i <= tasksPerPerson; i++) {
+                Task* task = syntheticTask(random, taskTypes);
+                task->id = i;
+                person->completedTasks.append(*task);
+                delete task;
+            }
+        }
+    });
+    const uint64_t archived = residentBytes();
+
+    size_t archiveBytes = 0;
+    vector<TaskList> lists(personCount);
+    size_t index = 0;
+    for (const Person* person = people.head; person; person = person->next) {
+        archiveBytes += person->completedTasks.getMemoryUsage();
+        Task* last = nullptr;
+        TaskList& list = lists[index++];
+        person->completedTasks.forEach([&](const Task& task) {
+            last = list.insertAfter(last, new Task(task.id, task.description, task.importance, task.date, task.time,
+                                                   task.type));
+        }, false);
+    }
+    const uint64_t listed = residentBytes();
+
+    const long long taskCount = static_cast<long long>(personCount) * tasksPerPerson;
+    const auto megabytes = [](const uint64_t bytes) { return static_cast<double>(bytes) / (1 << 20); };
+    printf("%lld tareas completadas, comprimidas en %.0f ms\n", taskCount, compression);
+    printf("archivo: %.1f MB residentes (%.1f MB en bloques, %.1f bytes por tarea)\n", megabytes(archived - before),
+           megabytes(archiveBytes), static_cast<double>(archiveBytes) / static_cast<double>(taskCount));
+    printf("listas:  %.1f MB residentes (x%.1f)\n", megabytes(listed - archived),
+           static_cast<double>(listed - archived) / static_cast<double>(max<uint64_t>(archived - before, 1)));
+
+    long long listCount = 0;
+    long long fullCount = 0;
+    long long filteredCount = 0;
+    BlockScan scan;
+    TaskArchiveFilter filter;
+    filter.importance = InternedString::find("Alto");
+    const double listScan = measureMillis([&] {
+        for (const TaskList& list : lists) {
+            for (const Task* task = list.head; task; task = task->next) listCount += task->importance == "Alto";
+        }
+    });
+    const double fullScan = measureMillis([&] {
+        for (const Person* person = people.head; person; person = person->next) {
+            person->completedTasks.forEach([&](const Task& task) { fullCount += task.importance == "Alto"; }, false);
+        }
+    });
+    const double filteredScan = measureMillis([&] {
+        for (const Person* person = people.head; person; person = person->next) {
+            scan.merge(person->completedTasks.forEachMatching(filter, [&](const Task&) { filteredCount++; }));
+        }
+    });
+    printf("recorrido de listas: %.0f ms (%lld tareas Alto)\n", listScan, listCount);
+    printf("recorrido del archivo: %.0f ms completo (%lld), %.0f ms con resumen (%lld; %llu bloques revisados, "
+           "%llu saltados)\n", fullScan, fullCount, filteredScan, filteredCount,
+           static_cast<unsigned long long>(scan.blocksScanned), static_cast<unsigned long long>(scan.blocksSkipped));
+
+    for (TaskList& list : lists) {
+        while (Task* task = list.head) {
+            list.head = task->next;
+            delete task;
+        }
+    }
+    destroyPeople(people);
+}
+
+/**
+ * @brief Mide las consultas por rango de fechas que saltan bloques de tareas activas con su resumen.
+ *
+ * Crea `personCount` personas con `tasksPerPerson` tareas activas cada una, agregadas en orden cronológico a lo
+ * largo de tres años, como quedan al registrar las tareas a medida que aparecen. Ejecuta las consultas 4 y 5 y el
+ * reporte de la semana, y compara cada una con el mismo recorrido tarea por tarea de toda la lista.
+ *
+ * @param pool Pool de hilos para las consultas.
+ * @param personCount Cantidad de personas.
+ * @param tasksPerPerson Cantidad de tareas activas por persona.
+ * @author fabian
+ */
+void benchmarkBlockSkipping(ThreadPool& pool, const int personCount, const int tasksPerPerson) {
+    static const char* importances[] = {"Alto", "Medio", "Bajo"};
+
+    PersonList people;
+    TaskTypeList taskTypes;
+    generateSyntheticData(people, taskTypes, personCount, 0);
+
+    SyntheticRandom random;
+    const double step = 1095.0 / max(tasksPerPerson, 1);
+    for (Person* person = people.head; person; person = person->next) {
+        tm date = {};
+        date.tm_year = 123;
+        date.tm_mday = 1;
+        tm time = {};
+        int day = 0;
+        Task* last = nullptr;
+        for (int i = 1; i <= tasksPerPerson; i++) {
+            for (const int target = static_cast<int>(i * step); day < target; day++) {
+                if (++date.tm_mday > daysInMonth(date.tm_mon + 1, date.tm_year + 1900)) {
+                    date.tm_mday = 1;
+                    if (++date.tm_mon == 12) {
+                        date.tm_mon = 0;
+                        date.tm_year++;
+                    }
+                }
+            }
+            time.tm_hour = static_cast<int>(random.next(24));
+            last = person->activeTasks.insertAfter(last, new Task(i, "Tarea", importances[random.next(3)], date, time,
+                taskTypes.get(static_cast<int>(random.next(taskTypes.getLength())))));
+        }
+    }
+
+    tm limit = {};
+    limit.tm_year = 123;
+    limit.tm_mon = 3;
+    limit.tm_mday = 1;
+    tm from = {};
+    from.tm_year = 124;
+    from.tm_mon = 5;
+    from.tm_mday = 10;
+    const long limitDay = dayNumber(limit);
+    const long fromDay = dayNumber(from);
+    const optional<InternedString> work = InternedString::find("Trabajo");
+
+    const auto fullScan = [&people](auto predicate) {
+        long long count = 0;
+        for (const Person* person = people.head; person; person = person->next) {
+            for (const Task* task = person->activeTasks.head; task; task = task->next) count += predicate(*task);
+        }
+        return count;
+    };
+    const auto report = [](const char* name, const double full, const long long fullCount, const double skipping,
+                           const long long skippingCount, const BlockScan& scan) {
+        printf("%s: %.1f ms sin bloques (%lld), %.1f ms con bloques (%lld; %llu bloques revisados, %llu saltados)\n",
+               name, full, fullCount, skipping, skippingCount, static_cast<unsigned long long>(scan.blocksScanned),
+               static_cast<unsigned long long>(scan.blocksSkipped));
+    };
+
+    long long fullCount = 0;
+    long long skippingCount = 0;
+    BlockScan scan;
+    double full = measureMillis([&] {
+        fullCount = 0;
+        for (const Person* person = people.head; person; person = person->next) {
+            long long count = 0;
+            for (const Task* task = person->activeTasks.head; task; task = task->next) {
+                count += task->type->name == *work && dayNumber(task->date) < limitDay;
+            }
+            fullCount = max(fullCount, count);
+        }
+    });
+    double skipping = measureMillis([&] {
+        skippingCount = queryMostExpiredTasksOfType(people, pool, "Trabajo", limit, &scan).count;
+    });
+    report("consulta 4 (Trabajo antes del 01-04-2023)", full, fullCount, skipping, skippingCount, scan);
+
+    full = measureMillis([&] { fullCount = fullScan([&](const Task& task) { return dayNumber(task.date) < limitDay; }); });
+    skipping = measureMillis([&] {
+        skippingCount = 0;
+        for (const auto& [type, count] : queryExpiredTaskTypes(people, pool, limit, &scan).entries) skippingCount += count;
+    });
+    report("consulta 5 (antes del 01-04-2023)", full, fullCount, skipping, skippingCount, scan);
+
+    full = measureMillis([&] {
+        fullCount = fullScan([&](const Task& task) {
+            const long days = dayNumber(task.date) - fromDay;
+            return days >= 0 && days < 8;
+        });
+    });
+    skipping = measureMillis([&] {
+        skippingCount = static_cast<long long>(reportTasksDueWithinWeek(people, pool, from, &scan).size());
+    });
+    report("reporte 5 (semana del 10-06-2024)", full, fullCount, skipping, skippingCount, scan);
+
+    destroyPeople(people);
+}
+
+/**
+ * @brief Mide el árbol B+ en disco con búsquedas puntuales y recorridos de rango, en frío y en caliente.
+ *
+ * Inserta `taskCount` registros de tareas repartidos entre `personCount` personas, en orden de persona como al
+ * cargar una instantánea, con una tarea cada seis horas. Luego mide búsquedas puntuales de claves al azar, el
+ * historial completo de personas al azar y un mes de historial, primero en frío (pool vacío y caché del sistema
+ * descartada) y luego en caliente, repitiendo las mismas claves con las páginas ya en el pool.
+ *
+ * @param taskCount Cantidad de registros.
+ * @param personCount Cantidad de personas.
+ * @param cacheMegabytes Memoria del pool de páginas, en MB.
+ * @param path Ruta del archivo de páginas; se elimina al terminar.
+ * @author fabian
+ */
+void benchmarkTaskTree(const uint64_t taskCount, const int personCount, const uint64_t cacheMegabytes,
+                       const string& path) {
+    static constexpr int64_t TASK_INTERVAL = 6 * 3600;
+    static constexpr int LOOKUPS = 20000;
+    static constexpr int SCANS = 2000;
+
+    TaskTree tree(path, cacheMegabytes << 20);
+    const uint64_t tasksPerPerson = max<uint64_t>(taskCount / max(personCount, 1), 1);
+    tm firstDate = {};
+    firstDate.tm_year = 123;
+    firstDate.tm_mday = 1;
+    const int64_t firstKey = TaskArchive::dueKey(firstDate, tm{});
+
+    SyntheticRandom random;
+    string value(24, ' ');
+    const double insertion = measureMillis([&] {
+        for (int person = 0; person < personCount; person++) {
+            for (uint64_t i = 0; i < tasksPerPerson; i++) {
+                value[0] = static_cast<char>('a' + random.next(26));
+                tree.insert(TaskTreeKey{100000000 + person, firstKey + static_cast<int64_t>(i) * TASK_INTERVAL,
+                                        static_cast<int32_t>(i + 1)}, value);
+            }
+        }
+    });
+    TaskTreeStats stats = tree.getStats();
+    const uint64_t inserted = tasksPerPerson * personCount;
+    printf("insercion: %llu registros en %.0f ms (%.2f millones/s)\n", static_cast<unsigned long long>(inserted),
+           insertion, static_cast<double>(inserted) / insertion / 1000);
+    printf("arbol: altura %u, %llu hojas, %llu nodos internos, %.1f MB en disco (%.1f bytes por registro), "
+           "pool de %.0f MB\n", stats.height, static_cast<unsigned long long>(stats.leafPages),
+           static_cast<unsigned long long>(stats.innerPages),
+           static_cast<double>(stats.pool.pageCount * BufferPool::PAGE_SIZE) / (1 << 20),
+           static_cast<double>(stats.pool.pageCount * BufferPool::PAGE_SIZE) / static_cast<double>(inserted),
+           static_cast<double>(cacheMegabytes));
+
+    vector<TaskTreeKey> lookups(LOOKUPS);
+    for (TaskTreeKey& key : lookups) {
+        const auto task = static_cast<int64_t>(random.next(static_cast<unsigned>(tasksPerPerson)));
+        key = TaskTreeKey{100000000 + static_cast<int>(random.next(personCount)), firstKey + task * TASK_INTERVAL,
+                          static_cast<int32_t>(task + 1)};
+    }
+    vector<int> scanned(SCANS);
+    for (int& person : scanned) person = 100000000 + static_cast<int>(random.next(personCount));
+
+    const auto report = [&tree](const char* name, const int operations, uint64_t& rows, const auto& run) {
+        const BufferPoolStats before = tree.getStats().pool;
+        rows = 0;
+        const double millis = measureMillis(run);
+        const BufferPoolStats after = tree.getStats().pool;
+        printf("%s: %.1f us por operacion, %.1f paginas leidas por operacion (%llu filas)\n", name,
+               millis * 1000 / operations, static_cast<double>(after.pagesRead - before.pagesRead) / operations,
+               static_cast<unsigned long long>(rows));
+    };
+    const auto pointLookups = [&](uint64_t& rows) {
+        report(rows == 0 ? "busqueda puntual en frio" : "busqueda puntual en caliente", LOOKUPS, rows, [&] {
+            string found;
+            for (const TaskTreeKey& key : lookups) rows += tree.find(key, found);
+        });
+    };
+    const auto historyScans = [&](const char* name, const int64_t days, uint64_t& rows) {
+        report(name, SCANS, rows, [&] {
+            for (const int person : scanned) {
+                const int64_t middle = firstKey + static_cast<int64_t>(tasksPerPerson) * TASK_INTERVAL / 2;
+                const int64_t from = days ? middle - days * 86400 / 2 : INT64_MIN;
+                const int64_t to = days ? from + days * 86400 : INT64_MAX;
+                tree.scan(TaskTreeKey{person, from, INT32_MIN}, TaskTreeKey{person, to, INT32_MAX},
+                          [&rows](const TaskTreeKey&, string_view) { rows++; });
+            }
+        });
+    };
+
+    uint64_t rows = 0;
+    tree.dropCache();
+    pointLookups(rows);
+    pointLookups(rows);
+    tree.dropCache();
+    historyScans("historial completo en frio", 0, rows);
+    historyScans("historial completo en caliente", 0, rows);
+    tree.dropCache();
+    historyScans("un mes de historial en frio", 31, rows);
+    historyScans("un mes de historial en caliente", 31, rows);
+
+    stats = tree.getStats();
+    printf("pool: %llu aciertos, %llu fallos, %llu paginas escritas\n", static_cast<unsigned long long>(stats.pool.hits),
+           static_cast<unsigned long long>(stats.pool.misses), static_cast<unsigned long long>(stats.pool.pagesWritten));
+}
+
+/**
+ * @brief Estado compartido por los clientes simulados de `benchmarkServerLoad`. Todos corren en el mismo reactor,
+ * así que no necesita candados.
+ */
+struct ServerLoad {
+    vector<string> typeNames;
+    int firstPersonId = 0;
+    int writePercent = 0;
+    chrono::steady_clock::time_point deadline;
+    vector<double> readLatencies;
+    vector<double> writeLatencies;
+    uint64_t errors = 0;
+};
+
+/**
+ * @brief Corrutina de un cliente simulado: agrega una persona propia, envía una solicitud a la vez hasta que se
+ * acaba el tiempo y elimina su persona.
+ *
+ * @param client Conexión del cliente.
+ * @param load Estado compartido de la prueba.
+ * @param index Número del cliente.
+ * @author fabian
+ */
+static Async<> serverLoadClient(AsyncTaskClient& client, ServerLoad& load, const int index) {
+    static const char* importances[] = {"Alto", "Medio", "Bajo"};
+
+    SyntheticRandom random;
+    random.state += static_cast<unsigned long long>(index);
+    const int personId = load.firstPersonId + index;
+    LogPayloadWriter person;
+    person.integer(personId);
+    person.text("Carga");
+    person.text("Cliente " + to_string(index));
+    person.integer(30);
+    co_await client.call(RequestType::AddPerson, person);
+
+    vector<int> activeTasks;
+    char date[16];
+    while (chrono::steady_clock::now() < load.deadline) {
+        const bool write = static_cast<int>(random.next(100)) < load.writePercent;
+        LogPayloadWriter request;
+        RequestType type;
+        if (write && (activeTasks.size() < 16 || random.next(2) == 0)) {
+            type = RequestType::AddTask;
+            snprintf(date, sizeof(date), "%02u-%02u-%04u", random.next(28) + 1, random.next(12) + 1,
+                     2024 + random.next(3));
+            request.integer(personId);
+            request.byte(0);
+            request.text(load.typeNames[random.next(static_cast<unsigned>(load.typeNames.size()))]);
+            request.text("Carga");
+            request.text(importances[random.next(3)]);
+            request.text(date);
+            request.text("12:00:00");
+        } else if (write) {
+            type = RequestType::CompleteTask;
+            const size_t position = random.next(static_cast<unsigned>(activeTasks.size()));
+            request.integer(personId);
+            request.integer(activeTasks[position]);
+            activeTasks[position] = activeTasks.back();
+            activeTasks.pop_back();
+        } else {
+            type = RequestType::Query;
+            const auto query = static_cast<uint8_t>(random.next(8) + 1);
+            request.byte(query);
+            if (query == 2 || query == 4) {
+                request.text(load.typeNames[random.next(static_cast<unsigned>(load.typeNames.size()))]);
+            }
+            if (query == 4 || query == 5) request.text("01-01-2025");
+        }
+
+        const auto start = chrono::steady_clock::now();
+        try {
+            LogPayloadReader response = co_await client.call(type, request);
+            if (type == RequestType::AddTask) activeTasks.push_back(response.integer());
+        } catch (const runtime_error&) {
+            load.errors++;
+        }
+        const double micros = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        (write ? load.writeLatencies : load.readLatencies).push_back(micros);
+    }
+
+    LogPayloadWriter removal;
+    removal.integer(personId);
+    co_await client.call(RequestType::DeletePerson, removal);
+}
+
+/**
+ * @brief Generador de carga para un servidor en marcha (`--servidor`): mide rendimiento y latencias con tráfico
+ * mixto de lecturas y escrituras.
+ *
+ * Cada cliente abre su propia conexión, agrega una persona propia y, hasta que se acaba el tiempo, envía una
+ * solicitud a la vez: con probabilidad `writePercent` una escritura (agregar una tarea a su persona o completar una
+ * de las que agregó) y si no una de las ocho consultas al azar. Al terminar elimina su persona. Los clientes son
+ * corrutinas de un solo `Reactor`, así que se pueden simular miles desde un hilo. Además se abren `idleCount`
+ * conexiones que no envían nada durante la prueba, para medir que los clientes inactivos no frenan al servidor, y
+ * una conexión aparte pide sin pausa el reporte de todas las tareas completadas, para medir que un reporte largo no
+ * detiene a las demás solicitudes. Las latencias se miden en el cliente, desde que envía la solicitud hasta que
+ * recibe la respuesta.
+ *
+ * @param path Ruta del socket del servidor.
+ * @param clientCount Cantidad de clientes concurrentes.
+ * @param seconds Duración de la medición, en segundos.
+ * @param writePercent Porcentaje de solicitudes que son escrituras.
+ * @param idleCount Cantidad de conexiones inactivas.
+ * @author fabian
+ */
+void benchmarkServerLoad(const string& path, const int clientCount, const int seconds, const int writePercent,
+                         const int idleCount) {
+    ServerLoad load;
+    {
+        TaskClient client(path);
+        LogPayloadReader description = client.call(RequestType::Describe, LogPayloadWriter());
+        const int personCount = description.integer();
+        const int typeCount = description.integer();
+        for (int i = 0; i < typeCount; i++) load.typeNames.push_back(description.text());
+        printf("servidor: %d personas, %d tipos de tarea\n", personCount, typeCount);
+    }
+    if (load.typeNames.empty()) throw runtime_error("El servidor no tiene tipos de tarea");
+    load.firstPersonId = 700000000 + static_cast<int>(getpid() % 1000) * 1000000;
+    load.writePercent = writePercent;
+
+    Reactor reactor;
+    vector<unique_ptr<AsyncTaskClient>> clients;
+    vector<SocketConnection> idle;
+    const double connecting = measureMillis([&] {
+        for (int i = 0; i < idleCount; i++) idle.push_back(SocketConnection::connect(path));
+        for (int i = 0; i < clientCount; i++) clients.push_back(make_unique<AsyncTaskClient>(reactor, path));
+    });
+    printf("%d conexiones abiertas en %.0f ms\n", clientCount + idleCount, connecting);
+
+    load.deadline = chrono::steady_clock::now() + chrono::seconds(seconds);
+    vector<double> reports;
+    thread reporter([&] {
+        TaskClient client(path);
+        LogPayloadWriter request;
+        request.byte(8);
+        request.integer(0);
+        while (chrono::steady_clock::now() < load.deadline) {
+            const auto start = chrono::steady_clock::now();
+            client.call(RequestType::Report, request);
+            reports.push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - start).count());
+        }
+    });
+    for (int index = 0; index < clientCount; index++) reactor.spawn(serverLoadClient(*clients[index], load, index));
+    while (reactor.getLiveCount() > 0) reactor.runOnce(100);
+    reporter.join();
+    clients.clear();
+
+    vector<double>& reads = load.readLatencies;
+    vector<double>& writes = load.writeLatencies;
+    const double total = static_cast<double>(reads.size() + writes.size());
+    printf("%d clientes (%d inactivos), %d s, %d%% escrituras: %.0f solicitudes/s, %llu errores\n", clientCount,
+           idleCount, seconds, writePercent, total / seconds, static_cast<unsigned long long>(load.errors));
+    printf("lecturas: %zu (%.0f/s), p50 %.1f us, p99 %.1f us\n", reads.size(),
+           static_cast<double>(reads.size()) / seconds, latencyPercentile(reads, 50), latencyPercentile(reads, 99));
+    printf("escrituras: %zu (%.0f/s), p50 %.1f us, p99 %.1f us\n", writes.size(),
+           static_cast<double>(writes.size()) / seconds, latencyPercentile(writes, 50), latencyPercentile(writes, 99));
+    printf("reportes de completadas: %zu, p50 %.1f ms, p99 %.1f ms\n", reports.size(),
+           latencyPercentile(reports, 50) / 1000, latencyPercentile(reports, 99) / 1000);
+}
+
+/**
+ * @brief Aplica una mutación de la prueba de la cola: cambia la fecha de la tarea de una persona o el progreso de
+ * su subtarea. Ninguna de las dos hace crecer las listas, así que todas las fases parten de los mismos datos.
+ *
+ * @param type 1 para cambiar la fecha, 2 para cambiar el progreso.
+ * @param payload Cédula de la persona y la fecha (texto) o el progreso (decimal).
+ * @param response No se usa.
+ * @throws runtime_error Si la mutación no se puede aplicar.
+ * @author fabian
+ */
+static void applyQueueMutation(const uint8_t type, const string_view payload, LogPayloadWriter&) {
+    LogPayloadReader reader{payload};
+    const int personId = reader.integer();
+    if (type == 1) {
+        modifyActiveTask(personId, 0, reader.text(), "08:30:00");
+        return;
+    }
+    subTaskProgress(personId, 1, 0, reader.decimal());
+}
+
+/**
+ * @brief Compara la cola de mutaciones sin candados (`MutationQueue`) con un candado global alrededor de las
+ * operaciones, con 1, 2, 4, ... hasta `maxProducers` hilos productores.
+ *
+ * Cada productor modifica la tarea de su propia persona de tres formas: tomando un candado global para aplicar
+ * cada mutación, encolándola y esperando su resultado, y encolándola con una función de respuesta sin esperar más
+ * que al final. Sin archivo las mutaciones no se registran y se mide solo la serialización; con archivo se abre un
+ * registro de mutaciones y cada mutación se sincroniza antes de contarla (en la cola, por lotes).
+ *
+ * @param maxProducers Cantidad máxima de hilos productores.
+ * @param mutationCount Cantidad de mutaciones de cada fase, repartidas entre los productores.
+ * @param path Ruta del registro de mutaciones, o vacía para no registrar.
+ * @author fabian
+ */
+void benchmarkMutationQueue(const int maxProducers, const int mutationCount, const string& path) {
+    static const char* dates[] = {"01-02-2025", "15-03-2025", "30-06-2025", "10-10-2025"};
+    constexpr int firstPersonId = 500000000;
+    clearData();
+    unique_ptr<MutationLog> log;
+    if (!path.empty()) {
+        remove(path.c_str());
+        log = make_unique<MutationLog>(path);
+        recoverMutations(*log, 0);
+    }
+    addTaskType("Estudio", "Generado");
+    for (int i = 0; i < maxProducers; i++) {
+        addPerson(firstPersonId + i, "Productor", "Sintetico", 30);
+        addTask(firstPersonId + i, new Task("Cola", "Medio", "01-01-2025", "08:00:00", taskTypes.head));
+        addSubTask(firstPersonId + i, 0, new SubTask("Paso", "", 0));
+    }
+    commitMutations();
+
+    const auto mutation = [](SyntheticRandom& random, const int personId, uint8_t& type) {
+        LogPayloadWriter payload;
+        payload.integer(personId);
+        type = static_cast<uint8_t>(random.next(2) + 1);
+        if (type == 1) payload.text(dates[random.next(4)]);
+        else payload.decimal(static_cast<float>(random.next(100)));
+        return std::move(payload.bytes);
+    };
+
+    const auto runProducers = [&](const int producers, const function<void(int, SyntheticRandom&, int)>& produce) {
+        return measureMillis([&] {
+            vector<thread> threads;
+            for (int index = 0; index < producers; index++) {
+                threads.emplace_back([&, index] {
+                    SyntheticRandom random;
+                    random.state += static_cast<unsigned long long>(index);
+                    produce(index, random, mutationCount / producers);
+                });
+            }
+            for (thread& producer : threads) producer.join();
+        });
+    };
+
+    atomic<uint64_t> errors{0};
+    mutex engineLock;
+    for (int producers = 1; producers <= maxProducers; producers *= 2) {
+        const double lockMillis = runProducers(producers, [&](const int index, SyntheticRandom& random, const int count) {
+            LogPayloadWriter response;
+            for (int i = 0; i < count; i++) {
+                uint8_t type;
+                const string payload = mutation(random, firstPersonId + index, type);
+                try {
+                    lock_guard guard(engineLock);
+                    applyQueueMutation(type, payload, response);
+                } catch (const exception&) {
+                    errors++;
+                }
+                commitMutations();
+            }
+        });
+
+        MutationQueue queue(applyQueueMutation);
+        const double futureMillis = runProducers(producers, [&](const int index, SyntheticRandom& random, const int count) {
+            for (int i = 0; i < count; i++) {
+                uint8_t type;
+                string payload = mutation(random, firstPersonId + index, type);
+                if (!queue.submit(type, std::move(payload)).get().ok) errors++;
+            }
+        });
+
+        const double callbackMillis = runProducers(producers, [&](const int index, SyntheticRandom& random, const int count) {
+            atomic<int> pending{count};
+            for (int i = 0; i < count; i++) {
+                uint8_t type;
+                string payload = mutation(random, firstPersonId + index, type);
+                queue.submit(type, std::move(payload), [&pending, &errors](MutationResult&& result) {
+                    if (!result.ok) errors++;
+                    pending.fetch_sub(1, memory_order_release);
+                });
+            }
+            while (pending.load(memory_order_acquire) > 0) this_thread::yield();
+        });
+
+        const MutationQueueStats stats = queue.getStats();
+        const int done = mutationCount / producers * producers;
+        printf("%2d productores: candado %.0f mutaciones/s, cola esperando cada una %.0f mutaciones/s, "
+               "cola con respuesta %.0f mutaciones/s (%.1f por lote, %llu veces llena)\n",
+               producers, done / (lockMillis / 1000.0), done / (futureMillis / 1000.0), done / (callbackMillis / 1000.0),
+               static_cast<double>(stats.commands) / static_cast<double>(max<uint64_t>(stats.batches, 1)),
+               static_cast<unsigned long long>(stats.fullWaits));
+    }
+    if (errors) printf("%llu mutaciones fallaron\n", static_cast<unsigned long long>(errors.load()));
+
+    mutationLog = nullptr;
+    log.reset();
+    clearData();
+    if (!path.empty()) remove(path.c_str());
+}
+
+/**
+ * @brief Mide las mutaciones por segundo del motor dividido por cédula (`ShardedEngine`) con 1, 2, 4, ... hasta
+ * `maxShards` fragmentos.
+ *
+ * Ocho productores modifican tareas de personas al azar entre 4096, encolando cada mutación en el fragmento de su
+ * persona con una función de respuesta y esperando solo al final. Las mutaciones no se registran, así que se mide
+ * cuánto escalan la aplicación y la publicación de versiones al repartirlas entre varios escritores.
+ *
+ * @param maxShards Cantidad máxima de fragmentos.
+ * @param mutationCount Cantidad de mutaciones de cada fase, repartidas entre los productores.
+ * @author fabian
+ */
+void benchmarkShardedWrites(const int maxShards, const int mutationCount) {
+    static const char* dates[] = {"01-02-2025", "15-03-2025", "30-06-2025", "10-10-2025"};
+    constexpr int firstPersonId = 500000000;
+    constexpr int personCount = 4096;
+    constexpr int producers = 8;
+    clearData();
+    addTaskType("Estudio", "Generado");
+    for (int i = 0; i < personCount; i++) {
+        addPerson(firstPersonId + i, "Productor", "Sintetico", 30);
+        addTask(firstPersonId + i, new Task("Fragmento", "Medio", "01-01-2025", "08:00:00", taskTypes.head));
+        addSubTask(firstPersonId + i, 0, new SubTask("Paso", "", 0));
+    }
+
+    atomic<uint64_t> errors{0};
+    const int perProducer = mutationCount / producers;
+    for (int shardCount = 1; shardCount <= maxShards; shardCount *= 2) {
+        ShardedEngine engine(shardCount, applyQueueMutation);
+        const double millis = measureMillis([&] {
+            vector<thread> threads;
+            for (int index = 0; index < producers; index++) {
+                threads.emplace_back([&, index] {
+                    SyntheticRandom random;
+                    random.state += static_cast<unsigned long long>(index);
+                    atomic<int> pending{perProducer};
+                    for (int i = 0; i < perProducer; i++) {
+                        const int personId = firstPersonId + static_cast<int>(random.next(personCount));
+                        LogPayloadWriter payload;
+                        payload.integer(personId);
+                        const auto type = static_cast<uint8_t>(random.next(2) + 1);
+                        if (type == 1) payload.text(dates[random.next(4)]);
+                        else payload.decimal(static_cast<float>(random.next(100)));
+                        engine.submit(personId, type, std::move(payload.bytes),
+                                      [&pending, &errors](MutationResult&& result) {
+                                          if (!result.ok) errors++;
+                                          pending.fetch_sub(1, memory_order_release);
+                                      });
+                    }
+                    while (pending.load(memory_order_acquire) > 0) this_thread::yield();
+                });
+            }
+            for (thread& producer : threads) producer.join();
+        });
+        engine.stop();
+
+        const MutationQueueStats stats = engine.getStats();
+        const int done = perProducer * producers;
+        printf("%2d fragmentos: %.0f mutaciones/s (%.1f por lote)\n", shardCount, done / (millis / 1000.0),
+               static_cast<double>(stats.commands) / static_cast<double>(max<uint64_t>(stats.batches, 1)));
+    }
+    if (errors) printf("%llu mutaciones fallaron\n", static_cast<unsigned long long>(errors.load()));
+    clearData();
+}
+
+/**
+ * @brief Pide el estado de replicación a un servidor.
+ *
+ * @param client Cliente conectado al servidor.
+ * @return LSN aplicado y retraso en milisegundos.
+ * @author fabian
+ */
+static pair<uint64_t, double> replicationStatus(TaskClient& client) {
+    LogPayloadReader status = client.call(RequestType::Status, LogPayloadWriter());
+    status.byte();
+    const uint64_t appliedLsn = status.integer64();
+    status.integer64();
+    return {appliedLsn, status.decimal()};
+}
+
+/**
+ * @brief Ejecuta las mismas consultas y reportes en dos servidores y cuenta cuántas respuestas son iguales.
+ *
+ * @param primary Cliente del primario.
+ * @param replica Cliente de la réplica.
+ * @return Cantidad de respuestas comparadas y cantidad de respuestas distintas.
+ * @author fabian
+ */
+static pair<int, int> compareServers(TaskClient& primary, TaskClient& replica) {
+    vector<pair<RequestType, LogPayloadWriter>> requests;
+    requests.emplace_back(RequestType::Describe, LogPayloadWriter());
+    string typeName;
+    {
+        LogPayloadReader description = primary.call(RequestType::Describe, LogPayloadWriter());
+        description.integer();
+        if (description.integer() > 0) typeName = description.text();
+    }
+    for (uint8_t query = 1; query <= 8; query++) {
+        LogPayloadWriter request;
+        request.byte(query);
+        if (query == 2 || query == 4) request.text(typeName);
+        if (query == 4 || query == 5) request.text("01-01-2025");
+        requests.emplace_back(RequestType::Query, std::move(request));
+    }
+    for (const uint8_t report : {3, 5, 8}) {
+        LogPayloadWriter request;
+        request.byte(report);
+        request.integer(100);
+        if (report == 5) request.text("01-01-2025");
+        requests.emplace_back(RequestType::Report, std::move(request));
+    }
+
+    int different = 0;
+    for (const auto& [type, request] : requests) {
+        const string expected(primary.call(type, request).bytes);
+        if (string(replica.call(type, request).bytes) != expected) different++;
+    }
+    return {static_cast<int>(requests.size()), different};
+}
+
+/**
+ * @brief Pone a prueba una réplica de lectura junto a su primario, los dos ya escuchando en la misma máquina.
+ *
+ * Genera carga en el primario con `benchmarkServerLoad` mientras mide cada 20 ms cuántas mutaciones le faltan a la
+ * réplica y su retraso. Después agrega personas con tareas, completa la mitad, espera a que la réplica alcance al
+ * primario y compara las respuestas de ambos a todas las consultas y a los reportes largos.
+ *
+ * @param primaryPath Ruta del socket del primario.
+ * @param replicaPath Ruta del socket de la réplica.
+ * @param clientCount Cantidad de clientes de la carga.
+ * @param seconds Duración de la carga.
+ * @param writePercent Porcentaje de escrituras de la carga.
+ * @return true si la réplica alcanzó al primario y todas las respuestas coinciden.
+ * @author fabian
+ */
+bool benchmarkReplica(const string& primaryPath, const string& replicaPath, const int clientCount, const int seconds,
+                      const int writePercent) {
+    atomic<bool> loading{true};
+    vector<double> behind;
+    vector<double> lags;
+    thread sampler([&] {
+        TaskClient primary(primaryPath);
+        TaskClient replica(replicaPath);
+        while (loading) {
+            const uint64_t primaryLsn = replicationStatus(primary).first;
+            const auto [replicaLsn, lagMillis] = replicationStatus(replica);
+            behind.push_back(static_cast<double>(primaryLsn > replicaLsn ? primaryLsn - replicaLsn : 0));
+            lags.push_back(lagMillis);
+            this_thread::sleep_for(chrono::milliseconds(20));
+        }
+    });
+    try {
+        benchmarkServerLoad(primaryPath, clientCount, seconds, writePercent);
+    } catch (...) {
+        loading = false;
+        sampler.join();
+        throw;
+    }
+    loading = false;
+    sampler.join();
+    printf("replica durante la carga: %zu muestras, p50 %.0f y p99 %.0f mutaciones atras, retraso p50 %.1f ms y "
+           "p99 %.1f ms\n", lags.size(), latencyPercentile(behind, 50), latencyPercentile(behind, 99),
+           latencyPercentile(lags, 50), latencyPercentile(lags, 99));
+
+    TaskClient primary(primaryPath);
+    TaskClient replica(replicaPath);
+    string typeName;
+    {
+        LogPayloadReader description = primary.call(RequestType::Describe, LogPayloadWriter());
+        description.integer();
+        if (description.integer() == 0) throw runtime_error("El servidor no tiene tipos de tarea");
+        typeName = description.text();
+    }
+    constexpr int personCount = 50;
+    constexpr int tasksPerPerson = 20;
+    const int firstPersonId = 800000000 + static_cast<int>(getpid() % 1000) * 1000;
+    for (int index = 0; index < personCount; index++) {
+        LogPayloadWriter person;
+        person.integer(firstPersonId + index);
+        person.text("Replica");
+        person.text("Persona " + to_string(index));
+        person.integer(40);
+        primary.call(RequestType::AddPerson, person);
+        for (int i = 0; i < tasksPerPerson; i++) {
+            char date[16];
+            snprintf(date, sizeof(date), "%02d-%02d-2025", i % 28 + 1, index % 12 + 1);
+            LogPayloadWriter task;
+            task.integer(firstPersonId + index);
+            task.byte(0);
+            task.text(typeName);
+            task.text("Convergencia");
+            task.text(i % 3 == 0 ? "Alto" : "Medio");
+            task.text(date);
+            task.text("09:00:00");
+            const int taskId = primary.call(RequestType::AddTask, task).integer();
+            if (i % 2 != 0) continue;
+            LogPayloadWriter completion;
+            completion.integer(firstPersonId + index);
+            completion.integer(taskId);
+            primary.call(RequestType::CompleteTask, completion);
+        }
+    }
+
+    const uint64_t targetLsn = replicationStatus(primary).first;
+    const auto start = chrono::steady_clock::now();
+    uint64_t replicaLsn = 0;
+    while ((replicaLsn = replicationStatus(replica).first) < targetLsn
+           && chrono::steady_clock::now() - start < chrono::seconds(10)) {
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    const double catchUpMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    const auto [compared, different] = compareServers(primary, replica);
+    printf("replica en el LSN %llu de %llu tras %.1f ms: %d de %d respuestas iguales\n",
+           static_cast<unsigned long long>(replicaLsn), static_cast<unsigned long long>(targetLsn), catchUpMillis,
+           compared - different, compared);
+
+    for (int index = 0; index < personCount; index++) {
+        LogPayloadWriter removal;
+        removal.integer(firstPersonId + index);
+        primary.call(RequestType::DeletePerson, removal);
+    }
+    return replicaLsn >= targetLsn && different == 0;
+}
+
+/**
+ * @brief Ejecuta una consulta sobre la imagen de una memoria compartida y escribe el resultado con el mismo formato
+ * que la respuesta de `TaskServer` a una solicitud `Query`.
+ *
+ * @param image Instantánea de la ranura actual.
+ * @param query Número de consulta.
+ * @param typeName Tipo de tarea de las consultas 2 y 4.
+ * @param limit Fecha de las consultas 4 y 5.
+ * @return Campos de la respuesta.
+ * @author fabian
+ */
+static string sharedQuery(const SnapshotImage& image, const uint8_t query, const string& typeName, const tm& limit) {
+    LogPayloadWriter response;
+    const auto writePerson = [&response](const PersonSummary& result) {
+        response.integer(result.found ? result.id : 0);
+        response.text(result.found ? result.name : string());
+        response.integer(result.count);
+    };
+    const auto writeCounts = [&response](const KeyCounts& counts) {
+        const int maxCount = counts.maxCount();
+        const vector<string> keys = counts.entries.empty() ? vector<string>() : counts.keysWithCount(maxCount);
+        response.integer(maxCount);
+        response.integer(static_cast<int32_t>(keys.size()));
+        for (const string& key : keys) response.text(key);
+    };
+    switch (query) {
+        case 1: writePerson(queryMostActiveTasks(image)); break;
+        case 2: writePerson(queryMostActiveTasksOfType(image, typeName)); break;
+        case 3: writeCounts(queryActiveTaskTypes(image)); break;
+        case 4: writePerson(queryMostExpiredTasksOfType(image, typeName, limit)); break;
+        case 5: writeCounts(queryExpiredTaskTypes(image, limit)); break;
+        case 6: writeCounts(queryActiveImportances(image)); break;
+        case 7: writeCounts(queryTaskTypesByImportance(image, false, "Medio")); break;
+        default: writeCounts(queryTaskTypesByImportance(image, true, "Alto")); break;
+    }
+    return std::move(response.bytes);
+}
+
+/**
+ * @brief Compara las consultas de un servidor por su socket con las mismas consultas leídas por otro proceso desde
+ * la memoria compartida que publica el servidor.
+ *
+ * Durante `seconds` segundos alterna las ocho consultas por los dos caminos y mide su latencia. Después espera a
+ * que el servidor publique la versión más reciente y compara las respuestas; la comparación solo tiene sentido si
+ * nadie más está escribiendo en ese momento.
+ *
+ * @param serverPath Ruta del socket del servidor.
+ * @param name Nombre de la memoria compartida del servidor.
+ * @param seconds Duración de la medición.
+ * @return true si todas las respuestas coinciden.
+ * @author fabian
+ */
+bool benchmarkSharedDataset(const string& serverPath, const string& name, const int seconds) {
+    TaskClient client(serverPath);
+    SharedDatasetReader reader(name);
+    string typeName;
+    {
+        LogPayloadReader description = client.call(RequestType::Describe, LogPayloadWriter());
+        description.integer();
+        if (description.integer() > 0) typeName = description.text();
+    }
+    tm limit = {};
+    parseDate("01-01-2025", limit);
+    const auto request = [&typeName](const uint8_t query) {
+        LogPayloadWriter writer;
+        writer.byte(query);
+        if (query == 2 || query == 4) writer.text(typeName);
+        if (query == 4 || query == 5) writer.text("01-01-2025");
+        return writer;
+    };
+
+    const uint64_t firstGeneration = reader.getGeneration();
+    vector<double> socketLatencies[8];
+    vector<double> sharedLatencies[8];
+    const auto deadline = chrono::steady_clock::now() + chrono::seconds(seconds);
+    while (chrono::steady_clock::now() < deadline) {
+        for (uint8_t query = 1; query <= 8; query++) {
+            const LogPayloadWriter writer = request(query);
+            socketLatencies[query - 1].push_back(
+                1000 * measureMillis([&] { client.call(RequestType::Query, writer); }));
+            sharedLatencies[query - 1].push_back(1000 * measureMillis([&] {
+                reader.read([&](const SnapshotImage& image) { return sharedQuery(image, query, typeName, limit); });
+            }));
+        }
+    }
+
+    printf("consulta   socket p50 (us)   socket p99 (us)   memoria p50 (us)   memoria p99 (us)\n");
+    for (int query = 0; query < 8; query++) {
+        printf("%8d %17.1f %17.1f %18.1f %18.1f\n", query + 1, latencyPercentile(socketLatencies[query], 50),
+               latencyPercentile(socketLatencies[query], 99), latencyPercentile(sharedLatencies[query], 50),
+               latencyPercentile(sharedLatencies[query], 99));
+    }
+    printf("%llu publicaciones durante la medicion, %llu lecturas repetidas\n",
+           static_cast<unsigned long long>(reader.getGeneration() - firstGeneration),
+           static_cast<unsigned long long>(reader.getRetries()));
+
+    this_thread::sleep_for(chrono::milliseconds(500));
+    int different = 0;
+    for (uint8_t query = 1; query <= 8; query++) {
+        const string expected(client.call(RequestType::Query, request(query)).bytes);
+        const string shared =
+            reader.read([&](const SnapshotImage& image) { return sharedQuery(image, query, typeName, limit); });
+        if (shared != expected) different++;
+    }
+    printf("%d de 8 respuestas iguales\n", 8 - different);
+    return different == 0;
+}
+
+/**
+ * @brief Mide el costo de ejecutar consultas y reportes como trabajos en segundo plano de un `JobExecutor`.
+ *
+ * Sobre una versión publicada de un conjunto sintético mide la latencia desde que se envía hasta que termina un
+ * trabajo vacío y cuántos trabajos vacíos por segundo atiende el ejecutor; el tiempo de cada consulta del menú
+ * ejecutada de una vez y como trabajo por tramos, comprobando que describan el mismo resultado; cuántos trabajos de
+ * consultas y reportes por segundo se completan con varios a la vez; y cuánto tarda en detenerse un reporte
+ * cancelado.
+ *
+ * @param pool Pool de hilos para las consultas.
+ * @param personCount Cantidad de personas del conjunto sintético.
+ * @param tasksPerPerson Cantidad de tareas activas (y completadas) por persona.
+ * @param jobCount Cantidad de trabajos vacíos a medir.
+ * @return true si todas las consultas por tramos dieron el mismo resultado que de una vez.
+ * @author fabian
+ */
+bool benchmarkJobs(ThreadPool& pool, const int personCount, const int tasksPerPerson, const int jobCount) {
+    PersonList people;
+    TaskTypeList taskTypes;
+    cout << "Generando " << personCount << " personas con " << tasksPerPerson << " tareas activas y "
+         << tasksPerPerson << " completadas cada una..." << endl;
+    generateSyntheticData(people, taskTypes, personCount, tasksPerPerson);
+    VersionedPeople versions(people, taskTypes);
+    const shared_ptr<const PeopleVersion> version = versions.pin();
+    JobExecutor executor(2);
+
+    vector<double> latencies;
+    for (int i = 0; i < jobCount; i++) {
+        latencies.push_back(1000 * measureMillis([&] { executor.submit("Vacio", [](Job&) {})->wait(); }));
+    }
+    vector<shared_ptr<Job>> jobs;
+    const double emptyMillis = measureMillis([&] {
+        for (int i = 0; i < jobCount; i++) jobs.push_back(executor.submit("Vacio", [](Job&) {}));
+        for (const shared_ptr<Job>& job : jobs) job->wait();
+    });
+    printf("Trabajos vacios: p50 %.1f us y p99 %.1f us desde el envio hasta el fin; %.0f trabajos/s\n",
+           latencyPercentile(latencies, 50), latencyPercentile(latencies, 99), jobCount / (emptyMillis / 1000.0));
+
+    vector<QueryJobRequest> requests(8);
+    for (int query = 1; query <= 8; query++) {
+        QueryJobRequest& request = requests[query - 1];
+        request.query = query;
+        request.typeName = "Trabajo";
+        request.limitText = "01-07-2024";
+        parseDate(request.limitText, request.limit);
+    }
+
+    bool same = true;
+    printf("consulta   de una vez (ms)   por tramos (ms)\n");
+    for (const QueryJobRequest& request : requests) {
+        string expected;
+        const double direct = measureMillis([&] { expected = describeQuery(request, PeopleView(*version), pool); });
+        shared_ptr<Job> job;
+        const double sliced = measureMillis([&] {
+            job = executor.submit(queryJobName(request), queryJob(version, pool, request));
+            job->wait();
+        });
+        const bool equal = job->getProgress().state == JobState::Finished && job->getResult() == expected;
+        same = same && equal;
+        printf("%8d %17.1f %17.1f%s\n", request.query, direct, sliced, equal ? "" : "   resultado distinto");
+    }
+
+    tm from = {};
+    parseDate("01-06-2024", from);
+    jobs.clear();
+    uint64_t rows = 0;
+    const double concurrentMillis = measureMillis([&] {
+        for (const QueryJobRequest& request : requests) {
+            jobs.push_back(executor.submit(queryJobName(request), queryJob(version, pool, request)));
+        }
+        jobs.push_back(executor.submit("Sin tareas activas", peopleWithoutActiveTasksJob(version, pool)));
+        jobs.push_back(executor.submit("Proximas a vencer", tasksDueWithinWeekJob(version, pool, from)));
+        jobs.push_back(executor.submit("Completadas", completedTasksJob(version, pool)));
+        for (const shared_ptr<Job>& job : jobs) {
+            job->wait();
+            rows += job->getProgress().rows;
+        }
+    });
+    printf("%zu consultas y reportes a la vez en %.1f ms: %.1f trabajos/s, %llu filas\n", jobs.size(),
+           concurrentMillis, static_cast<double>(jobs.size()) / (concurrentMillis / 1000.0),
+           static_cast<unsigned long long>(rows));
+
+    const shared_ptr<Job> cancelled = executor.submit("Completadas", completedTasksJob(version, pool));
+    while (cancelled->getProgress().done == 0 && !cancelled->isDone()) this_thread::yield();
+    const double cancelMillis = measureMillis([&] {
+        cancelled->cancel();
+        cancelled->wait();
+    });
+    const JobProgress progress = cancelled->getProgress();
+    printf("Cancelacion: el reporte de completadas se detuvo %.2f ms despues de cancelarlo, con %llu de %llu "
+           "personas recorridas\n", cancelMillis, static_cast<unsigned long long>(progress.done),
+           static_cast<unsigned long long>(progress.total));
+
+    if (!same) printf("Alguna consulta por tramos no dio el mismo resultado que de una vez\n");
+    return same;
+}
+
+/**
+ * @brief Ejecuta la prueba de rendimiento indicada por línea de comandos.
+ *
+ * Uso: `--bench escalado|lotes [personas] [tareas por persona]` o
+ * `--bench instantanea [personas] [tareas por persona] [archivo]`, `--bench registro [mutaciones] [archivo]` o
+ * `--bench compactacion [personas] [tareas por persona] [MB/s] [archivo]` o `--bench carga [tareas] [personas]` o
+ * `--bench cadenas|archivo|bloques|masivas|handles [personas] [tareas por persona]` o
+ * `--bench arbol [tareas] [personas] [MB de pool] [archivo]` o
+ * `--bench servidor ruta [clientes] [segundos] [% de escrituras] [conexiones inactivas]`, con un servidor ya
+ * escuchando en la ruta, o
+ * `--bench cola [mutaciones] [archivo]` o `--bench fragmentos [mutaciones] [max fragmentos]` o
+ * `--bench replica primario replica [clientes] [segundos] [% de escrituras]`, con un primario y su réplica ya
+ * escuchando; termina con código 2 si la réplica no converge, o
+ * `--bench compartida ruta nombre [segundos]`, con un servidor escuchando en la ruta y publicando en la memoria
+ * compartida con ese nombre; termina con código 2 si alguna respuesta es distinta, o
+ * `--bench trabajos [personas] [tareas por persona] [trabajos vacios]`; termina con código 2 si alguna consulta por
+ * tramos da un resultado distinto.
+ *
+ * @param args Argumentos que siguen a `--bench`.
+ * @param maxThreads Cantidad máxima de hilos configurada.
+ * @return Código de salida del programa.
+ * @author fabian
+ */
+int runBenchmark(const vector<string>& args, const unsigned maxThreads) {
+    if (args.empty()) {
+        cout << "Pruebas disponibles: escalado, lotes, instantanea, registro, compactacion, importacion, carga, masivas, handles, fechas, exportacion, cadenas, archivo, bloques, arbol, servidor, cola, fragmentos, replica, compartida, trabajos" << endl;
+        return 1;
+    }
+
+    if (args[0] == "escalado") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 200000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 10;
+        benchmarkQueryScaling(static_cast<int>(maxThreads), personCount, tasksPerPerson);
+        return 0;
+    }
+
+    if (args[0] == "lotes") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 2000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 20;
+        ThreadPool pool(maxThreads);
+        benchmarkBatch(pool, personCount, tasksPerPerson);
+        return 0;
+    }
+
+    if (args[0] == "instantanea") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 500000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 10;
+        const string path = args.size() > 3 ? args[3] : "bench.snapshot";
+        ThreadPool pool(maxThreads);
+        benchmarkSnapshot(pool, personCount, tasksPerPerson, path);
+        return 0;
+    }
+
+    if (args[0] == "registro") {
+        const int mutationCount = args.size() > 1 ? stoi(args[1]) : 20000;
+        const string path = args.size() > 2 ? args[2] : "bench.wal";
+        benchmarkMutationLog(static_cast<int>(max(maxThreads, 16u)), mutationCount, path);
+        return 0;
+    }
+
+    if (args[0] == "compactacion") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 100000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 10;
+        const uint64_t megabytesPerSecond = args.size() > 3 ? stoull(args[3]) : 100;
+        const string path = args.size() > 4 ? args[4] : "bench.snapshot";
+        ThreadPool pool(maxThreads);
+        benchmarkCompaction(pool, personCount, tasksPerPerson, megabytesPerSecond, path);
+        return 0;
+    }
+
+    if (args[0] == "importacion") {
+        const int taskCount = args.size() > 1 ? stoi(args[1]) : 2000000;
+        const int personCount = args.size() > 2 ? stoi(args[2]) : 100000;
+        benchmarkImport(maxThreads, personCount, taskCount);
+        return 0;
+    }
+
+    if (args[0] == "carga") {
+        const int taskCount = args.size() > 1 ? stoi(args[1]) : 10000000;
+        const int personCount = args.size() > 2 ? stoi(args[2]) : 1000000;
+        benchmarkBulkLoad(personCount, taskCount);
+        return 0;
+    }
+
+    if (args[0] == "masivas") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 100000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 100;
+        benchmarkBulkUpdates(personCount, tasksPerPerson);
+        return 0;
+    }
+
+    if (args[0] == "handles") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 1000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 1000;
+        benchmarkHandles(personCount, tasksPerPerson);
+        return 0;
+    }
+
+    if (args[0] == "fechas") {
+        benchmarkDateTime(args.size() > 1 ? stoi(args[1]) : 1000000);
+        return 0;
+    }
+
+    if (args[0] == "exportacion") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 1000000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 10;
+        const string path = args.size() > 3 ? args[3] : "bench.export";
+        ThreadPool pool(maxThreads);
+        benchmarkExport(pool, personCount, tasksPerPerson, path);
+        return 0;
+    }
+
+    if (args[0] == "archivo") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 200000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 50;
+        benchmarkArchive(personCount, tasksPerPerson);
+        return 0;
+    }
+
+    if (args[0] == "servidor" && args.size() > 1) {
+        const int clientCount = args.size() > 2 ? stoi(args[2]) : 8;
+        const int seconds = args.size() > 3 ? stoi(args[3]) : 10;
+        const int writePercent = args.size() > 4 ? stoi(args[4]) : 10;
+        const int idleCount = args.size() > 5 ? stoi(args[5]) : 0;
+        benchmarkServerLoad(args[1], clientCount, seconds, writePercent, idleCount);
+        return 0;
+    }
+
+    if (args[0] == "cola") {
+        const int mutationCount = args.size() > 1 ? stoi(args[1]) : 200000;
+        benchmarkMutationQueue(32, mutationCount, args.size() > 2 ? args[2] : "");
+        return 0;
+    }
+
+    if (args[0] == "replica" && args.size() > 2) {
+        const int clientCount = args.size() > 3 ? stoi(args[3]) : 8;
+        const int seconds = args.size() > 4 ? stoi(args[4]) : 10;
+        const int writePercent = args.size() > 5 ? stoi(args[5]) : 30;
+        return benchmarkReplica(args[1], args[2], clientCount, seconds, writePercent) ? 0 : 2;
+    }
+
+    if (args[0] == "compartida" && args.size() > 2) {
+        return benchmarkSharedDataset(args[1], args[2], args.size() > 3 ? stoi(args[3]) : 5) ? 0 : 2;
+    }
+
+    if (args[0] == "trabajos") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 200000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 10;
+        const int jobCount = args.size() > 3 ? stoi(args[3]) : 20000;
+        ThreadPool pool(maxThreads);
+        return benchmarkJobs(pool, personCount, tasksPerPerson, jobCount) ? 0 : 2;
+    }
+
+    if (args[0] == "fragmentos") {
+        const int mutationCount = args.size() > 1 ? stoi(args[1]) : 400000;
+        benchmarkShardedWrites(args.size() > 2 ? stoi(args[2]) : 8, mutationCount);
+        return 0;
+    }
+
+    if (args[0] == "arbol") {
+        const uint64_t taskCount = args.size() > 1 ? stoull(args[1]) : 10000000;
+        const int personCount = args.size() > 2 ? stoi(args[2]) : 100000;
+        const uint64_t cacheMegabytes = args.size() > 3 ? stoull(args[3]) : 256;
+        const string path = args.size() > 4 ? args[4] : "bench.pages";
+        benchmarkTaskTree(taskCount, personCount, cacheMegabytes, path);
+        return 0;
+    }
+
+    if (args[0] == "bloques") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 100000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 200;
+        ThreadPool pool(maxThreads);
+        benchmarkBlockSkipping(pool, personCount, tasksPerPerson);
+        return 0;
+    }
+
+    if (args[0] == "cadenas") {
+        const int personCount = args.size() > 1 ? stoi(args[1]) : 1000000;
+        const int tasksPerPerson = args.size() > 2 ? stoi(args[2]) : 10;
+        ThreadPool pool(maxThreads);
+        benchmarkStringPool(pool, personCount, tasksPerPerson);
+        return 0;
+    }
+
+    cout << "Prueba desconocida: " << args[0] << endl;
+    return 1;
+}
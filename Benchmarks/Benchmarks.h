@@ -0,0 +1,51 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+#include <string>
+#include <vector>
+
+#include "../Lists/PersonList.h"
+#include "../Lists/TaskTypeList.h"
+#include "../Queries/Queries.h"
+#include "../Batch/CommandInterpreter.h"
+#include "../Storage/Snapshot.h"
+#include "../Engine/Compactor.h"
+#include "../Import/TaskImporter.h"
+#include "../Export/ReportExporter.h"
+#include "../Server/Protocol.h"
+#include "../Engine/ShardedEngine.h"
+#include "../Storage/SharedDataset.h"
+#include "../Queries/ReportJobs.h"
+
+void generateSyntheticData(PersonList& people, TaskTypeList& taskTypes, int personCount, int tasksPerPerson);
+void benchmarkQueryScaling(int maxThreads, int personCount, int tasksPerPerson);
+void benchmarkBatch(ThreadPool& pool, int personCount, int tasksPerPerson);
+void benchmarkSnapshot(ThreadPool& pool, int personCount, int tasksPerPerson, const string& path);
+void benchmarkMutationLog(int maxThreads, int mutationCount, const string& path);
+void benchmarkCompaction(ThreadPool& pool, int personCount, int tasksPerPerson, uint64_t megabytesPerSecond,
+                         const string& path);
+void benchmarkImport(unsigned maxThreads, int personCount, int taskCount);
+void benchmarkBulkLoad(int personCount, int taskCount);
+void benchmarkBulkUpdates(int personCount, int tasksPerPerson);
+void benchmarkHandles(int personCount, int tasksPerPerson);
+void benchmarkDateTime(int count);
+void benchmarkExport(ThreadPool& pool, int personCount, int tasksPerPerson, const string& path);
+void benchmarkStringPool(ThreadPool& pool, int personCount, int tasksPerPerson);
+void benchmarkArchive(int personCount, int tasksPerPerson);
+void benchmarkBlockSkipping(ThreadPool& pool, int personCount, int tasksPerPerson);
+void benchmarkTaskTree(uint64_t taskCount, int personCount, uint64_t cacheMegabytes, const string& path);
+void benchmarkServerLoad(const string& path, int clientCount, int seconds, int writePercent, int idleCount = 0);
+void benchmarkMutationQueue(int maxProducers, int mutationCount, const string& path);
+void benchmarkShardedWrites(int maxShards, int mutationCount);
+bool benchmarkReplica(const string& primaryPath, const string& replicaPath, int clientCount, int seconds,
+                      int writePercent);
+bool benchmarkSharedDataset(const string& serverPath, const string& name, int seconds);
+bool benchmarkJobs(ThreadPool& pool, int personCount, int tasksPerPerson, int jobCount);
+int runBenchmark(const vector<string>& args, unsigned maxThreads);
+
+#include "Benchmarks.cpp"
+#endif //BENCHMARKS_H
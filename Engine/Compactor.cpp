@@ -0,0 +1,218 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "Compactor.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+Compactor* compactor = nullptr;
+
+/**
+ * @brief Guarda una instantánea de las personas de varias listas, en orden de cédula, y de `taskTypes`.
+ *
+ * @param path Ruta del archivo.
+ * @param lists Listas de personas, cada una ordenada por cédula, o vacío para usar `people`.
+ * @param lsn LSN de la última mutación incluida en los datos.
+ * @param bytesPerSecond Límite de velocidad de escritura, o 0 para no limitar.
+ * @throws runtime_error Si el archivo no se puede escribir.
+ * @author fabian
+ */
+static void saveListsSnapshot(const string& path, const vector<const PersonList*>& lists, const uint64_t lsn,
+                              const uint64_t bytesPerSecond) {
+    if (lists.size() <= 1) {
+        saveSnapshot(path, lists.empty() ? people : *lists[0], taskTypes, lsn, bytesPerSecond);
+        return;
+    }
+    vector<const Person*> persons;
+    for (const PersonList* list : lists) {
+        for (const Person* person = list->head; person; person = person->next) persons.push_back(person);
+    }
+    sort(persons.begin(), persons.end(), [](const Person* left, const Person* right) { return left->id < right->id; });
+    saveSnapshot(path, persons, taskTypes, lsn, bytesPerSecond);
+}
+
+/**
+ * @brief Constructor de la clase Compactor.
+ *
+ * @param snapshotPath Ruta de la instantánea que se reemplaza en cada compactación.
+ * @param log Registro de mutaciones que se recorta.
+ * @param thresholdBytes Tamaño del registro a partir del cual `maybeStart()` inicia una compactación.
+ * @param bytesPerSecond Límite de velocidad de escritura de la instantánea, o 0 para no limitar.
+ * @author fabian
+ */
+Compactor::Compactor(const string& snapshotPath, MutationLog& log, const uint64_t thresholdBytes,
+                     const uint64_t bytesPerSecond)
+    : snapshotPath(snapshotPath), log(log), thresholdBytes(thresholdBytes), bytesPerSecond(bytesPerSecond) {}
+
+/**
+ * @brief Destructor de la clase Compactor. Espera a que termine la compactación en curso.
+ * @author fabian
+ */
+Compactor::~Compactor() {
+    wait();
+}
+
+/**
+ * @brief Inicia una compactación si el registro pasó del umbral y no hay otra en curso.
+ *
+ * @param lists Listas con todas las personas, con cédulas distintas, o vacío para usar `people`.
+ * @return true si se inició una compactación.
+ * @author fabian
+ */
+bool Compactor::maybeStart(const vector<const PersonList*>& lists) {
+    if (!isDue()) return false;
+    return start(lists);
+}
+
+/**
+ * @brief Indica si el registro pasó del umbral y no hay una compactación en curso.
+ *
+ * Sirve para no detener a los demás escritores (ver MutationQueue) antes de saber si hace falta compactar.
+ *
+ * @return true si `maybeStart()` iniciaría una compactación.
+ * @author fabian
+ */
+bool Compactor::isDue() const {
+    return !this->running && this->log.getSize() >= this->thresholdBytes;
+}
+
+/**
+ * @brief Inicia una compactación, salvo que ya haya una en curso.
+ *
+ * Solo se compacta si todas las mutaciones del registro ya son durables: después de un error de sincronización, la
+ * memoria puede tener cambios que no están en el disco y que se informaron como fallidos, y no deben llegar a una
+ * instantánea.
+ *
+ * @param lists Listas con todas las personas, con cédulas distintas, o vacío para usar `people`.
+ * @return true si se inició la compactación.
+ * @author fabian
+ */
+bool Compactor::start(const vector<const PersonList*>& lists) {
+    if (this->running.exchange(true)) return false;
+    if (this->finisher.joinable()) this->finisher.join();
+
+    const auto started = chrono::steady_clock::now();
+    const uint64_t lsn = this->log.getLastLsn();
+    try {
+        this->log.sync(lsn);
+    } catch (const exception&) {
+        finish(false, lsn, 0, started);
+        return false;
+    }
+
+#ifdef _WIN32
+    const bool inProcess = true;
+#else
+    const bool inProcess = completedTaskTree != nullptr;
+#endif
+    if (inProcess) {
+        bool saved = true;
+        try {
+            saveListsSnapshot(this->snapshotPath, lists, lsn, this->bytesPerSecond);
+        } catch (const exception&) {
+            saved = false;
+        }
+        const double pauseMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - started).count();
+        finish(saved, lsn, pauseMillis, started);
+        return true;
+    }
+
+#ifndef _WIN32
+    const pid_t child = fork();
+    if (child == 0) {
+        try {
+            saveListsSnapshot(this->snapshotPath, lists, lsn, this->bytesPerSecond);
+        } catch (...) {
+            _exit(1);
+        }
+        _exit(0);
+    }
+    const double pauseMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - started).count();
+    if (child < 0) {
+        finish(false, lsn, pauseMillis, started);
+        return false;
+    }
+
+    this->finisher = thread([this, child, lsn, pauseMillis, started] {
+        int status = 0;
+        while (waitpid(child, &status, 0) < 0 && errno == EINTR) {}
+        finish(WIFEXITED(status) && WEXITSTATUS(status) == 0, lsn, pauseMillis, started);
+    });
+#endif
+    return true;
+}
+
+/**
+ * @brief Termina una compactación: si la instantánea se guardó, recorta el registro y actualiza las estadísticas.
+ *
+ * @param saved Indica si la instantánea se guardó correctamente.
+ * @param lsn LSN incluido en la instantánea.
+ * @param pauseMillis Pausa que causó el inicio de la compactación.
+ * @param started Momento en que empezó la compactación.
+ * @author fabian
+ */
+void Compactor::finish(const bool saved, const uint64_t lsn, const double pauseMillis,
+                       const chrono::steady_clock::time_point started) {
+    double truncatePauseMillis = 0;
+    uint64_t discarded = 0;
+    bool truncated = saved;
+    if (saved) {
+        try {
+            discarded = this->log.truncateThrough(lsn, &truncatePauseMillis);
+        } catch (const exception&) {
+            truncated = false;
+        }
+    }
+
+    {
+        lock_guard guard(this->statsLock);
+        if (truncated) {
+            ++this->stats.compactions;
+            this->stats.lastSnapshotLsn = lsn;
+            this->stats.lastBytesDiscarded = discarded;
+        } else {
+            ++this->stats.failures;
+        }
+        this->stats.lastPauseMillis = pauseMillis;
+        this->stats.maxPauseMillis = max(this->stats.maxPauseMillis, pauseMillis);
+        this->stats.lastTruncatePauseMillis = truncatePauseMillis;
+        this->stats.maxTruncatePauseMillis = max(this->stats.maxTruncatePauseMillis, truncatePauseMillis);
+        this->stats.lastDurationMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - started).count();
+    }
+    this->running = false;
+}
+
+/**
+ * @brief Espera a que termine la compactación en curso, si hay una.
+ * @author fabian
+ */
+void Compactor::wait() {
+    if (this->finisher.joinable()) this->finisher.join();
+}
+
+/**
+ * @brief Indica si hay una compactación en curso.
+ *
+ * @return true si hay una compactación en curso.
+ * @author fabian
+ */
+bool Compactor::isRunning() const { return this->running; }
+
+/**
+ * @brief Obtiene las estadísticas de las compactaciones hechas hasta ahora.
+ *
+ * @return Copia de las estadísticas.
+ * @author fabian
+ */
+CompactionStats Compactor::getStats() {
+    lock_guard guard(this->statsLock);
+    return this->stats;
+}
@@ -0,0 +1,80 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef COMPACTOR_H
+#define COMPACTOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Operations.h"
+#include "../Storage/Snapshot.h"
+
+/**
+ * @brief Estadísticas de las compactaciones hechas por un Compactor.
+ */
+struct CompactionStats {
+    uint64_t compactions = 0;
+    uint64_t failures = 0;
+    double lastPauseMillis = 0;
+    double maxPauseMillis = 0;
+    double lastTruncatePauseMillis = 0;
+    double maxTruncatePauseMillis = 0;
+    double lastDurationMillis = 0;
+    uint64_t lastSnapshotLsn = 0;
+    uint64_t lastBytesDiscarded = 0;
+};
+
+/**
+ * @brief Compactador en segundo plano: guarda una instantánea nueva y descarta la parte vieja del registro.
+ *
+ * En sistemas POSIX toma una vista consistente de `people` y `taskTypes` con `fork()`: el proceso hijo ve una
+ * copia congelada de la memoria (copia en escritura) y escribe la instantánea con un límite de bytes por segundo,
+ * mientras el proceso principal sigue aceptando cambios. La única pausa del proceso principal es la copia de las
+ * tablas de páginas que hace `fork()` y, al terminar, el recorte del registro. En Windows, y cuando las tareas
+ * completadas están en el árbol en disco (`completedTaskTree`), la instantánea se guarda en el mismo hilo, por lo
+ * que la pausa dura toda la escritura: el proceso hijo leería páginas del archivo del árbol que el padre sigue
+ * modificando.
+ *
+ * `maybeStart()` y `start()` deben llamarse desde el hilo que aplica las mutaciones, entre una mutación y otra; si
+ * varios hilos aplican mutaciones en listas distintas, con todos detenidos entre un lote y otro y recibiendo todas
+ * las listas (ver MutationQueue).
+ */
+class Compactor {
+public:
+    Compactor(const string& snapshotPath, MutationLog& log, uint64_t thresholdBytes, uint64_t bytesPerSecond);
+    ~Compactor();
+
+    Compactor(const Compactor&) = delete;
+    Compactor& operator=(const Compactor&) = delete;
+
+    bool maybeStart(const vector<const PersonList*>& lists = {});
+    bool start(const vector<const PersonList*>& lists = {});
+    void wait();
+
+    [[nodiscard]] bool isDue() const;
+    [[nodiscard]] bool isRunning() const;
+    [[nodiscard]] CompactionStats getStats();
+
+private:
+    string snapshotPath;
+    MutationLog& log;
+    uint64_t thresholdBytes;
+    uint64_t bytesPerSecond;
+    atomic<bool> running{false};
+    thread finisher;
+    mutex statsLock;
+    CompactionStats stats;
+
+    void finish(bool saved, uint64_t lsn, double pauseMillis, chrono::steady_clock::time_point started);
+};
+
+extern Compactor* compactor;
+
+#include "Compactor.cpp"
+#endif //COMPACTOR_H
@@ -0,0 +1,161 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "LogReplica.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Constructor de la clase LogReplica. Publica la primera versión con los datos cargados.
+ *
+ * @param snapshotPath Ruta de la instantánea del primario; su registro es `snapshotPath.wal`.
+ * @param snapshotLsn LSN de la última mutación incluida en los datos cargados.
+ * @param pool Pool de hilos con el que se recarga la instantánea.
+ * @param pollMillis Milisegundos entre lecturas del registro cuando no hay mutaciones nuevas.
+ * @author fabian
+ */
+LogReplica::LogReplica(const string& snapshotPath, const uint64_t snapshotLsn, ThreadPool& pool, const int pollMillis)
+    : snapshotPath(snapshotPath), pool(pool), pollMillis(pollMillis), tailer(snapshotPath + ".wal"),
+      versions(make_unique<VersionedPeople>(people, taskTypes)), appliedLsn(snapshotLsn),
+      caughtUpAt(chrono::steady_clock::now()) {
+    this->status.appliedLsn = snapshotLsn;
+    this->status.logLsn = snapshotLsn;
+}
+
+/**
+ * @brief Destructor de la clase LogReplica. Detiene al seguidor, suelta las versiones y libera los tipos de tarea
+ * retirados.
+ * @author fabian
+ */
+LogReplica::~LogReplica() {
+    stop();
+    this->versions.reset();
+    for (const TaskType* type : this->retiredTaskTypes) delete type;
+}
+
+/**
+ * @brief Inicia el hilo seguidor.
+ * @author fabian
+ */
+void LogReplica::start() {
+    if (this->follower.joinable()) return;
+    this->stopping = false;
+    this->follower = thread(&LogReplica::follow, this);
+}
+
+/**
+ * @brief Detiene el hilo seguidor y espera a que termine; los datos quedan en la última versión publicada.
+ * @author fabian
+ */
+void LogReplica::stop() {
+    this->stopping = true;
+    if (this->follower.joinable()) this->follower.join();
+}
+
+/**
+ * @brief Fija la versión publicada más reciente para leerla.
+ *
+ * @return La versión; sus personas siguen vivas y sin cambios mientras se tenga el puntero.
+ * @author fabian
+ */
+shared_ptr<const PeopleVersion> LogReplica::pin() {
+    return this->versions->pin();
+}
+
+/**
+ * @brief Obtiene el estado de la réplica.
+ *
+ * @return LSN aplicado, último LSN visto en el registro, retraso, recargas de la instantánea y el último error.
+ * @author fabian
+ */
+ReplicaStatus LogReplica::getStatus() {
+    lock_guard guard(this->statusLock);
+    ReplicaStatus current = this->status;
+    current.lagMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - this->caughtUpAt).count();
+    return current;
+}
+
+/**
+ * @brief Ciclo del hilo seguidor: aplica lo nuevo del registro, publica y espera si no había nada.
+ *
+ * Si una mutación no se puede aplicar, la réplica anota el error y vuelve a intentarlo en la siguiente lectura;
+ * las lecturas siguen viendo la última versión publicada.
+ *
+ * @author fabian
+ */
+void LogReplica::follow() {
+    peopleVersions = this->versions.get();
+    while (!this->stopping) {
+        const auto polled = chrono::steady_clock::now();
+        LogTailResult result;
+        string error;
+        try {
+            result = this->tailer.poll(this->appliedLsn, applyMutation);
+            if (result.gap) reload();
+        } catch (const exception& exception) {
+            error = exception.what();
+        }
+        this->versions->publish();
+
+        {
+            lock_guard guard(this->statusLock);
+            this->status.appliedLsn = this->appliedLsn;
+            this->status.logLsn = max(result.lastLsn, this->appliedLsn);
+            this->status.error = error;
+            if (error.empty() && !result.gap && this->appliedLsn >= result.lastLsn) this->caughtUpAt = polled;
+        }
+        if (result.applied == 0 && !result.gap) this_thread::sleep_for(chrono::milliseconds(this->pollMillis));
+    }
+    peopleVersions = nullptr;
+}
+
+/**
+ * @brief Reemplaza los datos por los de la instantánea actual del primario.
+ *
+ * Se llama desde el hilo seguidor cuando faltan mutaciones en el registro; la instantánea, que el primario guarda
+ * antes de descartarlas, ya las incluye.
+ *
+ * @throws runtime_error Si la instantánea no se puede cargar o no incluye las mutaciones que faltan.
+ * @author fabian
+ */
+void LogReplica::reload() {
+    PersonList loadedPeople;
+    TaskTypeList loadedTypes;
+    SnapshotSummary summary;
+    try {
+        summary = loadSnapshot(this->snapshotPath, loadedPeople, loadedTypes, this->pool);
+        if (summary.lastLsn <= this->appliedLsn) {
+            throw runtime_error("La instantanea no incluye las mutaciones que faltan");
+        }
+    } catch (...) {
+        while (loadedPeople.head) destroyPerson(loadedPeople.remove(loadedPeople.head->id));
+        TaskType* type = loadedTypes.head;
+        for (int i = 0; i < loadedTypes.getLength(); i++) {
+            TaskType* next = type->next;
+            delete type;
+            type = next;
+        }
+        throw;
+    }
+
+    while (people.head) deletePerson(people.head->id);
+    TaskType* type = taskTypes.head;
+    for (int i = 0; i < taskTypes.getLength(); i++) {
+        this->retiredTaskTypes.push_back(type);
+        type = type->next;
+    }
+    taskTypes = loadedTypes;
+
+    while (loadedPeople.head) {
+        Person* person = loadedPeople.remove(loadedPeople.head->id);
+        people.adopt(person);
+        this->versions->markChanged(person->id);
+    }
+    this->versions->markTaskTypesChanged();
+    this->appliedLsn = summary.lastLsn;
+
+    lock_guard guard(this->statusLock);
+    this->status.reloads++;
+}
@@ -0,0 +1,86 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef LOGREPLICA_H
+#define LOGREPLICA_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Operations.h"
+#include "../Lists/VersionedPeople.h"
+#include "../Storage/LogTailer.h"
+#include "../Storage/Snapshot.h"
+
+/**
+ * @brief Estado de una réplica de lectura.
+ */
+struct ReplicaStatus {
+    uint64_t appliedLsn = 0;
+    uint64_t logLsn = 0;
+    double lagMillis = 0;
+    uint64_t reloads = 0;
+    string error;
+};
+
+/**
+ * @brief Réplica de lectura: sigue el registro de mutaciones de otro proceso y publica versiones de sus datos.
+ *
+ * Parte de los datos de la instantánea del primario, ya cargados en `people` y `taskTypes`. Un hilo seguidor lee
+ * cada `pollMillis` lo que el primario agregó al registro (ver `LogTailer`), lo aplica con las mismas operaciones
+ * que la recuperación y publica una versión nueva (ver `VersionedPeople`), que los lectores fijan con `pin()`. La
+ * réplica nunca escribe el registro ni la instantánea.
+ *
+ * Si el primario compactó el registro y descartó mutaciones que la réplica no había aplicado, la réplica vuelve a
+ * cargar la instantánea: retira todas sus personas, que se liberan cuando los lectores sueltan las versiones que
+ * las tienen, y conserva los tipos de tarea viejos hasta destruirse, porque esas versiones los siguen usando.
+ *
+ * El retraso (`ReplicaStatus::lagMillis`) es el tiempo desde la última vez que la réplica tenía aplicado todo lo
+ * que el primario había escrito en el registro: los datos que sirve son al menos así de recientes.
+ */
+class LogReplica {
+public:
+    static constexpr int DEFAULT_POLL_MILLIS = 5;
+
+    LogReplica(const string& snapshotPath, uint64_t snapshotLsn, ThreadPool& pool,
+               int pollMillis = DEFAULT_POLL_MILLIS);
+    ~LogReplica();
+
+    LogReplica(const LogReplica&) = delete;
+    LogReplica& operator=(const LogReplica&) = delete;
+
+    void start();
+    void stop();
+
+    [[nodiscard]] shared_ptr<const PeopleVersion> pin();
+    [[nodiscard]] ReplicaStatus getStatus();
+
+private:
+    string snapshotPath;
+    ThreadPool& pool;
+    int pollMillis;
+    LogTailer tailer;
+    unique_ptr<VersionedPeople> versions;
+    vector<TaskType*> retiredTaskTypes;
+    uint64_t appliedLsn;
+
+    thread follower;
+    atomic<bool> stopping{false};
+
+    mutex statusLock;
+    ReplicaStatus status;
+    chrono::steady_clock::time_point caughtUpAt;
+
+    void follow();
+    void reload();
+};
+
+#include "LogReplica.cpp"
+#endif //LOGREPLICA_H
@@ -0,0 +1,215 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "MutationQueue.h"
+
+#include <chrono>
+#include <vector>
+
+/**
+ * @brief Constructor de la clase MutationQueue. Inicia el hilo escritor.
+ *
+ * @param apply Función que aplica una mutación, llena la respuesta y lanza una excepción si falla. Solo se llama
+ * desde el hilo escritor.
+ * @param options Lista que modifica el escritor, sus versiones, el candado de los lotes y la capacidad.
+ * @author fabian
+ */
+MutationQueue::MutationQueue(Applier apply, const MutationQueueOptions& options)
+    : apply(std::move(apply)), options(options), ring(options.capacity),
+      spinAttempts(thread::hardware_concurrency() > 1 ? SPIN_ATTEMPTS : 0) {
+    this->writer = thread(&MutationQueue::writerLoop, this);
+}
+
+/**
+ * @brief Destructor de la clase MutationQueue. Detiene el escritor si sigue activo.
+ * @author fabian
+ */
+MutationQueue::~MutationQueue() {
+    stop();
+}
+
+/**
+ * @brief Espera a que el escritor aplique los comandos encolados y lo detiene.
+ *
+ * Ningún productor debe seguir encolando comandos.
+ *
+ * @author fabian
+ */
+void MutationQueue::stop() {
+    this->stopping.store(true);
+    wakeWriter();
+    if (this->writer.joinable()) this->writer.join();
+}
+
+/**
+ * @brief Encola una mutación.
+ *
+ * @param type Tipo de la mutación, tal como lo entiende la función `apply`.
+ * @param payload Campos de la mutación.
+ * @return Futuro con el resultado, listo cuando la mutación está aplicada y sincronizada.
+ * @author fabian
+ */
+future<MutationResult> MutationQueue::submit(const uint8_t type, string payload) {
+    auto* command = new Command;
+    command->type = type;
+    command->payload = std::move(payload);
+    future<MutationResult> result = command->result.get_future();
+    push(command);
+    return result;
+}
+
+/**
+ * @brief Encola una mutación y entrega su resultado a una función.
+ *
+ * @param type Tipo de la mutación, tal como lo entiende la función `apply`.
+ * @param payload Campos de la mutación.
+ * @param callback Función que recibe el resultado; se llama desde el hilo escritor y no debe bloquearse.
+ * @author fabian
+ */
+void MutationQueue::submit(const uint8_t type, string payload, Callback callback) {
+    auto* command = new Command;
+    command->type = type;
+    command->payload = std::move(payload);
+    command->callback = std::move(callback);
+    push(command);
+}
+
+/**
+ * @brief Obtiene las estadísticas de la cola.
+ *
+ * @return Comandos aplicados, lotes, comandos con error y veces que un productor encontró la cola llena.
+ * @author fabian
+ */
+MutationQueueStats MutationQueue::getStats() const {
+    return {this->commands.load(), this->batches.load(), this->errors.load(), this->fullWaits.load()};
+}
+
+/**
+ * @brief Pone un comando en la cola, esperando si está llena, y despierta al escritor si está dormido.
+ *
+ * @param command Comando a encolar; el escritor lo libera.
+ * @author fabian
+ */
+void MutationQueue::push(Command* command) {
+    if (!this->ring.tryPush(command)) {
+        this->fullWaits.fetch_add(1, memory_order_relaxed);
+        for (int attempt = 0; !this->ring.tryPush(command); attempt++) {
+            if (attempt < 64) this_thread::yield();
+            else this_thread::sleep_for(chrono::microseconds(50));
+        }
+    }
+    atomic_thread_fence(memory_order_seq_cst);
+    if (this->waiting.load(memory_order_relaxed)) wakeWriter();
+}
+
+/**
+ * @brief Despierta al escritor si está esperando comandos.
+ * @author fabian
+ */
+void MutationQueue::wakeWriter() {
+    this->signal.fetch_add(1, memory_order_release);
+    this->signal.notify_one();
+}
+
+/**
+ * @brief Ciclo del hilo escritor: aplica los comandos encolados por lotes hasta que se detenga la cola.
+ *
+ * Con la cola vacía y más de un núcleo revisa otra vez `SPIN_ATTEMPTS` veces antes de dormirse, porque despertarlo
+ * cuesta una llamada al sistema por comando. Antes de dormirse anuncia que espera y vuelve a revisar la cola; un
+ * productor que encola después revisa el anuncio, así que ningún comando se queda esperando con el escritor dormido.
+ * Al iniciar, el hilo toma la lista y las versiones de `options` como `activePeople` y `peopleVersions`.
+ *
+ * Si la sincronización de un lote falla, sus cambios ya están en la lista pero no en el disco: el escritor no
+ * publica esa versión, responde con error a los comandos del lote que se habían aplicado y, desde entonces, responde
+ * con el mismo error a todos los comandos sin aplicarlos, así que ningún lector ve un cambio que se informó como
+ * fallido. Después de responder, si toca compactar, toma `batchLock` en modo exclusivo, así que los escritores que
+ * comparten el candado quedan detenidos entre un lote y otro mientras se toma la vista de la compactación; una
+ * compactación que no se pudo iniciar no afecta las respuestas, porque el lote ya es durable.
+ *
+ * @author fabian
+ */
+void MutationQueue::writerLoop() {
+    activePeople = this->options.people;
+    peopleVersions = this->options.versions;
+    vector<Command*> batch;
+    vector<MutationResult> results;
+    string failure;
+    vector<const PersonList*> snapshotPeople = this->options.snapshotPeople;
+    if (snapshotPeople.empty()) snapshotPeople.push_back(this->options.people);
+    while (true) {
+        Command* command;
+        while (batch.size() < MAX_BATCH && this->ring.tryPop(command)) batch.push_back(command);
+
+        if (batch.empty()) {
+            if (this->stopping.load()) return;
+            for (int spin = 0; spin < this->spinAttempts && batch.empty(); spin++) {
+                if (this->ring.tryPop(command)) batch.push_back(command);
+            }
+            if (!batch.empty()) continue;
+            const uint32_t seen = this->signal.load(memory_order_acquire);
+            this->waiting.store(true, memory_order_relaxed);
+            atomic_thread_fence(memory_order_seq_cst);
+            if (this->ring.tryPop(command)) {
+                batch.push_back(command);
+            } else if (!this->stopping.load()) {
+                this->signal.wait(seen, memory_order_acquire);
+            }
+            this->waiting.store(false, memory_order_relaxed);
+            continue;
+        }
+
+        results.assign(batch.size(), MutationResult());
+        if (!failure.empty()) {
+            for (MutationResult& result : results) result.error = failure;
+        } else {
+            shared_lock<shared_mutex> guard;
+            if (this->options.batchLock) guard = shared_lock(*this->options.batchLock);
+            for (size_t i = 0; i < batch.size(); i++) {
+                LogPayloadWriter response;
+                try {
+                    this->apply(batch[i]->type, batch[i]->payload, response);
+                    results[i].ok = true;
+                    results[i].response = std::move(response.bytes);
+                } catch (const exception& error) {
+                    results[i].error = error.what();
+                }
+            }
+
+            try {
+                commitMutations();
+            } catch (const exception& error) {
+                failure = string("Registro de mutaciones no disponible, el escritor se detuvo: ") + error.what();
+            }
+            if (failure.empty()) {
+                if (this->options.versions) this->options.versions->publish();
+            } else {
+                for (MutationResult& result : results) {
+                    if (result.ok) result = MutationResult{false, {}, failure};
+                }
+            }
+        }
+
+        uint64_t failed = 0;
+        for (size_t i = 0; i < batch.size(); i++) {
+            if (!results[i].ok) failed++;
+            if (batch[i]->callback) batch[i]->callback(std::move(results[i]));
+            else batch[i]->result.set_value(std::move(results[i]));
+            delete batch[i];
+        }
+        this->commands.fetch_add(batch.size(), memory_order_relaxed);
+        this->batches.fetch_add(1, memory_order_relaxed);
+        this->errors.fetch_add(failed, memory_order_relaxed);
+        batch.clear();
+
+        if (failure.empty() && compactor && this->options.compact && compactor->isDue()) {
+            try {
+                unique_lock<shared_mutex> guard;
+                if (this->options.batchLock) guard = unique_lock(*this->options.batchLock);
+                compactor->maybeStart(snapshotPeople);
+            } catch (const exception&) {
+                // La compactación se vuelve a intentar después de otro lote; el lote ya es durable.
+            }
+        }
+    }
+}
@@ -0,0 +1,123 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef MUTATIONQUEUE_H
+#define MUTATIONQUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Compactor.h"
+#include "Operations.h"
+#include "../Lists/VersionedPeople.h"
+#include "../utils/MpscRing.h"
+
+/**
+ * @brief Resultado de una mutación aplicada por una MutationQueue.
+ */
+struct MutationResult {
+    bool ok = false;
+    string response;
+    string error;
+};
+
+/**
+ * @brief Estadísticas de una MutationQueue.
+ */
+struct MutationQueueStats {
+    uint64_t commands = 0;
+    uint64_t batches = 0;
+    uint64_t errors = 0;
+    uint64_t fullWaits = 0;
+};
+
+/**
+ * @brief Lista que modifica el hilo escritor de una MutationQueue y qué hace después de cada lote.
+ */
+struct MutationQueueOptions {
+    /** Lista de personas que modifica el escritor; las operaciones la usan como `activePeople`. */
+    PersonList* people = &::people;
+    /** Versiones de esa lista que el escritor publica después de cada lote, o nullptr. */
+    VersionedPeople* versions = nullptr;
+    /** Candado que el escritor toma en modo compartido durante cada lote, o nullptr. */
+    shared_mutex* batchLock = nullptr;
+    /** Si el escritor inicia las compactaciones del registro de mutaciones. */
+    bool compact = true;
+    /** Listas de los escritores que comparten `batchLock`, para compactar; vacío para usar solo `people`. */
+    vector<const PersonList*> snapshotPeople;
+    /** Cantidad de comandos que pueden esperar en la cola. */
+    size_t capacity = 4096;
+};
+
+/**
+ * @brief Cola de mutaciones de varios productores hacia un único hilo escritor, sin candado global.
+ *
+ * Los productores (clientes del servidor, importadores) encolan comandos en una `MpscRing` y reciben el resultado
+ * por un `future` o una función de respuesta. El hilo escritor es el único que modifica su lista de personas (ver
+ * `MutationQueueOptions`): saca todos los comandos disponibles, hasta `MAX_BATCH`, los aplica en orden con la
+ * función `apply`, sincroniza el lote con el registro de mutaciones, publica una versión nueva si tiene versiones,
+ * responde e inicia una compactación si toca. Si la sincronización falla, el lote no se publica y el
+ * escritor se detiene: los comandos del lote y todos los siguientes responden con ese error. Cuando la cola está
+ * vacía el escritor duerme hasta que un productor lo despierte; cuando está llena los productores esperan a que se
+ * libere una casilla.
+ */
+class MutationQueue {
+public:
+    using Applier = function<void(uint8_t type, string_view payload, LogPayloadWriter& response)>;
+    using Callback = function<void(MutationResult&& result)>;
+
+    static constexpr size_t MAX_BATCH = 1024;
+    static constexpr int SPIN_ATTEMPTS = 4096;
+
+    explicit MutationQueue(Applier apply, const MutationQueueOptions& options = {});
+    ~MutationQueue();
+
+    MutationQueue(const MutationQueue&) = delete;
+    MutationQueue& operator=(const MutationQueue&) = delete;
+
+    future<MutationResult> submit(uint8_t type, string payload);
+    void submit(uint8_t type, string payload, Callback callback);
+    void stop();
+
+    [[nodiscard]] MutationQueueStats getStats() const;
+
+private:
+    /**
+     * @brief Comando encolado: la mutación y a quién entregarle su resultado.
+     */
+    struct Command {
+        uint8_t type = 0;
+        string payload;
+        promise<MutationResult> result;
+        Callback callback;
+    };
+
+    Applier apply;
+    MutationQueueOptions options;
+    MpscRing<Command*> ring;
+    int spinAttempts;
+    atomic<uint32_t> signal{0};
+    atomic<bool> waiting{false};
+    atomic<bool> stopping{false};
+    thread writer;
+
+    atomic<uint64_t> commands{0};
+    atomic<uint64_t> batches{0};
+    atomic<uint64_t> errors{0};
+    atomic<uint64_t> fullWaits{0};
+
+    void push(Command* command);
+    void wakeWriter();
+    void writerLoop();
+};
+
+#include "MutationQueue.cpp"
+#endif //MUTATIONQUEUE_H
@@ -0,0 +1,1157 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "Operations.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "../Lists/VersionedPeople.h"
+
+PersonList people = PersonList();
+TaskTypeList taskTypes = TaskTypeList();
+MutationLog* mutationLog = nullptr;
+
+/**
+ * @brief Lista de personas que modifican las operaciones en este hilo: `people`, salvo en el hilo escritor de un
+ * fragmento de `ShardedEngine`, que modifica la lista de su fragmento.
+ */
+thread_local PersonList* activePeople = &people;
+
+/**
+ * @brief Handles de las tareas activas y de sus subtareas. Se entregan al pedirlos con `getTaskHandle` y
+ * `getSubTaskHandle`, siguen a la tarea cuando se copia una persona publicada y dejan de ser válidos cuando la
+ * tarea se completa o se elimina.
+ */
+SlotMap<Task> taskHandles;
+SlotMap<SubTask> subTaskHandles;
+
+/**
+ * @brief LSN de la última mutación que agregó este hilo al registro; `commitMutations()` espera hasta él.
+ */
+thread_local uint64_t lastMutationLsn = 0;
+
+/**
+ * @brief Agrega una mutación ya aplicada al registro de mutaciones, si hay uno abierto.
+ *
+ * @param type Tipo de la mutación.
+ * @param payload Contenido de la mutación.
+ * @author fabian
+ */
+static void logMutation(const MutationType type, const LogPayloadWriter& payload) {
+    if (!mutationLog) return;
+    lastMutationLsn = mutationLog->append(static_cast<uint8_t>(type), payload.bytes);
+}
+
+/**
+ * @brief Registra una tarea agregada a una persona.
+ *
+ * @param personId Identificador de la persona.
+ * @param task Tarea agregada.
+ * @param completed Indica si se agregó a las tareas completadas.
+ * @author fabian
+ */
+static void logAddTask(const int personId, const Task* task, const bool completed) {
+    if (!mutationLog) return;
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    payload.byte(completed);
+    payload.integer(task->type->id);
+    payload.text(task->description);
+    payload.text(task->importance);
+    payload.date(task->date);
+    payload.time(task->time);
+    logMutation(MutationType::AddTask, payload);
+}
+
+/**
+ * @brief Busca un tipo de tarea por su ID en la lista circular de tipos.
+ *
+ * @param id Identificador del tipo.
+ * @return El tipo de tarea.
+ * @throws runtime_error Si el tipo no existe.
+ * @author fabian
+ */
+static TaskType* findTaskType(const int id) {
+    TaskType* current = taskTypes.head;
+    if (current) {
+        do {
+            if (current->id == id) return current;
+            current = current->next;
+        } while (current != taskTypes.head);
+    }
+    throw runtime_error("Tipo de tarea no encontrado");
+}
+
+/**
+ * @brief Agrega un nuevo tipo de tarea.
+ *
+ * @param name Nombre del tipo.
+ * @param description Descripción del tipo.
+ * @author fabian
+ */
+void addTaskType(const string& name, const string& description) {
+    taskTypes.insert(name, description);
+
+    LogPayloadWriter payload;
+    payload.text(name);
+    payload.text(description);
+    if (peopleVersions) peopleVersions->markTaskTypesChanged();
+    logMutation(MutationType::AddTaskType, payload);
+}
+
+/**
+ * @brief Agrega una nueva persona.
+ *
+ * @param id Cédula de la persona.
+ * @param name Nombre de la persona.
+ * @param lastname Apellido de la persona.
+ * @param age Edad de la persona.
+ * @throws runtime_error Si ya existe una persona con esa cédula.
+ * @author fabian
+ */
+void addPerson(const int id, const string& name, const string& lastname, const int age) {
+    try {
+        activePeople->insert(id, name, lastname, age);
+    } catch (const runtime_error&) {
+        throw;
+    } catch (const exception&) {
+        throw runtime_error("Cedula repetida");
+    }
+    if (peopleVersions) peopleVersions->markChanged(id);
+
+    LogPayloadWriter payload;
+    payload.integer(id);
+    payload.text(name);
+    payload.text(lastname);
+    payload.integer(age);
+    logMutation(MutationType::AddPerson, payload);
+}
+
+/**
+ * @brief Elimina una persona junto con todas sus tareas.
+ *
+ * Si la persona está en una versión publicada, solo se quita de la lista y queda retirada: la libera la última
+ * versión que la suelte. Los handles de sus tareas dejan de ser válidos enseguida.
+ *
+ * @param personId Cédula de la persona.
+ * @throws runtime_error Si la persona no se encuentra.
+ * @author fabian
+ */
+void deletePerson(const int personId) {
+    Person* person = activePeople->removeById(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    if (peopleVersions) peopleVersions->markChanged(personId);
+    if (peopleVersions && person->published) {
+        person->retired = true;
+        for (const Task* task = person->activeTasks.head; task; task = task->next) {
+            for (const SubTask* subTask = task->subTasks.head; subTask; subTask = subTask->next) {
+                subTaskHandles.erase(subTask);
+            }
+            taskHandles.erase(task);
+        }
+    } else {
+        destroyPerson(person);
+    }
+
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    logMutation(MutationType::DeletePerson, payload);
+}
+
+/**
+ * @brief Libera una tarea junto con sus subtareas, invalidando sus handles.
+ *
+ * @param task Tarea a liberar.
+ * @author fabian
+ */
+static void destroyTask(Task* task) {
+    while (SubTask* subTask = task->subTasks.head) {
+        task->subTasks.head = subTask->next;
+        subTaskHandles.erase(subTask);
+        delete subTask;
+    }
+    taskHandles.erase(task);
+    delete task;
+}
+
+/**
+ * @brief Copia una tarea activa junto con sus subtareas, sin enlazarla a ninguna lista. Los handles de la tarea y
+ * de sus subtareas pasan a la copia.
+ *
+ * @param task Tarea a copiar.
+ * @return La copia.
+ * @author fabian
+ */
+static Task* copyTask(const Task& task) {
+    auto* copy = new Task(task);
+    copy->next = nullptr;
+    copy->subTasks = List<SubTask>();
+    SubTask* last = nullptr;
+    for (const SubTask* subTask = task.subTasks.head; subTask; subTask = subTask->next) {
+        auto* subTaskCopy = new SubTask(*subTask);
+        last = copy->subTasks.insertAfter(last, subTaskCopy);
+        subTaskHandles.rebind(subTaskCopy);
+    }
+    taskHandles.rebind(copy);
+    return copy;
+}
+
+/**
+ * @brief Busca una persona para modificarla.
+ *
+ * Si hay versiones publicadas y la persona está en alguna, no se modifica: se copia (las tareas activas una por
+ * una y el archivo compartiendo sus bloques), la copia la reemplaza en la lista y la original queda retirada hasta
+ * que la suelte la última versión que la tiene.
+ *
+ * @param personId Cédula de la persona.
+ * @return La persona que se puede modificar, o nullptr si no se encuentra.
+ * @author fabian
+ */
+static Person* findPersonForUpdate(const int personId) {
+    Person* person = activePeople->findById(personId);
+    if (!person || !peopleVersions) return person;
+    peopleVersions->markChanged(personId);
+    if (!person->published) return person;
+
+    auto* copy = new Person(*person);
+    copy->published = false;
+    copy->activeTasks = TaskList();
+    Task* last = nullptr;
+    for (const Task* task = person->activeTasks.head; task; task = task->next) {
+        last = copy->activeTasks.insertAfter(last, copyTask(*task));
+    }
+    activePeople->replace(person, copy);
+    person->retired = true;
+    return copy;
+}
+
+/**
+ * @brief Agrega una tarea activa a una persona.
+ *
+ * Busca a la persona por su ID y agrega una tarea a su lista de tareas activas o a su archivo de tareas
+ * completadas. Las tareas completadas se comprimen en el archivo y la tarea recibida se libera.
+ *
+ * @param personId Identificador de la persona a la que se le agregará la tarea.
+ * @param task Puntero a la tarea que se va a agregar.
+ * @param completed Define si la tarea está completada o no
+ * @return El ID asignado a la tarea.
+ * @throws runtime_error Si la persona no se encuentra.
+ * @author fabian
+ */
+int addTask(const int personId, Task* task, const bool completed) {
+    Person* person = findPersonForUpdate(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+
+    if (completed) {
+        task->id = person->completedTasks.getLastId() + 1;
+        person->completedTasks.append(*task);
+        logAddTask(personId, task, completed);
+        const int id = task->id;
+        destroyTask(task);
+        return id;
+    }
+
+    Task* lastTask = person->activeTasks.getLast();
+    task->id = lastTask ? lastTask->id + 1 : 1;
+    person->activeTasks.insertAfter(lastTask, task);
+    logAddTask(personId, task, completed);
+    return task->id;
+}
+
+/**
+ * @brief Enlaza tareas al final de la lista de tareas activas o completadas de una persona ya buscada, con IDs
+ * consecutivos, y registra cada una. Las completadas se comprimen en el archivo y se liberan.
+ *
+ * @param person Persona que se puede modificar.
+ * @param first Primera tarea a agregar.
+ * @param last Posición siguiente a la última tarea a agregar.
+ * @param completed Define si las tareas están completadas o no.
+ * @author fabian
+ */
+static void appendTasks(Person* person, Task* const* first, Task* const* last, const bool completed) {
+    if (completed) {
+        int nextId = person->completedTasks.getLastId() + 1;
+        for (; first != last; ++first) {
+            Task* task = *first;
+            task->id = nextId++;
+            person->completedTasks.append(*task);
+            logAddTask(person->id, task, completed);
+            destroyTask(task);
+        }
+        return;
+    }
+
+    Task* lastTask = person->activeTasks.getLast();
+    int nextId = lastTask ? lastTask->id + 1 : 1;
+    for (; first != last; ++first) {
+        Task* task = *first;
+        task->id = nextId++;
+        lastTask = person->activeTasks.insertAfter(lastTask, task);
+        logAddTask(person->id, task, completed);
+    }
+}
+
+/**
+ * @brief Agrega varias tareas al final de la lista de tareas activas o completadas de una persona.
+ *
+ * Equivale a llamar a `addTask` con cada tarea en orden, pero recorre la lista una sola vez: busca el final,
+ * asigna los IDs consecutivos y enlaza las tareas detrás del último nodo. Las tareas completadas se comprimen en
+ * el archivo de la persona y se liberan.
+ *
+ * @param personId Identificador de la persona.
+ * @param newTasks Tareas a agregar, en el orden en que deben quedar.
+ * @param completed Define si las tareas están completadas o no.
+ * @throws runtime_error Si la persona no se encuentra; en ese caso no se agrega ninguna tarea.
+ * @author fabian
+ */
+void addTasks(const int personId, const vector<Task*>& newTasks, const bool completed) {
+    Person* person = findPersonForUpdate(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    appendTasks(person, newTasks.data(), newTasks.data() + newTasks.size(), completed);
+}
+
+/**
+ * @brief Clave de orden de una tarea por su fecha y hora de vencimiento.
+ *
+ * @param task Tarea.
+ * @return Clave que ordena como la fecha y la hora de la tarea.
+ * @author fabian
+ */
+static uint64_t dueKey(const Task& task) {
+    const uint64_t day = (static_cast<uint64_t>(task.date.tm_year + 1900) * 16 + task.date.tm_mon) * 32 +
+                         task.date.tm_mday;
+    const uint64_t second = task.time.tm_hour * 3600 + task.time.tm_min * 60 + task.time.tm_sec;
+    return day << 17 | second;
+}
+
+/**
+ * @brief Agrega muchas tareas de muchas personas de una sola vez, por ejemplo al cargar o importar datos.
+ *
+ * Agrupa las tareas por persona con una sola pasada sobre una tabla hash, ordena cada grupo por lista (activas
+ * antes que completadas) y por fecha y hora de vencimiento, conservando el orden recibido entre tareas que vencen
+ * a la vez, y agrega cada grupo a su persona como `addTasks`: busca a la persona una vez y enlaza todas sus tareas
+ * detrás de la última con IDs consecutivos. Así el costo es lineal en la cantidad de tareas más el orden de cada
+ * grupo, en lugar de una búsqueda de la persona y de su última tarea por cada tarea.
+ *
+ * @param records Tareas a agregar y sus personas.
+ * @return Las posiciones, en orden, de las tareas cuya persona no se encontró; esas tareas no se agregan ni se
+ *         liberan.
+ * @author fabian
+ */
+vector<size_t> addTaskBatch(const vector<TaskRecord>& records) {
+    unordered_map<int, uint32_t> groupOf;
+    vector<int> groupPerson;
+    vector<uint32_t> groupOfRecord(records.size());
+    for (size_t i = 0; i < records.size(); i++) {
+        const auto [found, inserted] = groupOf.try_emplace(records[i].personId, groupPerson.size());
+        if (inserted) groupPerson.push_back(records[i].personId);
+        groupOfRecord[i] = found->second;
+    }
+
+    // Se reparten las posiciones por grupo, conservando el orden recibido dentro de cada uno
+    vector<size_t> bounds(groupPerson.size() + 1);
+    for (const uint32_t group : groupOfRecord) bounds[group + 1]++;
+    for (size_t group = 0; group < groupPerson.size(); group++) bounds[group + 1] += bounds[group];
+    vector<size_t> order(records.size());
+    vector<size_t> next(bounds.begin(), bounds.end() - 1);
+    for (size_t i = 0; i < records.size(); i++) order[next[groupOfRecord[i]]++] = i;
+
+    vector<size_t> rejected;
+    vector<pair<uint64_t, size_t>> keyed;
+    vector<Task*> tasks;
+    for (size_t group = 0; group < groupPerson.size(); group++) {
+        Person* person = findPersonForUpdate(groupPerson[group]);
+        if (!person) {
+            rejected.insert(rejected.end(), order.begin() + static_cast<long>(bounds[group]),
+                            order.begin() + static_cast<long>(bounds[group + 1]));
+            continue;
+        }
+
+        keyed.clear();
+        for (size_t position = bounds[group]; position < bounds[group + 1]; position++) {
+            const TaskRecord& record = records[order[position]];
+            keyed.emplace_back(static_cast<uint64_t>(record.completed) << 63 | dueKey(*record.task), order[position]);
+        }
+        sort(keyed.begin(), keyed.end());
+        tasks.clear();
+        for (const auto& [key, index] : keyed) tasks.push_back(records[index].task);
+
+        const auto activeCount = count_if(keyed.begin(), keyed.end(), [](const pair<uint64_t, size_t>& entry) {
+            return entry.first >> 63 == 0;
+        });
+        Task** split = tasks.data() + activeCount;
+        appendTasks(person, tasks.data(), split, false);
+        appendTasks(person, split, tasks.data() + tasks.size(), true);
+    }
+    sort(rejected.begin(), rejected.end());
+    return rejected;
+}
+
+/**
+ * @brief Agrega una subtarea a una tarea específica de una persona.
+ *
+ * Busca a la persona y su tarea por ID e índice, respectivamente. Si la tarea es del tipo "Estudio",
+ * la subtarea se agrega a la lista de subtareas de la tarea. Si no, la subtarea se elimina.
+ *
+ * @param personId Identificador de la persona.
+ * @param taskIndex Índice de la tarea dentro de las tareas activas.
+ * @param subTask Puntero a la subtarea que se va a agregar.
+ * @throws runtime_error Si la persona o la tarea no se encuentran.
+ * @author fabian
+ */
+void addSubTask(const int personId, const int taskIndex, SubTask* subTask) {
+    Person* person = findPersonForUpdate(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    Task* task = person->activeTasks.get(taskIndex);
+    if (!task) throw runtime_error("Tarea no encontrada");
+
+    if (task->type->name != "Estudio") {
+        delete subTask;
+        return;
+    }
+    task->subTasks.insertLast(subTask);
+    task->countSubTask(*subTask);
+
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    payload.integer(taskIndex);
+    payload.text(subTask->name);
+    payload.text(subTask->comments);
+    payload.decimal(subTask->progress);
+    logMutation(MutationType::AddSubTask, payload);
+}
+
+/**
+ * @brief Cambia la fecha y hora de una tarea activa ya ubicada y actualiza el resumen de su bloque.
+ *
+ * @param person Persona dueña de la tarea, que se puede modificar.
+ * @param task Tarea a modificar.
+ * @param newDate Nueva fecha en formato "dd-mm-YYYY".
+ * @param newTime Nueva hora en formato "HH:MM:SS".
+ * @throws runtime_error Si la fecha o la hora no son válidas; en ese caso la tarea queda sin cambios.
+ * @author fabian
+ */
+static void reschedule(Person* person, Task* task, const string& newDate, const string& newTime) {
+    const tm oldDate = task->date;
+    const tm oldTime = task->time;
+    try {
+        task->setDate(newDate);
+        task->setTime(newTime);
+    } catch (...) {
+        task->date = oldDate;
+        task->time = oldTime;
+        throw;
+    }
+    person->activeTasks.refresh(task);
+}
+
+/**
+ * @brief Modifica la fecha y hora de una tarea activa de una persona.
+ *
+ * Busca la persona y la tarea por sus IDs y modifica la fecha y hora de la tarea.
+ *
+ * @param personId Identificador de la persona.
+ * @param taskIndex Identificador de la tarea.
+ * @param newDate Nueva fecha en formato "dd-mm-YYYY".
+ * @param newTime Nueva hora en formato "HH:MM:SS".
+ * @throws runtime_error Si la persona o la tarea no se encuentran, o si la fecha o la hora no son válidas; en ese
+ * caso la tarea queda sin cambios.
+ * @author fabian
+ */
+void modifyActiveTask(const int personId, const int taskIndex, const string& newDate, const string& newTime) {
+    Person* person = findPersonForUpdate(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    Task* task = person->activeTasks.get(taskIndex);
+    if (!task) throw runtime_error("Tarea no encontrada");
+    reschedule(person, task, newDate, newTime);
+
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    payload.integer(taskIndex);
+    payload.date(task->date);
+    payload.time(task->time);
+    logMutation(MutationType::ModifyActiveTask, payload);
+}
+
+/**
+ * @brief Mueve una tarea ya ubicada de la lista de tareas activas de una persona a su archivo de completadas, en
+ * tiempo constante, y la libera.
+ *
+ * @param person Persona dueña de la tarea.
+ * @param task Tarea a mover.
+ * @author fabian
+ */
+static void moveToCompleted(Person* person, Task* task) {
+    person->activeTasks.unlink(task);
+    person->completedTasks.append(*task);
+    destroyTask(task);
+}
+
+/**
+ * @brief Marca una tarea activa como completada y la comprime en el archivo de tareas completadas.
+ *
+ * Busca y elimina una tarea activa de una persona y la comprime en el archivo de tareas completadas.
+ *
+ * @param personId Identificador de la persona.
+ * @param taskId Identificador de la tarea.
+ * @throws runtime_error Si la persona o la tarea no se encuentran.
+ * @author fabian
+ */
+void completeTask(const int personId, const int taskId) {
+    Person* person = findPersonForUpdate(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    Task* task = person->activeTasks.findById(taskId);
+    if (!task) throw runtime_error("Tarea no encontrada");
+    moveToCompleted(person, task);
+
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    payload.integer(taskId);
+    logMutation(MutationType::CompleteTask, payload);
+}
+
+/**
+ * @brief Cambia el progreso de una subtarea ya ubicada, lo registra y, si con ella quedan completadas todas las
+ * subtareas de su tarea, mueve la tarea a las completadas. Los totales de la tarea evitan recorrer sus subtareas.
+ *
+ * Se registra como `UpdateSubTask`, que al reproducirse aplica la misma regla; los registros `CompleteSubTask` y
+ * `SubTaskProgress` de versiones anteriores se reproducen con la suya (ver `replayLegacySubTask`).
+ *
+ * @param person Persona dueña de la tarea, que se puede modificar.
+ * @param task Tarea de la subtarea.
+ * @param subTask Subtarea a modificar.
+ * @param subTaskIndex Índice de la subtarea dentro de la tarea, para el registro.
+ * @param newProgress Nuevo progreso de la subtarea (0-100).
+ * @author fabian
+ */
+static void setSubTaskProgress(Person* person, Task* task, SubTask* subTask, const int subTaskIndex,
+                               const float newProgress) {
+    const bool allCompleted = task->setSubTaskProgress(*subTask, newProgress);
+
+    LogPayloadWriter payload;
+    payload.integer(person->id);
+    payload.integer(task->id);
+    payload.integer(subTaskIndex);
+    payload.decimal(newProgress);
+    logMutation(MutationType::UpdateSubTask, payload);
+
+    if (allCompleted) moveToCompleted(person, task);
+}
+
+/**
+ * @brief Marca una subtarea de una tarea activa como completada.
+ *
+ * Busca la persona, la tarea y la subtarea por sus IDs y las marca como completadas. Si era la última subtarea
+ * pendiente, la tarea pasa a las completadas.
+ *
+ * @param personId Identificador de la persona.
+ * @param taskId Identificador de la tarea.
+ * @param subTaskIndex Índice de la subtarea dentro de la tarea.
+ * @throws runtime_error Si la persona, la tarea o la subtarea no se encuentran.
+ * @author fabian
+ */
+void completeSubTask(const int personId, const int taskId, const int subTaskIndex) {
+    Person* person = findPersonForUpdate(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    Task* task = person->activeTasks.findById(taskId);
+    if (!task) throw runtime_error("Tarea no encontrada");
+
+    SubTask* subTask = task->subTasks.get(subTaskIndex);
+    if (!subTask) throw runtime_error("Subtarea no encontrada");
+    setSubTaskProgress(person, task, subTask, subTaskIndex, 100);
+}
+
+/**
+ * @brief Modifica el progreso de una subtarea específica de una tarea activa de una persona.
+ *
+ * Busca la persona, la tarea y la subtarea por sus IDs e índice, respectivamente, y modifica el progreso de la subtarea.
+ * Si al completarla quedan completadas todas las subtareas, la tarea pasa a las completadas.
+ *
+ * @param personId Identificador de la persona.
+ * @param taskId Identificador de la tarea.
+ * @param subTaskIndex Índice de la subtarea dentro de la tarea.
+ * @param newProgress Nuevo progreso de la subtarea (0-100).
+ * @throws runtime_error Si la persona, la tarea o la subtarea no se encuentran.
+ * @author fabian
+ */
+void subTaskProgress(const int personId, const int taskId, const int subTaskIndex, const float newProgress) {
+    Person* person = findPersonForUpdate(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    Task* task = person->activeTasks.findById(taskId);
+    if (!task) throw runtime_error("Tarea no encontrada");
+
+    SubTask* subTask = task->subTasks.get(subTaskIndex);
+    if (!subTask) throw runtime_error("Subtarea no encontrada");
+    setSubTaskProgress(person, task, subTask, subTaskIndex, newProgress);
+}
+
+/**
+ * @brief Elimina una tarea activa de una persona.
+ *
+ * @param personId Identificador de la persona.
+ * @param taskId Identificador de la tarea.
+ * @throws runtime_error Si la persona o la tarea no se encuentran.
+ * @author fabian
+ */
+void deleteTask(const int personId, const int taskId) {
+    Person* person = findPersonForUpdate(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    Task* task = person->activeTasks.removeById(taskId);
+    if (!task) throw runtime_error("Tarea no encontrada");
+    destroyTask(task);
+
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    payload.integer(taskId);
+    logMutation(MutationType::DeleteTask, payload);
+}
+
+/**
+ * @brief Completa las tareas activas de una persona que vencen antes de una fecha y registra una sola mutación.
+ *
+ * Si ninguna tarea vence antes de la fecha, la persona no se modifica ni se registra nada.
+ *
+ * @param personId Identificador de la persona.
+ * @param limit Fecha límite; se completan las tareas de días anteriores.
+ * @return Cantidad de tareas completadas.
+ * @throws runtime_error Si la persona no se encuentra.
+ * @author fabian
+ */
+static int completeDueTasks(const int personId, const tm& limit) {
+    const Person* current = activePeople->findById(personId);
+    if (!current) throw runtime_error("Persona no encontrada");
+
+    TaskBlockFilter filter;
+    filter.maxDay = dayNumber(limit) - 1;
+    const auto due = [lastDay = filter.maxDay](const Task& task) { return dayNumber(task.date) <= lastDay; };
+    int count = 0;
+    current->activeTasks.scanBlocks(filter, [&](const Task& task) { count += due(task) ? 1 : 0; });
+    if (!count) return 0;
+
+    Person* person = findPersonForUpdate(personId);
+    Task* task = person->activeTasks.extractIf(filter, due);
+    while (task) {
+        Task* next = task->next;
+        person->completedTasks.append(*task);
+        destroyTask(task);
+        task = next;
+    }
+
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    payload.date(limit);
+    logMutation(MutationType::CompleteTasksBefore, payload);
+    return count;
+}
+
+/**
+ * @brief Marca como completadas todas las tareas activas de una persona que vencen antes de una fecha.
+ *
+ * Equivale a llamar a `completeTask` con cada una, pero busca a la persona una sola vez, quita todas las tareas
+ * en un solo recorrido de la lista (saltando los bloques que vencen después) y registra una sola mutación.
+ *
+ * @param personId Identificador de la persona.
+ * @param date Fecha límite en formato "dd-mm-YYYY"; se completan las tareas de días anteriores.
+ * @return Cantidad de tareas completadas.
+ * @throws runtime_error Si la persona no se encuentra o la fecha no es válida.
+ * @author fabian
+ */
+int completeTasksBefore(const int personId, const string& date) {
+    tm limit = {};
+    if (!parseDate(date, limit)) throw runtime_error("Formato de fecha incorrecto. (dd-mm-YYYY)");
+    return completeDueTasks(personId, limit);
+}
+
+/**
+ * @brief Mueve la fecha de todas las tareas activas de un tipo de una persona, sin registrar la mutación.
+ *
+ * @param personId Identificador de la persona.
+ * @param type Tipo de las tareas a mover.
+ * @param days Días a sumar a la fecha de cada tarea; negativo para adelantarlas.
+ * @return Cantidad de tareas del tipo que tiene la persona.
+ * @throws runtime_error Si la persona no se encuentra.
+ * @author fabian
+ */
+static int shiftTypeTasks(const int personId, const TaskType* type, const int days) {
+    const Person* current = activePeople->findById(personId);
+    if (!current) throw runtime_error("Persona no encontrada");
+
+    TaskBlockFilter filter;
+    filter.typeMask = taskTypeBit(type->name);
+    int count = 0;
+    current->activeTasks.scanBlocks(filter, [&](const Task& task) { count += task.type == type ? 1 : 0; });
+    if (!count || !days) return count;
+
+    Person* person = findPersonForUpdate(personId);
+    person->activeTasks.updateIf(filter, [&](Task& task) {
+        if (task.type != type) return false;
+        addDays(task.date, days);
+        return true;
+    });
+    return count;
+}
+
+/**
+ * @brief Mueve la fecha de todas las tareas activas de un tipo de una persona y registra una sola mutación.
+ *
+ * Equivale a llamar a `modifyActiveTask` con cada una, pero busca a la persona una sola vez y cambia todas las
+ * tareas en un solo recorrido de la lista, saltando los bloques sin tareas del tipo. La lista conserva su orden y
+ * sus bloques se vuelven a calcular una vez. Si la persona no tiene tareas del tipo, no se modifica ni se registra
+ * nada.
+ *
+ * @param personId Identificador de la persona.
+ * @param type Tipo de las tareas a mover.
+ * @param days Días a sumar a la fecha de cada tarea; negativo para adelantarlas.
+ * @return Cantidad de tareas movidas.
+ * @throws runtime_error Si la persona o el tipo no se encuentran.
+ * @author fabian
+ */
+int shiftTasks(const int personId, TaskType* type, const int days) {
+    if (!type) throw runtime_error("Tipo de tarea no encontrado");
+    const int count = shiftTypeTasks(personId, type, days);
+    if (!count || !days) return count;
+
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    payload.integer(type->id);
+    payload.integer(days);
+    logMutation(MutationType::ShiftTasks, payload);
+    return count;
+}
+
+/**
+ * @brief Mueve la fecha de todas las tareas activas de un tipo de todas las personas, por ejemplo por un feriado.
+ *
+ * Solo modifica a las personas cuyos bloques pueden tener tareas del tipo, y registra una sola mutación
+ * `ShiftAllTasks` al final: al reproducir el registro, el cambio se aplica a todas las personas o a ninguna.
+ *
+ * @param type Tipo de las tareas a mover.
+ * @param days Días a sumar a la fecha de cada tarea; negativo para adelantarlas.
+ * @return Cantidad de tareas movidas.
+ * @throws runtime_error Si el tipo no se encuentra.
+ * @author fabian
+ */
+uint64_t shiftAllTasks(TaskType* type, const int days) {
+    if (!type) throw runtime_error("Tipo de tarea no encontrado");
+    TaskBlockFilter filter;
+    filter.typeMask = taskTypeBit(type->name);
+
+    vector<int> personIds;
+    for (const Person* person = activePeople->head; person; person = person->next) {
+        for (const TaskBlock& block : person->activeTasks.getBlocks()) {
+            if (!block.mayMatch(filter)) continue;
+            personIds.push_back(person->id);
+            break;
+        }
+    }
+
+    uint64_t count = 0;
+    for (const int personId : personIds) count += static_cast<uint64_t>(shiftTypeTasks(personId, type, days));
+    if (!count || !days) return count;
+
+    LogPayloadWriter payload;
+    payload.integer(type->id);
+    payload.integer(days);
+    logMutation(MutationType::ShiftAllTasks, payload);
+    return count;
+}
+
+/**
+ * @brief Obtiene el handle de una tarea activa, registrándola si todavía no tiene uno.
+ *
+ * Buscar la tarea por su ID recorre la lista una vez; después, las operaciones `...ByHandle` la encuentran en
+ * tiempo constante. El handle deja de ser válido cuando la tarea se completa o se elimina.
+ *
+ * Las operaciones `...ByHandle` modifican a la persona como las demás mutaciones: si hay versiones publicadas (ver
+ * `VersionedPeople`) y la persona está en alguna, la primera mutación la copia junto con todas sus tareas activas
+ * (ver `findPersonForUpdate`), y las siguientes, hasta la próxima publicación, modifican la copia en tiempo
+ * constante. Sin versiones publicadas, como en el menú y en `--batch`, no se copia nada.
+ *
+ * @param personId Identificador de la persona.
+ * @param taskId Identificador de la tarea.
+ * @return El handle de la tarea.
+ * @throws runtime_error Si la persona o la tarea no se encuentran.
+ * @author fabian
+ */
+uint64_t getTaskHandle(const int personId, const int taskId) {
+    const Person* person = activePeople->findById(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    Task* task = person->activeTasks.findById(taskId);
+    if (!task) throw runtime_error("Tarea no encontrada");
+
+    const uint64_t handle = taskHandles.handleOf(task);
+    return handle ? handle : taskHandles.insert(task, personId);
+}
+
+/**
+ * @brief Obtiene el handle de una subtarea, registrándola (y a su tarea) si todavía no tiene uno.
+ *
+ * @param personId Identificador de la persona.
+ * @param taskId Identificador de la tarea.
+ * @param subTaskIndex Índice de la subtarea dentro de la tarea.
+ * @return El handle de la subtarea.
+ * @throws runtime_error Si la persona, la tarea o la subtarea no se encuentran.
+ * @author fabian
+ */
+uint64_t getSubTaskHandle(const int personId, const int taskId, const int subTaskIndex) {
+    getTaskHandle(personId, taskId);
+    Task* task = activePeople->findById(personId)->activeTasks.findById(taskId);
+    SubTask* subTask = task->subTasks.get(subTaskIndex);
+    if (!subTask) throw runtime_error("Subtarea no encontrada");
+
+    const uint64_t handle = subTaskHandles.handleOf(subTask);
+    return handle ? handle : subTaskHandles.insert(subTask, personId, task->slot);
+}
+
+/**
+ * @brief Busca una persona para modificarla y una de sus tareas activas por su handle.
+ *
+ * El handle se revisa antes de buscar a la persona, para no copiarla si no es válido; después se vuelve a
+ * resolver, porque al copiar la persona el handle pasa a la copia de la tarea.
+ *
+ * @param personId Identificador de la persona.
+ * @param handle Handle de la tarea.
+ * @param person Recibe la persona que se puede modificar.
+ * @return La tarea.
+ * @throws runtime_error Si la persona no se encuentra o el handle no es válido para ella.
+ * @author fabian
+ */
+static Task* findTaskForUpdate(const int personId, const uint64_t handle, Person*& person) {
+    if (!taskHandles.find(handle, personId)) throw runtime_error("Tarea no encontrada");
+    person = findPersonForUpdate(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    return taskHandles.find(handle, personId);
+}
+
+/**
+ * @brief Busca una persona para modificarla y una de sus subtareas por su handle, junto con su tarea.
+ *
+ * Como `findTaskForUpdate`, revisa el handle antes de buscar a la persona. El índice de la subtarea, que va en el
+ * registro de mutaciones, es el que la subtarea guarda al agregarse (ver `Task::countSubTask`).
+ *
+ * @param personId Identificador de la persona.
+ * @param handle Handle de la subtarea.
+ * @param person Recibe la persona que se puede modificar.
+ * @param task Recibe la tarea de la subtarea.
+ * @param subTaskIndex Recibe el índice de la subtarea dentro de la tarea, para el registro.
+ * @return La subtarea.
+ * @throws runtime_error Si la persona no se encuentra o el handle no es válido para ella.
+ * @author fabian
+ */
+static SubTask* findSubTaskForUpdate(const int personId, const uint64_t handle, Person*& person, Task*& task,
+                                     int& subTaskIndex) {
+    if (!subTaskHandles.find(handle, personId)) throw runtime_error("Subtarea no encontrada");
+    person = findPersonForUpdate(personId);
+    if (!person) throw runtime_error("Persona no encontrada");
+    uint32_t parent = 0;
+    SubTask* subTask = subTaskHandles.find(handle, personId, &parent);
+    task = taskHandles.at(parent);
+    subTaskIndex = static_cast<int>(subTask->index);
+    return subTask;
+}
+
+/**
+ * @brief Marca como completada la tarea activa de un handle, en tiempo constante.
+ *
+ * @param personId Identificador de la persona.
+ * @param handle Handle de la tarea.
+ * @throws runtime_error Si la persona no se encuentra o el handle no es válido para ella.
+ * @author fabian
+ */
+void completeTaskByHandle(const int personId, const uint64_t handle) {
+    Person* person;
+    Task* task = findTaskForUpdate(personId, handle, person);
+    const int taskId = task->id;
+    moveToCompleted(person, task);
+
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    payload.integer(taskId);
+    logMutation(MutationType::CompleteTask, payload);
+}
+
+/**
+ * @brief Elimina la tarea activa de un handle, en tiempo constante.
+ *
+ * @param personId Identificador de la persona.
+ * @param handle Handle de la tarea.
+ * @throws runtime_error Si la persona no se encuentra o el handle no es válido para ella.
+ * @author fabian
+ */
+void deleteTaskByHandle(const int personId, const uint64_t handle) {
+    Person* person;
+    Task* task = findTaskForUpdate(personId, handle, person);
+    const int taskId = task->id;
+    person->activeTasks.unlink(task);
+    destroyTask(task);
+
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    payload.integer(taskId);
+    logMutation(MutationType::DeleteTask, payload);
+}
+
+/**
+ * @brief Modifica la fecha y hora de la tarea activa de un handle, en tiempo constante.
+ *
+ * Se registra con el ID de la tarea (`RescheduleTask`), porque su índice en la lista costaría recorrerla.
+ *
+ * @param personId Identificador de la persona.
+ * @param handle Handle de la tarea.
+ * @param newDate Nueva fecha en formato "dd-mm-YYYY".
+ * @param newTime Nueva hora en formato "HH:MM:SS".
+ * @throws runtime_error Si la persona no se encuentra, el handle no es válido para ella o la fecha o la hora no
+ * son válidas; en ese caso la tarea queda sin cambios.
+ * @author fabian
+ */
+void rescheduleTaskByHandle(const int personId, const uint64_t handle, const string& newDate, const string& newTime) {
+    Person* person;
+    Task* task = findTaskForUpdate(personId, handle, person);
+    reschedule(person, task, newDate, newTime);
+
+    LogPayloadWriter payload;
+    payload.integer(personId);
+    payload.integer(task->id);
+    payload.date(task->date);
+    payload.time(task->time);
+    logMutation(MutationType::RescheduleTask, payload);
+}
+
+/**
+ * @brief Marca como completada la subtarea de un handle.
+ *
+ * @param personId Identificador de la persona.
+ * @param handle Handle de la subtarea.
+ * @throws runtime_error Si la persona no se encuentra o el handle no es válido para ella.
+ * @author fabian
+ */
+void completeSubTaskByHandle(const int personId, const uint64_t handle) {
+    Person* person;
+    Task* task;
+    int subTaskIndex;
+    SubTask* subTask = findSubTaskForUpdate(personId, handle, person, task, subTaskIndex);
+    setSubTaskProgress(person, task, subTask, subTaskIndex, 100);
+}
+
+/**
+ * @brief Modifica el progreso de la subtarea de un handle, como `subTaskProgress`.
+ *
+ * @param personId Identificador de la persona.
+ * @param handle Handle de la subtarea.
+ * @param newProgress Nuevo progreso de la subtarea (0-100).
+ * @throws runtime_error Si la persona no se encuentra o el handle no es válido para ella.
+ * @author fabian
+ */
+void subTaskProgressByHandle(const int personId, const uint64_t handle, const float newProgress) {
+    Person* person;
+    Task* task;
+    int subTaskIndex;
+    SubTask* subTask = findSubTaskForUpdate(personId, handle, person, task, subTaskIndex);
+    setSubTaskProgress(person, task, subTask, subTaskIndex, newProgress);
+}
+
+/**
+ * @brief Libera una persona que ya no está en la lista, junto con sus tareas y subtareas.
+ *
+ * Las tareas completadas se eliminan también del árbol en disco si están ahí.
+ *
+ * @param person Persona a liberar.
+ * @author fabian
+ */
+void destroyPerson(Person* person) {
+    while (Task* task = person->activeTasks.head) {
+        person->activeTasks.head = task->next;
+        destroyTask(task);
+    }
+    person->completedTasks.clear();
+    delete person;
+}
+
+/**
+ * @brief Elimina todas las personas y todos los tipos de tarea, sin registrarlo como mutación.
+ * @author fabian
+ */
+void clearData() {
+    while (people.head) destroyPerson(people.remove(people.head->id));
+
+    TaskType* type = taskTypes.head;
+    for (int i = 0; i < taskTypes.getLength(); i++) {
+        TaskType* next = type->next;
+        delete type;
+        type = next;
+    }
+    taskTypes = TaskTypeList();
+}
+
+/**
+ * @brief Reproduce un registro `CompleteSubTask` o `SubTaskProgress`, que solo escriben las versiones anteriores a
+ * `UpdateSubTask`, con el significado que tenían al escribirse: `CompleteSubTask` completaba la subtarea sin mover
+ * su tarea, y `SubTaskProgress` movía la tarea a las completadas en cuanto esa subtarea llegaba a 100.
+ *
+ * @param type Tipo del registro.
+ * @param reader Contenido del registro.
+ * @throws runtime_error Si la persona, la tarea o la subtarea no se encuentran.
+ * @author fabian
+ */
+static void replayLegacySubTask(const MutationType type, LogPayloadReader& reader) {
+    Person* person = findPersonForUpdate(reader.integer());
+    if (!person) throw runtime_error("Persona no encontrada");
+    Task* task = person->activeTasks.findById(reader.integer());
+    if (!task) throw runtime_error("Tarea no encontrada");
+    SubTask* subTask = task->subTasks.get(reader.integer());
+    if (!subTask) throw runtime_error("Subtarea no encontrada");
+
+    const float newProgress = type == MutationType::CompleteSubTask ? 100 : reader.decimal();
+    task->setSubTaskProgress(*subTask, newProgress);
+    if (type == MutationType::SubTaskProgress && newProgress == 100) moveToCompleted(person, task);
+}
+
+/**
+ * @brief Aplica una mutación leída del registro de mutaciones.
+ *
+ * @param type Tipo de la mutación.
+ * @param payload Contenido de la mutación.
+ * @throws runtime_error Si el contenido está incompleto o la mutación no se puede aplicar.
+ * @author fabian
+ */
+void applyMutation(const uint8_t type, const string_view payload) {
+    LogPayloadReader reader{payload};
+    switch (static_cast<MutationType>(type)) {
+        case MutationType::AddTaskType: {
+            const string name = reader.text();
+            addTaskType(name, reader.text());
+            break;
+        }
+        case MutationType::AddPerson: {
+            const int id = reader.integer();
+            const string name = reader.text();
+            const string lastname = reader.text();
+            addPerson(id, name, lastname, reader.integer());
+            break;
+        }
+        case MutationType::DeletePerson:
+            deletePerson(reader.integer());
+            break;
+        case MutationType::AddTask: {
+            const int personId = reader.integer();
+            const bool completed = reader.byte();
+            TaskType* taskType = findTaskType(reader.integer());
+            const string description = reader.text();
+            const string importance = reader.text();
+            const tm date = reader.date();
+            const tm time = reader.time();
+            auto* task = new Task(0, description, importance, date, time, taskType);
+            try {
+                addTask(personId, task, completed);
+            } catch (...) {
+                delete task;
+                throw;
+            }
+            break;
+        }
+        case MutationType::AddSubTask: {
+            const int personId = reader.integer();
+            const int taskIndex = reader.integer();
+            const string name = reader.text();
+            const string comments = reader.text();
+            auto* subTask = new SubTask(name, comments, reader.decimal());
+            try {
+                addSubTask(personId, taskIndex, subTask);
+            } catch (...) {
+                delete subTask;
+                throw;
+            }
+            break;
+        }
+        case MutationType::ModifyActiveTask: {
+            Person* person = findPersonForUpdate(reader.integer());
+            if (!person) throw runtime_error("Persona no encontrada");
+            Task* task = person->activeTasks.get(reader.integer());
+            if (!task) throw runtime_error("Tarea no encontrada");
+            task->date = reader.date();
+            task->time = reader.time();
+            person->activeTasks.refresh(task);
+            break;
+        }
+        case MutationType::RescheduleTask: {
+            Person* person = findPersonForUpdate(reader.integer());
+            if (!person) throw runtime_error("Persona no encontrada");
+            Task* task = person->activeTasks.findById(reader.integer());
+            if (!task) throw runtime_error("Tarea no encontrada");
+            task->date = reader.date();
+            task->time = reader.time();
+            person->activeTasks.refresh(task);
+            break;
+        }
+        case MutationType::CompleteTask: {
+            const int personId = reader.integer();
+            completeTask(personId, reader.integer());
+            break;
+        }
+        case MutationType::CompleteSubTask:
+        case MutationType::SubTaskProgress:
+            replayLegacySubTask(static_cast<MutationType>(type), reader);
+            break;
+        case MutationType::UpdateSubTask: {
+            const int personId = reader.integer();
+            const int taskId = reader.integer();
+            const int subTaskIndex = reader.integer();
+            subTaskProgress(personId, taskId, subTaskIndex, reader.decimal());
+            break;
+        }
+        case MutationType::DeleteTask: {
+            const int personId = reader.integer();
+            deleteTask(personId, reader.integer());
+            break;
+        }
+        case MutationType::CompleteTasksBefore: {
+            const int personId = reader.integer();
+            completeDueTasks(personId, reader.date());
+            break;
+        }
+        case MutationType::ShiftTasks: {
+            const int personId = reader.integer();
+            TaskType* taskType = findTaskType(reader.integer());
+            shiftTasks(personId, taskType, reader.integer());
+            break;
+        }
+        case MutationType::ShiftAllTasks: {
+            TaskType* taskType = findTaskType(reader.integer());
+            shiftAllTasks(taskType, reader.integer());
+            break;
+        }
+        default:
+            throw runtime_error("Tipo de mutacion desconocido: " + to_string(type));
+    }
+}
+
+/**
+ * @brief Reproduce el registro de mutaciones sobre los datos cargados y empieza a registrar las nuevas mutaciones.
+ *
+ * @param log Registro de mutaciones.
+ * @param snapshotLsn LSN de la última mutación incluida en la instantánea cargada, o 0 si no se cargó ninguna.
+ * @return Cantidad de mutaciones reproducidas.
+ * @throws runtime_error Si el registro no se puede leer o alguna mutación no se puede aplicar.
+ * @author fabian
+ */
+uint64_t recoverMutations(MutationLog& log, const uint64_t snapshotLsn) {
+    mutationLog = nullptr;
+    const uint64_t applied = log.recover(snapshotLsn, applyMutation);
+    mutationLog = &log;
+    return applied;
+}
+
+/**
+ * @brief Espera hasta que todas las mutaciones hechas por este hilo estén en el disco.
+ *
+ * Se llama antes de confirmarle al usuario un cambio. Las mutaciones acumuladas desde la última llamada, y las
+ * de otros hilos que esperan al mismo tiempo, se sincronizan juntas.
+ *
+ * @throws runtime_error Si el registro no se puede escribir.
+ * @author fabian
+ */
+void commitMutations() {
+    if (mutationLog && lastMutationLsn) mutationLog->sync(lastMutationLsn);
+}
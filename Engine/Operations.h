@@ -0,0 +1,86 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef OPERATIONS_H
+#define OPERATIONS_H
+
+#include <vector>
+
+#include "../Lists/PersonList.h"
+#include "../Lists/SlotMap.h"
+#include "../Lists/TaskTypeList.h"
+#include "../Structures/SubTask.h"
+#include "../Structures/Task.h"
+#include "../Storage/MutationLog.h"
+
+/**
+ * @brief Tipos de mutación que se guardan en el registro de mutaciones.
+ */
+enum class MutationType : uint8_t {
+    AddTaskType = 1,
+    AddPerson,
+    DeletePerson,
+    AddTask,
+    AddSubTask,
+    ModifyActiveTask,
+    CompleteTask,
+    CompleteSubTask,
+    SubTaskProgress,
+    DeleteTask,
+    CompleteTasksBefore,
+    ShiftTasks,
+    RescheduleTask,
+    ShiftAllTasks,
+    UpdateSubTask
+};
+
+/**
+ * @brief Tarea nueva de una carga masiva y la persona que la recibe.
+ */
+struct TaskRecord {
+    int personId;
+    bool completed;
+    Task* task;
+};
+
+extern PersonList people;
+extern TaskTypeList taskTypes;
+extern MutationLog* mutationLog;
+extern thread_local PersonList* activePeople;
+extern SlotMap<Task> taskHandles;
+extern SlotMap<SubTask> subTaskHandles;
+
+void addTaskType(const string& name, const string& description);
+void addPerson(int id, const string& name, const string& lastname, int age);
+void deletePerson(int personId);
+int addTask(int personId, Task* task, bool completed = false);
+void addTasks(int personId, const vector<Task*>& newTasks, bool completed);
+vector<size_t> addTaskBatch(const vector<TaskRecord>& records);
+void addSubTask(int personId, int taskIndex, SubTask* subTask);
+void modifyActiveTask(int personId, int taskIndex, const string& newDate, const string& newTime);
+void completeTask(int personId, int taskId);
+void completeSubTask(int personId, int taskId, int subTaskIndex);
+void subTaskProgress(int personId, int taskId, int subTaskIndex, float newProgress);
+void deleteTask(int personId, int taskId);
+int completeTasksBefore(int personId, const string& date);
+int shiftTasks(int personId, TaskType* type, int days);
+uint64_t shiftAllTasks(TaskType* type, int days);
+
+uint64_t getTaskHandle(int personId, int taskId);
+uint64_t getSubTaskHandle(int personId, int taskId, int subTaskIndex);
+void completeTaskByHandle(int personId, uint64_t handle);
+void deleteTaskByHandle(int personId, uint64_t handle);
+void rescheduleTaskByHandle(int personId, uint64_t handle, const string& newDate, const string& newTime);
+void completeSubTaskByHandle(int personId, uint64_t handle);
+void subTaskProgressByHandle(int personId, uint64_t handle, float newProgress);
+
+void destroyPerson(Person* person);
+void clearData();
+void applyMutation(uint8_t type, string_view payload);
+
+uint64_t recoverMutations(MutationLog& log, uint64_t snapshotLsn);
+void commitMutations();
+
+#include "Operations.cpp"
+#endif //OPERATIONS_H
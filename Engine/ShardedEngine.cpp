@@ -0,0 +1,175 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "ShardedEngine.h"
+
+#include <stdexcept>
+
+/**
+ * @brief Constructor de la clase ShardedEngine. Reparte las personas de `people` e inicia un escritor por fragmento.
+ *
+ * @param shardCount Cantidad de fragmentos; al menos 1.
+ * @param apply Función que aplica una mutación de una persona; se llama desde el escritor de su fragmento.
+ * @throws runtime_error Si la cantidad de fragmentos no es válida.
+ * @author fabian
+ */
+ShardedEngine::ShardedEngine(const int shardCount, const MutationQueue::Applier& apply) {
+    if (shardCount < 1) throw runtime_error("Cantidad de fragmentos invalida");
+    this->shards.resize(shardCount);
+    this->shards[0].people = &people;
+    for (int i = 1; i < shardCount; i++) {
+        this->shards[i].ownPeople = make_unique<PersonList>();
+        this->shards[i].people = this->shards[i].ownPeople.get();
+    }
+
+    if (shardCount > 1) {
+        Person* current = people.head;
+        while (current) {
+            Person* next = current->next;
+            const int shard = shardFor(current->id);
+            if (shard != 0) this->shards[shard].people->adopt(people.remove(current->id));
+            current = next;
+        }
+    }
+
+    vector<const PersonList*> lists;
+    for (const Shard& shard : this->shards) lists.push_back(shard.people);
+    for (Shard& shard : this->shards) {
+        shard.versions = make_unique<VersionedPeople>(*shard.people, taskTypes);
+        MutationQueueOptions options;
+        options.people = shard.people;
+        options.versions = shard.versions.get();
+        options.batchLock = &this->typesLock;
+        options.snapshotPeople = lists;
+        shard.queue = make_unique<MutationQueue>(apply, options);
+    }
+}
+
+/**
+ * @brief Destructor de la clase ShardedEngine. Detiene los escritores y devuelve las personas a `people`.
+ * @author fabian
+ */
+ShardedEngine::~ShardedEngine() {
+    stop();
+}
+
+/**
+ * @brief Obtiene la cantidad de fragmentos.
+ *
+ * @return Número de fragmentos.
+ * @author fabian
+ */
+int ShardedEngine::getShardCount() const { return static_cast<int>(this->shards.size()); }
+
+/**
+ * @brief Obtiene el fragmento de una persona.
+ *
+ * @param personId Cédula de la persona.
+ * @return Índice del fragmento, por un hash multiplicativo de la cédula.
+ * @author fabian
+ */
+int ShardedEngine::shardFor(const int personId) const {
+    const uint64_t hash = static_cast<uint64_t>(static_cast<uint32_t>(personId)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<int>((hash >> 32) % this->shards.size());
+}
+
+/**
+ * @brief Encola una mutación de una persona en el escritor de su fragmento.
+ *
+ * @param personId Cédula de la persona que modifica la mutación.
+ * @param type Tipo de la mutación, tal como lo entiende la función `apply`.
+ * @param payload Campos de la mutación.
+ * @return Futuro con el resultado, listo cuando la mutación está aplicada, sincronizada y publicada.
+ * @author fabian
+ */
+future<MutationResult> ShardedEngine::submit(const int personId, const uint8_t type, string payload) {
+    return this->shards[shardFor(personId)].queue->submit(type, std::move(payload));
+}
+
+/**
+ * @brief Encola una mutación de una persona en el escritor de su fragmento y entrega su resultado a una función.
+ *
+ * @param personId Cédula de la persona que modifica la mutación.
+ * @param type Tipo de la mutación, tal como lo entiende la función `apply`.
+ * @param payload Campos de la mutación.
+ * @param callback Función que recibe el resultado, desde el escritor del fragmento.
+ * @author fabian
+ */
+void ShardedEngine::submit(const int personId, const uint8_t type, string payload, MutationQueue::Callback callback) {
+    this->shards[shardFor(personId)].queue->submit(type, std::move(payload), std::move(callback));
+}
+
+/**
+ * @brief Agrega un tipo de tarea, común a todos los fragmentos, y espera a que sea durable.
+ *
+ * Toma `typesLock` en modo exclusivo, así que espera a que terminen los lotes en curso; publica una versión nueva
+ * de cada fragmento con el tipo antes de soltarlo.
+ *
+ * @param name Nombre del tipo.
+ * @param description Descripción del tipo.
+ * @throws runtime_error Si el registro de mutaciones no se puede escribir.
+ * @author fabian
+ */
+void ShardedEngine::addTaskType(const string& name, const string& description) {
+    {
+        unique_lock guard(this->typesLock);
+        ::addTaskType(name, description);
+        for (Shard& shard : this->shards) {
+            shard.versions->markTaskTypesChanged();
+            shard.versions->publish();
+        }
+    }
+    commitMutations();
+}
+
+/**
+ * @brief Fija la versión publicada más reciente de cada fragmento.
+ *
+ * @return Una versión por fragmento, en orden de fragmento.
+ * @author fabian
+ */
+vector<shared_ptr<const PeopleVersion>> ShardedEngine::pin() {
+    vector<shared_ptr<const PeopleVersion>> versions;
+    versions.reserve(this->shards.size());
+    for (Shard& shard : this->shards) versions.push_back(shard.versions->pin());
+    return versions;
+}
+
+/**
+ * @brief Obtiene las estadísticas de las colas de todos los fragmentos, sumadas.
+ *
+ * @return Comandos, lotes, errores y veces que un productor encontró una cola llena.
+ * @author fabian
+ */
+MutationQueueStats ShardedEngine::getStats() const {
+    MutationQueueStats total;
+    for (const Shard& shard : this->shards) {
+        if (!shard.queue) continue;
+        const MutationQueueStats stats = shard.queue->getStats();
+        total.commands += stats.commands;
+        total.batches += stats.batches;
+        total.errors += stats.errors;
+        total.fullWaits += stats.fullWaits;
+    }
+    return total;
+}
+
+/**
+ * @brief Espera a que los escritores apliquen lo encolado, los detiene y devuelve las personas a `people`.
+ *
+ * Ningún productor debe seguir encolando mutaciones ni ningún lector debe tener versiones fijadas: al soltar las
+ * versiones se liberan las personas retiradas.
+ *
+ * @author fabian
+ */
+void ShardedEngine::stop() {
+    if (this->stopped) return;
+    this->stopped = true;
+    for (Shard& shard : this->shards) shard.queue->stop();
+    for (Shard& shard : this->shards) shard.versions.reset();
+    for (size_t i = 1; i < this->shards.size(); i++) {
+        PersonList& shardPeople = *this->shards[i].people;
+        while (shardPeople.head) people.adopt(shardPeople.remove(shardPeople.head->id));
+    }
+}
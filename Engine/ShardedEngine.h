@@ -0,0 +1,68 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef SHARDEDENGINE_H
+#define SHARDEDENGINE_H
+
+#include <future>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "MutationQueue.h"
+
+/**
+ * @brief Motor dividido en fragmentos por cédula, cada uno con su lista de personas, sus versiones y su hilo
+ * escritor.
+ *
+ * Al crearlo, las personas de `people` se reparten por un hash de la cédula: el fragmento 0 se queda con `people` y
+ * los demás reciben su propia lista. Las mutaciones de una persona van a la `MutationQueue` de su fragmento, así que
+ * las de personas de fragmentos distintos se aplican en paralelo; todas van al mismo registro de mutaciones, que
+ * las sincroniza en grupo, y como las tareas de cada persona son independientes, el orden entre fragmentos no
+ * importa al recuperarlo. Los tipos de tarea son comunes: cada escritor toma `typesLock` en modo compartido durante
+ * sus lotes y `addTaskType` lo toma en modo exclusivo. Las lecturas fijan una versión de cada fragmento y las
+ * recorren juntas en orden de cédula (ver `PeopleView`).
+ *
+ * Cualquier escritor puede iniciar una compactación: toma `typesLock` en modo exclusivo, así que todos los
+ * fragmentos quedan entre un lote y otro, con sus mutaciones ya sincronizadas, y la instantánea junta las personas
+ * de todos los fragmentos hasta el último LSN del registro. Al detenerse, las personas vuelven a `people`.
+ */
+class ShardedEngine {
+public:
+    ShardedEngine(int shardCount, const MutationQueue::Applier& apply);
+    ~ShardedEngine();
+
+    ShardedEngine(const ShardedEngine&) = delete;
+    ShardedEngine& operator=(const ShardedEngine&) = delete;
+
+    [[nodiscard]] int getShardCount() const;
+    [[nodiscard]] int shardFor(int personId) const;
+
+    future<MutationResult> submit(int personId, uint8_t type, string payload);
+    void submit(int personId, uint8_t type, string payload, MutationQueue::Callback callback);
+    void addTaskType(const string& name, const string& description);
+
+    [[nodiscard]] vector<shared_ptr<const PeopleVersion>> pin();
+    [[nodiscard]] MutationQueueStats getStats() const;
+    void stop();
+
+private:
+    /**
+     * @brief Lista de personas de un fragmento, sus versiones y la cola de su escritor.
+     */
+    struct Shard {
+        unique_ptr<PersonList> ownPeople;
+        PersonList* people = nullptr;
+        unique_ptr<VersionedPeople> versions;
+        unique_ptr<MutationQueue> queue;
+    };
+
+    vector<Shard> shards;
+    shared_mutex typesLock;
+    bool stopped = false;
+};
+
+#include "ShardedEngine.cpp"
+#endif //SHARDEDENGINE_H
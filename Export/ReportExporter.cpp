@@ -0,0 +1,768 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "ReportExporter.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
+
+/**
+ * @brief Constructor de la clase ExportWriter.
+ *
+ * @param path Ruta del archivo a crear.
+ * @param background Si es true, un hilo aparte escribe los búferes llenos en el disco.
+ * @param bufferSize Tamaño de cada búfer.
+ * @throws runtime_error Si el archivo no se puede crear.
+ * @author fabian
+ */
+ExportWriter::ExportWriter(const string& path, const bool background, const size_t bufferSize)
+    : file(path, 64 << 10), current(bufferSize), background(background) {
+    if (this->background) {
+        this->spare.resize(bufferSize);
+        this->writer = thread(&ExportWriter::writerLoop, this);
+    }
+}
+
+/**
+ * @brief Destructor de la clase ExportWriter. Si no se llamó a `finish()`, el destino queda intacto.
+ * @author fabian
+ */
+ExportWriter::~ExportWriter() {
+    stopWriter();
+}
+
+/**
+ * @brief Agrega bytes al archivo.
+ *
+ * @param data Bytes a agregar.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la escritura de un búfer anterior falló.
+ * @author fabian
+ */
+void ExportWriter::write(const void* data, size_t size) {
+    const auto* bytes = static_cast<const char*>(data);
+    this->offset += size;
+    if (this->used + size <= this->current.size()) {
+        memcpy(this->current.data() + this->used, bytes, size);
+        this->used += size;
+        return;
+    }
+    while (size > 0) {
+        if (this->used == this->current.size()) handOff();
+        const size_t amount = min(size, this->current.size() - this->used);
+        memcpy(this->current.data() + this->used, bytes, amount);
+        this->used += amount;
+        bytes += amount;
+        size -= amount;
+    }
+}
+
+/**
+ * @brief Agrega un texto al archivo.
+ *
+ * @param text Texto a agregar.
+ * @author fabian
+ */
+void ExportWriter::write(const string_view text) {
+    write(text.data(), text.size());
+}
+
+/**
+ * @brief Agrega un carácter al archivo.
+ *
+ * @param character Carácter a agregar.
+ * @author fabian
+ */
+void ExportWriter::put(const char character) {
+    if (this->used == this->current.size()) handOff();
+    this->current[this->used++] = character;
+    ++this->offset;
+}
+
+/**
+ * @brief Escribe lo pendiente, espera al hilo de escritura y reemplaza el destino con el archivo nuevo.
+ *
+ * @throws runtime_error Si alguna escritura falló.
+ * @author fabian
+ */
+void ExportWriter::finish() {
+    handOff();
+    stopWriter();
+    if (this->error) rethrow_exception(this->error);
+    this->file.commit();
+}
+
+/**
+ * @brief Obtiene la cantidad de bytes agregados hasta el momento.
+ *
+ * @return Posición actual en el archivo.
+ * @author fabian
+ */
+uint64_t ExportWriter::getOffset() const { return this->offset; }
+
+/**
+ * @brief Entrega el búfer actual para escribirlo en el disco.
+ *
+ * Sin hilo de escritura, lo escribe directamente. Con hilo, espera a que el hilo termine el búfer anterior,
+ * intercambia los búferes y sigue sin esperar la escritura del actual.
+ *
+ * @throws runtime_error Si la escritura de un búfer anterior falló.
+ * @author fabian
+ */
+void ExportWriter::handOff() {
+    if (this->used == 0) return;
+    if (!this->background) {
+        this->file.write(this->current.data(), this->used);
+        this->used = 0;
+        return;
+    }
+
+    unique_lock guard(this->lock);
+    this->changed.wait(guard, [this] { return !this->pending; });
+    if (this->error) rethrow_exception(this->error);
+    swap(this->current, this->spare);
+    this->pendingSize = this->used;
+    this->pending = true;
+    this->used = 0;
+    this->changed.notify_all();
+}
+
+/**
+ * @brief Espera a que el hilo de escritura termine lo pendiente y lo detiene.
+ * @author fabian
+ */
+void ExportWriter::stopWriter() {
+    if (!this->writer.joinable()) return;
+    {
+        lock_guard guard(this->lock);
+        this->stopping = true;
+    }
+    this->changed.notify_all();
+    this->writer.join();
+}
+
+/**
+ * @brief Ciclo del hilo de escritura: escribe cada búfer que se le entrega hasta que se le pide detenerse.
+ *
+ * Cada `SYNC_INTERVAL` bytes sincroniza con el disco, para que el sistema operativo no acumule todo el archivo en
+ * memoria y la escritura real al disco ocurra mientras se sigue formateando, en lugar de toda al final.
+ *
+ * @author fabian
+ */
+void ExportWriter::writerLoop() {
+    size_t unsynced = 0;
+    unique_lock guard(this->lock);
+    while (true) {
+        this->changed.wait(guard, [this] { return this->pending || this->stopping; });
+        if (!this->pending) return;
+
+        guard.unlock();
+        exception_ptr writeError;
+        try {
+            this->file.write(this->spare.data(), this->pendingSize);
+            unsynced += this->pendingSize;
+            if (unsynced >= SYNC_INTERVAL) {
+                this->file.sync();
+                unsynced = 0;
+            }
+        } catch (...) {
+            writeError = current_exception();
+        }
+        guard.lock();
+
+        this->pending = false;
+        this->changed.notify_all();
+        if (writeError) {
+            this->error = writeError;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Constructor de la clase ExportTable. En CSV escribe la línea de encabezado y en formato columnar el
+ * encabezado del archivo.
+ *
+ * @param writer Escritor del archivo.
+ * @param format Formato de la tabla.
+ * @param columns Columnas de la tabla, en orden.
+ * @author fabian
+ */
+ExportTable::ExportTable(ExportWriter& writer, const ExportFormat format, vector<ExportColumn> columns)
+    : writer(writer), format(format), columns(move(columns)) {
+    if (this->format == ExportFormat::Csv) {
+        for (size_t i = 0; i < this->columns.size(); i++) {
+            if (i > 0) this->writer.put(',');
+            this->writer.write(this->columns[i].name);
+        }
+        this->writer.put('\n');
+    } else if (this->format == ExportFormat::Columnar) {
+        this->data.resize(this->columns.size());
+        const uint32_t header[2] = {COLUMNAR_VERSION, static_cast<uint32_t>(this->columns.size())};
+        this->writer.write(COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC));
+        this->writer.write(header, sizeof(header));
+    }
+}
+
+/**
+ * @brief Prepara la escritura del siguiente valor de la fila: el separador en CSV y la llave en JSON.
+ *
+ * @param type Tipo del valor, que debe coincidir con el de la columna.
+ * @throws runtime_error Si la fila ya tiene todos sus valores o el tipo no coincide.
+ * @author fabian
+ */
+void ExportTable::beginValue(const ExportColumnType type) {
+    if (this->column >= this->columns.size() || this->columns[this->column].type != type) {
+        throw runtime_error("Valor fuera de las columnas del reporte");
+    }
+    if (this->format == ExportFormat::Csv) {
+        if (this->column > 0) this->writer.put(',');
+    } else if (this->format == ExportFormat::JsonLines) {
+        this->writer.put(this->column == 0 ? '{' : ',');
+        this->writer.put('"');
+        this->writer.write(this->columns[this->column].name);
+        this->writer.write("\":");
+    }
+}
+
+/**
+ * @brief Agrega un valor entero a la fila.
+ *
+ * @param value Valor.
+ * @author fabian
+ */
+void ExportTable::integer(const long long value) {
+    beginValue(ExportColumnType::Integer);
+    if (this->format == ExportFormat::Columnar) {
+        this->data[this->column++].integers.push_back(value);
+        return;
+    }
+    char buffer[24];
+    const auto result = to_chars(buffer, buffer + sizeof(buffer), value);
+    this->writer.write(buffer, static_cast<size_t>(result.ptr - buffer));
+    ++this->column;
+}
+
+/**
+ * @brief Agrega un valor decimal a la fila, con la representación más corta que lo identifica.
+ *
+ * @param value Valor.
+ * @author fabian
+ */
+void ExportTable::decimal(const float value) {
+    beginValue(ExportColumnType::Decimal);
+    if (this->format == ExportFormat::Columnar) {
+        this->data[this->column++].decimals.push_back(value);
+        return;
+    }
+    char buffer[32];
+    const auto result = to_chars(buffer, buffer + sizeof(buffer), value);
+    this->writer.write(buffer, static_cast<size_t>(result.ptr - buffer));
+    ++this->column;
+}
+
+/**
+ * @brief Agrega un texto a la fila.
+ *
+ * En CSV se pone entre comillas solo si contiene comas, comillas o saltos de línea; en JSON siempre va entre
+ * comillas con los caracteres especiales escapados.
+ *
+ * @param value Texto.
+ * @author fabian
+ */
+void ExportTable::text(const string_view value) {
+    beginValue(ExportColumnType::Text);
+    if (this->format == ExportFormat::Columnar) {
+        ColumnData& column = this->data[this->column++];
+        column.bytes.append(value);
+        column.offsets.push_back(static_cast<uint32_t>(column.bytes.size()));
+        return;
+    }
+    bool plain = this->format == ExportFormat::Csv;
+    for (size_t i = 0; plain && i < value.size(); i++) {
+        const char character = value[i];
+        plain = character != ',' && character != '"' && character != '\n' && character != '\r';
+    }
+    if (plain) this->writer.write(value);
+    else writeQuoted(value);
+    ++this->column;
+}
+
+/**
+ * @brief Agrega una fecha a la fila: "dd-mm-YYYY" en texto y AAAAMMDD en formato columnar.
+ *
+ * @param value Fecha.
+ * @author fabian
+ */
+void ExportTable::date(const tm& value) {
+    beginValue(ExportColumnType::Date);
+    if (this->format == ExportFormat::Columnar) {
+        const int64_t key = (value.tm_year + 1900) * 10000 + (value.tm_mon + 1) * 100 + value.tm_mday;
+        this->data[this->column++].integers.push_back(key);
+        return;
+    }
+    char buffer[DATE_TEXT_LENGTH + 3];
+    const bool json = this->format == ExportFormat::JsonLines;
+    buffer[0] = '"';
+    const size_t length = formatDate(value, buffer + 1);
+    buffer[length + 1] = '"';
+    this->writer.write(buffer + !json, length + 2 * json);
+    ++this->column;
+}
+
+/**
+ * @brief Agrega una hora a la fila: "HH:MM:SS" en texto y segundos desde la medianoche en formato columnar.
+ *
+ * @param value Hora.
+ * @author fabian
+ */
+void ExportTable::time(const tm& value) {
+    beginValue(ExportColumnType::Time);
+    if (this->format == ExportFormat::Columnar) {
+        this->data[this->column++].integers.push_back(value.tm_hour * 3600 + value.tm_min * 60 + value.tm_sec);
+        return;
+    }
+    char buffer[TIME_TEXT_LENGTH + 3];
+    const bool json = this->format == ExportFormat::JsonLines;
+    buffer[0] = '"';
+    const size_t length = formatTime(value, buffer + 1);
+    buffer[length + 1] = '"';
+    this->writer.write(buffer + !json, length + 2 * json);
+    ++this->column;
+}
+
+/**
+ * @brief Escribe un texto entre comillas, escapado según el formato.
+ *
+ * @param value Texto.
+ * @author fabian
+ */
+void ExportTable::writeQuoted(const string_view value) {
+    static const char hexDigits[] = "0123456789abcdef";
+    this->writer.put('"');
+    size_t start = 0;
+    for (size_t i = 0; i < value.size(); i++) {
+        const auto character = static_cast<unsigned char>(value[i]);
+        const bool escape = this->format == ExportFormat::Csv
+                                ? character == '"'
+                                : character == '"' || character == '\\' || character < 0x20;
+        if (!escape) continue;
+
+        this->writer.write(value.substr(start, i - start));
+        start = i + 1;
+        if (this->format == ExportFormat::Csv) {
+            this->writer.write("\"\"");
+        } else if (character == '"' || character == '\\') {
+            this->writer.put('\\');
+            this->writer.put(static_cast<char>(character));
+        } else if (character == '\n') {
+            this->writer.write("\\n");
+        } else if (character == '\t') {
+            this->writer.write("\\t");
+        } else {
+            const char escaped[] = {'\\', 'u', '0', '0', hexDigits[character >> 4], hexDigits[character & 0xF]};
+            this->writer.write(escaped, sizeof(escaped));
+        }
+    }
+    this->writer.write(value.substr(start));
+    this->writer.put('"');
+}
+
+/**
+ * @brief Cierra la fila actual.
+ *
+ * @throws runtime_error Si a la fila le faltan valores.
+ * @author fabian
+ */
+void ExportTable::endRow() {
+    if (this->column != this->columns.size()) throw runtime_error("Faltan valores en la fila del reporte");
+    this->column = 0;
+    ++this->rowCount;
+
+    if (this->format == ExportFormat::Csv) {
+        this->writer.put('\n');
+    } else if (this->format == ExportFormat::JsonLines) {
+        this->writer.write("}\n");
+    } else if (++this->groupRows == ROW_GROUP_SIZE) {
+        flushRowGroup();
+    }
+}
+
+/**
+ * @brief Escribe los datos de una columna del bloque y guarda su posición y estadísticas para el pie.
+ *
+ * @param bytes Datos de la columna.
+ * @param size Cantidad de bytes.
+ * @param minimum Mínimo de los valores (0 para textos).
+ * @param maximum Máximo de los valores (0 para textos).
+ * @author fabian
+ */
+void ExportTable::writeColumnChunk(const void* bytes, const size_t size, const int64_t minimum, const int64_t maximum) {
+    this->chunks.push_back({this->writer.getOffset(), size, crc32c(0, bytes, size), minimum, maximum});
+    this->writer.write(bytes, size);
+}
+
+/**
+ * @brief Escribe el bloque de filas acumulado, columna por columna.
+ * @author fabian
+ */
+void ExportTable::flushRowGroup() {
+    if (this->groupRows == 0) return;
+
+    for (size_t i = 0; i < this->columns.size(); i++) {
+        ColumnData& column = this->data[i];
+        switch (this->columns[i].type) {
+            case ExportColumnType::Integer:
+            case ExportColumnType::Date:
+            case ExportColumnType::Time: {
+                const auto [minimum, maximum] = minmax_element(column.integers.begin(), column.integers.end());
+                writeColumnChunk(column.integers.data(), column.integers.size() * sizeof(int64_t), *minimum, *maximum);
+                column.integers.clear();
+                break;
+            }
+            case ExportColumnType::Decimal: {
+                const auto [minimum, maximum] = minmax_element(column.decimals.begin(), column.decimals.end());
+                writeColumnChunk(column.decimals.data(), column.decimals.size() * sizeof(double),
+                                 static_cast<int64_t>(*minimum), static_cast<int64_t>(*maximum));
+                column.decimals.clear();
+                break;
+            }
+            case ExportColumnType::Text: {
+                const size_t offsetBytes = column.offsets.size() * sizeof(uint32_t);
+                this->chunks.push_back({this->writer.getOffset(), offsetBytes + column.bytes.size(),
+                                        crc32c(crc32c(0, column.offsets.data(), offsetBytes), column.bytes.data(),
+                                               column.bytes.size()),
+                                        0, 0});
+                this->writer.write(column.offsets.data(), offsetBytes);
+                this->writer.write(column.bytes);
+                column.offsets.assign(1, 0);
+                column.bytes.clear();
+                break;
+            }
+        }
+    }
+    this->groupSizes.push_back(this->groupRows);
+    this->groupRows = 0;
+}
+
+/**
+ * @brief Termina la tabla. En formato columnar escribe el último bloque y el pie.
+ *
+ * @throws runtime_error Si la última fila quedó incompleta.
+ * @author fabian
+ */
+void ExportTable::finish() {
+    if (this->column != 0) throw runtime_error("Faltan valores en la fila del reporte");
+    if (this->format != ExportFormat::Columnar) return;
+
+    flushRowGroup();
+    const uint64_t footerStart = this->writer.getOffset();
+    for (const ExportColumn& column : this->columns) {
+        const auto nameLength = static_cast<uint16_t>(strlen(column.name));
+        this->writer.write(&nameLength, sizeof(nameLength));
+        this->writer.write(column.name, nameLength);
+        this->writer.put(static_cast<char>(column.type));
+    }
+    const auto groupCount = static_cast<uint32_t>(this->groupSizes.size());
+    this->writer.write(&groupCount, sizeof(groupCount));
+    for (uint32_t group = 0; group < groupCount; group++) {
+        this->writer.write(&this->groupSizes[group], sizeof(uint32_t));
+        for (size_t i = 0; i < this->columns.size(); i++) {
+            const ColumnChunk& chunk = this->chunks[group * this->columns.size() + i];
+            this->writer.write(&chunk.offset, sizeof(chunk.offset));
+            this->writer.write(&chunk.size, sizeof(chunk.size));
+            this->writer.write(&chunk.checksum, sizeof(chunk.checksum));
+            this->writer.write(&chunk.minimum, sizeof(chunk.minimum));
+            this->writer.write(&chunk.maximum, sizeof(chunk.maximum));
+        }
+    }
+    const auto footerSize = static_cast<uint32_t>(this->writer.getOffset() - footerStart);
+    this->writer.write(&footerSize, sizeof(footerSize));
+    this->writer.write(COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC));
+}
+
+/**
+ * @brief Obtiene la cantidad de filas escritas.
+ *
+ * @return Número de filas.
+ * @author fabian
+ */
+long long ExportTable::getRowCount() const { return this->rowCount; }
+
+/**
+ * @brief Decide el formato de exportación por la extensión del archivo.
+ *
+ * @param path Ruta del archivo.
+ * @return `JsonLines` para `.jsonl`/`.json`, `Columnar` para `.tcol` y `Csv` en los demás casos.
+ * @author fabian
+ */
+ExportFormat exportFormatFromPath(const string& path) {
+    const size_t dot = path.rfind('.');
+    const string extension = dot == string::npos ? "" : path.substr(dot + 1);
+    if (extension == "jsonl" || extension == "json" || extension == "ndjson") return ExportFormat::JsonLines;
+    if (extension == "tcol") return ExportFormat::Columnar;
+    return ExportFormat::Csv;
+}
+
+/**
+ * @brief Columnas de los reportes de tareas.
+ */
+static const vector<ExportColumn> TASK_COLUMNS = {
+    {"cedula", ExportColumnType::Integer}, {"nombre", ExportColumnType::Text},
+    {"tipo", ExportColumnType::Text},      {"id", ExportColumnType::Integer},
+    {"importancia", ExportColumnType::Text}, {"fecha", ExportColumnType::Date},
+    {"hora", ExportColumnType::Time},      {"descripcion", ExportColumnType::Text},
+};
+
+/**
+ * @brief Escribe una tarea con las columnas de `TASK_COLUMNS`.
+ *
+ * @param table Tabla destino.
+ * @param person Persona dueña de la tarea.
+ * @param task Tarea.
+ * @author fabian
+ */
+static void writeTaskRow(ExportTable& table, const Person& person, const Task& task) {
+    table.integer(person.id);
+    table.text(person.name.view());
+    table.text(task.type->name.view());
+    table.integer(task.id);
+    table.text(task.importance);
+    table.date(task.date);
+    table.time(task.time);
+    table.text(task.description.view());
+    table.endRow();
+}
+
+/**
+ * @brief Obtiene la persona indicada en los argumentos, si hay alguna.
+ *
+ * @param args Argumentos del reporte.
+ * @return La persona, o nullptr si no se indicó ninguna.
+ * @throws runtime_error Si la persona indicada no existe.
+ * @author fabian
+ */
+static const Person* exportPerson(const vector<string>& args) {
+    if (args.empty()) return nullptr;
+    const Person* person = people.findById(stoi(args[0]));
+    if (!person) throw runtime_error("Persona no encontrada");
+    return person;
+}
+
+/**
+ * @brief Aplica una función a cada persona, o solo a la persona indicada.
+ *
+ * @param person Persona indicada, o nullptr para todas.
+ * @param function Función a aplicar.
+ * @author fabian
+ */
+template <class Function>
+static void forEachExportPerson(const Person* person, Function function) {
+    if (person) {
+        function(*person);
+        return;
+    }
+    for (const Person* current = people.head; current; current = current->next) function(*current);
+}
+
+/**
+ * @brief Exporta las tareas activas de cada persona, ordenadas por fecha y hora como en el reporte del menú.
+ *
+ * @param table Tabla destino.
+ * @param person Persona indicada, o nullptr para todas.
+ * @author fabian
+ */
+static void exportActiveTasks(ExportTable& table, const Person* person) {
+    vector<const Task*> tasks;
+    forEachExportPerson(person, [&](const Person& current) {
+        tasks.clear();
+        for (const Task* task = current.activeTasks.head; task; task = task->next) tasks.push_back(task);
+        stable_sort(tasks.begin(), tasks.end(), [](const Task* left, const Task* right) {
+            const auto key = [](const Task* task) {
+                return tuple(task->date.tm_year, task->date.tm_mon, task->date.tm_mday, task->time.tm_hour,
+                             task->time.tm_min, task->time.tm_sec);
+            };
+            return key(left) < key(right);
+        });
+        for (const Task* task : tasks) writeTaskRow(table, current, *task);
+    });
+}
+
+/**
+ * @brief Exporta las tareas completadas, en el orden de los archivos, descomprimiendo un bloque a la vez.
+ *
+ * @param table Tabla destino.
+ * @param person Persona indicada, o nullptr para todas.
+ * @author fabian
+ */
+static void exportCompletedTasks(ExportTable& table, const Person* person) {
+    forEachExportPerson(person, [&](const Person& current) {
+        current.completedTasks.forEach([&](const Task& task) { writeTaskRow(table, current, task); }, false);
+    });
+}
+
+/**
+ * @brief Exporta las subtareas de las tareas activas y completadas.
+ *
+ * @param table Tabla destino, con las columnas de subtareas.
+ * @param person Persona indicada, o nullptr para todas.
+ * @author fabian
+ */
+static void exportSubTasks(ExportTable& table, const Person* person) {
+    forEachExportPerson(person, [&](const Person& current) {
+        const auto writeSubTasks = [&](const Task& task) {
+            for (const SubTask* subTask = task.subTasks.head; subTask; subTask = subTask->next) {
+                table.integer(current.id);
+                table.integer(task.id);
+                table.text(subTask->name.view());
+                table.text(subTask->comments.view());
+                table.decimal(subTask->progress);
+                table.integer(subTask->completed);
+                table.endRow();
+            }
+        };
+        for (const Task* task = current.activeTasks.head; task; task = task->next) writeSubTasks(*task);
+        if (current.completedTasks.getSubTaskCount() > 0) current.completedTasks.forEach(writeSubTasks);
+    });
+}
+
+/**
+ * @brief Exporta los resultados de las consultas del menú de consultas, una fila por clave empatada en el máximo.
+ *
+ * Las consultas 2 y 4 se exportan una vez por cada tipo de tarea; la 4 y la 5 solo si se indica la fecha.
+ *
+ * @param table Tabla destino, con las columnas de consultas.
+ * @param pool Pool de hilos para las consultas.
+ * @param args Argumentos: la fecha límite de las consultas 4 y 5 (opcional).
+ * @author fabian
+ */
+static void exportQueries(ExportTable& table, ThreadPool& pool, const vector<string>& args) {
+    tm limit = {};
+    const bool withDate = !args.empty();
+    if (withDate && !parseDate(args[0], limit)) throw runtime_error("Formato de fecha incorrecto. (dd-mm-YYYY)");
+
+    const auto writePerson = [&](const int query, const string_view parameter, const PersonArgMax& result) {
+        table.integer(query);
+        table.text(parameter);
+        table.text(result.person ? to_string(result.person->id) : "-");
+        table.integer(result.count);
+        table.endRow();
+    };
+    const auto writeCounts = [&](const int query, const string_view parameter, const KeyCounts& counts) {
+        if (counts.entries.empty()) return;
+        const int maxCount = counts.maxCount();
+        for (const string& key : counts.keysWithCount(maxCount)) {
+            table.integer(query);
+            table.text(parameter);
+            table.text(key);
+            table.integer(maxCount);
+            table.endRow();
+        }
+    };
+
+    vector<string> typeNames;
+    if (const TaskType* type = taskTypes.head) {
+        do {
+            typeNames.push_back(type->name);
+            type = type->next;
+        } while (type != taskTypes.head);
+    }
+
+    writePerson(1, "", queryMostActiveTasks(people, pool));
+    for (const string& typeName : typeNames) writePerson(2, typeName, queryMostActiveTasksOfType(people, pool, typeName));
+    writeCounts(3, "", queryActiveTaskTypes(people, pool));
+    if (withDate) {
+        for (const string& typeName : typeNames) {
+            writePerson(4, typeName, queryMostExpiredTasksOfType(people, pool, typeName, limit));
+        }
+        writeCounts(5, args[0], queryExpiredTaskTypes(people, pool, limit));
+    }
+    writeCounts(6, "", queryActiveImportances(people, pool));
+    writeCounts(7, "Medio", queryTaskTypesByImportance(people, pool, false, "Medio"));
+    writeCounts(8, "Alto", queryTaskTypesByImportance(people, pool, true, "Alto"));
+}
+
+/**
+ * @brief Exporta un reporte a un archivo.
+ *
+ * Reportes disponibles y sus argumentos:
+ * - `activas [cedula]`: tareas activas de cada persona, ordenadas por fecha.
+ * - `semana fecha`: tareas activas que vencen en la semana siguiente a la fecha.
+ * - `completadas [cedula]`: tareas completadas.
+ * - `subtareas [cedula]`: subtareas de todas las tareas.
+ * - `progreso [minimo]`: tareas activas con subtareas y al menos ese avance (0 por defecto), de mayor a menor.
+ * - `consultas [fecha]`: resultados de las consultas del menú de consultas.
+ *
+ * El formato se decide por la extensión del archivo (ver `exportFormatFromPath`).
+ *
+ * @param report Nombre del reporte.
+ * @param args Argumentos del reporte.
+ * @param path Ruta del archivo a crear.
+ * @param pool Pool de hilos para los reportes que hacen consultas.
+ * @param background Si es true, la escritura al disco se hace en un hilo aparte.
+ * @return Cantidad de filas y de bytes escritos.
+ * @throws runtime_error Si el reporte no existe, sus argumentos son inválidos o el archivo no se puede escribir.
+ * @author fabian
+ */
+ExportSummary exportReport(const string& report, const vector<string>& args, const string& path, ThreadPool& pool,
+                           const bool background) {
+    static const vector<ExportColumn> subTaskColumns = {
+        {"cedula", ExportColumnType::Integer},  {"tarea", ExportColumnType::Integer},
+        {"nombre", ExportColumnType::Text},     {"comentarios", ExportColumnType::Text},
+        {"progreso", ExportColumnType::Decimal}, {"completada", ExportColumnType::Integer},
+    };
+    static const vector<ExportColumn> progressColumns = {
+        {"cedula", ExportColumnType::Integer},    {"tarea", ExportColumnType::Integer},
+        {"descripcion", ExportColumnType::Text},  {"subtareas", ExportColumnType::Integer},
+        {"completadas", ExportColumnType::Integer}, {"progreso", ExportColumnType::Decimal},
+    };
+    static const vector<ExportColumn> queryColumns = {
+        {"consulta", ExportColumnType::Integer}, {"parametro", ExportColumnType::Text},
+        {"clave", ExportColumnType::Text},       {"cantidad", ExportColumnType::Integer},
+    };
+
+    const vector<ExportColumn>* columns;
+    if (report == "activas" || report == "semana" || report == "completadas") columns = &TASK_COLUMNS;
+    else if (report == "subtareas") columns = &subTaskColumns;
+    else if (report == "progreso") columns = &progressColumns;
+    else if (report == "consultas") columns = &queryColumns;
+    else throw runtime_error("Reporte desconocido: " + report);
+
+    tm from = {};
+    if (report == "semana" && (args.empty() || !parseDate(args[0], from))) {
+        throw runtime_error("Formato de fecha incorrecto. (dd-mm-YYYY)");
+    }
+    const float minProgress = report == "progreso" && !args.empty() ? stof(args[0]) : 0;
+    const bool global = report == "semana" || report == "consultas" || report == "progreso";
+    const Person* person = global ? nullptr : exportPerson(args);
+
+    ExportWriter writer(path, background);
+    ExportTable table(writer, exportFormatFromPath(path), *columns);
+    if (report == "activas") {
+        exportActiveTasks(table, person);
+    } else if (report == "semana") {
+        for (const TaskRow& row : reportTasksDueWithinWeek(people, pool, from)) writeTaskRow(table, *row.person, *row.task);
+    } else if (report == "completadas") {
+        exportCompletedTasks(table, person);
+    } else if (report == "subtareas") {
+        exportSubTasks(table, person);
+    } else if (report == "progreso") {
+        for (const TaskRow& row : reportTasksByProgress(people, pool, minProgress)) {
+            table.integer(row.person->id);
+            table.integer(row.task->id);
+            table.text(row.task->description.view());
+            table.integer(row.task->subTasks.getLength());
+            table.integer(row.task->completedSubTasks);
+            table.decimal(row.task->getProgress());
+            table.endRow();
+        }
+    } else {
+        exportQueries(table, pool, args);
+    }
+    table.finish();
+    writer.finish();
+    return {table.getRowCount(), writer.getOffset()};
+}
@@ -0,0 +1,168 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef REPORTEXPORTER_H
+#define REPORTEXPORTER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../Queries/Queries.h"
+#include "../Storage/Checksum.h"
+#include "../Storage/File.h"
+#include "../utils/DateTime.h"
+
+/**
+ * @brief Formatos a los que se puede exportar un reporte.
+ */
+enum class ExportFormat { Csv, JsonLines, Columnar };
+
+/**
+ * @brief Tipo de los valores de una columna exportada.
+ */
+enum class ExportColumnType : uint8_t { Integer = 1, Decimal = 2, Text = 3, Date = 4, Time = 5 };
+
+/**
+ * @brief Nombre y tipo de una columna exportada.
+ */
+struct ExportColumn {
+    const char* name;
+    ExportColumnType type;
+};
+
+/**
+ * @brief Resultado de una exportación.
+ */
+struct ExportSummary {
+    long long rows = 0;
+    uint64_t bytes = 0;
+};
+
+constexpr char COLUMNAR_MAGIC[8] = {'T', 'A', 'S', 'K', 'C', 'O', 'L', '\0'};
+constexpr uint32_t COLUMNAR_VERSION = 1;
+
+/**
+ * @brief Escritor con un búfer grande y, opcionalmente, un hilo que escribe en el disco mientras se llena el siguiente.
+ *
+ * Con el hilo de escritura hay dos búferes: cuando el actual se llena se entrega al hilo y se sigue formateando en
+ * el otro, así que el formateo y la escritura al disco se solapan. El archivo se escribe con FileWriter y solo
+ * reemplaza al destino al llamar a `finish()`.
+ */
+class ExportWriter {
+public:
+    ExportWriter(const string& path, bool background, size_t bufferSize = 8 << 20);
+    ~ExportWriter();
+
+    ExportWriter(const ExportWriter&) = delete;
+    ExportWriter& operator=(const ExportWriter&) = delete;
+
+    void write(const void* data, size_t size);
+    void write(string_view text);
+    void put(char character);
+    void finish();
+
+    [[nodiscard]] uint64_t getOffset() const;
+
+private:
+    static constexpr size_t SYNC_INTERVAL = 64 << 20;
+
+    FileWriter file;
+    vector<char> current;
+    vector<char> spare;
+    size_t used = 0;
+    uint64_t offset = 0;
+
+    bool background;
+    thread writer;
+    mutex lock;
+    condition_variable changed;
+    size_t pendingSize = 0;
+    bool pending = false;
+    bool stopping = false;
+    exception_ptr error;
+
+    void handOff();
+    void stopWriter();
+    void writerLoop();
+};
+
+/**
+ * @brief Tabla que se exporta fila por fila en CSV, JSON por líneas o en formato columnar.
+ *
+ * Los valores de cada fila se agregan en el orden de las columnas y la fila se cierra con `endRow()`.
+ *
+ * El formato columnar se parece a Parquet: el archivo empieza con `COLUMNAR_MAGIC` y la versión, y las filas se
+ * agrupan en bloques de `ROW_GROUP_SIZE`. Dentro de cada bloque cada columna se guarda contigua: los enteros, las
+ * fechas (AAAAMMDD) y las horas (segundos desde la medianoche) como `int64`, los decimales como `double` y los
+ * textos como `rows + 1` desplazamientos `uint32` seguidos de los bytes. Al final va el pie: las columnas (nombre y
+ * tipo) y, por cada bloque, su cantidad de filas y, por cada columna, su posición, tamaño, CRC-32C y el mínimo y
+ * máximo de los valores numéricos. El archivo termina con el tamaño del pie y otra vez `COLUMNAR_MAGIC`.
+ */
+class ExportTable {
+public:
+    static constexpr uint32_t ROW_GROUP_SIZE = 65536;
+
+    ExportTable(ExportWriter& writer, ExportFormat format, vector<ExportColumn> columns);
+
+    void integer(long long value);
+    void decimal(float value);
+    void text(string_view value);
+    void date(const tm& value);
+    void time(const tm& value);
+    void endRow();
+    void finish();
+
+    [[nodiscard]] long long getRowCount() const;
+
+private:
+    /**
+     * @brief Valores de una columna en el bloque actual del formato columnar.
+     */
+    struct ColumnData {
+        vector<int64_t> integers;
+        vector<double> decimals;
+        vector<uint32_t> offsets{0};
+        string bytes;
+    };
+
+    /**
+     * @brief Posición y estadísticas de una columna dentro de un bloque escrito.
+     */
+    struct ColumnChunk {
+        uint64_t offset;
+        uint64_t size;
+        uint32_t checksum;
+        int64_t minimum;
+        int64_t maximum;
+    };
+
+    ExportWriter& writer;
+    ExportFormat format;
+    vector<ExportColumn> columns;
+    size_t column = 0;
+    long long rowCount = 0;
+
+    vector<ColumnData> data;
+    uint32_t groupRows = 0;
+    vector<uint32_t> groupSizes;
+    vector<ColumnChunk> chunks;
+
+    void beginValue(ExportColumnType type);
+    void writeQuoted(string_view value);
+    void writeColumnChunk(const void* bytes, size_t size, int64_t minimum, int64_t maximum);
+    void flushRowGroup();
+};
+
+ExportFormat exportFormatFromPath(const string& path);
+ExportSummary exportReport(const string& report, const vector<string>& args, const string& path, ThreadPool& pool,
+                           bool background);
+
+#include "ReportExporter.cpp"
+#endif //REPORTEXPORTER_H
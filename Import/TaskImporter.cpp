@@ -0,0 +1,515 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "TaskImporter.h"
+
+#include <algorithm>
+#include <charconv>
+#include <iostream>
+#include <unordered_set>
+
+/**
+ * @brief Posición de cada campo dentro de una fila, en el orden de las columnas del CSV.
+ */
+enum ImportField { FieldPersonId, FieldType, FieldImportance, FieldDate, FieldTime, FieldCompleted, FieldDescription };
+
+static const char* const IMPORT_FIELD_NAMES[] = {"cedula", "tipo", "importancia", "fecha", "hora", "completada",
+                                                 "descripcion"};
+
+/**
+ * @brief Constructor de la clase TaskImporter.
+ *
+ * Guarda los nombres de los tipos de tarea existentes para no recorrer la lista circular en cada fila.
+ *
+ * @param pool Pool de hilos donde se interpretan los bloques.
+ * @param parseThreads Cantidad de partes en que se divide cada bloque (1 para interpretar en un solo hilo).
+ * @author fabian
+ */
+TaskImporter::TaskImporter(ThreadPool& pool, const unsigned parseThreads)
+    : pool(pool), parseThreads(max(parseThreads, 1u)) {
+    TaskType* current = taskTypes.head;
+    if (!current) return;
+    do {
+        this->typeNames.emplace_back(current->name, current);
+        current = current->next;
+    } while (current != taskTypes.head);
+}
+
+/**
+ * @brief Decide el formato de un archivo por su extensión o, si no la reconoce, por su primer carácter.
+ *
+ * @param path Ruta del archivo.
+ * @param input Archivo ya abierto; se revisa su primer carácter sin consumirlo.
+ * @return `JsonLines` para `.jsonl`, `.json` o contenido que empieza con `{`; `Csv` en los demás casos.
+ * @author fabian
+ */
+ImportFormat TaskImporter::detectFormat(const string& path, FILE* input) {
+    const size_t dot = path.rfind('.');
+    const string extension = dot == string::npos ? "" : path.substr(dot + 1);
+    if (extension == "jsonl" || extension == "json" || extension == "ndjson") return ImportFormat::JsonLines;
+    if (extension == "csv") return ImportFormat::Csv;
+
+    const int first = fgetc(input);
+    if (first == EOF) return ImportFormat::Csv;
+    ungetc(first, input);
+    return first == '{' ? ImportFormat::JsonLines : ImportFormat::Csv;
+}
+
+/**
+ * @brief Importa todas las tareas de un archivo.
+ *
+ * Lee la entrada por bloques grandes, interpreta cada bloque en paralelo y acumula las filas válidas. Al final
+ * las agrega a las personas con una sola pasada por lista.
+ *
+ * @param input Archivo o entrada estándar con las filas.
+ * @param format Formato de las filas.
+ * @return Cantidad de filas leídas, importadas y con error.
+ * @author fabian
+ */
+ImportSummary TaskImporter::run(FILE* input, const ImportFormat format) {
+    this->summary = {};
+    this->rows.clear();
+    this->firstLine = true;
+
+    vector<ParsedPart> parts(this->parseThreads);
+    vector<char> buffer(CHUNK_SIZE);
+    size_t pending = 0;
+    long long lineNumber = 1;
+
+    while (true) {
+        const size_t read = fread(buffer.data() + pending, 1, buffer.size() - pending, input);
+        const size_t available = pending + read;
+        const bool finished = read == 0;
+
+        size_t end = available;
+        if (!finished) {
+            const size_t lastNewline = string_view(buffer.data(), available).rfind('\n');
+            if (lastNewline == string_view::npos) {
+                pending = available;
+                if (pending == buffer.size()) buffer.resize(buffer.size() * 2);
+                continue;
+            }
+            end = lastNewline + 1;
+        }
+
+        const string_view chunk(buffer.data(), end);
+        parseChunk(chunk, lineNumber, format, parts);
+        lineNumber += count(chunk.begin(), chunk.end(), '\n');
+        if (finished) break;
+
+        pending = available - end;
+        copy(buffer.begin() + static_cast<long>(end), buffer.begin() + static_cast<long>(available), buffer.begin());
+    }
+
+    applyRows();
+    return this->summary;
+}
+
+/**
+ * @brief Interpreta un bloque de líneas completas, dividido en partes que se procesan en paralelo.
+ *
+ * Cada parte empieza justo después de un salto de línea, así que ninguna línea queda repartida entre dos hilos.
+ * Las filas se juntan en el orden del archivo.
+ *
+ * @param chunk Bloque de líneas completas.
+ * @param firstLineNumber Número de la primera línea del bloque en el archivo.
+ * @param format Formato de las filas.
+ * @param parts Partes reutilizables, una por hilo de interpretación.
+ * @author fabian
+ */
+void TaskImporter::parseChunk(string_view chunk, long long firstLineNumber, const ImportFormat format,
+                              vector<ParsedPart>& parts) {
+    if (this->firstLine) {
+        this->firstLine = false;
+        if (format == ImportFormat::Csv && chunk.substr(0, 6) == "cedula") {
+            const size_t newline = chunk.find('\n');
+            chunk.remove_prefix(newline == string_view::npos ? chunk.size() : newline + 1);
+            ++firstLineNumber;
+        }
+    }
+
+    const size_t partCount = chunk.size() < (64 << 10) ? 1 : parts.size();
+    vector<string_view> texts(partCount);
+    vector<long long> firstLines(partCount);
+    size_t start = 0;
+    for (size_t i = 0; i < partCount; i++) {
+        size_t end = chunk.size();
+        if (i + 1 < partCount) {
+            end = max(start, chunk.size() * (i + 1) / partCount);
+            const size_t newline = chunk.find('\n', end);
+            end = newline == string_view::npos ? chunk.size() : newline + 1;
+        }
+        texts[i] = chunk.substr(start, end - start);
+        firstLines[i] = firstLineNumber;
+        firstLineNumber += count(texts[i].begin(), texts[i].end(), '\n');
+        start = end;
+    }
+
+    const auto parse = [&](const int i) { parsePart(texts[i], firstLines[i], format, parts[i]); };
+    if (partCount == 1) parse(0);
+    else this->pool.parallelFor(static_cast<int>(partCount), parse);
+
+    for (size_t i = 0; i < partCount; i++) {
+        ParsedPart& part = parts[i];
+        this->summary.rows += static_cast<long long>(part.rows.size() + part.errors.size());
+        this->rows.insert(this->rows.end(), part.rows.begin(), part.rows.end());
+        for (const ImportError& error : part.errors) {
+            if (this->summary.errors++ < MAX_REPORTED_ERRORS) cerr << "Linea " << error.line << ": " << error.message << endl;
+        }
+        part.rows.clear();
+        part.errors.clear();
+    }
+}
+
+/**
+ * @brief Interpreta todas las líneas de una parte de un bloque.
+ *
+ * @param text Líneas completas de la parte.
+ * @param firstLineNumber Número de la primera línea de la parte en el archivo.
+ * @param format Formato de las filas.
+ * @param part Donde se guardan las filas y los errores.
+ * @author fabian
+ */
+void TaskImporter::parsePart(string_view text, long long firstLineNumber, const ImportFormat format,
+                             ParsedPart& part) const {
+    while (!text.empty()) {
+        const size_t newline = text.find('\n');
+        string_view line = text.substr(0, newline);
+        text.remove_prefix(newline == string_view::npos ? text.size() : newline + 1);
+
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        if (!line.empty()) {
+            try {
+                parseLine(line, firstLineNumber, format, part);
+            } catch (const exception& error) {
+                part.errors.push_back({firstLineNumber, error.what()});
+            }
+        }
+        ++firstLineNumber;
+    }
+}
+
+/**
+ * @brief Separa una línea CSV en sus campos.
+ *
+ * Un campo entre comillas puede contener comas, y `""` representa una comilla; en ese caso el campo se copia sin
+ * las comillas dobles al búfer del campo. Los demás campos apuntan directamente a la línea.
+ *
+ * @param line Línea a separar.
+ * @param fields Campos de la fila.
+ * @param scratch Búferes para los campos que necesitan quitar comillas dobles.
+ * @throws runtime_error Si la cantidad de campos no es la esperada o una comilla no se cierra.
+ * @author fabian
+ */
+static void splitCsvLine(string_view line, string_view* fields, string* scratch) {
+    int fieldCount = 0;
+    while (true) {
+        if (fieldCount == 7) throw runtime_error("Demasiados campos");
+        string_view& field = fields[fieldCount];
+
+        if (!line.empty() && line.front() == '"') {
+            size_t position = 1;
+            bool escaped = false;
+            while (true) {
+                const size_t quote = line.find('"', position);
+                if (quote == string_view::npos) throw runtime_error("Comillas sin cerrar");
+                if (quote + 1 < line.size() && line[quote + 1] == '"') {
+                    escaped = true;
+                    position = quote + 2;
+                    continue;
+                }
+                position = quote;
+                break;
+            }
+            field = line.substr(1, position - 1);
+            if (escaped) {
+                string& unescaped = scratch[fieldCount];
+                unescaped.clear();
+                for (size_t i = 0; i < field.size(); i++) {
+                    unescaped += field[i];
+                    if (field[i] == '"') ++i;
+                }
+                field = unescaped;
+            }
+            line.remove_prefix(position + 1);
+            ++fieldCount;
+            if (line.empty()) break;
+            if (line.front() != ',') throw runtime_error("Texto despues de las comillas");
+            line.remove_prefix(1);
+            continue;
+        }
+
+        const size_t comma = line.find(',');
+        field = line.substr(0, comma);
+        ++fieldCount;
+        if (comma == string_view::npos) break;
+        line.remove_prefix(comma + 1);
+    }
+    if (fieldCount != 7) throw runtime_error("Faltan campos");
+}
+
+/**
+ * @brief Agrega un carácter Unicode a una cadena codificado en UTF-8.
+ *
+ * @param text Cadena destino.
+ * @param codePoint Carácter a agregar.
+ * @author fabian
+ */
+static void appendUtf8(string& text, const uint32_t codePoint) {
+    if (codePoint < 0x80) {
+        text += static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        text += static_cast<char>(0xC0 | codePoint >> 6);
+        text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        text += static_cast<char>(0xE0 | codePoint >> 12);
+        text += static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+        text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        text += static_cast<char>(0xF0 | codePoint >> 18);
+        text += static_cast<char>(0x80 | (codePoint >> 12 & 0x3F));
+        text += static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+        text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+/**
+ * @brief Lee los cuatro dígitos hexadecimales de un escape `\uXXXX`.
+ *
+ * @param text Texto que empieza con los dígitos.
+ * @return El valor leído.
+ * @throws runtime_error Si no hay cuatro dígitos hexadecimales.
+ * @author fabian
+ */
+static uint32_t readHexEscape(const string_view text) {
+    uint32_t value = 0;
+    if (text.size() < 4 || from_chars(text.data(), text.data() + 4, value, 16).ptr != text.data() + 4) {
+        throw runtime_error("Escape \\u invalido");
+    }
+    return value;
+}
+
+/**
+ * @brief Lee una cadena JSON que empieza después de su comilla inicial y la consume junto con la comilla final.
+ *
+ * Si la cadena no tiene escapes, el resultado apunta directamente a la línea; si los tiene, se decodifica en
+ * `scratch`, incluidos los pares sustitutos de `\u`.
+ *
+ * @param line Texto que empieza justo después de la comilla inicial.
+ * @param scratch Búfer para la cadena decodificada.
+ * @return La cadena.
+ * @throws runtime_error Si la cadena no se cierra o tiene un escape inválido.
+ * @author fabian
+ */
+static string_view readJsonString(string_view& line, string& scratch) {
+    size_t end = 0;
+    while (end < line.size() && line[end] != '"' && line[end] != '\\') ++end;
+    if (end == line.size()) throw runtime_error("Cadena sin cerrar");
+    if (line[end] == '"') {
+        const string_view value = line.substr(0, end);
+        line.remove_prefix(end + 1);
+        return value;
+    }
+
+    scratch.assign(line.data(), end);
+    size_t i = end;
+    while (true) {
+        if (i == line.size()) throw runtime_error("Cadena sin cerrar");
+        const char character = line[i++];
+        if (character == '"') break;
+        if (character != '\\') {
+            scratch += character;
+            continue;
+        }
+        if (i == line.size()) throw runtime_error("Cadena sin cerrar");
+        switch (line[i++]) {
+            case '"': scratch += '"'; break;
+            case '\\': scratch += '\\'; break;
+            case '/': scratch += '/'; break;
+            case 'b': scratch += '\b'; break;
+            case 'f': scratch += '\f'; break;
+            case 'n': scratch += '\n'; break;
+            case 'r': scratch += '\r'; break;
+            case 't': scratch += '\t'; break;
+            case 'u': {
+                uint32_t codePoint = readHexEscape(line.substr(i));
+                i += 4;
+                if (codePoint >= 0xD800 && codePoint < 0xDC00 && line.substr(i, 2) == "\\u") {
+                    const uint32_t low = readHexEscape(line.substr(i + 2));
+                    if (low >= 0xDC00 && low < 0xE000) {
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                        i += 6;
+                    }
+                }
+                appendUtf8(scratch, codePoint);
+                break;
+            }
+            default: throw runtime_error("Escape invalido");
+        }
+    }
+    line.remove_prefix(i);
+    return scratch;
+}
+
+/**
+ * @brief Quita los espacios al inicio de un texto.
+ *
+ * @param text Texto a recortar.
+ * @author fabian
+ */
+static void skipJsonSpaces(string_view& text) {
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+}
+
+/**
+ * @brief Separa una línea JSON, con un objeto plano, en los campos de una fila.
+ *
+ * Los valores pueden ser cadenas, números o `true`/`false`; las llaves desconocidas se ignoran.
+ *
+ * @param line Línea con el objeto.
+ * @param fields Campos de la fila.
+ * @param scratch Búferes para las cadenas con escapes.
+ * @throws runtime_error Si el objeto está mal formado o falta alguna llave.
+ * @author fabian
+ */
+static void splitJsonLine(string_view line, string_view* fields, string* scratch) {
+    bool present[7] = {};
+    string keyScratch;
+
+    skipJsonSpaces(line);
+    if (line.empty() || line.front() != '{') throw runtime_error("Se esperaba un objeto");
+    line.remove_prefix(1);
+    skipJsonSpaces(line);
+
+    while (!line.empty() && line.front() != '}') {
+        if (line.front() != '"') throw runtime_error("Se esperaba una llave");
+        line.remove_prefix(1);
+        const string_view key = readJsonString(line, keyScratch);
+        skipJsonSpaces(line);
+        if (line.empty() || line.front() != ':') throw runtime_error("Se esperaba ':'");
+        line.remove_prefix(1);
+        skipJsonSpaces(line);
+
+        int index = -1;
+        for (int i = 0; i < 7; i++) {
+            if (key == IMPORT_FIELD_NAMES[i]) index = i;
+        }
+
+        string_view value;
+        string unused;
+        if (!line.empty() && line.front() == '"') {
+            line.remove_prefix(1);
+            value = readJsonString(line, index >= 0 ? scratch[index] : unused);
+        } else {
+            size_t end = 0;
+            while (end < line.size() && line[end] != ',' && line[end] != '}' && line[end] != ' ') ++end;
+            value = line.substr(0, end);
+            line.remove_prefix(end);
+            if (value.empty()) throw runtime_error("Valor vacio");
+        }
+        if (index >= 0) {
+            fields[index] = value;
+            present[index] = true;
+        }
+
+        skipJsonSpaces(line);
+        if (!line.empty() && line.front() == ',') {
+            line.remove_prefix(1);
+            skipJsonSpaces(line);
+        }
+    }
+    if (line.empty()) throw runtime_error("Objeto sin cerrar");
+
+    for (int i = 0; i < 7; i++) {
+        if (!present[i]) throw runtime_error(string("Falta la llave ") + IMPORT_FIELD_NAMES[i]);
+    }
+}
+
+/**
+ * @brief Interpreta una línea y agrega su fila a la parte.
+ *
+ * @param line Línea sin el salto de línea.
+ * @param lineNumber Número de la línea en el archivo.
+ * @param format Formato de la línea.
+ * @param part Donde se guarda la fila.
+ * @throws runtime_error Si algún campo es inválido o el tipo no existe. La persona se valida al agregar las filas.
+ * @author fabian
+ */
+void TaskImporter::parseLine(const string_view line, const long long lineNumber, const ImportFormat format,
+                             ParsedPart& part) const {
+    string_view fields[FIELD_COUNT];
+    if (format == ImportFormat::Csv) splitCsvLine(line, fields, part.scratch);
+    else splitJsonLine(line, fields, part.scratch);
+
+    int personId = 0;
+    const string_view idText = fields[FieldPersonId];
+    const auto [idEnd, idError] = from_chars(idText.data(), idText.data() + idText.size(), personId);
+    if (idError != errc() || idEnd != idText.data() + idText.size()) {
+        throw runtime_error("Cedula invalida: " + string(idText));
+    }
+
+    TaskType* type = findType(fields[FieldType]);
+    if (!type) throw runtime_error("Tipo de tarea no encontrado: " + string(fields[FieldType]));
+
+    const string_view importance = fields[FieldImportance];
+    if (importance != "Alto" && importance != "Medio" && importance != "Bajo") {
+        throw runtime_error("Importancia invalida: " + string(importance));
+    }
+
+    tm date = {};
+    tm time = {};
+    if (!parseDate(fields[FieldDate], date)) throw runtime_error("Formato de fecha incorrecto. (dd-mm-YYYY)");
+    if (!parseTime(fields[FieldTime], time)) throw runtime_error("Formato de hora incorrecto. (HH:MM:SS)");
+
+    const string_view completedText = fields[FieldCompleted];
+    bool completed;
+    if (completedText == "1" || completedText == "true" || completedText == "si") completed = true;
+    else if (completedText.empty() || completedText == "0" || completedText == "false" || completedText == "no") completed = false;
+    else throw runtime_error("Valor de completada invalido: " + string(completedText));
+
+    auto* task = new Task(0, string(), string(importance), date, time, type);
+    task->description = fields[FieldDescription];
+    part.rows.push_back({{personId, completed, task}, lineNumber});
+}
+
+/**
+ * @brief Agrega a las personas todas las filas importadas.
+ *
+ * Entrega todas las filas juntas a `addTaskBatch`, que agrupa las tareas por persona y por lista, las ordena por
+ * fecha y hora de vencimiento (y por línea entre las que vencen a la vez) y recorre la lista de cada persona una
+ * sola vez sin importar cuántas tareas reciba. Si la persona no existe, todas sus filas cuentan como errores.
+ *
+ * @author fabian
+ */
+void TaskImporter::applyRows() {
+    vector<TaskRecord> records;
+    records.reserve(this->rows.size());
+    for (const ImportRow& row : this->rows) records.push_back(row.record);
+    const vector<size_t> rejected = addTaskBatch(records);
+
+    this->summary.imported += static_cast<long long>(records.size() - rejected.size());
+    unordered_set<int> reported;
+    for (const size_t index : rejected) {
+        const ImportRow& row = this->rows[index];
+        delete row.record.task;
+        if (this->summary.errors++ < MAX_REPORTED_ERRORS && reported.insert(row.record.personId).second) {
+            cerr << "Linea " << row.line << ": Persona no encontrada: " << row.record.personId << endl;
+        }
+    }
+    this->rows.clear();
+}
+
+/**
+ * @brief Busca un tipo de tarea por su nombre.
+ *
+ * @param name Nombre del tipo.
+ * @return El tipo, o nullptr si no existe.
+ * @author fabian
+ */
+TaskType* TaskImporter::findType(const string_view name) const {
+    for (const auto& [typeName, type] : this->typeNames) {
+        if (typeName == name) return type;
+    }
+    return nullptr;
+}
@@ -0,0 +1,98 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef TASKIMPORTER_H
+#define TASKIMPORTER_H
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Engine/Operations.h"
+#include "../utils/DateTime.h"
+#include "../utils/ThreadPool.h"
+
+/**
+ * @brief Formatos de archivo que acepta el importador.
+ */
+enum class ImportFormat { Csv, JsonLines };
+
+/**
+ * @brief Resultado de una importación.
+ */
+struct ImportSummary {
+    long long rows = 0;
+    long long imported = 0;
+    long long errors = 0;
+};
+
+/**
+ * @brief Importador masivo de tareas desde CSV o JSON por líneas.
+ *
+ * Cada fila describe una tarea con los campos `cedula`, `tipo`, `importancia`, `fecha` ("dd-mm-YYYY"),
+ * `hora` ("HH:MM:SS"), `completada` y `descripcion`. En CSV van en ese orden, separados por comas y
+ * opcionalmente entre comillas (con `""` para una comilla); una primera línea que empieza con `cedula` se toma como
+ * encabezado. En JSON por líneas cada línea es un objeto plano con esas llaves.
+ *
+ * La entrada se lee por bloques; cada bloque se corta en líneas completas y se reparte entre los hilos de
+ * interpretación. Al terminar, todas las filas se agregan juntas con `addTaskBatch`, que las agrupa por persona,
+ * las ordena por fecha de vencimiento y entrega a cada persona todas sus tareas nuevas de una sola vez. Las filas
+ * inválidas se cuentan como errores y no detienen la importación.
+ */
+class TaskImporter {
+public:
+    TaskImporter(ThreadPool& pool, unsigned parseThreads);
+
+    ImportSummary run(FILE* input, ImportFormat format);
+
+    static ImportFormat detectFormat(const string& path, FILE* input);
+
+private:
+    static constexpr size_t CHUNK_SIZE = 4 << 20;
+    static constexpr int FIELD_COUNT = 7;
+    static constexpr int MAX_REPORTED_ERRORS = 10;
+
+    /**
+     * @brief Fila ya interpretada y su número de línea.
+     */
+    struct ImportRow {
+        TaskRecord record;
+        long long line;
+    };
+
+    /**
+     * @brief Fila inválida y el motivo.
+     */
+    struct ImportError {
+        long long line;
+        string message;
+    };
+
+    /**
+     * @brief Filas y errores de una parte de un bloque, con los búferes que reutiliza su hilo.
+     */
+    struct ParsedPart {
+        vector<ImportRow> rows;
+        vector<ImportError> errors;
+        string scratch[FIELD_COUNT];
+    };
+
+    ThreadPool& pool;
+    unsigned parseThreads;
+    vector<pair<string, TaskType*>> typeNames;
+    vector<ImportRow> rows;
+    ImportSummary summary;
+    bool firstLine = true;
+
+    void parseChunk(string_view chunk, long long firstLineNumber, ImportFormat format, vector<ParsedPart>& parts);
+    void parsePart(string_view text, long long firstLineNumber, ImportFormat format, ParsedPart& part) const;
+    void parseLine(string_view line, long long lineNumber, ImportFormat format, ParsedPart& part) const;
+    void applyRows();
+
+    [[nodiscard]] TaskType* findType(string_view name) const;
+};
+
+#include "TaskImporter.cpp"
+#endif //TASKIMPORTER_H
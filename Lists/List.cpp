@@ -47,6 +47,28 @@ void List<T>::insertFirst(T* newNode) {
     ++length;
 }
 
+/**
+ * @brief Inserta un nuevo nodo después de otro nodo de la lista, en tiempo constante.
+ *
+ * Permite construir una lista completa de forma lineal guardando el último nodo insertado.
+ *
+ * @param previousNode Nodo tras el cual se inserta, o `nullptr` para insertar al principio.
+ * @param newNode Puntero al nuevo nodo.
+ * @return El nodo insertado.
+ * @author fabian
+ */
+template <class T>
+T* List<T>::insertAfter(T* previousNode, T* newNode) {
+    if (!previousNode) {
+        insertFirst(newNode);
+        return newNode;
+    }
+    newNode->next = previousNode->next;
+    previousNode->next = newNode;
+    ++length;
+    return newNode;
+}
+
 /**
  * @brief Obtiene un nodo de la lista en el índice especificado.
  *
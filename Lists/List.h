@@ -19,6 +19,7 @@ public:
 
     void insertLast(T* newNode);
     void insertFirst(T* newNode);
+    T* insertAfter(T* previousNode, T* newNode);
 
     [[nodiscard]] T* get(int index) const;
     [[nodiscard]] T* findById(int id) const;
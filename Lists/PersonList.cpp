@@ -19,56 +19,65 @@ PersonList::PersonList() {
  * @brief Inserta una nueva persona en la lista en orden ascendente por ID.
  *
  * Crea e inserta un nuevo nodo `Person` en la lista manteniendo el orden ascendente
- * por el identificador. Si el ID ya existe, lanza una excepción.
+ * por el identificador. La posición se obtiene del índice por cédula, sin recorrer la lista.
+ * Si el ID ya existe, lanza una excepción.
  *
  * @param id Identificador único de la persona.
  * @param name Nombre de la persona.
  * @param lastname Apellido de la persona.
  * @param age Edad de la persona.
+ * @return La persona insertada.
  * @throws std::exception Si el ID ya existe en la lista.
  * @author fabian
  */
-void PersonList::insert(const int id, const string& name, const string& lastname, const int age) {
-    if (this->head == nullptr) {
-        this->head = new Person(id, name, lastname, age);
-        this->length++;
-        return;
-    }
-
-    if (id < this->head->id) {
-        const auto newNode = new Person(id, name, lastname, age);
-        newNode->next = this->head;
-        this->head->prev = newNode;
-        this->head = newNode;
-        this->length++;
-        return;
-    }
+Person* PersonList::insert(const int id, const string& name, const string& lastname, const int age) {
+    const auto successor = this->index.lower_bound(id);
+    if (successor != this->index.end() && successor->first == id) throw std::exception();
 
-    Person* currentNode = this->head;
+    const auto newNode = new Person(id, name, lastname, age);
+    link(newNode, successor);
+    return newNode;
+}
 
-    while (currentNode != nullptr) {
-        if (id == currentNode->id) throw std::exception();
-
-        if (id < currentNode->id) {
-            const auto newNode = new Person(id, name, lastname, age);
-            newNode->next = currentNode;
-            newNode->prev = currentNode->prev;
-            currentNode->prev->next = newNode;
-            currentNode->prev = newNode;
-            this->length++;
-            break;
-        }
-
-        if (currentNode->next == nullptr) {
-            const auto newNode = new Person(id, name, lastname, age);
-            newNode->prev = currentNode;
-            currentNode->next = newNode;
-            ++this->length;
-            break;
-        }
+/**
+ * @brief Inserta en orden una persona ya creada que no está en ninguna lista.
+ *
+ * Insertar las personas en orden ascendente de cédula toma tiempo constante amortizado por persona.
+ *
+ * @param person Persona a insertar; su cédula no debe estar en la lista.
+ * @author fabian
+ */
+void PersonList::adopt(Person* person) {
+    person->next = nullptr;
+    person->prev = nullptr;
+    link(person, this->index.lower_bound(person->id));
+}
 
-        currentNode = currentNode->next;
+/**
+ * @brief Enlaza una persona antes de su sucesora y la agrega al índice.
+ *
+ * @param newNode Persona a enlazar.
+ * @param successor Posición en el índice de la primera cédula mayor.
+ * @author fabian
+ */
+void PersonList::link(Person* newNode, const map<int, Person*>::iterator successor) {
+    if (successor != this->index.end()) {
+        Person* nextNode = successor->second;
+        newNode->next = nextNode;
+        newNode->prev = nextNode->prev;
+        if (nextNode->prev) nextNode->prev->next = newNode;
+        else this->head = newNode;
+        nextNode->prev = newNode;
+    } else if (!this->index.empty()) {
+        Person* lastNode = this->index.rbegin()->second;
+        newNode->prev = lastNode;
+        lastNode->next = newNode;
+    } else {
+        this->head = newNode;
     }
+
+    this->index.emplace_hint(successor, newNode->id, newNode);
+    ++this->length;
 }
 
 /**
@@ -81,21 +90,51 @@ void PersonList::insert(const int id, const string& name, const string& lastname
  * @return Puntero a la persona eliminada, o `nullptr` si no se encuentra.
  * @author fabian
  */
-Person* PersonList::remove(int id) {
-    Person* currentNode = this->head;
-
-    while (currentNode != nullptr) {
-        if (currentNode->id == id) {
-            currentNode->prev->next = currentNode->next;
-            currentNode->next->prev = currentNode->prev;
-            --this->length;
-            return currentNode;
-        }
+Person* PersonList::remove(const int id) {
+    const auto found = this->index.find(id);
+    if (found == this->index.end()) return nullptr;
+
+    Person* currentNode = found->second;
+    if (currentNode->prev) currentNode->prev->next = currentNode->next;
+    else this->head = currentNode->next;
+    if (currentNode->next) currentNode->next->prev = currentNode->prev;
+
+    currentNode->next = nullptr;
+    currentNode->prev = nullptr;
+    this->index.erase(found);
+    --this->length;
+    return currentNode;
+}
 
-        currentNode = currentNode->next;
-    }
+/**
+ * @brief Elimina una persona de la lista por su ID.
+ *
+ * Equivale a `remove`; oculta la versión de `List` para mantener el índice por cédula y los punteros `prev`.
+ *
+ * @param id Identificador único de la persona a eliminar.
+ * @return Puntero a la persona eliminada, o `nullptr` si no se encuentra.
+ * @author fabian
+ */
+Person* PersonList::removeById(const int id) {
+    return remove(id);
+}
 
-    return nullptr;
+/**
+ * @brief Reemplaza una persona de la lista por otra con la misma cédula, en la misma posición.
+ *
+ * @param current Persona que está en la lista; queda fuera de ella.
+ * @param replacement Persona que la reemplaza.
+ * @author fabian
+ */
+void PersonList::replace(Person* current, Person* replacement) {
+    replacement->prev = current->prev;
+    replacement->next = current->next;
+    if (current->prev) current->prev->next = replacement;
+    else this->head = replacement;
+    if (current->next) current->next->prev = replacement;
+    this->index[current->id] = replacement;
+    current->next = nullptr;
+    current->prev = nullptr;
 }
 
 /**
@@ -127,14 +166,20 @@ Person* PersonList::get(int index) const {
  * @return Puntero a la persona con el ID especificado, o `nullptr` si no se encuentra.
  * @author fabian
  */
-Person* PersonList::getById(int id) const {
-    Person* currentNode = this->head;
-
-    while (currentNode != nullptr) {
-        if (currentNode->id == id) return currentNode;
-        if (currentNode->id > id) return nullptr;
-        currentNode = currentNode->next;
-    }
+Person* PersonList::getById(const int id) const {
+    const auto found = this->index.find(id);
+    return found == this->index.end() ? nullptr : found->second;
+}
 
-    return nullptr;
-}
\ No newline at end of file
+/**
+ * @brief Busca una persona en la lista por su ID usando el índice por cédula.
+ *
+ * Oculta la búsqueda lineal de `List`.
+ *
+ * @param id Identificador único de la persona a buscar.
+ * @return Puntero a la persona con el ID especificado, o `nullptr` si no se encuentra.
+ * @author fabian
+ */
+Person* PersonList::findById(const int id) const {
+    return getById(id);
+}
@@ -5,16 +5,26 @@
 #ifndef PERSONLIST_H
 #define PERSONLIST_H
 
+#include <map>
+
 #include "List.h"
 #include "../Structures/Person.h"
 
 class PersonList : public List<Person> {
 public:
     PersonList();
-    void insert(int id, const string& name, const string& lastname, int age);
+    Person* insert(int id, const string& name, const string& lastname, int age);
+    void adopt(Person* person);
     Person* remove(int id);
+    Person* removeById(int id);
+    void replace(Person* current, Person* replacement);
     [[nodiscard]] Person* get(int index) const;
     [[nodiscard]] Person* getById(int id) const;
+    [[nodiscard]] Person* findById(int id) const;
+private:
+    map<int, Person*> index;
+
+    void link(Person* newNode, map<int, Person*>::iterator successor);
 };
 
 #include "PersonList.cpp"
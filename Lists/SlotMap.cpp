@@ -0,0 +1,173 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "SlotMap.h"
+
+#include <stdexcept>
+
+/**
+ * @brief Constructor de la clase SlotMap. Reserva la tabla de bloques, vacía; cada bloque de ranuras se crea al
+ * usar su primera ranura. La ranura 0 no se usa, para que ningún handle válido sea 0.
+ * @author fabian
+ */
+template <class T>
+SlotMap<T>::SlotMap() : chunks(new atomic<Slot*>[MAX_CHUNKS]()) {}
+
+/**
+ * @brief Destructor de la clase SlotMap. Libera las ranuras, no los objetos registrados.
+ * @author fabian
+ */
+template <class T>
+SlotMap<T>::~SlotMap() {
+    for (uint32_t i = 0; i < MAX_CHUNKS; i++) delete[] this->chunks[i].load(memory_order_relaxed);
+}
+
+/**
+ * @brief Obtiene una ranura por su número.
+ *
+ * @param slot Número de la ranura.
+ * @return La ranura, o `nullptr` si su bloque todavía no existe.
+ * @author fabian
+ */
+template <class T>
+typename SlotMap<T>::Slot* SlotMap<T>::slotAt(const uint32_t slot) const {
+    if (slot == 0 || (slot >> CHUNK_BITS) >= MAX_CHUNKS) return nullptr;
+    Slot* chunk = this->chunks[slot >> CHUNK_BITS].load(memory_order_acquire);
+    return chunk ? &chunk[slot & (CHUNK_SIZE - 1)] : nullptr;
+}
+
+/**
+ * @brief Registra un objeto en una ranura libre y anota su número en `item->slot`.
+ *
+ * @param item Objeto a registrar; no debe estar registrado.
+ * @param owner Cédula de la persona dueña del objeto.
+ * @param parent Ranura del objeto padre en otro mapa, o 0 si no tiene.
+ * @return El handle del objeto.
+ * @throws runtime_error Si no quedan ranuras.
+ * @author fabian
+ */
+template <class T>
+uint64_t SlotMap<T>::insert(T* item, const int owner, const uint32_t parent) {
+    lock_guard guard(this->lock);
+    uint32_t slot = this->freeSlot;
+    Slot* entry;
+    if (slot) {
+        entry = slotAt(slot);
+        this->freeSlot = entry->nextFree;
+    } else {
+        slot = this->nextSlot;
+        if ((slot >> CHUNK_BITS) >= MAX_CHUNKS) throw runtime_error("No quedan ranuras para mas handles");
+        if ((slot & (CHUNK_SIZE - 1)) == 0 || slot == 1) {
+            this->chunks[slot >> CHUNK_BITS].store(new Slot[CHUNK_SIZE], memory_order_release);
+        }
+        this->nextSlot++;
+        entry = slotAt(slot);
+    }
+
+    entry->owner.store(owner, memory_order_relaxed);
+    entry->parent.store(parent, memory_order_relaxed);
+    entry->item.store(item, memory_order_release);
+    item->slot = slot;
+    this->liveCount++;
+    return static_cast<uint64_t>(entry->generation.load(memory_order_relaxed)) << 32 | slot;
+}
+
+/**
+ * @brief Hace que la ranura de un objeto apunte a otro que lo reemplaza, por ejemplo a su copia al modificar una
+ * persona publicada. El reemplazo tiene el mismo `slot` que el original, y los handles siguen siendo válidos.
+ *
+ * @param item Objeto que reemplaza al registrado; si su `slot` es 0, no se hace nada.
+ * @author fabian
+ */
+template <class T>
+void SlotMap<T>::rebind(T* item) {
+    if (!item->slot) return;
+    lock_guard guard(this->lock);
+    slotAt(item->slot)->item.store(item, memory_order_release);
+}
+
+/**
+ * @brief Borra un objeto del mapa antes de liberarlo: su ranura cambia de generación y queda libre, así que sus
+ * handles dejan de ser válidos.
+ *
+ * Si la ranura ya apunta a otro objeto (el original de una copia hecha con `rebind`), no se hace nada.
+ *
+ * @param item Objeto a borrar; si su `slot` es 0, no se hace nada.
+ * @author fabian
+ */
+template <class T>
+void SlotMap<T>::erase(const T* item) {
+    if (!item->slot) return;
+    lock_guard guard(this->lock);
+    Slot* entry = slotAt(item->slot);
+    if (entry->item.load(memory_order_relaxed) != item) return;
+
+    const uint32_t generation = entry->generation.load(memory_order_relaxed) + 1;
+    entry->generation.store(generation ? generation : 1, memory_order_release);
+    entry->item.store(nullptr, memory_order_release);
+    entry->nextFree = this->freeSlot;
+    this->freeSlot = item->slot;
+    this->liveCount--;
+}
+
+/**
+ * @brief Busca el objeto de un handle, en tiempo constante y sin candados.
+ *
+ * @param handle Handle entregado por `insert` o `handleOf`.
+ * @param owner Cédula de la persona que debe ser dueña del objeto.
+ * @param parent Si no es `nullptr`, recibe la ranura del padre del objeto.
+ * @return El objeto, o `nullptr` si el handle es inválido, ya fue borrado o es de otra persona.
+ * @author fabian
+ */
+template <class T>
+T* SlotMap<T>::find(const uint64_t handle, const int owner, uint32_t* parent) const {
+    const Slot* entry = slotAt(static_cast<uint32_t>(handle));
+    const auto generation = static_cast<uint32_t>(handle >> 32);
+    if (!entry || entry->generation.load(memory_order_acquire) != generation) return nullptr;
+
+    T* item = entry->item.load(memory_order_acquire);
+    const bool sameOwner = entry->owner.load(memory_order_relaxed) == owner;
+    if (parent) *parent = entry->parent.load(memory_order_relaxed);
+    if (entry->generation.load(memory_order_acquire) != generation || !sameOwner) return nullptr;
+    return item;
+}
+
+/**
+ * @brief Obtiene el objeto registrado en una ranura, sin revisar la generación.
+ *
+ * @param slot Número de la ranura, por ejemplo el padre que devuelve `find`.
+ * @return El objeto, o `nullptr` si la ranura está libre.
+ * @author fabian
+ */
+template <class T>
+T* SlotMap<T>::at(const uint32_t slot) const {
+    const Slot* entry = slotAt(slot);
+    return entry ? entry->item.load(memory_order_acquire) : nullptr;
+}
+
+/**
+ * @brief Obtiene el handle vigente de un objeto ya registrado.
+ *
+ * @param item Objeto.
+ * @return Su handle, o 0 si no está registrado.
+ * @author fabian
+ */
+template <class T>
+uint64_t SlotMap<T>::handleOf(const T* item) const {
+    const Slot* entry = slotAt(item->slot);
+    if (!entry || entry->item.load(memory_order_acquire) != item) return 0;
+    return static_cast<uint64_t>(entry->generation.load(memory_order_acquire)) << 32 | item->slot;
+}
+
+/**
+ * @brief Obtiene la cantidad de objetos registrados.
+ *
+ * @return Objetos registrados.
+ * @author fabian
+ */
+template <class T>
+uint32_t SlotMap<T>::getLiveCount() const {
+    lock_guard guard(this->lock);
+    return this->liveCount;
+}
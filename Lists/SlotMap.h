@@ -0,0 +1,73 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef SLOTMAP_H
+#define SLOTMAP_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Mapa de ranuras que entrega identificadores generacionales (handles) de objetos que viven en otras
+ * estructuras, para encontrarlos en tiempo constante.
+ *
+ * Un handle de 64 bits guarda la ranura en los 32 bits bajos y la generación de la ranura en los altos. Al borrar
+ * un objeto, su ranura cambia de generación y se reutiliza, así que un handle viejo ya no coincide y `find`
+ * devuelve `nullptr` en lugar de un objeto liberado o ajeno. El tipo `T` debe tener un campo `uint32_t slot`, que
+ * el mapa llena con su ranura (0 si no tiene).
+ *
+ * Cada ranura anota además la persona dueña del objeto y, si hace falta, la ranura de su padre (la tarea de una
+ * subtarea). Las ranuras se guardan en bloques de tamaño fijo que nunca se mueven: `find` no toma candados y se
+ * puede llamar desde cualquier hilo, mientras que registrar, mover y borrar toman el candado del mapa.
+ */
+template <class T>
+class SlotMap {
+public:
+    static constexpr uint32_t CHUNK_BITS = 16;
+    static constexpr uint32_t CHUNK_SIZE = 1u << CHUNK_BITS;
+    static constexpr uint32_t MAX_CHUNKS = 1u << 16;
+
+    SlotMap();
+    ~SlotMap();
+
+    SlotMap(const SlotMap&) = delete;
+    SlotMap& operator=(const SlotMap&) = delete;
+
+    uint64_t insert(T* item, int owner, uint32_t parent = 0);
+    void rebind(T* item);
+    void erase(const T* item);
+
+    [[nodiscard]] T* find(uint64_t handle, int owner, uint32_t* parent = nullptr) const;
+    [[nodiscard]] T* at(uint32_t slot) const;
+    [[nodiscard]] uint64_t handleOf(const T* item) const;
+    [[nodiscard]] uint32_t getLiveCount() const;
+
+private:
+    /**
+     * @brief Ranura del mapa: el objeto, su dueño, su padre y la generación actual.
+     */
+    struct Slot {
+        atomic<T*> item{nullptr};
+        atomic<uint32_t> generation{1};
+        atomic<int> owner{0};
+        atomic<uint32_t> parent{0};
+        uint32_t nextFree = 0;
+    };
+
+    unique_ptr<atomic<Slot*>[]> chunks;
+    mutable mutex lock;
+    uint32_t nextSlot = 1;
+    uint32_t freeSlot = 0;
+    uint32_t liveCount = 0;
+
+    [[nodiscard]] Slot* slotAt(uint32_t slot) const;
+};
+
+#include "SlotMap.cpp"
+#endif //SLOTMAP_H
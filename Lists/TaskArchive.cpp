@@ -0,0 +1,618 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "TaskArchive.h"
+
+#include <cstring>
+
+TaskTree* completedTaskTree = nullptr;
+
+/**
+ * @brief Agrega un entero sin signo en varint: 7 bits por byte, el bit alto indica que sigue otro byte.
+ *
+ * @param bytes Destino.
+ * @param value Valor.
+ * @author fabian
+ */
+static void writeVarint(vector<uint8_t>& bytes, uint64_t value) {
+    while (value >= 0x80) {
+        bytes.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<uint8_t>(value));
+}
+
+/**
+ * @brief Agrega un entero con signo en zigzag y varint, para que las diferencias pequeñas ocupen un byte.
+ *
+ * @param bytes Destino.
+ * @param value Valor.
+ * @author fabian
+ */
+static void writeSignedVarint(vector<uint8_t>& bytes, const int64_t value) {
+    writeVarint(bytes, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+/**
+ * @brief Lee un entero sin signo en varint.
+ *
+ * @param bytes Bytes del bloque.
+ * @param offset Posición de lectura, que avanza.
+ * @return El valor.
+ * @author fabian
+ */
+static uint64_t readVarint(const uint8_t* bytes, size_t& offset) {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+        const uint8_t byte = bytes[offset++];
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return value;
+    }
+}
+
+/**
+ * @brief Lee un entero con signo en zigzag y varint.
+ *
+ * @param bytes Bytes del bloque.
+ * @param offset Posición de lectura, que avanza.
+ * @return El valor.
+ * @author fabian
+ */
+static int64_t readSignedVarint(const uint8_t* bytes, size_t& offset) {
+    const uint64_t value = readVarint(bytes, offset);
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+/**
+ * @brief Obtiene el índice de un valor en un diccionario de bloque, agregándolo si no está.
+ *
+ * Las cadenas internadas se comparan por su entrada en el pool, así que la búsqueda solo compara punteros.
+ *
+ * @param dictionary Diccionario del bloque.
+ * @param value Valor.
+ * @return Índice del valor.
+ * @author fabian
+ */
+template <class T>
+static size_t dictionaryIndex(vector<T>& dictionary, const T& value) {
+    for (size_t i = 0; i < dictionary.size(); i++) {
+        if (dictionary[i] == value) return i;
+    }
+    dictionary.push_back(value);
+    return dictionary.size() - 1;
+}
+
+/**
+ * @brief Agrega un texto precedido de su longitud en varint.
+ *
+ * @param bytes Destino.
+ * @param text Texto.
+ * @author fabian
+ */
+static void writeText(vector<uint8_t>& bytes, const string_view text) {
+    writeVarint(bytes, text.size());
+    bytes.insert(bytes.end(), text.begin(), text.end());
+}
+
+/**
+ * @brief Lee un texto precedido de su longitud en varint.
+ *
+ * @param bytes Bytes del registro.
+ * @param offset Posición de lectura, que avanza.
+ * @return Vista al texto dentro de los bytes.
+ * @author fabian
+ */
+static string_view readText(const uint8_t* bytes, size_t& offset) {
+    const size_t length = readVarint(bytes, offset);
+    const string_view text(reinterpret_cast<const char*>(bytes) + offset, length);
+    offset += length;
+    return text;
+}
+
+/**
+ * @brief Constructor de la clase TreeRange.
+ *
+ * @param tree Árbol en disco.
+ * @param owner Número del archivo, primera parte de la clave de sus tareas en el árbol.
+ * @author fabian
+ */
+TaskArchive::TreeRange::TreeRange(TaskTree* tree, const int32_t owner) : tree(tree), owner(owner) {}
+
+/**
+ * @brief Destructor de la clase TreeRange. Borra del árbol las tareas del rango, si se agregó alguna.
+ *
+ * Si el borrado falla, las tareas quedan en el árbol sin que ningún archivo las lea.
+ *
+ * @author fabian
+ */
+TaskArchive::TreeRange::~TreeRange() {
+    if (!this->written) return;
+    try {
+        this->tree->eraseRange(TaskTreeKey{this->owner, INT64_MIN, INT32_MIN},
+                               TaskTreeKey{this->owner, INT64_MAX, INT32_MAX});
+    } catch (const exception&) {
+    }
+}
+
+/**
+ * @brief Crea un rango nuevo del árbol para un archivo, con un número que ningún otro archivo usó.
+ *
+ * @param tree Árbol en disco, o nullptr para guardar las tareas en memoria.
+ * @return El rango, o nullptr si no hay árbol.
+ * @author fabian
+ */
+shared_ptr<TaskArchive::TreeRange> TaskArchive::newRange(TaskTree* tree) {
+    static atomic<int32_t> nextOwner{1};
+    if (!tree) return nullptr;
+    return make_shared<TreeRange>(tree, nextOwner++);
+}
+
+/**
+ * @brief Crea un archivo vacío que guarda sus tareas en `completedTaskTree`, si está configurado, o en memoria.
+ *
+ * @return El archivo.
+ * @author fabian
+ */
+TaskArchive TaskArchive::create() {
+    TaskArchive archive;
+    archive.range = newRange(completedTaskTree);
+    return archive;
+}
+
+/**
+ * @brief Calcula la clave de vencimiento de una fecha y una hora.
+ *
+ * Cuenta los segundos como si todos los meses tuvieran 31 días: conserva el orden cronológico y las fechas
+ * cercanas dan claves cercanas, que es lo que necesitan las diferencias del archivo y los resúmenes de bloque.
+ *
+ * @param date Fecha.
+ * @param time Hora.
+ * @return La clave.
+ * @author fabian
+ */
+int64_t TaskArchive::dueKey(const tm& date, const tm& time) {
+    const int64_t day = (static_cast<int64_t>(date.tm_year + 1900) * 12 + date.tm_mon) * 31 + date.tm_mday - 1;
+    return day * 86400 + time.tm_hour * 3600 + time.tm_min * 60 + time.tm_sec;
+}
+
+/**
+ * @brief Reconstruye la fecha y la hora de una clave de vencimiento.
+ *
+ * @param key Clave calculada con `dueKey`.
+ * @param date Fecha a llenar, incluidos el día del año y de la semana.
+ * @param time Hora a llenar.
+ * @author fabian
+ */
+void TaskArchive::fromDueKey(const int64_t key, tm& date, tm& time) {
+    const int64_t day = key / 86400;
+    const int seconds = static_cast<int>(key % 86400);
+    date = {};
+    date.tm_mday = static_cast<int>(day % 31) + 1;
+    date.tm_mon = static_cast<int>(day / 31 % 12);
+    date.tm_year = static_cast<int>(day / 31 / 12) - 1900;
+    fillDateFields(date);
+    time = {};
+    time.tm_hour = seconds / 3600;
+    time.tm_min = seconds / 60 % 60;
+    time.tm_sec = seconds % 60;
+}
+
+/**
+ * @brief Obtiene el bit del tipo de una tarea en las máscaras de tipos.
+ *
+ * @param type Tipo de tarea, que puede faltar.
+ * @return El bit del nombre del tipo, o 0 si no hay tipo.
+ * @author fabian
+ */
+static uint64_t typeBit(const TaskType* type) {
+    return type ? taskTypeBit(type->name) : 0;
+}
+
+/**
+ * @brief Indica si alguna tarea del bloque podría cumplir el filtro según su resumen.
+ *
+ * @param filter Filtro del recorrido.
+ * @return false si ninguna tarea del bloque lo cumple.
+ * @author fabian
+ */
+bool TaskArchive::Block::mayMatch(const TaskArchiveFilter& filter) const {
+    if (this->maxKey < filter.minKey || this->minKey > filter.maxKey) return false;
+    if (!(this->typeMask & filter.typeMask)) return false;
+    if (filter.importance) {
+        for (const InternedString& importance : this->importances) {
+            if (importance == *filter.importance) return true;
+        }
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Ajusta la memoria de un bloque lleno a su contenido.
+ * @author fabian
+ */
+void TaskArchive::Block::seal() {
+    this->bytes.shrink_to_fit();
+    this->strings.shrink_to_fit();
+    this->importances.shrink_to_fit();
+    this->types.shrink_to_fit();
+}
+
+/**
+ * @brief Destructor de la tarea temporal. Libera sus subtareas.
+ * @author fabian
+ */
+TaskArchive::ScratchTask::~ScratchTask() {
+    clearSubTasks();
+}
+
+/**
+ * @brief Libera las subtareas descomprimidas en la tarea temporal.
+ * @author fabian
+ */
+void TaskArchive::ScratchTask::clearSubTasks() {
+    while (SubTask* subTask = this->task.subTasks.head) {
+        this->task.subTasks.head = subTask->next;
+        delete subTask;
+    }
+    this->task.subTasks = List<SubTask>();
+    this->task.completedSubTasks = 0;
+    this->task.progressSum = 0;
+}
+
+/**
+ * @brief Comprime una tarea completada al final del archivo.
+ *
+ * El archivo no toma la tarea: quien llama la sigue siendo dueño y normalmente la libera después. Si el último
+ * bloque está compartido con una copia del archivo, primero lo copia para que la copia no vea la tarea.
+ *
+ * @param task Tarea a agregar, con sus subtareas.
+ * @throws runtime_error Si el archivo está en el árbol en disco y la escritura falla o la tarea es muy grande.
+ * @author fabian
+ */
+void TaskArchive::append(const Task& task) {
+    uint64_t subTasks = 0;
+    for (const SubTask* subTask = task.subTasks.head; subTask; subTask = subTask->next) subTasks++;
+
+    if (this->range) {
+        this->range->tree->insert(TaskTreeKey{this->range->owner, dueKey(task.date, task.time), task.id},
+                                  encodeRecord(task, static_cast<uint32_t>(this->length)));
+        this->range->written = true;
+        this->length++;
+        this->lastId = task.id;
+        this->subTaskCount += subTasks;
+        return;
+    }
+
+    if (this->blocks.empty() || this->blocks.back()->count == BLOCK_SIZE) {
+        if (!this->blocks.empty() && this->blocks.back().use_count() == 1) this->blocks.back()->seal();
+        this->blocks.push_back(make_shared<Block>());
+    } else if (this->blocks.back().use_count() > 1) {
+        this->blocks.back() = make_shared<Block>(*this->blocks.back());
+    }
+    Block& block = *this->blocks.back();
+
+    const int64_t key = dueKey(task.date, task.time);
+    const size_t typeIndex = dictionaryIndex(block.types, task.type);
+    const size_t importanceIndex = dictionaryIndex(block.importances, InternedString(task.importance));
+
+    writeSignedVarint(block.bytes, static_cast<int64_t>(task.id) - block.lastId);
+    writeSignedVarint(block.bytes, key - block.lastKey);
+    writeVarint(block.bytes, typeIndex << 2 | min<size_t>(importanceIndex, 3));
+    if (importanceIndex >= 3) writeVarint(block.bytes, importanceIndex - 3);
+    writeVarint(block.bytes, dictionaryIndex(block.strings, task.description));
+    writeVarint(block.bytes, subTasks);
+    for (const SubTask* subTask = task.subTasks.head; subTask; subTask = subTask->next) {
+        writeVarint(block.bytes, dictionaryIndex(block.strings, subTask->name));
+        writeVarint(block.bytes, dictionaryIndex(block.strings, subTask->comments));
+        uint8_t progress[sizeof(float)];
+        memcpy(progress, &subTask->progress, sizeof(progress));
+        block.bytes.insert(block.bytes.end(), progress, progress + sizeof(progress));
+        block.bytes.push_back(subTask->completed);
+    }
+
+    block.minKey = min(block.minKey, key);
+    block.maxKey = max(block.maxKey, key);
+    block.lastKey = key;
+    block.lastId = task.id;
+    block.typeMask |= typeBit(task.type);
+    block.count++;
+    this->length++;
+    this->lastId = task.id;
+    this->subTaskCount += subTasks;
+}
+
+/**
+ * @brief Elimina todas las tareas del archivo.
+ *
+ * En el árbol en disco el archivo pasa a un rango nuevo; el anterior se borra del árbol en cuanto ninguna copia
+ * del archivo lo use.
+ *
+ * @author fabian
+ */
+void TaskArchive::clear() {
+    if (this->range) this->range = newRange(this->range->tree);
+    this->blocks.clear();
+    this->length = 0;
+    this->lastId = 0;
+    this->subTaskCount = 0;
+}
+
+/**
+ * @brief Obtiene la cantidad de tareas del archivo.
+ *
+ * @return Cantidad de tareas.
+ * @author fabian
+ */
+int TaskArchive::getLength() const { return this->length; }
+
+/**
+ * @brief Indica si el archivo no tiene tareas.
+ *
+ * @return true si está vacío.
+ * @author fabian
+ */
+bool TaskArchive::empty() const { return this->length == 0; }
+
+/**
+ * @brief Obtiene el ID de la última tarea agregada.
+ *
+ * @return El ID, o 0 si el archivo está vacío.
+ * @author fabian
+ */
+int TaskArchive::getLastId() const { return this->lastId; }
+
+/**
+ * @brief Obtiene la cantidad total de subtareas de las tareas del archivo.
+ *
+ * @return Cantidad de subtareas.
+ * @author fabian
+ */
+uint64_t TaskArchive::getSubTaskCount() const { return this->subTaskCount; }
+
+/**
+ * @brief Estima la memoria que ocupa el archivo, sin contar las cadenas del pool, que son compartidas.
+ *
+ * @return Bytes reservados por los bloques y sus diccionarios.
+ * @author fabian
+ */
+size_t TaskArchive::getMemoryUsage() const {
+    size_t bytes = this->blocks.capacity() * sizeof(shared_ptr<Block>);
+    for (const shared_ptr<Block>& pointer : this->blocks) {
+        const Block& block = *pointer;
+        bytes += sizeof(Block) + block.bytes.capacity() + block.strings.capacity() * sizeof(InternedString) +
+                 block.importances.capacity() * sizeof(InternedString) + block.types.capacity() * sizeof(TaskType*);
+    }
+    return bytes;
+}
+
+/**
+ * @brief Descomprime la siguiente tarea de un bloque sobre la tarea temporal.
+ *
+ * La tarea temporal debe tener el ID y la clave de la tarea anterior del bloque, o 0 al empezar el bloque.
+ *
+ * @param block Bloque.
+ * @param offset Posición de la tarea dentro del bloque.
+ * @param scratch Tarea temporal.
+ * @param withSubTasks Si es false, las subtareas se saltan sin crearlas.
+ * @return Posición de la tarea siguiente.
+ * @author fabian
+ */
+size_t TaskArchive::decode(const Block& block, size_t offset, ScratchTask& scratch, const bool withSubTasks) {
+    const uint8_t* bytes = block.bytes.data();
+    Task& task = scratch.task;
+
+    task.id += static_cast<int>(readSignedVarint(bytes, offset));
+    scratch.key += readSignedVarint(bytes, offset);
+    fromDueKey(scratch.key, task.date, task.time);
+
+    const uint64_t packed = readVarint(bytes, offset);
+    size_t importanceIndex = packed & 3;
+    if (importanceIndex == 3) importanceIndex += readVarint(bytes, offset);
+    task.type = block.types[packed >> 2];
+    task.importance = block.importances[importanceIndex].str();
+    task.description = block.strings[readVarint(bytes, offset)];
+
+    scratch.clearSubTasks();
+    const uint64_t subTasks = readVarint(bytes, offset);
+    SubTask* last = nullptr;
+    for (uint64_t i = 0; i < subTasks; i++) {
+        const uint64_t name = readVarint(bytes, offset);
+        const uint64_t comments = readVarint(bytes, offset);
+        float progress;
+        memcpy(&progress, bytes + offset, sizeof(progress));
+        const bool completed = bytes[offset + sizeof(progress)];
+        offset += sizeof(progress) + 1;
+        if (!withSubTasks) continue;
+
+        auto* subTask = new SubTask(string(), string(), progress);
+        subTask->name = block.strings[name];
+        subTask->comments = block.strings[comments];
+        subTask->completed = completed;
+        last = task.subTasks.insertAfter(last, subTask);
+        task.countSubTask(*subTask);
+    }
+    return offset;
+}
+
+/**
+ * @brief Codifica una tarea como valor del árbol en disco.
+ *
+ * El ID, la fecha y la hora van en la clave. El valor lleva la posición de la tarea en el archivo, el tipo (el
+ * puntero, porque el árbol solo vive lo que dura el proceso), la importancia, la descripción y las subtareas, con
+ * los textos precedidos de su longitud.
+ *
+ * @param task Tarea.
+ * @param position Posición de la tarea en el archivo, para que las copias anteriores la ignoren.
+ * @return Los bytes del valor.
+ * @author fabian
+ */
+string TaskArchive::encodeRecord(const Task& task, const uint32_t position) {
+    vector<uint8_t> bytes;
+    const auto type = reinterpret_cast<uintptr_t>(task.type);
+    bytes.resize(sizeof(position) + sizeof(type));
+    memcpy(bytes.data(), &position, sizeof(position));
+    memcpy(bytes.data() + sizeof(position), &type, sizeof(type));
+    writeText(bytes, task.importance);
+    writeText(bytes, task.description.view());
+
+    uint64_t subTasks = 0;
+    for (const SubTask* subTask = task.subTasks.head; subTask; subTask = subTask->next) subTasks++;
+    writeVarint(bytes, subTasks);
+    for (const SubTask* subTask = task.subTasks.head; subTask; subTask = subTask->next) {
+        writeText(bytes, subTask->name.view());
+        writeText(bytes, subTask->comments.view());
+        uint8_t progress[sizeof(float)];
+        memcpy(progress, &subTask->progress, sizeof(progress));
+        bytes.insert(bytes.end(), progress, progress + sizeof(progress));
+        bytes.push_back(subTask->completed);
+    }
+    return string(bytes.begin(), bytes.end());
+}
+
+/**
+ * @brief Decodifica una tarea del árbol en disco sobre la tarea temporal.
+ *
+ * @param value Valor guardado con `encodeRecord`.
+ * @param key Clave de la tarea.
+ * @param scratch Tarea temporal.
+ * @param withSubTasks Si es false, las subtareas no se crean.
+ * @author fabian
+ */
+void TaskArchive::decodeRecord(const string_view value, const TaskTreeKey& key, ScratchTask& scratch,
+                               const bool withSubTasks) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(value.data());
+    Task& task = scratch.task;
+    uintptr_t type;
+    memcpy(&type, bytes + sizeof(uint32_t), sizeof(type));
+    size_t offset = sizeof(uint32_t) + sizeof(type);
+
+    task.id = key.taskId;
+    scratch.key = key.dueKey;
+    fromDueKey(key.dueKey, task.date, task.time);
+    task.type = reinterpret_cast<TaskType*>(type);
+    task.importance = readText(bytes, offset);
+    task.description = readText(bytes, offset);
+
+    scratch.clearSubTasks();
+    if (!withSubTasks) return;
+    const uint64_t subTasks = readVarint(bytes, offset);
+    SubTask* last = nullptr;
+    for (uint64_t i = 0; i < subTasks; i++) {
+        const string_view name = readText(bytes, offset);
+        const string_view comments = readText(bytes, offset);
+        float progress;
+        memcpy(&progress, bytes + offset, sizeof(progress));
+        auto* subTask = new SubTask(string(), string(), progress);
+        subTask->name = name;
+        subTask->comments = comments;
+        subTask->completed = bytes[offset + sizeof(progress)];
+        offset += sizeof(progress) + 1;
+        last = task.subTasks.insertAfter(last, subTask);
+        task.countSubTask(*subTask);
+    }
+}
+
+/**
+ * @brief Indica si un registro del árbol ya estaba en el archivo cuando se copió.
+ *
+ * @param value Valor guardado con `encodeRecord`.
+ * @return false si la tarea se agregó a otra copia del archivo después.
+ * @author fabian
+ */
+bool TaskArchive::isVisible(const string_view value) const {
+    uint32_t position;
+    memcpy(&position, value.data(), sizeof(position));
+    return position < static_cast<uint32_t>(this->length);
+}
+
+/**
+ * @brief Recorre todas las tareas del archivo en el orden en que se agregaron.
+ *
+ * En el árbol en disco las recorre en orden de vencimiento.
+ *
+ * @param callback Función que recibe cada tarea como `const Task&`, válida solo durante la llamada.
+ * @param withSubTasks Si es false, las tareas se entregan sin subtareas.
+ * @author fabian
+ */
+template <class Callback>
+void TaskArchive::forEach(Callback callback, const bool withSubTasks) const {
+    ScratchTask scratch;
+    if (this->range) {
+        const int32_t owner = this->range->owner;
+        this->range->tree->scan(TaskTreeKey{owner, INT64_MIN, INT32_MIN}, TaskTreeKey{owner, INT64_MAX, INT32_MAX},
+            [&](const TaskTreeKey& key, const string_view value) {
+                if (!isVisible(value)) return;
+                decodeRecord(value, key, scratch, withSubTasks);
+                callback(static_cast<const Task&>(scratch.task));
+            });
+        return;
+    }
+    for (const shared_ptr<Block>& pointer : this->blocks) {
+        const Block& block = *pointer;
+        scratch.task.id = 0;
+        scratch.key = 0;
+        size_t offset = 0;
+        for (uint32_t i = 0; i < block.count; i++) {
+            offset = decode(block, offset, scratch, withSubTasks);
+            callback(static_cast<const Task&>(scratch.task));
+        }
+    }
+}
+
+/**
+ * @brief Recorre las tareas que cumplen un filtro, saltando los bloques cuyo resumen no puede cumplirlo.
+ *
+ * En el árbol en disco solo lee las hojas del rango de vencimiento del filtro, y cuenta cada hoja leída como un
+ * bloque revisado.
+ *
+ * @param filter Filtro de importancia, tipos y rango de claves de vencimiento.
+ * @param callback Función que recibe cada tarea que cumple el filtro, válida solo durante la llamada.
+ * @param withSubTasks Si es false, las tareas se entregan sin subtareas.
+ * @return Bloques revisados y saltados.
+ * @author fabian
+ */
+template <class Callback>
+BlockScan TaskArchive::forEachMatching(const TaskArchiveFilter& filter, Callback callback,
+                                       const bool withSubTasks) const {
+    BlockScan scan;
+    ScratchTask scratch;
+    if (this->range) {
+        const int32_t owner = this->range->owner;
+        scan.blocksScanned = this->range->tree->scan(TaskTreeKey{owner, filter.minKey, INT32_MIN},
+                                                     TaskTreeKey{owner, filter.maxKey, INT32_MAX},
+            [&](const TaskTreeKey& key, const string_view value) {
+                if (!isVisible(value)) return;
+                uintptr_t type;
+                memcpy(&type, value.data() + sizeof(uint32_t), sizeof(type));
+                if (!(typeBit(reinterpret_cast<const TaskType*>(type)) & filter.typeMask)) return;
+                size_t offset = sizeof(uint32_t) + sizeof(type);
+                const string_view importance = readText(reinterpret_cast<const uint8_t*>(value.data()), offset);
+                if (filter.importance && importance != filter.importance->view()) return;
+                decodeRecord(value, key, scratch, withSubTasks);
+                callback(static_cast<const Task&>(scratch.task));
+            });
+        return scan;
+    }
+    for (const shared_ptr<Block>& pointer : this->blocks) {
+        const Block& block = *pointer;
+        if (!block.mayMatch(filter)) {
+            scan.blocksSkipped++;
+            continue;
+        }
+        scan.blocksScanned++;
+
+        scratch.task.id = 0;
+        scratch.key = 0;
+        size_t offset = 0;
+        for (uint32_t i = 0; i < block.count; i++) {
+            offset = decode(block, offset, scratch, withSubTasks);
+            if (scratch.key < filter.minKey || scratch.key > filter.maxKey) continue;
+            if (!(typeBit(scratch.task.type) & filter.typeMask)) continue;
+            if (filter.importance && scratch.task.importance != filter.importance->view()) continue;
+            callback(static_cast<const Task&>(scratch.task));
+        }
+    }
+    return scan;
+}
@@ -0,0 +1,141 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef TASKARCHIVE_H
+#define TASKARCHIVE_H
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "TaskList.h"
+#include "../Storage/TaskTree.h"
+#include "../Structures/Task.h"
+#include "../utils/StringPool.h"
+
+using namespace std;
+
+/**
+ * @brief Condiciones de un recorrido del archivo de tareas.
+ *
+ * Un bloque se salta entero si su resumen muestra que ninguna de sus tareas puede cumplirlas. Las fechas se
+ * comparan con la clave de vencimiento de `TaskArchive::dueKey`.
+ */
+struct TaskArchiveFilter {
+    optional<InternedString> importance;
+    uint64_t typeMask = ~uint64_t{0};
+    int64_t minKey = INT64_MIN;
+    int64_t maxKey = INT64_MAX;
+};
+
+/**
+ * @brief Archivo comprimido, de solo agregado, de las tareas completadas de una persona.
+ *
+ * Las tareas se guardan en bloques de hasta `BLOCK_SIZE` tareas. Dentro de un bloque cada tarea ocupa unos pocos
+ * bytes: el ID y la clave de vencimiento (fecha y hora) como diferencias con la tarea anterior, el tipo y la
+ * importancia empaquetados en un solo entero como índices de los diccionarios del bloque, y la descripción y las
+ * subtareas como índices del diccionario de cadenas del bloque. Todos los enteros van en varint.
+ *
+ * Cada bloque guarda además un resumen (mínimo y máximo de la clave de vencimiento, máscara de tipos e
+ * importancias presentes) que permite saltarlo sin descomprimirlo. Los recorridos descomprimen un bloque a la vez
+ * sobre una sola tarea temporal, que solo es válida durante la llamada a la función del recorrido.
+ *
+ * Si `completedTaskTree` está configurado al crear el archivo con `create()`, sus tareas no se guardan en bloques
+ * en memoria sino en ese árbol en disco, con la clave (archivo, vencimiento, ID), donde el archivo es un número
+ * único por archivo creado. Los recorridos leen entonces las tareas en orden de vencimiento en lugar del orden en
+ * que se agregaron, y los que tienen un rango de fechas solo leen las hojas de ese rango.
+ *
+ * Copiar un archivo es barato y la copia queda congelada: comparte los bloques con el original, que copia el último
+ * bloque antes de agregarle una tarea si está compartido. En el árbol ambos comparten el rango de claves, cada
+ * registro lleva su posición en el archivo y la copia ignora los que se agregaron después de copiarla; el rango se
+ * borra del árbol cuando lo suelta el último archivo que lo usa.
+ */
+class TaskArchive {
+public:
+    static constexpr uint32_t BLOCK_SIZE = 128;
+
+    TaskArchive() = default;
+    static TaskArchive create();
+
+    void append(const Task& task);
+    void clear();
+
+    [[nodiscard]] int getLength() const;
+    [[nodiscard]] bool empty() const;
+    [[nodiscard]] int getLastId() const;
+    [[nodiscard]] uint64_t getSubTaskCount() const;
+    [[nodiscard]] size_t getMemoryUsage() const;
+
+    template <class Callback>
+    void forEach(Callback callback, bool withSubTasks = true) const;
+
+    template <class Callback>
+    BlockScan forEachMatching(const TaskArchiveFilter& filter, Callback callback, bool withSubTasks = false) const;
+
+    static int64_t dueKey(const tm& date, const tm& time);
+    static void fromDueKey(int64_t key, tm& date, tm& time);
+
+private:
+    /**
+     * @brief Bloque de tareas comprimidas con sus diccionarios y su resumen.
+     */
+    struct Block {
+        vector<uint8_t> bytes;
+        vector<InternedString> strings;
+        vector<InternedString> importances;
+        vector<TaskType*> types;
+        int64_t minKey = INT64_MAX;
+        int64_t maxKey = INT64_MIN;
+        int64_t lastKey = 0;
+        uint64_t typeMask = 0;
+        int lastId = 0;
+        uint32_t count = 0;
+
+        [[nodiscard]] bool mayMatch(const TaskArchiveFilter& filter) const;
+        void seal();
+    };
+
+    /**
+     * @brief Rango de claves de un archivo en el árbol en disco; lo borra del árbol al destruirse.
+     */
+    struct TreeRange {
+        TaskTree* tree;
+        int32_t owner;
+        bool written = false;
+
+        TreeRange(TaskTree* tree, int32_t owner);
+        ~TreeRange();
+    };
+
+    /**
+     * @brief Tarea temporal sobre la que se descomprime un bloque; libera sus subtareas al terminar.
+     */
+    struct ScratchTask {
+        Task task{0, string(), string(), tm{}, tm{}, nullptr};
+        int64_t key = 0;
+
+        ~ScratchTask();
+        void clearSubTasks();
+    };
+
+    vector<shared_ptr<Block>> blocks;
+    shared_ptr<TreeRange> range;
+    int length = 0;
+    int lastId = 0;
+    uint64_t subTaskCount = 0;
+
+    static size_t decode(const Block& block, size_t offset, ScratchTask& scratch, bool withSubTasks);
+    static shared_ptr<TreeRange> newRange(TaskTree* tree);
+    static string encodeRecord(const Task& task, uint32_t position);
+    static void decodeRecord(string_view value, const TaskTreeKey& key, ScratchTask& scratch, bool withSubTasks);
+    [[nodiscard]] bool isVisible(string_view value) const;
+};
+
+extern TaskTree* completedTaskTree;
+
+#include "TaskArchive.cpp"
+#endif //TASKARCHIVE_H
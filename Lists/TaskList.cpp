@@ -54,6 +54,314 @@ void TaskList::insert(Task* task) {
     if (currentNode == nullptr && previousNode) {
         previousNode->next = task;
     }
+    rebuildBlocks();
+}
+
+/**
+ * @brief Combina los bloques contados en otro recorrido.
+ *
+ * @param other Otro recorrido.
+ * @author fabian
+ */
+void BlockScan::merge(const BlockScan& other) {
+    this->blocksScanned += other.blocksScanned;
+    this->blocksSkipped += other.blocksSkipped;
+}
+
+/**
+ * @brief Amplía el resumen del bloque con una tarea más.
+ *
+ * @param task Tarea agregada al bloque.
+ * @author fabian
+ */
+void TaskBlock::add(const Task& task) {
+    const long day = dayNumber(task.date);
+    this->count++;
+    this->minDay = min(this->minDay, day);
+    this->maxDay = max(this->maxDay, day);
+    this->importanceMask |= importanceBit(task.importance);
+    this->typeMask |= task.type ? taskTypeBit(task.type->name) : 0;
+}
+
+/**
+ * @brief Indica si alguna tarea del bloque podría cumplir el filtro según su resumen.
+ *
+ * @param filter Filtro del recorrido.
+ * @return false si ninguna tarea del bloque lo cumple.
+ * @author fabian
+ */
+bool TaskBlock::mayMatch(const TaskBlockFilter& filter) const {
+    return this->maxDay >= filter.minDay && this->minDay <= filter.maxDay && (this->typeMask & filter.typeMask) &&
+           (this->importanceMask & filter.importanceMask);
+}
+
+/**
+ * @brief Vuelve a calcular los bloques recorriendo toda la lista, junto con el enlace a la tarea anterior y el
+ * índice del bloque de cada tarea.
+ * @author fabian
+ */
+void TaskList::rebuildBlocks() {
+    this->blocks.clear();
+    this->emptyBlocks = 0;
+    Task* previous = nullptr;
+    for (Task* task = this->head; task; previous = task, task = task->next) {
+        if (this->blocks.empty() || this->blocks.back().count == BLOCK_SIZE) this->blocks.push_back(TaskBlock{task});
+        this->blocks.back().add(*task);
+        task->prev = previous;
+        task->block = static_cast<uint32_t>(this->blocks.size() - 1);
+    }
+}
+
+/**
+ * @brief Inserta una tarea al final de la lista.
+ *
+ * El final se encuentra desde el primer nodo del último bloque, sin recorrer toda la lista.
+ *
+ * @param newNode Tarea a insertar.
+ * @author fabian
+ */
+void TaskList::insertLast(Task* newNode) {
+    newNode->next = nullptr;
+    insertAfter(getLast(), newNode);
+}
+
+/**
+ * @brief Inserta una tarea al principio de la lista.
+ *
+ * La tarea se agrega al primer bloque; si está lleno, los bloques se vuelven a calcular, porque uno nuevo al
+ * principio cambiaría el índice de todos los demás.
+ *
+ * @param newNode Tarea a insertar.
+ * @author fabian
+ */
+void TaskList::insertFirst(Task* newNode) {
+    List::insertFirst(newNode);
+    newNode->prev = nullptr;
+    if (newNode->next) newNode->next->prev = newNode;
+    if (this->blocks.empty()) {
+        this->blocks.push_back(TaskBlock{newNode});
+    } else if (this->blocks.front().count == BLOCK_SIZE) {
+        rebuildBlocks();
+        return;
+    } else if (this->blocks.front().count == 0) {
+        this->emptyBlocks--;
+    }
+    this->blocks.front().first = newNode;
+    this->blocks.front().add(*newNode);
+    newNode->block = 0;
+}
+
+/**
+ * @brief Inserta una tarea después de otra, en tiempo constante si se inserta al final.
+ *
+ * Al final, la tarea se agrega al último bloque o abre uno nuevo. En medio de la lista se agrega al bloque de
+ * la tarea anterior; si ese bloque crece al doble de `BLOCK_SIZE`, los bloques se vuelven a calcular.
+ *
+ * @param previousNode Tarea tras la cual se inserta, o `nullptr` para insertar al principio.
+ * @param newNode Tarea a insertar.
+ * @return La tarea insertada.
+ * @author fabian
+ */
+Task* TaskList::insertAfter(Task* previousNode, Task* newNode) {
+    if (!previousNode) {
+        insertFirst(newNode);
+        return newNode;
+    }
+    List::insertAfter(previousNode, newNode);
+    newNode->prev = previousNode;
+
+    if (!newNode->next) {
+        if (this->blocks.back().count == BLOCK_SIZE) this->blocks.push_back(TaskBlock{newNode});
+        this->blocks.back().add(*newNode);
+        newNode->block = static_cast<uint32_t>(this->blocks.size() - 1);
+        return newNode;
+    }
+
+    newNode->next->prev = newNode;
+    newNode->block = previousNode->block;
+    TaskBlock& block = this->blocks[newNode->block];
+    block.add(*newNode);
+    if (block.count >= 2 * BLOCK_SIZE) rebuildBlocks();
+    return newNode;
+}
+
+/**
+ * @brief Elimina una tarea de la lista por su ID, buscándola bloque por bloque.
+ *
+ * @param id ID de la tarea.
+ * @return La tarea eliminada, o `nullptr` si no se encuentra.
+ * @author fabian
+ */
+Task* TaskList::removeById(const int id) {
+    for (const TaskBlock& block : this->blocks) {
+        Task* task = block.first;
+        for (uint32_t i = 0; i < block.count; i++, task = task->next) {
+            if (task->id != id) continue;
+            unlink(task);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Quita de la lista una tarea ya ubicada, en tiempo constante, sin liberarla.
+ *
+ * El resumen del bloque de la tarea no se reduce. Si el bloque queda vacío y es el último, se elimina; si está en
+ * medio, se deja vacío hasta que la mitad de los bloques lo esté y se vuelvan a calcular.
+ *
+ * @param task Tarea a quitar, que debe estar en la lista.
+ * @author fabian
+ */
+void TaskList::unlink(Task* task) {
+    (task->prev ? task->prev->next : this->head) = task->next;
+    if (task->next) task->next->prev = task->prev;
+    --this->length;
+
+    TaskBlock& block = this->blocks[task->block];
+    if (--block.count > 0) {
+        if (block.first == task) block.first = task->next;
+    } else if (task->block + 1 == this->blocks.size()) {
+        this->blocks.pop_back();
+        while (!this->blocks.empty() && this->blocks.back().count == 0) {
+            this->blocks.pop_back();
+            this->emptyBlocks--;
+        }
+    } else if (++this->emptyBlocks * 2 > this->blocks.size()) {
+        rebuildBlocks();
+    }
+    task->next = nullptr;
+    task->prev = nullptr;
+}
+
+/**
+ * @brief Amplía el resumen del bloque de una tarea cuya fecha cambió.
+ *
+ * @param task Tarea modificada, que debe estar en la lista.
+ * @author fabian
+ */
+void TaskList::refresh(const Task* task) {
+    TaskBlock& block = this->blocks[task->block];
+    block.add(*task);
+    block.count--;
+}
+
+/**
+ * @brief Obtiene la última tarea de la lista recorriendo solo el último bloque.
+ *
+ * @return La última tarea, o `nullptr` si la lista está vacía.
+ * @author fabian
+ */
+Task* TaskList::getLast() const {
+    if (this->blocks.empty()) return nullptr;
+    Task* task = this->blocks.back().first;
+    for (uint32_t i = 1; i < this->blocks.back().count; i++) task = task->next;
+    return task;
+}
+
+/**
+ * @brief Obtiene los bloques de la lista con sus resúmenes.
+ *
+ * @return Los bloques, en el orden de la lista.
+ * @author fabian
+ */
+const vector<TaskBlock>& TaskList::getBlocks() const { return this->blocks; }
+
+/**
+ * @brief Recorre las tareas de los bloques cuyo resumen puede cumplir un filtro y salta los demás.
+ *
+ * El filtro solo decide qué bloques se revisan: la función recibe todas las tareas de los bloques revisados y
+ * debe aplicar su propia condición.
+ *
+ * @param filter Filtro de fechas, tipos e importancias.
+ * @param callback Función que recibe cada tarea de los bloques revisados como `const Task&`.
+ * @return Bloques revisados y saltados.
+ * @author fabian
+ */
+template <class Callback>
+BlockScan TaskList::scanBlocks(const TaskBlockFilter& filter, Callback callback) const {
+    BlockScan scan;
+    for (const TaskBlock& block : this->blocks) {
+        if (!block.count) continue;
+        if (!block.mayMatch(filter)) {
+            scan.blocksSkipped++;
+            continue;
+        }
+        scan.blocksScanned++;
+        const Task* task = block.first;
+        for (uint32_t i = 0; i < block.count; i++, task = task->next) callback(*task);
+    }
+    return scan;
+}
+
+/**
+ * @brief Quita de la lista, en un solo recorrido, todas las tareas que cumplen una condición.
+ *
+ * La condición solo se evalúa en los bloques cuyo resumen puede cumplir el filtro. Los bloques se vuelven a
+ * calcular en el mismo recorrido con las tareas que quedan, así que sus resúmenes quedan ajustados.
+ *
+ * @param filter Filtro de fechas, tipos e importancias que deben poder cumplir los bloques revisados.
+ * @param predicate Función que recibe cada tarea de los bloques revisados como `const Task&` y devuelve true para
+ * quitarla.
+ * @return La primera de las tareas quitadas, enlazadas entre sí por `next` en el orden de la lista, o `nullptr`
+ * si no se quitó ninguna.
+ * @author fabian
+ */
+template <class Predicate>
+Task* TaskList::extractIf(const TaskBlockFilter& filter, Predicate predicate) {
+    vector<TaskBlock> kept;
+    kept.reserve(this->blocks.size());
+    Task* extracted = nullptr;
+    Task* lastExtracted = nullptr;
+    Task* previous = nullptr;
+    for (const TaskBlock& block : this->blocks) {
+        const bool scan = block.mayMatch(filter);
+        Task* task = block.first;
+        for (uint32_t i = 0; i < block.count; i++) {
+            Task* next = task->next;
+            if (scan && predicate(static_cast<const Task&>(*task))) {
+                (previous ? previous->next : this->head) = next;
+                task->next = nullptr;
+                (lastExtracted ? lastExtracted->next : extracted) = task;
+                lastExtracted = task;
+                --this->length;
+            } else {
+                if (kept.empty() || kept.back().count == BLOCK_SIZE) kept.push_back(TaskBlock{task});
+                kept.back().add(*task);
+                task->prev = previous;
+                task->block = static_cast<uint32_t>(kept.size() - 1);
+                previous = task;
+            }
+            task = next;
+        }
+    }
+    this->blocks = std::move(kept);
+    this->emptyBlocks = 0;
+    return extracted;
+}
+
+/**
+ * @brief Modifica, en un solo recorrido, las tareas de los bloques cuyo resumen puede cumplir un filtro, y vuelve
+ * a calcular los bloques si alguna cambió.
+ *
+ * Sirve para cambiar la fecha de muchas tareas a la vez: la lista mantiene su orden y los resúmenes quedan
+ * ajustados a las fechas nuevas sin llamar a `refresh` por cada tarea.
+ *
+ * @param filter Filtro de fechas, tipos e importancias que deben poder cumplir los bloques revisados.
+ * @param update Función que recibe cada tarea de los bloques revisados como `Task&` y devuelve true si la cambió.
+ * @return Cantidad de tareas cambiadas.
+ * @author fabian
+ */
+template <class Update>
+int TaskList::updateIf(const TaskBlockFilter& filter, Update update) {
+    int updated = 0;
+    for (const TaskBlock& block : this->blocks) {
+        if (!block.count || !block.mayMatch(filter)) continue;
+        Task* task = block.first;
+        for (uint32_t i = 0; i < block.count; i++, task = task->next) updated += update(*task) ? 1 : 0;
+    }
+    if (updated) rebuildBlocks();
+    return updated;
 }
 
 /**
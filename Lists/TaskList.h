@@ -5,14 +5,94 @@
 #ifndef TASKLIST_H
 #define TASKLIST_H
 
+#include <climits>
+#include <cstdint>
+#include <vector>
+
 #include "List.h"
 #include "../Structures/Task.h"
 
+/**
+ * @brief Bloques revisados y saltados en un recorrido por bloques.
+ */
+struct BlockScan {
+    uint64_t blocksScanned = 0;
+    uint64_t blocksSkipped = 0;
+
+    void merge(const BlockScan& other);
+};
+
+/**
+ * @brief Condiciones que un bloque de tareas debe poder cumplir para revisarlo.
+ *
+ * Los días son los de `dayNumber` y el rango incluye ambos extremos.
+ */
+struct TaskBlockFilter {
+    long minDay = LONG_MIN;
+    long maxDay = LONG_MAX;
+    uint64_t typeMask = ~uint64_t{0};
+    uint8_t importanceMask = 0xFF;
+};
+
+/**
+ * @brief Resumen de un bloque de tareas consecutivas de una lista.
+ *
+ * El resumen puede ser más amplio que las tareas que quedan en el bloque (por ejemplo, después de eliminar
+ * una), pero nunca más estrecho: si el resumen no cumple un filtro, ninguna tarea del bloque lo cumple.
+ */
+struct TaskBlock {
+    Task* first;
+    uint32_t count = 0;
+    uint8_t importanceMask = 0;
+    uint64_t typeMask = 0;
+    long minDay = LONG_MAX;
+    long maxDay = LONG_MIN;
+
+    void add(const Task& task);
+    [[nodiscard]] bool mayMatch(const TaskBlockFilter& filter) const;
+};
+
+/**
+ * @brief Lista de tareas activas agrupada en bloques de hasta `BLOCK_SIZE` tareas con su resumen.
+ *
+ * Cada bloque guarda su primera tarea, su cantidad de tareas, el rango de fechas, la máscara de tipos y la de
+ * importancias. Los recorridos con filtro saltan los bloques cuyo resumen no puede cumplirlo sin leer sus
+ * tareas. Las operaciones que cambian la lista mantienen los bloques; las que cambian la fecha de una tarea
+ * deben llamar a `refresh`, o hacer el cambio con `updateIf`, que cambia varias y vuelve a calcular los bloques.
+ *
+ * La lista es doblemente enlazada (`Task::prev`) y cada tarea guarda el índice de su bloque (`Task::block`), así
+ * que `unlink` quita una tarea ya ubicada en tiempo constante. Un bloque que queda vacío en medio de la lista no
+ * se borra, para no mover los índices; los bloques se vuelven a calcular cuando la mitad está vacía.
+ */
 class TaskList : public List<Task> {
 public:
+    static constexpr uint32_t BLOCK_SIZE = 16;
+
     TaskList() = default;
     void insert(Task* task);
+    void insertLast(Task* newNode);
+    void insertFirst(Task* newNode);
+    Task* insertAfter(Task* previousNode, Task* newNode);
+    Task* removeById(int id);
+    void unlink(Task* task);
+    void refresh(const Task* task);
+
+    [[nodiscard]] Task* getLast() const;
+    [[nodiscard]] const vector<TaskBlock>& getBlocks() const;
+
+    template <class Callback>
+    BlockScan scanBlocks(const TaskBlockFilter& filter, Callback callback) const;
+    template <class Predicate>
+    Task* extractIf(const TaskBlockFilter& filter, Predicate predicate);
+    template <class Update>
+    int updateIf(const TaskBlockFilter& filter, Update update);
+
 private:
+    vector<TaskBlock> blocks;
+    uint32_t emptyBlocks = 0;
+
+    void rebuildBlocks();
+
     static bool compareDates(const tm& lhs, const tm& rhs);
     static bool compareTimes(const tm& lhs, const tm& rhs);
     static bool isSameDateTime(const tm& date1, const tm& time1, const tm& date2, const tm& time2);
@@ -0,0 +1,233 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "VersionedPeople.h"
+
+#include <algorithm>
+
+/**
+ * @brief Versiones de la lista que modifica este hilo, o nullptr si no hay lectores que las usen: las operaciones
+ * copian a las personas publicadas y anotan sus cambios aquí. Lo asigna el hilo escritor de una `MutationQueue`.
+ */
+thread_local VersionedPeople* peopleVersions = nullptr;
+
+void destroyPerson(Person* person);
+
+/**
+ * @brief Obtiene el número de la versión; cada versión publicada tiene uno mayor que la anterior.
+ *
+ * @return Número de la versión.
+ * @author fabian
+ */
+uint64_t PeopleVersion::getNumber() const { return this->number; }
+
+/**
+ * @brief Obtiene la cantidad de personas de la versión.
+ *
+ * @return Cantidad de personas.
+ * @author fabian
+ */
+int PeopleVersion::getLength() const { return this->length; }
+
+/**
+ * @brief Obtiene los tipos de tarea de la versión, en el orden de `taskTypes`.
+ *
+ * @return Los tipos de tarea.
+ * @author fabian
+ */
+const vector<const TaskType*>& PeopleVersion::getTaskTypes() const { return *this->taskTypes; }
+
+/**
+ * @brief Busca el fragmento donde está o debería estar una cédula.
+ *
+ * @param id Cédula.
+ * @return Índice del último fragmento cuya primera cédula es menor o igual, o 0 si no hay ninguno.
+ * @author fabian
+ */
+size_t PeopleVersion::chunkFor(const int id) const {
+    const auto after = upper_bound(this->chunks.begin(), this->chunks.end(), id,
+                                   [](const int key, const shared_ptr<Chunk>& chunk) { return key < chunk->front()->id; });
+    return after == this->chunks.begin() ? 0 : static_cast<size_t>(after - this->chunks.begin() - 1);
+}
+
+/**
+ * @brief Busca una persona de la versión por su cédula.
+ *
+ * @param id Cédula.
+ * @return La persona, o nullptr si no está en la versión.
+ * @author fabian
+ */
+const Person* PeopleVersion::findById(const int id) const {
+    if (this->chunks.empty()) return nullptr;
+    const Chunk& chunk = *this->chunks[chunkFor(id)];
+    const auto found = lower_bound(chunk.begin(), chunk.end(), id,
+                                   [](const shared_ptr<const Person>& person, const int key) { return person->id < key; });
+    return found != chunk.end() && (*found)->id == id ? found->get() : nullptr;
+}
+
+/**
+ * @brief Recorre las personas de la versión en orden de cédula.
+ *
+ * @param function Función que recibe cada persona como `const Person&`.
+ * @author fabian
+ */
+template <class Function>
+void PeopleVersion::forEach(Function function) const {
+    for (const shared_ptr<Chunk>& chunk : this->chunks) {
+        for (const shared_ptr<const Person>& person : *chunk) function(*person);
+    }
+}
+
+/**
+ * @brief Constructor de la clase VersionedPeople. Publica la primera versión con todas las personas.
+ *
+ * @param people Lista viva de personas.
+ * @param taskTypes Lista viva de tipos de tarea.
+ * @author fabian
+ */
+VersionedPeople::VersionedPeople(PersonList& people, TaskTypeList& taskTypes) : people(people), taskTypes(taskTypes) {
+    auto first = make_shared<PeopleVersion>();
+    for (Person* person = people.head; person; person = person->next) {
+        if (first->chunks.empty() || first->chunks.back()->size() == PeopleVersion::CHUNK_SIZE) {
+            first->chunks.push_back(make_shared<PeopleVersion::Chunk>());
+            first->chunks.back()->reserve(PeopleVersion::CHUNK_SIZE);
+        }
+        first->chunks.back()->push_back(share(person));
+        first->length++;
+    }
+    first->taskTypes = collectTaskTypes();
+    this->current = std::move(first);
+}
+
+/**
+ * @brief Fija la versión publicada más reciente para leerla.
+ *
+ * @return La versión; sus personas siguen vivas y sin cambios mientras se tenga el puntero.
+ * @author fabian
+ */
+shared_ptr<const PeopleVersion> VersionedPeople::pin() {
+    lock_guard guard(this->lock);
+    return this->current;
+}
+
+/**
+ * @brief Anota que una persona cambió, se agregó o se eliminó, para llevar el cambio a la siguiente versión.
+ *
+ * @param personId Cédula de la persona.
+ * @author fabian
+ */
+void VersionedPeople::markChanged(const int personId) {
+    this->changed.push_back(personId);
+}
+
+/**
+ * @brief Anota que se agregó un tipo de tarea, para llevarlo a la siguiente versión.
+ * @author fabian
+ */
+void VersionedPeople::markTaskTypesChanged() {
+    this->taskTypesChanged = true;
+}
+
+/**
+ * @brief Publica una versión nueva con los cambios anotados desde la anterior.
+ *
+ * Copia el arreglo de fragmentos de la versión actual y, en orden de cédula, cada fragmento con alguna persona
+ * cambiada, la primera vez que lo toca; un fragmento que pasa de `2 * CHUNK_SIZE` personas se divide en dos y uno
+ * que queda vacío se quita. Debe llamarse desde el hilo que modifica las listas, entre una mutación y otra.
+ *
+ * @author fabian
+ */
+void VersionedPeople::publish() {
+    if (this->changed.empty() && !this->taskTypesChanged) return;
+
+    auto next = make_shared<PeopleVersion>(*this->current);
+    next->number++;
+    if (this->taskTypesChanged) next->taskTypes = collectTaskTypes();
+
+    sort(this->changed.begin(), this->changed.end());
+    this->changed.erase(unique(this->changed.begin(), this->changed.end()), this->changed.end());
+
+    vector<bool> copied(next->chunks.size(), false);
+    for (const int id : this->changed) {
+        Person* live = this->people.findById(id);
+        size_t index = 0;
+        if (next->chunks.empty()) {
+            if (!live) continue;
+            next->chunks.push_back(make_shared<PeopleVersion::Chunk>());
+            copied.push_back(true);
+        } else {
+            index = next->chunkFor(id);
+        }
+        if (!copied[index]) {
+            next->chunks[index] = make_shared<PeopleVersion::Chunk>(*next->chunks[index]);
+            copied[index] = true;
+        }
+        PeopleVersion::Chunk& chunk = *next->chunks[index];
+        const auto position = lower_bound(chunk.begin(), chunk.end(), id,
+                                          [](const shared_ptr<const Person>& person, const int key) { return person->id < key; });
+        const bool present = position != chunk.end() && (*position)->id == id;
+
+        if (live) {
+            if (live->published) continue;
+            if (present) {
+                *position = share(live);
+            } else {
+                chunk.insert(position, share(live));
+                next->length++;
+            }
+        } else if (present) {
+            chunk.erase(position);
+            next->length--;
+        }
+
+        if (chunk.size() > 2 * PeopleVersion::CHUNK_SIZE) {
+            const auto half = chunk.begin() + static_cast<long>(chunk.size() / 2);
+            auto upper = make_shared<PeopleVersion::Chunk>(half, chunk.end());
+            chunk.erase(half, chunk.end());
+            next->chunks.insert(next->chunks.begin() + static_cast<long>(index) + 1, std::move(upper));
+            copied.insert(copied.begin() + static_cast<long>(index) + 1, true);
+        } else if (chunk.empty()) {
+            next->chunks.erase(next->chunks.begin() + static_cast<long>(index));
+            copied.erase(copied.begin() + static_cast<long>(index));
+        }
+    }
+    this->changed.clear();
+    this->taskTypesChanged = false;
+
+    shared_ptr<const PeopleVersion> previous = std::move(next);
+    {
+        lock_guard guard(this->lock);
+        swap(previous, this->current);
+    }
+}
+
+/**
+ * @brief Marca una persona como publicada y crea el puntero compartido con el que la tienen las versiones.
+ *
+ * @param person Persona de la lista viva.
+ * @return Puntero que, al soltarse en la última versión, libera a la persona si ya fue retirada.
+ * @author fabian
+ */
+shared_ptr<const Person> VersionedPeople::share(Person* person) {
+    person->published = true;
+    return shared_ptr<const Person>(person, [](const Person* released) {
+        if (released->retired) destroyPerson(const_cast<Person*>(released));
+    });
+}
+
+/**
+ * @brief Copia los punteros a los tipos de tarea de la lista viva.
+ *
+ * @return Los tipos, en el orden de la lista.
+ * @author fabian
+ */
+shared_ptr<const vector<const TaskType*>> VersionedPeople::collectTaskTypes() const {
+    auto types = make_shared<vector<const TaskType*>>();
+    const TaskType* type = this->taskTypes.head;
+    for (int i = 0; i < this->taskTypes.getLength(); i++) {
+        types->push_back(type);
+        type = type->next;
+    }
+    return types;
+}
@@ -0,0 +1,94 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef VERSIONEDPEOPLE_H
+#define VERSIONEDPEOPLE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "PersonList.h"
+#include "TaskTypeList.h"
+
+using namespace std;
+
+/**
+ * @brief Versión inmutable de las personas y los tipos de tarea, ordenada por cédula como `PersonList`.
+ *
+ * Las personas se guardan en fragmentos de hasta `2 * CHUNK_SIZE` punteros compartidos. Una versión nueva copia
+ * solo el arreglo de fragmentos y los fragmentos donde cambió alguna persona; los demás los comparte con la
+ * versión anterior. Las personas de una versión no se modifican mientras alguna versión las tenga.
+ */
+class PeopleVersion {
+public:
+    static constexpr size_t CHUNK_SIZE = 256;
+
+    [[nodiscard]] uint64_t getNumber() const;
+    [[nodiscard]] int getLength() const;
+    [[nodiscard]] const Person* findById(int id) const;
+    [[nodiscard]] const vector<const TaskType*>& getTaskTypes() const;
+
+    template <class Function>
+    void forEach(Function function) const;
+
+private:
+    friend class VersionedPeople;
+
+    using Chunk = vector<shared_ptr<const Person>>;
+
+    vector<shared_ptr<Chunk>> chunks;
+    shared_ptr<const vector<const TaskType*>> taskTypes;
+    uint64_t number = 0;
+    int length = 0;
+
+    [[nodiscard]] size_t chunkFor(int id) const;
+};
+
+/**
+ * @brief Publica versiones inmutables de `people` y `taskTypes` para que los lectores las recorran sin bloquear al
+ * hilo que los modifica.
+ *
+ * Los lectores fijan la versión actual con `pin()` y la recorren mientras la tengan; el hilo escritor sigue
+ * modificando la lista viva y, entre un lote de mutaciones y otro, publica una versión nueva con `publish()`, que
+ * reemplaza a la anterior de una sola vez. Las mutaciones nunca se ven a medias: una tarea que se está completando
+ * está en las tareas activas de una versión o en el archivo de la siguiente, nunca en ambas ni en ninguna.
+ *
+ * Las personas publicadas se copian al escribir: antes de modificar una persona publicada, el escritor la copia
+ * (las tareas activas una por una y el archivo compartiendo sus bloques), pone la copia en la lista viva y marca la
+ * original como retirada; la versión siguiente lleva la copia. Cada persona de una versión es un puntero
+ * compartido, así que una persona retirada se libera cuando se suelta la última versión que la tiene, sin importar
+ * qué hilo la suelte; las que siguen en la lista viva no se liberan.
+ */
+class VersionedPeople {
+public:
+    VersionedPeople(PersonList& people, TaskTypeList& taskTypes);
+
+    VersionedPeople(const VersionedPeople&) = delete;
+    VersionedPeople& operator=(const VersionedPeople&) = delete;
+
+    [[nodiscard]] shared_ptr<const PeopleVersion> pin();
+
+    void markChanged(int personId);
+    void markTaskTypesChanged();
+    void publish();
+
+private:
+    PersonList& people;
+    TaskTypeList& taskTypes;
+    vector<int> changed;
+    bool taskTypesChanged = false;
+
+    mutex lock;
+    shared_ptr<const PeopleVersion> current;
+
+    static shared_ptr<const Person> share(Person* person);
+    shared_ptr<const vector<const TaskType*>> collectTaskTypes() const;
+};
+
+extern thread_local VersionedPeople* peopleVersions;
+
+#include "VersionedPeople.cpp"
+#endif //VERSIONEDPEOPLE_H
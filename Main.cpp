@@ -1,11 +1,12 @@
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <limits>
 #include <sstream>
 #include <string>
-#include <windows.h>
 #include <cstdlib>
-#include <conio.h>
+#include <cstring>
+#include <csignal>
 
 #include "Structures/Person.h"
 #include "Structures/Task.h"
@@ -14,165 +15,47 @@
 #include "Lists/TaskTypeList.h"
 #include "Lists/PersonList.h"
 #include "utils/utils.h"
+#include "Engine/Operations.h"
+#include "Engine/Compactor.h"
+#include "utils/ThreadPool.h"
+#include "Queries/Queries.h"
+#include "Batch/CommandInterpreter.h"
+#include "Storage/Snapshot.h"
+#include "Import/TaskImporter.h"
+#include "Export/ReportExporter.h"
+#include "Benchmarks/Benchmarks.h"
+#include "Server/TaskServer.h"
+#include "Storage/SharedDataset.h"
+#include "utils/JobExecutor.h"
+#include "Queries/ReportJobs.h"
 
 using namespace std;
 
-PersonList people = PersonList();
-TaskTypeList taskTypes = TaskTypeList();
-HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+unique_ptr<ThreadPool> queryPool;
 
 /**
- * @brief Agrega una tarea activa a una persona.
- *
- * Busca a la persona por su ID y agrega una tarea a su lista de tareas activas o completadas.
- *
- * @param personId Identificador de la persona a la que se le agregará la tarea.
- * @param task Puntero a la tarea que se va a agregar.
- * @param completed Define si la tarea está completada o no
- * @throws runtime_error Si la persona no se encuentra.
- * @author fabian
+ * @brief Ejecutor de los reportes y consultas en segundo plano del menú, o nullptr fuera del menú.
  */
-void addTask(const int personId, Task* task, bool completed = false) {
-    Person* person = people.findById(personId);
-    if (!person) throw runtime_error("Persona no encontrada");
-
-    if (completed) {
-        if (const Task* lastTask = person->completedTasks.get(-1))
-            task->id = lastTask->id + 1;
-        else task->id = 1;
-
-        person->completedTasks.insertLast(task);
-        return;
-    }
-
-    if (const Task* lastTask = person->activeTasks.get(-1))
-        task->id = lastTask->id + 1;
-    else task->id = 1;
-
-    person->activeTasks.insertLast(task);
-}
+JobExecutor* reportJobs = nullptr;
 
 /**
- * @brief Agrega una subtarea a una tarea específica de una persona.
- *
- * Busca a la persona y su tarea por ID e índice, respectivamente. Si la tarea es del tipo "Estudio",
- * la subtarea se agrega a la lista de subtareas de la tarea. Si no, la subtarea se elimina.
- *
- * @param personId Identificador de la persona.
- * @param taskIndex Índice de la tarea dentro de las tareas activas.
- * @param subTask Puntero a la subtarea que se va a agregar.
- * @throws runtime_error Si la persona o la tarea no se encuentran.
- * @author fabian
+ * @brief Trabajos enviados desde el menú, en el orden en que se enviaron.
  */
-void addSubTask(const int personId, const int taskIndex, SubTask* subTask) {
-    Person* person = people.findById(personId);
-    if (!person) throw runtime_error("Persona no encontrada");
-    Task* task = person->activeTasks.get(taskIndex);
-    if (!task) throw runtime_error("Tarea no encontrada");
-
-    if (task->type->name == "Estudio") {
-        task->subTasks.insertLast(subTask);
-    } else {
-        delete subTask;
-    }
-}
-
-/**
- * @brief Modifica la fecha y hora de una tarea activa de una persona.
- *
- * Busca la persona y la tarea por sus IDs y modifica la fecha y hora de la tarea.
- *
- * @param personId Identificador de la persona.
- * @param taskIndex Identificador de la tarea.
- * @param newDate Nueva fecha en formato "dd-mm-YYYY".
- * @param newTime Nueva hora en formato "HH:MM:SS".
- * @throws runtime_error Si la persona o la tarea no se encuentran.
- * @author fabian
- */
-void modifyActiveTask(const int personId, const int taskIndex, const string& newDate, const string& newTime) {
-    Person* person = people.findById(personId);
-    if (!person) throw runtime_error("Persona no encontrada");
-    Task* task = person->activeTasks.get(taskIndex);
-    if (!task) throw runtime_error("Tarea no encontrada");
-
-    task->setDate(newDate);
-    task->setTime(newTime);
-}
-
-/**
- * @brief Marca una tarea activa como completada y la mueve a la lista de tareas completadas.
- *
- * Busca y elimina una tarea activa de una persona y la mueve a la lista de tareas completadas.
- *
- * @param personId Identificador de la persona.
- * @param taskId Identificador de la tarea.
- * @throws runtime_error Si la persona o la tarea no se encuentran.
- * @author fabian
- */
-void completeTask(const int personId, const int taskId) {
-    Person* person = people.findById(personId);
-    if (!person) throw runtime_error("Persona no encontrada");
-    Task* task = person->activeTasks.removeById(taskId);
-    if (!task) throw runtime_error("Tarea no encontrada");
-
-    person->completedTasks.insertLast(task);
-}
+vector<shared_ptr<Job>> backgroundJobs;
 
 /**
- * @brief Marca una subtarea de una tarea activa como completada.
- *
- * Busca la persona, la tarea y la subtarea por sus IDs y las marca como completadas.
- *
- * @param personId Identificador de la persona.
- * @param taskId Identificador de la tarea.
- * @param subTaskIndex Índice de la subtarea dentro de la tarea.
- * @throws runtime_error Si la persona, la tarea o la subtarea no se encuentran.
- * @author fabian
+ * @brief Se activa con SIGINT o SIGTERM para detener el modo servidor.
  */
-void completeSubTask(const int personId, const int taskId, const int subTaskIndex) {
-    Person* person = people.findById(personId);
-    if (!person) throw runtime_error("Persona no encontrada");
-    Task* task = person->activeTasks.findById(taskId);
-    if (!task) throw runtime_error("Tarea no encontrada");
-
-    SubTask* subTask = task->subTasks.get(subTaskIndex);
-    if (!subTask) throw runtime_error("Subtarea no encontrada");
-
-    subTask->completed = true;
-    subTask->progress = 100;
-}
+atomic<bool> serverStop{false};
 
 /**
- * @brief Modifica el progreso de una subtarea específica de una tarea activa de una persona.
+ * @brief Manejador de señales del modo servidor.
  *
- * Busca la persona, la tarea y la subtarea por sus IDs e índice, respectivamente, y modifica el progreso de la subtarea.
- * Al completar la subtarea, se valida si todas las subtareas estan completadas, para marcar la tarea como completada en
- * su totalidad
- *
- * @param personId Identificador de la persona.
- * @param taskId Identificador de la tarea.
- * @param subTaskIndex Índice de la subtarea dentro de la tarea.
- * @param newProgress Nuevo progreso de la subtarea (0-100).
- * @throws runtime_error Si la persona, la tarea o la subtarea no se encuentran.
+ * @param signalNumber Señal recibida.
  * @author fabian
  */
-void subTaskProgress(const int personId, const int taskId, const int subTaskIndex, const float newProgress) {
-    const Person* person = people.findById(personId);
-    if (!person) throw runtime_error("Persona no encontrada");
-    const Task* task = person->activeTasks.findById(taskId);
-    if (!task) throw runtime_error("Tarea no encontrada");
-
-    SubTask* subTask = task->subTasks.get(subTaskIndex);
-    if (!subTask) throw runtime_error("Subtarea no encontrada");
-
-    subTask->progress = newProgress;
-    if (newProgress == 100) subTask->completed = true;
-    else subTask->completed = false;
-
-    for (int i = 0; i < task->subTasks.getLength(); i++) {
-        if (!subTask->completed) return;
-    }
-    completeTask(personId, task->id);
+void stopServer([[maybe_unused]] int signalNumber) {
+  serverStop = true;
 }
 
 /**
@@ -399,7 +282,7 @@ void menuInsertTaskType() {
     cout << "================== Insertar nuevo tipo de tarea ==================" << endl;
     const string name = promptInput<string>("Nombre de la tarea: ", true);
     const string description = promptInput<string>("Descripcion: ", true);
-    taskTypes.insert(name, description);
+    addTaskType(name, description);
 }
 
 /**
@@ -418,8 +301,13 @@ void menuInsertPerson() {
         return menuInsertPerson();
     }
 
-    people.insert(id, name, lastname, age);
-    cout << "Persona insertada correctamente";
+    try {
+        addPerson(id, name, lastname, age);
+        cout << "Persona insertada correctamente";
+    } catch (const runtime_error& error) {
+        cout << error.what();
+        waitKeyPress();
+    }
 }
 
 /**
@@ -435,8 +323,15 @@ void menuDeletePerson() {
         return;
     }
     const int id = promptInput<int>("\nCedula: ");
-    const Person* deletedPerson = people.removeById(id);
-    cout << deletedPerson->name << " eliminado correctamente";
+    const Person* person = people.getById(id);
+    if (!person) {
+        cout << "Persona no encontrada";
+        waitKeyPress();
+        return;
+    }
+    const string name = person->name;
+    deletePerson(id);
+    cout << name << " eliminado correctamente";
 }
 
 /**
@@ -524,7 +419,7 @@ void menuDeleteTask() {
     const int personId = promptInput<int>("Cedula de la persona: ");
 
     const Person* person = people.getById(personId);
-    TaskList activeTasks = person->activeTasks;
+    const TaskList& activeTasks = person->activeTasks;
 
     if (isEmpty(activeTasks)) {
         cout << person->name << " no tiene tareas";
@@ -536,7 +431,7 @@ void menuDeleteTask() {
     const int taskIndex = selectIndex("Tareas activas de " + person->name + ": ", tasksString, activeTasks.getLength());
 
     try {
-        activeTasks.removeById(activeTasks.get(taskIndex)->id);
+        deleteTask(personId, activeTasks.get(taskIndex)->id);
     } catch (const runtime_error& error) {
         cout << error.what();
         cout << endl << "Por favor vuelva a intentarlo" << endl;
@@ -667,7 +562,7 @@ void menuCompleteTask() {
 void editionMenu() {
     while (true) {
         int option = 0;
-        system("cls");
+        terminal.clearScreen();
         cout << endl << "Actualizar informacion" << endl << endl;
         cout << "Opciones" << endl;
         cout << "1. Insertar un nuevo Tipo de tarea" << endl;
@@ -684,7 +579,7 @@ void editionMenu() {
         cin >> option;
         cin.ignore();
 
-        system("cls");
+        terminal.clearScreen();
         switch (option) {
             case 1: menuInsertTaskType(); break;
             case 2: menuInsertPerson(); break;
@@ -698,31 +593,27 @@ void editionMenu() {
             case 10: return;
             default: break;
         }
+        commitMutations();
+        if (peopleVersions) peopleVersions->publish();
+        if (compactor) compactor->maybeStart();
     }
 }
 /**
  * @brief Encuentra la pesona con mas tareas activas.
- * Recorre toda la lista de personas y almacena la cantidad de tareas activas, si hay una cantidad mayor, la actualizara
- * y guardara el indice de la persona en la lista para ser mostrado posteriormente.
+ * Recorre en paralelo toda la lista de personas y se queda con la que tiene mas tareas activas; en caso de empate
+ * se muestra la que aparece primero en la lista.
  *
  * @author Joseph
  */
-void showMostActiveTasksPerson(int index=0,int maxTasks=0,int selectedIndex=0){
-    if(people.get(index)==nullptr){
-        if (index==0){
-            cout << "No hay personas registradas" << endl;
-        }else{
-            cout << "Persona con mas tareas activas: " << people.get(selectedIndex)->name << endl;
-            cout << "Tareas registradas: " << people.get(selectedIndex)->activeTasks.getLength() << endl;
-        }return;
-    }else{
-        int tasks = people.get(index)->activeTasks.getLength();
-        if (tasks>maxTasks){
-            selectedIndex = index;
-            maxTasks = tasks;
-        }
-        showMostActiveTasksPerson(index+1,maxTasks,selectedIndex);
+void showMostActiveTasksPerson(){
+    if (people.head == nullptr) {
+        cout << "No hay personas registradas" << endl;
+        return;
     }
+    const PersonArgMax result = queryMostActiveTasks(people, *queryPool);
+    const Person* selected = result.person ? result.person : people.head;
+    cout << "Persona con mas tareas activas: " << selected->name << endl;
+    cout << "Tareas registradas: " << selected->activeTasks.getLength() << endl;
 }
 
 /**
@@ -731,6 +622,7 @@ void showMostActiveTasksPerson(int index=0,int maxTasks=0,int selectedIndex=0){
  * Esta función muestra un mensaje para seleccionar un tipo de tarea y permite al usuario navegar
  * por los tipos disponibles usando las teclas de flecha arriba y abajo. El usuario puede seleccionar
  * un tipo de tarea presionando la barra espaciadora. Si la lista de tipos de tarea está vacía, retorna "empty".
+ * La función espera cada tecla sin consumir CPU y redibuja solo la línea del tipo seleccionado.
  *
  * @param opt (Opcional) El índice inicial para la selección de la tarea. El valor predeterminado es 0.
  * @return El nombre del tipo de tarea seleccionado como una cadena, o "empty" si no se selecciona ninguno.
@@ -740,38 +632,32 @@ string selectTask(int opt = 0) {
     if (taskTypes.getLength() == 0) {
         return "empty";
     }
-    string strOpt;
     cout << "Selecciona el tipo de tarea:\n(Muevete con las flechas (up & down); presiona ESPACIO para seleccionar)\n";
-    COORD posText = getCursorPosition(hConsole);/*Obtiene la posicion actual del cursor*/
-
-    bool selection = false;
-    while (!selection) {
-        strOpt = taskTypes.get(opt)->name;
-        moveCursor(15, posText.Y, hConsole);        /*Mueve el cursor a una posicion en especifico*/
-        deleteLine(hConsole);                       /*Borra la linea actual en la consola*/
-        moveCursor(posText.X, posText.Y, hConsole);/*Vuelve a la posicion original del cursor*/
-        cout << "Tipo de tarea: " << strOpt <<endl;
-
-        if (GetAsyncKeyState(VK_ESCAPE) & 0x8000) {
-            return "empty";
-        } else if (GetAsyncKeyState(VK_DOWN) & 0x8000) {
-            opt++;
-            while (GetAsyncKeyState(VK_DOWN) & 0x8000) { Sleep(50); }/*Espera que se suelte la tecla*/
-        } else if (GetAsyncKeyState(VK_UP) & 0x8000) {
-            opt--;
-            while (GetAsyncKeyState(VK_UP) & 0x8000) { Sleep(50); }/*Espera que se suelte la tecla*/
-        } else if (GetAsyncKeyState(VK_SPACE) & 0x8000) {
-            while (GetAsyncKeyState(VK_SPACE) & 0x8000) { Sleep(50); }/*Espera que se suelte la tecla*/
-            FlushConsoleInputBuffer(GetStdHandle(STD_INPUT_HANDLE));/*Limpia el buffer de entrada de la consola*/
-            selection = true;
-            break;
-        }
-        if (opt < 0) { opt = taskTypes.getLength(); }/*Si el indice es menor que cero, va al final de la lista*/
-        else if (opt > taskTypes.getLength()) { opt = 0; } /*Si el indice supoera el tamao vuelve al inicio*/
 
-        Sleep(10); /*Evitar la sobrecarga de la CPU*/
+    while (true) {
+        const string strOpt = taskTypes.get(opt)->name;
+        terminal.rewriteLine("Tipo de tarea: " + strOpt);   /*Redibuja la linea del tipo de tarea*/
+
+        switch (terminal.readKey().key) {                    /*Espera la siguiente tecla*/
+            case Key::Escape:
+            case Key::EndOfInput:
+                cout << endl;
+                return "empty";
+            case Key::Down:
+                opt++;
+                break;
+            case Key::Up:
+                opt--;
+                break;
+            case Key::Space:
+                cout << endl;
+                return strOpt;
+            default:
+                break;
+        }
+        if (opt < 0) { opt = taskTypes.getLength() - 1; }/*Si el indice es menor que cero, va al final de la lista*/
+        else if (opt >= taskTypes.getLength()) { opt = 0; } /*Si el indice supera el tamaño vuelve al inicio*/
     }
-    return strOpt;
 }
 
 /**
@@ -787,25 +673,10 @@ string selectTask(int opt = 0) {
 void showMostSpecificActiveTasksPerson(){
   string respuesta=selectTask();
   if (respuesta!="empty"){
-    int index=0;
-    int maxTasks=0;
-    int selectedIndex=0;
-    while(people.get(index)!=nullptr){/*Itera a través de todas las personas en la lista*/
-      int tasks = 0;
-      for (int i = 0; i < people.get(index)->activeTasks.getLength(); i++) {/*Recorre las tareas activas de la persona actual*/
-        if (people.get(index)->activeTasks.get(i)->type->name == respuesta) {/*Comprueba si el tipo de tarea coincide con el seleccionado*/
-          tasks++;
-        }
-      }
-      if (tasks > maxTasks) {
-        selectedIndex = index;/*Actualiza el índice de la persona con más tareas de este tipo*/
-        maxTasks = tasks;/*Actualiza el máximo de tareas encontradas*/
-      }
-      index++;
-    }
-    if (maxTasks > 0) {
-      cout << "Persona con mas tareas activas de tipo " << respuesta << ": " << people.get(selectedIndex)->name << endl;
-      cout << "Tareas registradas: " << maxTasks << endl;
+    const PersonArgMax result = queryMostActiveTasksOfType(people, *queryPool, respuesta);
+    if (result.count > 0) {
+      cout << "Persona con mas tareas activas de tipo " << respuesta << ": " << result.person->name << endl;
+      cout << "Tareas registradas: " << result.count << endl;
     }
     else {
       cout << "No hay tareas activas de tipo " << respuesta << endl;
@@ -819,63 +690,20 @@ void showMostSpecificActiveTasksPerson(){
 /**
  * @brief Encuentra y muestra el tipo o los tipos de tarea más comunes entre todas las tareas activas.
  *
- * Esta función recorre todas las personas registradas y sus tareas activas para contar cuántas veces aparece cada tipo de tarea.
- * Utiliza arreglos para almacenar los nombres de los tipos de tarea y sus conteos correspondientes.
+ * Esta función recorre en paralelo todas las personas registradas y sus tareas activas para contar cuántas veces aparece
+ * cada tipo de tarea.
  * Al finalizar, determina el o los tipos de tarea que tienen el mayor número de ocurrencias y los muestra en la consola.
  * Si no hay tareas activas, informa al usuario que no existen tareas activas.
  *
  * @author Joseph
  */
 void commonTypeTask() {
-    int index = 0;
-    const int MAX_TASK_TYPES = 100;
-    std::string taskTypeNames[MAX_TASK_TYPES];
-    int taskTypeCounts[MAX_TASK_TYPES];
-    int taskTypeNum = 0; 
-    for (int i = 0; i < MAX_TASK_TYPES; i++) {
-        taskTypeCounts[i] = 0;
-    }
-    while (people.get(index) != nullptr) {
-        int numTasks = people.get(index)->activeTasks.getLength();
-        for (int i = 0; i < numTasks; i++) {
-            std::string taskTypeName = people.get(index)->activeTasks.get(i)->type->name;
-            int j;
-            for (j = 0; j < taskTypeNum; j++) {
-                if (taskTypeNames[j] == taskTypeName) {
-                    taskTypeCounts[j]++;
-                    break;
-                }
-            }
-            if (j == taskTypeNum) {
-                if (taskTypeNum >= MAX_TASK_TYPES) {
-                    std::cout << "Error: demasiados tipos de tareas." << std::endl;
-                    return;
-                }
-                taskTypeNames[taskTypeNum] = taskTypeName;
-                taskTypeCounts[taskTypeNum] = 1;
-                taskTypeNum++;
-            }
-        }
-        index++;
-    }
-    if (taskTypeNum > 0) {
-        int maxCount = 0;
-        for (int i = 0; i < taskTypeNum; i++) {
-            if (taskTypeCounts[i] > maxCount) {
-                maxCount = taskTypeCounts[i];
-            }
-        }
-        int numMostCommon = 0;
-        std::string mostCommonTaskTypes[MAX_TASK_TYPES];
-        for (int i = 0; i < taskTypeNum; i++) {
-            if (taskTypeCounts[i] == maxCount) {
-                mostCommonTaskTypes[numMostCommon] = taskTypeNames[i];
-                numMostCommon++;
-            }
-        }
+    const KeyCounts counts = queryActiveTaskTypes(people, *queryPool);
+    if (!counts.entries.empty()) {
+        const int maxCount = counts.maxCount();
         std::cout << "Tipo(s) de tarea mas comun(es) con " << maxCount << " ocurrencia(s):" << std::endl;
-        for (int i = 0; i < numMostCommon; i++) {
-            std::cout << "- " << mostCommonTaskTypes[i] << std::endl;
+        for (const string& taskType : counts.keysWithCount(maxCount)) {
+            std::cout << "- " << taskType << std::endl;
         }
     } else {
         std::cout << "No hay tareas activas" << std::endl;
@@ -905,30 +733,10 @@ void mostExpiredTaskPerson() {
         date.tm_mday = day;
         date.tm_mon = month - 1;    // Los meses en struct tm van de 0 (enero) a 11 (diciembre)
         date.tm_year = year - 1900; // Los años en struct tm se cuentan desde 1900
-        int index = 0;
-        int maxTasks = 0;
-        int selectedIndex = -1;
-        while (people.get(index) != nullptr) {
-            int tasks = 0;
-            for (int i = 0; i < people.get(index)->activeTasks.getLength(); i++) {
-                if (people.get(index)->activeTasks.get(i)->type->name == respuesta) {
-                    struct tm taskDate = people.get(index)->activeTasks.get(i)->date;
-                    time_t taskTime = mktime(&taskDate);
-                    time_t inputTime = mktime(&date);
-                    if (difftime(taskTime, inputTime) < 0) {
-                        tasks++;
-                    }
-                }
-            }
-            if (tasks > maxTasks) {
-                selectedIndex = index;
-                maxTasks = tasks;
-            }
-            index++;
-        }
-        if (maxTasks > 0 && selectedIndex != -1) {
-            cout << "Persona con mas tareas vencidas de tipo " << respuesta << " hasta la fecha " << dateStr << ": " << people.get(selectedIndex)->name << endl;
-            cout << "Tareas vencidas: " << maxTasks << endl;
+        const PersonArgMax result = queryMostExpiredTasksOfType(people, *queryPool, respuesta, date);
+        if (result.count > 0) {
+            cout << "Persona con mas tareas vencidas de tipo " << respuesta << " hasta la fecha " << dateStr << ": " << result.person->name << endl;
+            cout << "Tareas vencidas: " << result.count << endl;
         } else {
             cout << "No hay tareas vencidas de tipo " << respuesta << " hasta la fecha " << dateStr << endl;
         }
@@ -957,60 +765,12 @@ void mostCommonExpiredTask() {
     date.tm_mday = day;
     date.tm_mon = month - 1;    /*Los meses en struct tm van de 0 (enero) a 11 (diciembre)*/
     date.tm_year = year - 1900; /*Los años en struct tm se cuentan desde 1900*/
-    int index = 0;
-    const int MAX_TASK_TYPES = 100; 
-    std::string taskTypeNames[MAX_TASK_TYPES];
-    int taskTypeCounts[MAX_TASK_TYPES];
-    int taskTypeNum = 0;
-    for (int i = 0; i < MAX_TASK_TYPES; i++) {
-        taskTypeCounts[i] = 0;
-    }
-    while (people.get(index) != nullptr) {
-        int numTasks = people.get(index)->activeTasks.getLength();
-        for (int i = 0; i < numTasks; i++) {
-            std::string taskTypeName = people.get(index)->activeTasks.get(i)->type->name;
-            struct tm taskDate = people.get(index)->activeTasks.get(i)->date;
-            time_t taskTime = mktime(&taskDate);        /*Convierte la fecha de vencimiento de la tarea a time_t para poder compararla.*/
-            time_t inputTime = mktime(&date);           /*Convierte la fecha ingresada a time_t*/
-            if (difftime(taskTime, inputTime) < 0) {    /*Verifica si la tarea vence antes de la fecha ingresada*/
-                int j;
-                for (j = 0; j < taskTypeNum; j++) {
-                    if (taskTypeNames[j] == taskTypeName) {
-                        taskTypeCounts[j]++;
-                        break;
-                    }
-                }
-                if (j == taskTypeNum) {
-                    if (taskTypeNum >= MAX_TASK_TYPES) {
-                        std::cout << "Error: demasiados tipos de tareas." << std::endl;
-                        return;
-                    }
-                    taskTypeNames[taskTypeNum] = taskTypeName;
-                    taskTypeCounts[taskTypeNum] = 1;
-                    taskTypeNum++;
-                }
-            }
-        }
-        index++;
-    }
-    if (taskTypeNum > 0) {
-        int maxCount = 0;
-        for (int i = 0; i < taskTypeNum; i++) {
-            if (taskTypeCounts[i] > maxCount) {
-                maxCount = taskTypeCounts[i];
-            }
-        }
-        int numMostCommon = 0;
-        std::string mostCommonTaskTypes[MAX_TASK_TYPES];
-        for (int i = 0; i < taskTypeNum; i++) {
-            if (taskTypeCounts[i] == maxCount) {
-                mostCommonTaskTypes[numMostCommon] = taskTypeNames[i];
-                numMostCommon++;
-            }
-        }
+    const KeyCounts counts = queryExpiredTaskTypes(people, *queryPool, date);
+    if (!counts.entries.empty()) {
+        const int maxCount = counts.maxCount();
         std::cout << "Tipo(s) de tarea mas comun(es) que se vencen antes de la fecha " << dateStr << " con " << maxCount << " ocurrencia(s):" << std::endl;
-        for (int i = 0; i < numMostCommon; i++) {
-            std::cout << "- " << mostCommonTaskTypes[i] << std::endl;
+        for (const string& taskType : counts.keysWithCount(maxCount)) {
+            std::cout << "- " << taskType << std::endl;
         }
     } else {
         std::cout << "No hay tareas activas que se vencen antes de la fecha " << dateStr << std::endl;
@@ -1026,43 +786,11 @@ void mostCommonExpiredTask() {
  * @author Joseph
  */
 void mostCommonImportance() {
-    const int MAX_IMPORTANCES = 3;
-    std::string importanceNames[MAX_IMPORTANCES] = {"Alto", "Medio", "Bajo"};
-    int importanceCounts[MAX_IMPORTANCES];
-    for (int i = 0; i < MAX_IMPORTANCES; i++) {
-        importanceCounts[i] = 0;
-    }
-    int index = 0;
-    while (people.get(index) != nullptr) {                      /*Itera sobre todas las personas hasta que no haya más*/
-        int numTasks = people.get(index)->activeTasks.getLength();
-        for (int i = 0; i < numTasks; i++) {                     
-            std::string taskImportance = people.get(index)->activeTasks.get(i)->importance;
-            for (int j = 0; j < MAX_IMPORTANCES; j++) {         /*Encuentra el índice correspondiente al nivel de importancia*/
-                if (taskImportance == importanceNames[j]) {
-                    importanceCounts[j]++;
-                    break;
-                }
-            }
-        }
-        index++;
-    }
-    int maxCount = 0;
-    for (int i = 0; i < MAX_IMPORTANCES; i++) {
-        if (importanceCounts[i] > maxCount) {
-            maxCount = importanceCounts[i];
-        }
-    }   /*Determina el número máximo de ocurrencias entre los niveles de importancia*/
-    int numMostCommon = 0;
-    std::string mostCommonImportances[MAX_IMPORTANCES];
-    for (int i = 0; i < MAX_IMPORTANCES; i++) {
-        if (importanceCounts[i] == maxCount) {
-            mostCommonImportances[numMostCommon] = importanceNames[i];
-            numMostCommon++;
-        }
-    }   /*Recolecta los niveles de importancia más comunes*/
+    const KeyCounts counts = queryActiveImportances(people, *queryPool);
+    const int maxCount = counts.maxCount();   /*Determina el número máximo de ocurrencias entre los niveles de importancia*/
     std::cout << "Nivel(es) de importancia mas comun(es) con " << maxCount << " ocurrencia(s):" << std::endl;
-    for (int i = 0; i < numMostCommon; i++) {
-        std::cout << "- " << mostCommonImportances[i] << std::endl;
+    for (const string& importance : counts.keysWithCount(maxCount)) {
+        std::cout << "- " << importance << std::endl;
     }
 }
 
@@ -1075,57 +803,12 @@ void mostCommonImportance() {
  * @author Joseph
  */
 void mostCommonTypeTaskOnActiveMediumImportance(){
-    int index = 0;
-    const int MAX_TASK_TYPES = 100;
-    std::string taskTypeNames[MAX_TASK_TYPES];
-    int taskTypeCounts[MAX_TASK_TYPES];
-    int taskTypeNum = 0;
-    for (int i = 0; i < MAX_TASK_TYPES; i++) {
-        taskTypeCounts[i] = 0;
-    }
-    while (people.get(index) != nullptr) {
-        int numTasks = people.get(index)->activeTasks.getLength();
-        for (int i = 0; i < numTasks; i++) {
-            if (people.get(index)->activeTasks.get(i)->importance == "Medio") {
-                std::string taskTypeName = people.get(index)->activeTasks.get(i)->type->name;
-                int j;
-                for (j = 0; j < taskTypeNum; j++) {
-                    if (taskTypeNames[j] == taskTypeName) {
-                        taskTypeCounts[j]++;
-                        break;
-                    }
-                }       /*Busca el tipo de tarea en el arreglo existente y aumenta su contador si ya existe*/
-                if (j == taskTypeNum) {
-                    if (taskTypeNum >= MAX_TASK_TYPES) {
-                        std::cout << "Error: demasiados tipos de tareas." << std::endl;
-                        return;
-                    }
-                    taskTypeNames[taskTypeNum] = taskTypeName;
-                    taskTypeCounts[taskTypeNum] = 1;
-                    taskTypeNum++;
-                }   /*Agrega un nuevo tipo de tarea al arreglo si no existía*/
-            }
-        }
-        index++;
-    }
-    if (taskTypeNum > 0) {
-        int maxCount = 0;
-        for (int i = 0; i < taskTypeNum; i++) {
-            if (taskTypeCounts[i] > maxCount) {
-                maxCount = taskTypeCounts[i];
-            }
-        }       /*Encuentra el número máximo de ocurrencias entre los tipos de tareas*/
-        int numMostCommon = 0;
-        std::string mostCommonTaskTypes[MAX_TASK_TYPES];
-        for (int i = 0; i < taskTypeNum; i++) {
-            if (taskTypeCounts[i] == maxCount) {
-                mostCommonTaskTypes[numMostCommon] = taskTypeNames[i];
-                numMostCommon++;
-            }
-        }           /*Recopila los tipos de tareas con el máximo número de ocurrencias*/
+    const KeyCounts counts = queryTaskTypesByImportance(people, *queryPool, false, "Medio");
+    if (!counts.entries.empty()) {
+        const int maxCount = counts.maxCount();
         std::cout << "Tipo(s) de tarea mas comun(es) con importancia 'Medio' con " << maxCount << " ocurrencia(s):" << std::endl;
-        for (int i = 0; i < numMostCommon; i++) {
-            std::cout << "- " << mostCommonTaskTypes[i] << std::endl;
+        for (const string& taskType : counts.keysWithCount(maxCount)) {
+            std::cout << "- " << taskType << std::endl;
         }
     } else {
         std::cout << "No hay tareas activas con importancia 'Medio'" << std::endl;
@@ -1141,57 +824,12 @@ void mostCommonTypeTaskOnActiveMediumImportance(){
  * @author Joseph
  */
 void mostCommonTypeTaskOnCompletedHighImportance(){
-    int index = 0;
-    const int MAX_TASK_TYPES = 100;
-    std::string taskTypeNames[MAX_TASK_TYPES];
-    int taskTypeCounts[MAX_TASK_TYPES];
-    int taskTypeNum = 0;
-    for (int i = 0; i < MAX_TASK_TYPES; i++) {
-        taskTypeCounts[i] = 0;
-    }
-    while (people.get(index) != nullptr) {
-        int numTasks = people.get(index)->completedTasks.getLength();
-        for (int i = 0; i < numTasks; i++) {
-            if (people.get(index)->completedTasks.get(i)->importance == "Alto") {
-                std::string taskTypeName = people.get(index)->completedTasks.get(i)->type->name;
-                int j;
-                for (j = 0; j < taskTypeNum; j++) {
-                    if (taskTypeNames[j] == taskTypeName) {
-                        taskTypeCounts[j]++;
-                        break;
-                    }
-                }       /*Si el tipo de tarea ya existe en el arreglo, incrementa su contador*/
-                if (j == taskTypeNum) {
-                    if (taskTypeNum >= MAX_TASK_TYPES) {
-                        std::cout << "Error: demasiados tipos de tareas." << std::endl;
-                        return;
-                    }
-                    taskTypeNames[taskTypeNum] = taskTypeName;
-                    taskTypeCounts[taskTypeNum] = 1;
-                    taskTypeNum++;
-                }   /*Si es un nuevo tipo de tarea, lo agrega al arreglo y establece su contador en 1*/
-            }
-        }
-        index++;
-    }
-    if (taskTypeNum > 0) {
-        int maxCount = 0;
-        for (int i = 0; i < taskTypeNum; i++) {
-            if (taskTypeCounts[i] > maxCount) {
-                maxCount = taskTypeCounts[i];
-            }
-        }   /*Encuentra el número máximo de ocurrencias entre los tipos de tareas*/
-        int numMostCommon = 0;
-        std::string mostCommonTaskTypes[MAX_TASK_TYPES];
-        for (int i = 0; i < taskTypeNum; i++) {
-            if (taskTypeCounts[i] == maxCount) {
-                mostCommonTaskTypes[numMostCommon] = taskTypeNames[i];
-                numMostCommon++;
-            }
-        }   /*Recopila los tipos de tareas con el máximo número de ocurrencias*/
+    const KeyCounts counts = queryTaskTypesByImportance(people, *queryPool, true, "Alto");
+    if (!counts.entries.empty()) {
+        const int maxCount = counts.maxCount();
         std::cout << "Tipo(s) de tarea mas comun(es) con importancia 'Alto' completadas con " << maxCount << " ocurrencia(s):" << std::endl;
-        for (int i = 0; i < numMostCommon; i++) {
-            std::cout << "- " << mostCommonTaskTypes[i] << std::endl;
+        for (const string& taskType : counts.keysWithCount(maxCount)) {
+            std::cout << "- " << taskType << std::endl;
         }
     } else {
         std::cout << "No hay tareas completadas con importancia 'Alto'" << std::endl;
@@ -1207,11 +845,11 @@ void mostCommonTypeTaskOnCompletedHighImportance(){
  * @author Joseph
  */
 void queryMenu(){
-    system("cls");
-  COORD pos = getCursorPosition(hConsole);
+    terminal.clearScreen();
+  TerminalPosition pos = getCursorPosition();
   int option=0;
   while (true) {
-    system("cls");
+    terminal.clearScreen();
     cout << "Consultas\n";
     cout << "1. Cual es la persona que tiene mas tareas activas?\n";
     cout << "2. Cual es la persona que tiene mas tareas activas de un tipo X?\n";
@@ -1269,55 +907,193 @@ void queryMenu(){
         return;
       default:
         verifyInputType();
-        moveCursorAndDeleteLine(23, pos.Y, hConsole);
-        moveCursor(pos.X, pos.Y, hConsole);
+        moveCursorAndDeleteLine(23, pos.Y);
+        moveCursor(pos.X, pos.Y);
         break;
     }
   }
 }
 
 /**
- * @brief Ordenamiento de tareas activas de un usuario por fecha.
+ * @brief Exporta un reporte a un archivo CSV, JSON por líneas o columnar (.tcol), según la extensión.
  *
- * Realiza un ordenamiento burbuja de las tareas activas de un usuario en base a la fecha.
+ * @author fabian
+ */
+void exportReportMenu() {
+    cout << "\nReportes: activas [cedula], semana fecha, completadas [cedula], subtareas [cedula], progreso [minimo], "
+            "consultas [fecha]\n";
+    const string reporte = promptInput<string>("Reporte: ");
+    const string archivo = promptInput<string>("Archivo (.csv, .jsonl o .tcol): ");
+    const string argumento = promptInput<string>("Argumento (enter si no aplica): ", true);
+
+    try {
+        const vector<string> args = argumento.empty() ? vector<string>{} : vector<string>{argumento};
+        const ExportSummary summary = exportReport(reporte, args, archivo, *queryPool, queryPool->getThreadCount() > 1);
+        cout << "Se exportaron " << summary.rows << " filas (" << summary.bytes << " bytes) a " << archivo << endl;
+    } catch (const exception& error) {
+        cout << "Error: " << error.what() << endl;
+    }
+    cout << "Presiones enter para continuar...\n";
+    terminal.readKey();
+}
+
+/**
+ * @brief Describe el estado y el avance de un trabajo en una línea.
  *
- * @author mario
+ * @param job Trabajo.
+ * @return Número, nombre, estado, personas recorridas y filas emitidas.
+ * @author fabian
  */
-TaskList ordenarPorFecha (TaskList lPTareasActivas) {
-    if (lPTareasActivas.head->next == nullptr) {
-        return lPTareasActivas; // Si la lista está vacía o solo tiene un elemento
+string describeJob(const Job& job) {
+    static const char* states[] = {"en cola", "ejecutando", "terminado", "cancelado", "fallido"};
+    const JobProgress progress = job.getProgress();
+    string text = "#" + to_string(job.getId()) + " " + job.getName() + ": " + states[static_cast<int>(progress.state)];
+    if (progress.total > 0) {
+        text += ", " + to_string(progress.done) + " de " + to_string(progress.total) + " personas (" +
+                to_string(progress.done * 100 / progress.total) + "%)";
     }
-    bool cambios = true;
-
-    while (cambios) {
-        Task* tempTareaActiva = lPTareasActivas.head;
-        cambios = false;
-        Task* anteriorTarea = nullptr;
-        while (tempTareaActiva->next != nullptr) {
-            Task* siguiente = tempTareaActiva->next;
-            if ((tempTareaActiva->date.tm_year > tempTareaActiva->next->date.tm_year) ||
-                (tempTareaActiva->date.tm_year == tempTareaActiva->next->date.tm_year &&
-                    tempTareaActiva->date.tm_yday > tempTareaActiva->next->date.tm_yday)) {
-               if (anteriorTarea == nullptr)
-                   lPTareasActivas.head = siguiente;
-               else {
-                   anteriorTarea->next = siguiente;
-               }
-                tempTareaActiva->next = siguiente->next;
-                siguiente->next = tempTareaActiva;
-
-                cambios = true;
-
-                anteriorTarea = siguiente;
-            }
-            else {
-                // Si no hay cambios avanza con los siguientes dos elementos
-                anteriorTarea = tempTareaActiva;
-                tempTareaActiva = tempTareaActiva->next;
+    if (progress.rows > 0) text += ", " + to_string(progress.rows) + " filas";
+    return text;
+}
+
+/**
+ * @brief Envía un trabajo al ejecutor del menú y lo agrega a los trabajos en segundo plano.
+ *
+ * @param name Nombre del trabajo.
+ * @param work Función del trabajo.
+ * @return El trabajo.
+ * @author fabian
+ */
+shared_ptr<Job> submitJob(const string& name, JobExecutor::Work work) {
+    shared_ptr<Job> job = reportJobs->submit(name, std::move(work));
+    backgroundJobs.push_back(job);
+    return job;
+}
+
+/**
+ * @brief Muestra un trabajo mientras avanza, sin bloquear el menú.
+ *
+ * Escribe las filas del trabajo a medida que llegan, de a unas pocas para revisar el teclado entre una tanda y
+ * otra, y debajo una línea de estado que se redibuja solo cuando cambia. Con 'c' se cancela el trabajo y con 's' se
+ * deja en segundo plano para seguirlo después desde el menú de trabajos. Al terminar muestra el resultado o el error.
+ *
+ * @param job Trabajo a seguir.
+ * @author fabian
+ */
+void followJob(const shared_ptr<Job>& job) {
+    constexpr size_t rowsPerRefresh = 256;
+    cout << "\nTrabajo #" << job->getId() << " (c: cancelar, s: dejar en segundo plano)\n";
+    size_t shown = 0;
+    string status;
+    while (true) {
+        const bool done = job->isDone();
+        const vector<string> rows = job->getRows(shown, rowsPerRefresh);
+        if (!rows.empty()) {
+            if (!status.empty()) terminal.rewriteLine("");
+            for (const string& row : rows) cout << row;
+            shown += rows.size();
+            status.clear();
+        }
+        const bool pending = rows.size() == rowsPerRefresh;
+        if (done && !pending) break;
+
+        const string current = describeJob(*job);
+        if (current != status) {
+            if (status.empty()) cout << current << flush;
+            else terminal.rewriteLine(current);
+            status = current;
+        }
+        const KeyEvent event = terminal.readKey(pending ? 0 : 100);
+        if (event.key == Key::Character && tolower(event.character) == 'c') job->cancel();
+        if ((event.key == Key::Character && tolower(event.character) == 's') || event.key == Key::EndOfInput) {
+            cout << endl;
+            return;
+        }
+    }
+
+    if (!status.empty()) terminal.rewriteLine("");
+    cout << describeJob(*job) << endl;
+    const string error = job->getError();
+    const string result = job->getResult();
+    if (!error.empty()) cout << "Error: " << error << endl;
+    else if (!result.empty()) cout << result << endl;
+}
+
+/**
+ * @brief Pide una consulta del menú de consultas con sus argumentos y la ejecuta como trabajo en segundo plano.
+ *
+ * @author fabian
+ */
+void submitQueryJob() {
+    QueryJobRequest request;
+    request.query = promptInput<int>("Consulta (1 - 8, las del menu de consultas): ");
+    if (request.query < 1 || request.query > 8) {
+        cout << "Consulta inexistente" << endl;
+        return;
+    }
+    if (request.query == 2 || request.query == 4) {
+        request.typeName = selectTask();
+        if (request.typeName == "empty") {
+            cout << "No existe ningun tipo de tarea en este momento." << endl;
+            return;
+        }
+    }
+    if (request.query == 4 || request.query == 5) {
+        request.limitText = promptInput<string>("Ingrese la fecha limite (dd-mm-yyyy): ");
+        int day, month, year;
+        if (!validateDates(day, month, year, request.limitText)) return;
+        request.limit.tm_mday = day;
+        request.limit.tm_mon = month - 1;
+        request.limit.tm_year = year - 1900;
+    }
+    followJob(submitJob(queryJobName(request), queryJob(peopleVersions->pin(), *queryPool, request)));
+}
+
+/**
+ * @brief Menú de los trabajos en segundo plano: lista los reportes y consultas enviados con su avance, y permite
+ * enviar consultas, seguir un trabajo o cancelarlo.
+ *
+ * @author fabian
+ */
+void jobsMenu() {
+    while (true) {
+        terminal.clearScreen();
+        cout << "Trabajos en segundo plano\n\n";
+        if (backgroundJobs.empty()) cout << "No hay trabajos\n";
+        for (const shared_ptr<Job>& job : backgroundJobs) cout << describeJob(*job) << "\n";
+        cout << "\n1. Enviar una consulta\n";
+        cout << "2. Seguir un trabajo\n";
+        cout << "3. Cancelar un trabajo\n";
+        cout << "4. Quitar los trabajos que ya terminaron\n";
+        cout << "5. Volver\n";
+        const int option = promptInput<int>("Seleccione una opcion: ");
+
+        if (option == 1) {
+            submitQueryJob();
+        } else if (option == 2 || option == 3) {
+            const int id = promptInput<int>("Numero del trabajo: ");
+            const auto found = find_if(backgroundJobs.begin(), backgroundJobs.end(), [id](const shared_ptr<Job>& job) {
+                return job->getId() == static_cast<uint64_t>(id);
+            });
+            if (found == backgroundJobs.end()) {
+                cout << "No existe el trabajo #" << id << endl;
+            } else if (option == 2) {
+                followJob(*found);
+            } else {
+                (*found)->cancel();
+                cout << "Se pidio cancelar el trabajo #" << id << endl;
             }
+        } else if (option == 4) {
+            erase_if(backgroundJobs, [](const shared_ptr<Job>& job) { return job->isDone(); });
+            continue;
+        } else if (option == 5) {
+            return;
+        } else {
+            continue;
         }
+        cout << "Presione enter para continuar...\n";
+        terminal.readKey();
     }
-    return lPTareasActivas;
 }
 
 /**
@@ -1328,14 +1104,13 @@ TaskList ordenarPorFecha (TaskList lPTareasActivas) {
  * @author mario
  */
 void menuReportes() {
-    system("cls");
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE); // Se usa para modificar el color de la consola
+    terminal.clearScreen();
     string opcionReporte = "0";
 
     while (opcionReporte != "9") {
-        SetConsoleTextAttribute(hConsole, 160); // Se modifica el color de la consola
+        terminal.setTextAttribute(160); // Se modifica el color de la consola
         cout << "\nMenu de reportes:";
-        SetConsoleTextAttribute(hConsole, 10);
+        terminal.setTextAttribute(10);
         cout << "\n1. Mostrar los tipos de tareas.\n";
         cout << "2. Mostrar todos los usuarios.\n";
         cout << "3. Mostrar usuarios sin tareas activas.\n";
@@ -1345,8 +1120,9 @@ void menuReportes() {
         cout << "7. Mostrar tareas realizadas por un usuario en especifico.\n";
         cout << "8. Mostrar tareas realizadas al 100%.\n";
         cout << "9. Volver al menu principal.\n";
-        SetConsoleTextAttribute(hConsole, 7);
-        cout << "Seleccione una opcion [1-9]:";
+        cout << "10. Exportar un reporte a un archivo.\n";
+        terminal.setTextAttribute(7);
+        cout << "Seleccione una opcion [1-10]:";
         cin >> opcionReporte;
 
         if (opcionReporte == "1") {
@@ -1356,7 +1132,7 @@ void menuReportes() {
                 actual = actual->next;
             } while (actual != taskTypes.head);
             cout << "Presiones enter para continuar...\n";
-            _getch();
+            terminal.readKey();
         }
         else if (opcionReporte == "2") {
             Person* actual = people.head;
@@ -1365,17 +1141,13 @@ void menuReportes() {
                 actual = actual->next;
             } while (actual != nullptr);
             cout << "Presiones enter para continuar...\n";
-            _getch();
+            terminal.readKey();
         }
         else if (opcionReporte == "3") {
-            Person* actual = people.head;
-            do {
-                if (actual->activeTasks.head == nullptr)
-                    cout << actual->name << endl;
-                actual = actual->next;
-            } while (actual != nullptr);
+            followJob(submitJob("Usuarios sin tareas activas",
+                                peopleWithoutActiveTasksJob(peopleVersions->pin(), *queryPool)));
             cout << "Presiones enter para continuar...\n";
-            _getch();
+            terminal.readKey();
         }
         else if (opcionReporte == "4") {
             Person* actual = people.head;
@@ -1389,19 +1161,26 @@ void menuReportes() {
             }
             if (actual == nullptr) {
                 cout << "El usuario ingresado no existe! Presiones enter para continuar...\n";
-                _getch();
+                terminal.readKey();
                 continue;
             }
             else if (actual->activeTasks.head == nullptr) {
                 cout << "El usuario ingresado no tiene tareas pendientes! Presiones enter para continuar...\n";
-                _getch();
+                terminal.readKey();
                 continue;
             }
-            actual->activeTasks = ordenarPorFecha(actual->activeTasks);
+            // Se ordena una copia de los punteros: las versiones publicadas comparten la lista de la persona
+            vector<const Task*> tareasOrdenadas;
+            for (const Task* tarea = actual->activeTasks.head; tarea; tarea = tarea->next) {
+                tareasOrdenadas.push_back(tarea);
+            }
+            stable_sort(tareasOrdenadas.begin(), tareasOrdenadas.end(), [](const Task* a, const Task* b) {
+                if (a->date.tm_year != b->date.tm_year) return a->date.tm_year < b->date.tm_year;
+                return a->date.tm_yday < b->date.tm_yday;
+            });
             cout << "Tareas pendientes de " << actual->name << ":\n\n";
-            Task* tareaActual = actual->activeTasks.head;
             int contadorTareas = 1;
-            do {
+            for (const Task* tareaActual : tareasOrdenadas) {
                 cout << "Tarea #" << contadorTareas << endl;
                 cout << "Tipo: " << tareaActual->type->name << endl;
                 cout << "ID: " << tareaActual->id << endl;
@@ -1409,17 +1188,14 @@ void menuReportes() {
                 cout << "Fecha: " << tareaActual->getDate() << endl;
                 cout << "Hora: " << tareaActual->getTime() << endl;
                 cout << "Descripcion: " << tareaActual->description << endl << endl;
-                tareaActual = tareaActual->next;
 
                 contadorTareas++;
-            } while (tareaActual != nullptr);
+            }
             cout << "Presiones enter para continuar...\n";
-            _getch();
+            terminal.readKey();
 
         }
         else if (opcionReporte == "5") {
-            Person* actual = people.head;
-            int contadorTareas = 1;
             string yearTemp;
             string mesTemp;
             string diaTemp;
@@ -1435,39 +1211,13 @@ void menuReportes() {
 
             string strFechaTemp = diaTemp + "-" + mesTemp + "-" + yearTemp;
             tm contenedorFecha = {};
-            istringstream fechaTemp(strFechaTemp);
-            fechaTemp >> get_time(&contenedorFecha, "%d-%m-%Y");
-            if (fechaTemp.fail()) {
+            if (!parseDate(strFechaTemp, contenedorFecha)) {
                 throw runtime_error("Formato de fecha incorrecto. (dd-mm-YYYY)");
                 continue;
             }
 
-            while (actual != nullptr) {
-                Task* tareaActual = actual->activeTasks.head;
-                while (tareaActual != nullptr) {
-                    int restaDias = tareaActual->date.tm_yday - contenedorFecha.tm_yday;
-                    if ((tareaActual->date.tm_year == contenedorFecha.tm_year && (restaDias < 8 && restaDias >= 0)) ||
-                        (tareaActual->date.tm_year == contenedorFecha.tm_year + 1 && restaDias < -358)) {
-
-                        cout << "Tarea #" << contadorTareas << endl;
-                        cout << "Usuario: " << actual->name << endl;
-                        cout << "Tipo: " << tareaActual->type->name << endl;
-                        cout << "ID: " << tareaActual->id << endl;
-                        cout << "Importancia: " << tareaActual->importance << endl;
-                        cout << "Fecha: " << tareaActual->getDate() << endl;
-                        cout << "Hora: " << tareaActual->getTime() << endl;
-                        cout << "Descripcion: " << tareaActual->description << endl << endl;
-                        if (actual->completedTasks.getLength() == 1)
-                            break;
-                        contadorTareas++;
-
-                    }
-
-                    tareaActual = tareaActual->next;
-
-                }
-                actual = actual->next;
-            }
+            followJob(submitJob("Tareas proximas a vencer desde " + strFechaTemp,
+                                tasksDueWithinWeekJob(peopleVersions->pin(), *queryPool, contenedorFecha)));
         }
         else if (opcionReporte == "6") {
             Person* actual = people.head;
@@ -1481,12 +1231,12 @@ void menuReportes() {
             }
             if (actual == nullptr) {
                 cout << "El usuario ingresado no existe! Presiones enter para continuar...\n";
-                _getch();
+                terminal.readKey();
                 continue;
             }
-            else if (actual->activeTasks.head == nullptr && actual->completedTasks.head == nullptr) {
+            else if (actual->activeTasks.head == nullptr && actual->completedTasks.empty()) {
                 cout << "El usuario ingresado no tiene tareas! Presiones enter para continuar...\n";
-                _getch();
+                terminal.readKey();
                 continue;
             }
             int tareaABuscar;
@@ -1500,23 +1250,15 @@ void menuReportes() {
                     noTareasActivas = true;
                 break;
             }
-            if (noTareasActivas) {
-                Task* tareaActual = actual->completedTasks.head;
-                while (tareaActual->id != tareaABuscar) {
-                    actual = actual->next;
-                    if (actual == nullptr)
-                        break;
-                }
-            }
             if (noTareasActivas) {
                 cout << "La tarea buscada no esta dentro de las tareas del usuario! Presiones enter para continuar...\n";
-                _getch();
+                terminal.readKey();
                 continue;
             }
             SubTask* subTareaActual = tareaActual->subTasks.head;
             if (subTareaActual == nullptr) {
                 cout << "La tarea buscada no tiene subtareas! Presiones enter para continuar...\n";
-                _getch();
+                terminal.readKey();
                 continue;
             }
             int contaSubTareas = 1;
@@ -1529,7 +1271,7 @@ void menuReportes() {
                 contaSubTareas++;
             }
             cout << "Presiones enter para continuar...\n";
-            _getch();
+            terminal.readKey();
         }
         else if (opcionReporte == "7") {
             Person* actual = people.head;
@@ -1543,62 +1285,42 @@ void menuReportes() {
             }
             if (actual == nullptr) {
                 cout << "El usuario ingresado no existe! Presiones enter para continuar...\n";
-                _getch();
+                terminal.readKey();
                 continue;
             }
-            else if (actual->completedTasks.head == nullptr) {
+            else if (actual->completedTasks.empty()) {
                 cout << "El usuario ingresado no tiene tareas completadas! Presiones enter para continuar...\n";
-                _getch();
+                terminal.readKey();
                 continue;
             }
             cout << "Tareas completadas de " << actual->name << ":\n\n";
-            Task* tareaActual = actual->completedTasks.head;
             int contadorTareas = 1;
-            do {
+            actual->completedTasks.forEach([&contadorTareas](const Task& tareaActual) {
                 cout << "Tarea #" << contadorTareas << endl;
-                cout << "Tipo: " << tareaActual->type->name << endl;
-                cout << "ID: " << tareaActual->id << endl;
-                cout << "Importancia: " << tareaActual->importance << endl;
-                cout << "Fecha: " << tareaActual->getDate() << endl;
-                cout << "Hora: " << tareaActual->getTime() << endl;
-                cout << "Descripcion: " << tareaActual->description << endl << endl;
-                if (actual->completedTasks.getLength() == 1)
-                    break;
-                tareaActual = tareaActual->next;
+                cout << "Tipo: " << tareaActual.type->name << endl;
+                cout << "ID: " << tareaActual.id << endl;
+                cout << "Importancia: " << tareaActual.importance << endl;
+                cout << "Fecha: " << tareaActual.getDate() << endl;
+                cout << "Hora: " << tareaActual.getTime() << endl;
+                cout << "Descripcion: " << tareaActual.description << endl << endl;
                 contadorTareas++;
-            } while (tareaActual != nullptr);
+            }, false);
             cout << "Presiones enter para continuar...\n";
-            _getch();
+            terminal.readKey();
         }
         else if (opcionReporte == "8") {
-            Person* actual = people.head;
-            int contadorTareas = 1;
-            while (actual != nullptr) {
-                Task* tareaActual = actual->completedTasks.head;
-                while (tareaActual != nullptr) {
-                    cout << "Tarea #" << contadorTareas << endl;
-                    cout << "Usuario: " << actual->name << endl;
-                    cout << "Tipo: " << tareaActual->type->name << endl;
-                    cout << "ID: " << tareaActual->id << endl;
-                    cout << "Importancia: " << tareaActual->importance << endl;
-                    cout << "Fecha: " << tareaActual->getDate() << endl;
-                    cout << "Hora: " << tareaActual->getTime() << endl;
-                    cout << "Descripcion: " << tareaActual->description << endl << endl;
-                    if (actual->completedTasks.getLength() == 1)
-                        break;
-                    tareaActual = tareaActual->next;
-                    contadorTareas++;
-                }
-                actual = actual->next;
-            }
+            followJob(submitJob("Tareas realizadas al 100%", completedTasksJob(peopleVersions->pin(), *queryPool)));
 
         }
         else if (opcionReporte == "9") {
             // Se salta la iteración
         }
+        else if (opcionReporte == "10") {
+            exportReportMenu();
+        }
         else {
             cout << "Opcion no valida! Presione enter para volver a mostrar el menu...\n";
-            _getch();
+            terminal.readKey();
         }
     }
 }
@@ -1606,34 +1328,316 @@ void menuReportes() {
 void menu() {
   int option=0;
   while(true){
-    system("cls");
+    terminal.clearScreen();
       cout << endl << "Bienvenid@ al gestor de tareas" << endl << endl;
     cout << "1. Actualizacion de informacion" << endl;
     cout << "2. Consultas" << endl;
     cout << "3. Informes" << endl;
-    cout << "4. Salir" << endl;
+    cout << "4. Trabajos en segundo plano" << endl;
+    cout << "5. Salir" << endl;
     cout << "Seleccione una opcion: ";
-    COORD pos = getCursorPosition(hConsole);
+    TerminalPosition pos = getCursorPosition();
     cin >> option;
     switch (option) {
         case 1: editionMenu(); break;
         case 2:
-            system("cls");
+            terminal.clearScreen();
             queryMenu();
             break;
         case 3: menuReportes();break;
-        case 4: return;
+        case 4: jobsMenu(); break;
+        case 5: return;
         default:
             verifyInputType();
-            moveCursorAndDeleteLine(23, pos.Y, hConsole);
-            moveCursor(pos.X, pos.Y, hConsole);
+            moveCursorAndDeleteLine(23, pos.Y);
+            moveCursor(pos.X, pos.Y);
             break;
     }
   }
 }
 
-int main() {
+/**
+ * @brief Carga la instantánea indicada si existe o, si no, los datos de prueba.
+ *
+ * @param snapshotPath Ruta de la instantánea.
+ * @return LSN de la última mutación incluida en la instantánea, o 0 si no se cargó ninguna.
+ * @author fabian
+ */
+uint64_t cargarInstantanea(const string& snapshotPath) {
+  if (fileExists(snapshotPath)) return loadSnapshot(snapshotPath, people, taskTypes, *queryPool).lastLsn;
   cargarDatos();
-  menu();
   return 0;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Carga los datos iniciales y reproduce el registro de mutaciones.
+ *
+ * Carga la instantánea indicada si existe o, si no, los datos de prueba. Luego abre el registro de mutaciones
+ * (`instantanea.wal`), reproduce las mutaciones posteriores a la instantánea y deja el registro abierto para las
+ * mutaciones nuevas.
+ *
+ * @param snapshotPath Ruta de la instantánea, o cadena vacía para usar los datos de prueba sin persistencia.
+ * @return El registro de mutaciones abierto, o nullptr si no hay persistencia.
+ * @author fabian
+ */
+unique_ptr<MutationLog> cargarDatosIniciales(const string& snapshotPath) {
+  if (snapshotPath.empty()) {
+    cargarDatos();
+    return nullptr;
+  }
+
+  const uint64_t snapshotLsn = cargarInstantanea(snapshotPath);
+  auto log = make_unique<MutationLog>(snapshotPath + ".wal");
+  recoverMutations(*log, snapshotLsn);
+  return log;
+}
+
+/**
+ * @brief Ejecuta una consulta sobre la memoria compartida que publica un servidor y escribe el resultado en la
+ * salida estándar con el formato de `CommandInterpreter::runQuery`.
+ *
+ * @param args Nombre de la memoria compartida, número de consulta y sus argumentos: el tipo para la 2, el tipo y
+ *             la fecha para la 4 y la fecha para la 5.
+ * @return Código de salida del programa.
+ * @author fabian
+ */
+int consultarMemoriaCompartida(const vector<string>& args) {
+  try {
+    if (args.size() < 2) throw runtime_error("Uso: --consulta-compartida nombre consulta [argumentos]");
+    const auto argument = [&args](const size_t index) -> const string& {
+      if (index >= args.size()) throw runtime_error("Faltan campos");
+      return args[index];
+    };
+    const auto date = [&argument](const size_t index) {
+      tm result = {};
+      if (!parseDate(argument(index), result)) throw runtime_error("Formato de fecha incorrecto. (dd-mm-YYYY)");
+      return result;
+    };
+    const int query = stoi(args[1]);
+    if (query < 1 || query > 8) throw runtime_error("Consulta desconocida");
+
+    SharedDatasetReader reader(args[0]);
+    const string output = reader.read([&](const SnapshotImage& image) {
+      PersonSummary person;
+      KeyCounts counts;
+      switch (query) {
+        case 1: person = queryMostActiveTasks(image); break;
+        case 2: person = queryMostActiveTasksOfType(image, argument(2)); break;
+        case 3: counts = queryActiveTaskTypes(image); break;
+        case 4: person = queryMostExpiredTasksOfType(image, argument(2), date(3)); break;
+        case 5: counts = queryExpiredTaskTypes(image, date(2)); break;
+        case 6: counts = queryActiveImportances(image); break;
+        case 7: counts = queryTaskTypesByImportance(image, false, "Medio"); break;
+        default: counts = queryTaskTypesByImportance(image, true, "Alto"); break;
+      }
+
+      if (query == 1 || query == 2 || query == 4) {
+        if (!person.found) return string("ok\t-\t-\t0\n");
+        return "ok\t" + to_string(person.id) + '\t' + person.name + '\t' + to_string(person.count) + '\n';
+      }
+      const int maxCount = counts.maxCount();
+      string line = "ok\t" + to_string(maxCount);
+      if (!counts.entries.empty()) {
+        for (const string& key : counts.keysWithCount(maxCount)) line += '\t' + key;
+      }
+      return line + '\n';
+    });
+    cout << output;
+    return 0;
+  } catch (const exception& error) {
+    cout << "error\t" << error.what() << endl;
+    return 2;
+  }
+}
+
+/**
+ * @brief Punto de entrada del programa.
+ *
+ * Opciones de línea de comandos:
+ * - `--hilos N`: cantidad de hilos para las consultas y reportes (por defecto, la cantidad de núcleos).
+ * - `--instantanea archivo`: carga los datos de la instantánea al iniciar (si existe), registra cada cambio en
+ *   `archivo.wal` y guarda una instantánea nueva al salir.
+ * - `--compactar-mb N`: tamaño del registro de mutaciones, en MB, a partir del cual se compacta en segundo plano
+ *   (64 por defecto).
+ * - `--io-mb-s N`: límite de escritura de la compactación en MB por segundo (0, sin límite, por defecto).
+ * - `--bench nombre [args...]`: ejecuta una prueba de rendimiento en lugar del menú.
+ * - `--importar archivo`: importa tareas desde un archivo CSV o JSON por líneas antes de abrir el menú o ejecutar
+ *   los comandos; ver TaskImporter.
+ * - `--batch [archivo]`: ejecuta los comandos del archivo (o de la entrada estándar) sin menú; ver CommandInterpreter.
+ * - `--historial-disco archivo`: guarda las tareas completadas en un árbol B+ en ese archivo en lugar de en memoria;
+ *   el archivo se crea vacío al iniciar y se elimina al salir, y las tareas se cargan desde la instantánea.
+ * - `--cache-mb N`: memoria, en MB, del pool de páginas del historial en disco (256 por defecto).
+ * - `--servidor ruta`: atiende solicitudes por un socket de dominio Unix en esa ruta en lugar de abrir el menú, hasta
+ *   recibir SIGINT o SIGTERM; ver TaskServer.
+ * - `--fragmentos N`: en modo servidor, reparte las personas en N fragmentos por cédula, cada uno con su hilo
+ *   escritor (1 por defecto). Ver ShardedEngine.
+ * - `--replica`: con `--servidor` e `--instantanea`, sirve solo consultas y reportes como réplica de lectura del
+ *   primario que usa esa instantánea, siguiendo su registro de mutaciones sin escribirlo; ver LogReplica.
+ * - `--memoria-compartida nombre`: en modo servidor, publica también los datos en un segmento de memoria compartida
+ *   POSIX con ese nombre cada vez que cambian, para que otros procesos los consulten sin conectarse; ver
+ *   SharedDatasetWriter.
+ * - `--memoria-mb N`: tamaño máximo, en MB, de los datos publicados en la memoria compartida (64 por defecto).
+ * - `--consulta-compartida nombre consulta [argumentos]`: ejecuta una consulta sobre la memoria compartida de un
+ *   servidor, sin cargar datos, y escribe el resultado como `--batch`.
+ *
+ * @author fabian
+ */
+int main(int argc, char* argv[]) {
+  unsigned threads = 0;
+  string snapshotPath;
+  bool batch = false;
+  FILE* input = stdin;
+  uint64_t compactionMegabytes = 64;
+  uint64_t compactionMegabytesPerSecond = 0;
+  string importPath;
+  string historyPath;
+  uint64_t cacheMegabytes = 256;
+  string serverPath;
+  int shardCount = 1;
+  bool replicaMode = false;
+  string sharedName;
+  uint64_t sharedMegabytes = 64;
+  for (int i = 1; i < argc; i++) {
+    const string arg = argv[i];
+    if (arg == "--hilos" && i + 1 < argc) {
+      threads = static_cast<unsigned>(stoi(argv[++i]));
+    } else if (arg == "--instantanea" && i + 1 < argc) {
+      snapshotPath = argv[++i];
+    } else if (arg == "--compactar-mb" && i + 1 < argc) {
+      compactionMegabytes = stoull(argv[++i]);
+    } else if (arg == "--io-mb-s" && i + 1 < argc) {
+      compactionMegabytesPerSecond = stoull(argv[++i]);
+    } else if (arg == "--bench") {
+      queryPool = make_unique<ThreadPool>(threads);
+      return runBenchmark(vector<string>(argv + i + 1, argv + argc), queryPool->getThreadCount());
+    } else if (arg == "--importar" && i + 1 < argc) {
+      importPath = argv[++i];
+    } else if (arg == "--historial-disco" && i + 1 < argc) {
+      historyPath = argv[++i];
+    } else if (arg == "--cache-mb" && i + 1 < argc) {
+      cacheMegabytes = stoull(argv[++i]);
+    } else if (arg == "--servidor" && i + 1 < argc) {
+      serverPath = argv[++i];
+    } else if (arg == "--fragmentos" && i + 1 < argc) {
+      shardCount = stoi(argv[++i]);
+    } else if (arg == "--replica") {
+      replicaMode = true;
+    } else if (arg == "--memoria-compartida" && i + 1 < argc) {
+      sharedName = argv[++i];
+    } else if (arg == "--memoria-mb" && i + 1 < argc) {
+      sharedMegabytes = stoull(argv[++i]);
+    } else if (arg == "--consulta-compartida") {
+      return consultarMemoriaCompartida(vector<string>(argv + i + 1, argv + argc));
+    } else if (arg == "--batch") {
+      batch = true;
+      if (i + 1 < argc && argv[i + 1][0] != '-') {
+        input = fopen(argv[++i], "rb");
+        if (!input) {
+          cerr << "No se pudo abrir " << argv[i] << endl;
+          return 1;
+        }
+      }
+    }
+  }
+  queryPool = make_unique<ThreadPool>(threads);
+
+  if (replicaMode && (serverPath.empty() || snapshotPath.empty() || !importPath.empty())) {
+    cerr << "--replica requiere --servidor e --instantanea, y no admite --importar" << endl;
+    return 1;
+  }
+  if (!sharedName.empty() && serverPath.empty()) {
+    cerr << "--memoria-compartida requiere --servidor" << endl;
+    return 1;
+  }
+
+  unique_ptr<TaskTree> historyTree;
+  unique_ptr<MutationLog> log;
+  uint64_t snapshotLsn = 0;
+  try {
+    if (!historyPath.empty()) {
+      historyTree = make_unique<TaskTree>(historyPath, cacheMegabytes << 20);
+      completedTaskTree = historyTree.get();
+    }
+    if (replicaMode) snapshotLsn = cargarInstantanea(snapshotPath);
+    else log = cargarDatosIniciales(snapshotPath);
+  } catch (const exception& error) {
+    cerr << error.what() << endl;
+    return 1;
+  }
+
+  unique_ptr<Compactor> logCompactor;
+  if (log) {
+    logCompactor = make_unique<Compactor>(snapshotPath, *log, compactionMegabytes << 20, compactionMegabytesPerSecond << 20);
+    compactor = logCompactor.get();
+  }
+
+  int status = 0;
+  try {
+    if (!importPath.empty()) {
+      FILE* importFile = fopen(importPath.c_str(), "rb");
+      if (!importFile) throw runtime_error("No se pudo abrir " + importPath);
+      TaskImporter importer(*queryPool, queryPool->getThreadCount());
+      const ImportSummary summary = importer.run(importFile, TaskImporter::detectFormat(importPath, importFile));
+      fclose(importFile);
+      commitMutations();
+      cerr << "Importadas " << summary.imported << " de " << summary.rows << " tareas, " << summary.errors
+           << " errores" << endl;
+      if (summary.errors > 0) status = 2;
+    }
+
+    if (replicaMode) {
+      LogReplica replica(snapshotPath, snapshotLsn, *queryPool);
+      TaskServer server(serverPath, *queryPool, replica);
+      if (!sharedName.empty()) server.publishTo(sharedName, sharedMegabytes << 20);
+      signal(SIGINT, stopServer);
+      signal(SIGTERM, stopServer);
+      cerr << "Replica escuchando en " << serverPath << endl;
+      server.run(serverStop);
+      const ServerStats stats = server.getStats();
+      const ReplicaStatus replicaStatus = replica.getStatus();
+      cerr << "Replica detenida en el LSN " << replicaStatus.appliedLsn << ": " << stats.connections
+           << " conexiones, " << stats.reads << " lecturas, " << replicaStatus.reloads << " recargas, "
+           << stats.sharedPublishes << " publicaciones en memoria compartida, " << stats.errors << " errores" << endl;
+    } else if (!serverPath.empty()) {
+      TaskServer server(serverPath, *queryPool, shardCount);
+      if (!sharedName.empty()) server.publishTo(sharedName, sharedMegabytes << 20);
+      signal(SIGINT, stopServer);
+      signal(SIGTERM, stopServer);
+      cerr << "Escuchando en " << serverPath << endl;
+      server.run(serverStop);
+      const ServerStats stats = server.getStats();
+      cerr << "Servidor detenido: " << stats.connections << " conexiones, " << stats.reads << " lecturas, "
+           << stats.writes << " escrituras en " << stats.writeBatches << " lotes, " << stats.sharedPublishes
+           << " publicaciones en memoria compartida, " << stats.errors << " errores" << endl;
+    } else if (batch) {
+      CommandInterpreter interpreter(*queryPool);
+      interpreter.run(input, stdout);
+      if (input != stdin) fclose(input);
+      if (interpreter.getErrorCount() > 0) status = 2;
+    } else {
+      VersionedPeople versions(people, taskTypes);
+      JobExecutor executor(2);
+      peopleVersions = &versions;
+      reportJobs = &executor;
+      menu();
+      reportJobs = nullptr;
+      backgroundJobs.clear();
+      peopleVersions = nullptr;
+    }
+
+    if (log) {
+      logCompactor->wait();
+      log->sync();
+      const uint64_t lastLsn = log->getLastLsn();
+      saveSnapshot(snapshotPath, people, taskTypes, lastLsn);
+      log->truncateThrough(lastLsn);
+    }
+  } catch (const exception& error) {
+    cerr << error.what() << endl;
+    return 1;
+  }
+  compactor = nullptr;
+  mutationLog = nullptr;
+  completedTaskTree = nullptr;
+  return status;
+}
@@ -0,0 +1,277 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "ParallelScan.h"
+
+#include <algorithm>
+
+/**
+ * @brief Propone una persona como máximo.
+ *
+ * @param candidate Persona candidata.
+ * @param candidateCount Conteo de la persona candidata.
+ * @author fabian
+ */
+void PersonArgMax::offer(const Person* candidate, const int candidateCount) {
+    if (candidateCount > this->count) {
+        this->person = candidate;
+        this->count = candidateCount;
+    }
+}
+
+/**
+ * @brief Combina el resultado de un fragmento posterior de la lista.
+ *
+ * @param other Máximo parcial del fragmento siguiente.
+ * @author fabian
+ */
+void PersonArgMax::merge(const PersonArgMax& other) {
+    offer(other.person, other.count);
+}
+
+/**
+ * @brief Suma ocurrencias a una clave, registrándola si es la primera vez que aparece.
+ *
+ * @param key Clave a contar.
+ * @param amount Cantidad de ocurrencias a sumar.
+ * @author fabian
+ */
+void KeyCounts::add(const string& key, const int amount) {
+    for (auto& [entryKey, entryCount] : this->entries) {
+        if (entryKey == key) {
+            entryCount += amount;
+            return;
+        }
+    }
+    this->entries.emplace_back(key, amount);
+}
+
+/**
+ * @brief Combina los conteos de un fragmento posterior de la lista.
+ *
+ * @param other Conteos parciales del fragmento siguiente.
+ * @author fabian
+ */
+void KeyCounts::merge(const KeyCounts& other) {
+    for (const auto& [key, count] : other.entries) add(key, count);
+}
+
+/**
+ * @brief Obtiene el mayor conteo registrado.
+ *
+ * @return El conteo máximo, o 0 si no hay claves.
+ * @author fabian
+ */
+int KeyCounts::maxCount() const {
+    int maxCount = 0;
+    for (const auto& [key, count] : this->entries) {
+        if (count > maxCount) maxCount = count;
+    }
+    return maxCount;
+}
+
+/**
+ * @brief Obtiene las claves que tienen exactamente el conteo indicado.
+ *
+ * @param count Conteo buscado.
+ * @return Claves con ese conteo, en orden de primera aparición.
+ * @author fabian
+ */
+vector<string> KeyCounts::keysWithCount(const int count) const {
+    vector<string> keys;
+    for (const auto& [key, entryCount] : this->entries) {
+        if (entryCount == count) keys.push_back(key);
+    }
+    return keys;
+}
+
+/**
+ * @brief Constructor de la clase PersonTopK.
+ *
+ * @param k Cantidad máxima de personas a conservar.
+ * @author fabian
+ */
+PersonTopK::PersonTopK(const int k) {
+    this->k = k;
+}
+
+/**
+ * @brief Propone una persona para el top K.
+ *
+ * @param candidate Persona candidata.
+ * @param candidateCount Conteo de la persona candidata.
+ * @author fabian
+ */
+void PersonTopK::offer(const Person* candidate, const int candidateCount) {
+    if (this->k <= 0 || candidateCount <= 0) return;
+    if (static_cast<int>(this->entries.size()) == this->k && this->entries.back().count >= candidateCount) return;
+
+    auto position = this->entries.begin();
+    while (position != this->entries.end() && position->count >= candidateCount) ++position;
+    this->entries.insert(position, PersonArgMax{candidate, candidateCount});
+
+    if (static_cast<int>(this->entries.size()) > this->k) this->entries.pop_back();
+}
+
+/**
+ * @brief Combina el top K de un fragmento posterior de la lista.
+ *
+ * @param other Top K parcial del fragmento siguiente.
+ * @author fabian
+ */
+void PersonTopK::merge(const PersonTopK& other) {
+    for (const PersonArgMax& entry : other.entries) offer(entry.person, entry.count);
+}
+
+/**
+ * @brief Constructor de la clase PeopleView. Recorre la lista viva de personas.
+ *
+ * @param people Lista de personas.
+ * @author fabian
+ */
+PeopleView::PeopleView(const PersonList& people) {
+    this->persons.reserve(people.getLength());
+    for (const Person* current = people.head; current; current = current->next) {
+        this->persons.push_back(current);
+    }
+}
+
+/**
+ * @brief Constructor de la clase PeopleView. Recorre las personas de una versión publicada.
+ *
+ * @param version Versión a recorrer; debe seguir fijada mientras se use la vista.
+ * @author fabian
+ */
+PeopleView::PeopleView(const PeopleVersion& version) {
+    this->persons.reserve(version.getLength());
+    version.forEach([this](const Person& person) { this->persons.push_back(&person); });
+}
+
+/**
+ * @brief Constructor de la clase PeopleView. Junta las personas de varias versiones en orden de cédula.
+ *
+ * Cada versión ya está ordenada, así que se mezclan de dos en dos como en un ordenamiento por mezcla.
+ *
+ * @param versions Versiones a recorrer, con cédulas distintas; deben seguir fijadas mientras se use la vista.
+ * @author fabian
+ */
+PeopleView::PeopleView(const vector<shared_ptr<const PeopleVersion>>& versions) {
+    size_t total = 0;
+    for (const auto& version : versions) total += static_cast<size_t>(version->getLength());
+    this->persons.reserve(total);
+
+    vector<size_t> bounds{0};
+    for (const auto& version : versions) {
+        version->forEach([this](const Person& person) { this->persons.push_back(&person); });
+        bounds.push_back(this->persons.size());
+    }
+    const auto byId = [](const Person* left, const Person* right) { return left->id < right->id; };
+    for (size_t width = 1; width + 1 < bounds.size(); width *= 2) {
+        for (size_t first = 0; first + width + 1 < bounds.size(); first += 2 * width) {
+            const size_t last = min(first + 2 * width, bounds.size() - 1);
+            inplace_merge(this->persons.begin() + static_cast<long>(bounds[first]),
+                          this->persons.begin() + static_cast<long>(bounds[first + width]),
+                          this->persons.begin() + static_cast<long>(bounds[last]), byId);
+        }
+    }
+}
+
+/**
+ * @brief Constructor de la clase PeopleView. Recorre una parte de otra vista, por ejemplo un tramo de un trabajo en
+ * segundo plano.
+ *
+ * @param persons Personas a recorrer, en orden de cédula; deben seguir vivas mientras se use la vista.
+ * @author fabian
+ */
+PeopleView::PeopleView(vector<const Person*> persons) : persons(std::move(persons)) {}
+
+/**
+ * @brief Obtiene las personas de la vista.
+ *
+ * @return Las personas, en orden de cédula.
+ * @author fabian
+ */
+const vector<const Person*>& PeopleView::getPersons() const { return this->persons; }
+
+/**
+ * @brief Constructor de la clase PersonShards.
+ *
+ * Divide las personas en fragmentos contiguos de tamaño similar, sin copiarlas.
+ *
+ * @param people Personas a dividir; la vista debe vivir mientras se usen los fragmentos.
+ * @param shardCount Cantidad de fragmentos deseada.
+ * @author fabian
+ */
+PersonShards::PersonShards(const PeopleView& people, int shardCount) : persons(people.getPersons()) {
+    const int total = static_cast<int>(this->persons.size());
+    if (shardCount > total) shardCount = total;
+    if (shardCount < 1) shardCount = 1;
+
+    for (int i = 0; i <= shardCount; i++) {
+        this->bounds.push_back(static_cast<int>(static_cast<long long>(total) * i / shardCount));
+    }
+}
+
+/**
+ * @brief Obtiene la cantidad de fragmentos.
+ *
+ * @return Número de fragmentos.
+ * @author fabian
+ */
+int PersonShards::getShardCount() const { return static_cast<int>(this->bounds.size()) - 1; }
+
+/**
+ * @brief Obtiene el inicio de un fragmento.
+ *
+ * @param shard Índice del fragmento.
+ * @return Puntero a la primera persona del fragmento.
+ * @author fabian
+ */
+const Person* const* PersonShards::begin(const int shard) const {
+    return this->persons.data() + this->bounds[shard];
+}
+
+/**
+ * @brief Obtiene el final (exclusivo) de un fragmento.
+ *
+ * @param shard Índice del fragmento.
+ * @return Puntero posterior a la última persona del fragmento.
+ * @author fabian
+ */
+const Person* const* PersonShards::end(const int shard) const {
+    return this->persons.data() + this->bounds[shard + 1];
+}
+
+/**
+ * @brief Recorre todas las personas en paralelo calculando agregados parciales por fragmento.
+ *
+ * Divide la lista en varios fragmentos por hilo para que el robo de trabajo equilibre la carga, calcula
+ * un agregado parcial por fragmento y los combina en el orden de la lista, de modo que los desempates
+ * coinciden con los de un recorrido secuencial.
+ *
+ * @tparam Partial Tipo del agregado parcial.
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos que ejecuta los fragmentos.
+ * @param identity Agregado vacío con el que inicia cada fragmento.
+ * @param map Función `void(const Person&, Partial&)` que acumula una persona en el agregado.
+ * @param merge Función `void(Partial&, const Partial&)` que combina dos agregados.
+ * @return El agregado de toda la lista.
+ * @author fabian
+ */
+template <class Partial, class Map, class Merge>
+Partial parallelScan(const PeopleView& people, ThreadPool& pool, const Partial& identity, Map map, Merge merge) {
+    const int shardsPerThread = pool.getThreadCount() > 1 ? 4 : 1;
+    const PersonShards shards(people, static_cast<int>(pool.getThreadCount()) * shardsPerThread);
+    vector<Partial> partials(shards.getShardCount(), identity);
+
+    pool.parallelFor(shards.getShardCount(), [&](const int shard) {
+        for (const Person* const* current = shards.begin(shard); current != shards.end(shard); ++current) {
+            map(**current, partials[shard]);
+        }
+    });
+
+    Partial result = identity;
+    for (const Partial& partial : partials) merge(result, partial);
+    return result;
+}
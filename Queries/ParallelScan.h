@@ -0,0 +1,94 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef PARALLELSCAN_H
+#define PARALLELSCAN_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../Lists/PersonList.h"
+#include "../Lists/VersionedPeople.h"
+#include "../utils/ThreadPool.h"
+
+/**
+ * @brief Persona con el mayor conteo visto hasta el momento.
+ *
+ * En caso de empate se conserva la persona que aparece primero en la lista.
+ */
+struct PersonArgMax {
+    const Person* person = nullptr;
+    int count = 0;
+
+    void offer(const Person* candidate, int candidateCount);
+    void merge(const PersonArgMax& other);
+};
+
+/**
+ * @brief Conteo de ocurrencias por clave, en el orden en que cada clave apareció por primera vez.
+ */
+struct KeyCounts {
+    vector<pair<string, int>> entries;
+
+    void add(const string& key, int amount = 1);
+    void merge(const KeyCounts& other);
+    [[nodiscard]] int maxCount() const;
+    [[nodiscard]] vector<string> keysWithCount(int count) const;
+};
+
+/**
+ * @brief Las K personas con mayor conteo, ordenadas de mayor a menor.
+ *
+ * En caso de empate se conserva el orden de la lista de personas.
+ */
+struct PersonTopK {
+    int k = 0;
+    vector<PersonArgMax> entries;
+
+    explicit PersonTopK(int k = 0);
+    void offer(const Person* candidate, int candidateCount);
+    void merge(const PersonTopK& other);
+};
+
+/**
+ * @brief Personas a recorrer en una consulta, en orden de cédula: las de la lista viva, las de una versión publicada
+ * o las de una versión de cada fragmento de un `ShardedEngine`.
+ *
+ * Se construye implícitamente desde la lista o una versión, así que las consultas aceptan ambas.
+ */
+class PeopleView {
+public:
+    PeopleView(const PersonList& people);
+    PeopleView(const PeopleVersion& version);
+    explicit PeopleView(const vector<shared_ptr<const PeopleVersion>>& versions);
+    explicit PeopleView(vector<const Person*> persons);
+
+    [[nodiscard]] const vector<const Person*>& getPersons() const;
+
+private:
+    vector<const Person*> persons;
+};
+
+/**
+ * @brief Divide las personas en fragmentos contiguos para recorrerlos en paralelo.
+ */
+class PersonShards {
+public:
+    PersonShards(const PeopleView& people, int shardCount);
+
+    [[nodiscard]] int getShardCount() const;
+    [[nodiscard]] const Person* const* begin(int shard) const;
+    [[nodiscard]] const Person* const* end(int shard) const;
+
+private:
+    const vector<const Person*>& persons;
+    vector<int> bounds;
+};
+
+template <class Partial, class Map, class Merge>
+Partial parallelScan(const PeopleView& people, ThreadPool& pool, const Partial& identity, Map map, Merge merge);
+
+#include "ParallelScan.cpp"
+#endif //PARALLELSCAN_H
@@ -0,0 +1,557 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "Queries.h"
+
+/**
+ * @brief Determina si una fecha es anterior a otra, comparando solo año, mes y día.
+ *
+ * @param date Fecha a comparar.
+ * @param limit Fecha límite.
+ * @return `true` si `date` es anterior a `limit`.
+ * @author fabian
+ */
+static bool isDateBefore(const tm& date, const tm& limit) {
+    if (date.tm_year != limit.tm_year) return date.tm_year < limit.tm_year;
+    if (date.tm_mon != limit.tm_mon) return date.tm_mon < limit.tm_mon;
+    return date.tm_mday < limit.tm_mday;
+}
+
+/**
+ * @brief Resultado parcial de un recorrido por bloques junto con los bloques revisados y saltados.
+ */
+template <class Partial>
+struct BlockScanned {
+    Partial value;
+    BlockScan blocks;
+};
+
+/**
+ * @brief Recorre en paralelo las personas acumulando también los bloques revisados y saltados.
+ *
+ * Igual que `parallelScan`, pero la función de cada persona recibe además el `BlockScan` parcial donde sumar los
+ * bloques de sus recorridos; al terminar, el total se copia en `blocks` si no es nulo.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @param identity Resultado parcial inicial.
+ * @param map Función `(const Person&, Partial&, BlockScan&)`.
+ * @param merge Función que combina dos resultados parciales.
+ * @param blocks Destino de los bloques revisados y saltados, o `nullptr`.
+ * @return El resultado combinado.
+ * @author fabian
+ */
+template <class Partial, class Map, class Merge>
+static Partial parallelBlockScan(const PeopleView& people, ThreadPool& pool, const Partial& identity, Map map,
+                                 Merge merge, BlockScan* blocks) {
+    BlockScanned<Partial> result = parallelScan(people, pool, BlockScanned<Partial>{identity, {}},
+        [&map](const Person& person, BlockScanned<Partial>& partial) { map(person, partial.value, partial.blocks); },
+        [&merge](BlockScanned<Partial>& into, const BlockScanned<Partial>& from) {
+            merge(into.value, from.value);
+            into.blocks.merge(from.blocks);
+        });
+    if (blocks) *blocks = result.blocks;
+    return result.value;
+}
+
+/**
+ * @brief Combina dos listas de filas conservando el orden de la lista de personas.
+ * @author fabian
+ */
+template <class Row>
+static void appendRows(vector<Row>& into, const vector<Row>& from) {
+    into.insert(into.end(), from.begin(), from.end());
+}
+
+/**
+ * @brief Encuentra la persona con más tareas activas.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @return La persona con más tareas activas y su cantidad.
+ * @author fabian
+ */
+PersonArgMax queryMostActiveTasks(const PeopleView& people, ThreadPool& pool) {
+    return parallelScan(people, pool, PersonArgMax{},
+        [](const Person& person, PersonArgMax& partial) {
+            partial.offer(&person, person.activeTasks.getLength());
+        },
+        [](PersonArgMax& into, const PersonArgMax& from) { into.merge(from); });
+}
+
+/**
+ * @brief Encuentra la persona con más tareas activas de un tipo.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @param typeName Nombre del tipo de tarea.
+ * @return La persona con más tareas activas del tipo y su cantidad.
+ * @author fabian
+ */
+PersonArgMax queryMostActiveTasksOfType(const PeopleView& people, ThreadPool& pool, const string& typeName) {
+    const optional<InternedString> type = InternedString::find(typeName);
+    if (!type) return {};
+    return parallelScan(people, pool, PersonArgMax{},
+        [&type](const Person& person, PersonArgMax& partial) {
+            int tasks = 0;
+            for (const Task* task = person.activeTasks.head; task; task = task->next) {
+                if (task->type->name == *type) tasks++;
+            }
+            partial.offer(&person, tasks);
+        },
+        [](PersonArgMax& into, const PersonArgMax& from) { into.merge(from); });
+}
+
+/**
+ * @brief Cuenta las tareas activas por tipo de tarea.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @return Conteo de tareas activas por nombre de tipo.
+ * @author fabian
+ */
+KeyCounts queryActiveTaskTypes(const PeopleView& people, ThreadPool& pool) {
+    return parallelScan(people, pool, KeyCounts{},
+        [](const Person& person, KeyCounts& partial) {
+            for (const Task* task = person.activeTasks.head; task; task = task->next) {
+                partial.add(task->type->name);
+            }
+        },
+        [](KeyCounts& into, const KeyCounts& from) { into.merge(from); });
+}
+
+/**
+ * @brief Encuentra la persona con más tareas activas de un tipo vencidas antes de una fecha.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @param typeName Nombre del tipo de tarea.
+ * @param limit Fecha límite.
+ * @param blocks Destino de los bloques revisados y saltados, o `nullptr`.
+ * @return La persona con más tareas vencidas del tipo y su cantidad.
+ * @author fabian
+ */
+PersonArgMax queryMostExpiredTasksOfType(const PeopleView& people, ThreadPool& pool, const string& typeName, const tm& limit,
+                                         BlockScan* blocks) {
+    const optional<InternedString> type = InternedString::find(typeName);
+    if (!type) return {};
+
+    TaskBlockFilter filter;
+    filter.maxDay = dayNumber(limit) - 1;
+    filter.typeMask = taskTypeBit(*type);
+    return parallelBlockScan(people, pool, PersonArgMax{},
+        [&type, &limit, &filter](const Person& person, PersonArgMax& partial, BlockScan& scan) {
+            int tasks = 0;
+            scan.merge(person.activeTasks.scanBlocks(filter, [&](const Task& task) {
+                if (task.type->name == *type && isDateBefore(task.date, limit)) tasks++;
+            }));
+            partial.offer(&person, tasks);
+        },
+        [](PersonArgMax& into, const PersonArgMax& from) { into.merge(from); }, blocks);
+}
+
+/**
+ * @brief Cuenta por tipo las tareas activas que vencen antes de una fecha.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @param limit Fecha límite.
+ * @param blocks Destino de los bloques revisados y saltados, o `nullptr`.
+ * @return Conteo de tareas vencidas por nombre de tipo.
+ * @author fabian
+ */
+KeyCounts queryExpiredTaskTypes(const PeopleView& people, ThreadPool& pool, const tm& limit, BlockScan* blocks) {
+    TaskBlockFilter filter;
+    filter.maxDay = dayNumber(limit) - 1;
+    return parallelBlockScan(people, pool, KeyCounts{},
+        [&limit, &filter](const Person& person, KeyCounts& partial, BlockScan& scan) {
+            scan.merge(person.activeTasks.scanBlocks(filter, [&](const Task& task) {
+                if (isDateBefore(task.date, limit)) partial.add(task.type->name);
+            }));
+        },
+        [](KeyCounts& into, const KeyCounts& from) { into.merge(from); }, blocks);
+}
+
+/**
+ * @brief Cuenta las tareas activas por nivel de importancia ("Alto", "Medio", "Bajo").
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @return Conteo por nivel de importancia, siempre con los tres niveles en ese orden.
+ * @author fabian
+ */
+KeyCounts queryActiveImportances(const PeopleView& people, ThreadPool& pool) {
+    KeyCounts levels;
+    levels.entries = {{"Alto", 0}, {"Medio", 0}, {"Bajo", 0}};
+
+    return parallelScan(people, pool, levels,
+        [](const Person& person, KeyCounts& partial) {
+            for (const Task* task = person.activeTasks.head; task; task = task->next) {
+                for (auto& [level, count] : partial.entries) {
+                    if (task->importance == level) {
+                        count++;
+                        break;
+                    }
+                }
+            }
+        },
+        [](KeyCounts& into, const KeyCounts& from) { into.merge(from); });
+}
+
+/**
+ * @brief Cuenta por tipo las tareas activas o completadas de un nivel de importancia.
+ *
+ * Los bloques de tareas, activas o del archivo de completadas, que no tienen tareas de esa importancia se saltan
+ * sin leerlos.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @param completed Si es `true` recorre las tareas completadas, si no las activas.
+ * @param importance Nivel de importancia a filtrar.
+ * @param blocks Destino de los bloques revisados y saltados, o `nullptr`.
+ * @return Conteo de tareas por nombre de tipo.
+ * @author fabian
+ */
+KeyCounts queryTaskTypesByImportance(const PeopleView& people, ThreadPool& pool, const bool completed, const string& importance,
+                                     BlockScan* blocks) {
+    TaskArchiveFilter archiveFilter;
+    if (completed) archiveFilter.importance = InternedString(importance);
+    TaskBlockFilter filter;
+    filter.importanceMask = importanceBit(importance);
+
+    return parallelBlockScan(people, pool, KeyCounts{},
+        [completed, &importance, &filter, &archiveFilter](const Person& person, KeyCounts& partial, BlockScan& scan) {
+            if (completed) {
+                scan.merge(person.completedTasks.forEachMatching(archiveFilter, [&partial](const Task& task) {
+                    partial.add(task.type->name);
+                }));
+                return;
+            }
+            scan.merge(person.activeTasks.scanBlocks(filter, [&](const Task& task) {
+                if (task.importance == importance) partial.add(task.type->name);
+            }));
+        },
+        [](KeyCounts& into, const KeyCounts& from) { into.merge(from); }, blocks);
+}
+
+/**
+ * @brief Obtiene las K personas con más tareas activas.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @param k Cantidad de personas a obtener.
+ * @return Las personas ordenadas de mayor a menor cantidad de tareas activas.
+ * @author fabian
+ */
+PersonTopK queryTopActivePeople(const PeopleView& people, ThreadPool& pool, const int k) {
+    return parallelScan(people, pool, PersonTopK(k),
+        [](const Person& person, PersonTopK& partial) {
+            partial.offer(&person, person.activeTasks.getLength());
+        },
+        [](PersonTopK& into, const PersonTopK& from) { into.merge(from); });
+}
+
+/**
+ * @brief Obtiene las personas que no tienen tareas activas.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @return Personas sin tareas activas, en el orden de la lista.
+ * @author fabian
+ */
+vector<const Person*> reportPeopleWithoutActiveTasks(const PeopleView& people, ThreadPool& pool) {
+    return parallelScan(people, pool, vector<const Person*>{},
+        [](const Person& person, vector<const Person*>& partial) {
+            if (person.activeTasks.head == nullptr) partial.push_back(&person);
+        },
+        appendRows<const Person*>);
+}
+
+/**
+ * @brief Obtiene las tareas activas que vencen dentro de la semana siguiente a una fecha.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @param from Fecha desde la que se cuenta la semana.
+ * @param blocks Destino de los bloques revisados y saltados, o `nullptr`.
+ * @return Tareas que vencen entre `from` y siete días después, en el orden de la lista.
+ * @author fabian
+ */
+vector<TaskRow> reportTasksDueWithinWeek(const PeopleView& people, ThreadPool& pool, const tm& from, BlockScan* blocks) {
+    const long fromDay = dayNumber(from);
+    TaskBlockFilter filter;
+    filter.minDay = fromDay;
+    filter.maxDay = fromDay + 7;
+
+    return parallelBlockScan(people, pool, vector<TaskRow>{},
+        [fromDay, &filter](const Person& person, vector<TaskRow>& partial, BlockScan& scan) {
+            scan.merge(person.activeTasks.scanBlocks(filter, [&](const Task& task) {
+                const long days = dayNumber(task.date) - fromDay;
+                if (days >= 0 && days < 8) partial.push_back({&person, &task});
+            }));
+        },
+        appendRows<TaskRow>, blocks);
+}
+
+/**
+ * @brief Obtiene todas las tareas completadas de todas las personas.
+ *
+ * Las tareas se descomprimen del archivo de cada persona y se copian sin sus subtareas.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @return Tareas completadas, en el orden de la lista.
+ * @author fabian
+ */
+vector<CompletedTaskRow> reportCompletedTasks(const PeopleView& people, ThreadPool& pool) {
+    return parallelScan(people, pool, vector<CompletedTaskRow>{},
+        [](const Person& person, vector<CompletedTaskRow>& partial) {
+            person.completedTasks.forEach([&](const Task& task) { partial.push_back({&person, task}); }, false);
+        },
+        appendRows<CompletedTaskRow>);
+}
+
+/**
+ * @brief Obtiene las tareas activas con subtareas, ordenadas de mayor a menor avance.
+ *
+ * El avance de cada tarea sale de los totales que la tarea lleva de sus subtareas (ver `Task::getProgress`), así
+ * que las subtareas no se recorren.
+ *
+ * @param people Personas a recorrer.
+ * @param pool Pool de hilos para el recorrido.
+ * @param minProgress Avance mínimo (0-100) de las tareas a incluir.
+ * @return Tareas con al menos `minProgress` de avance; las de igual avance, en el orden de la lista.
+ * @author fabian
+ */
+vector<TaskRow> reportTasksByProgress(const PeopleView& people, ThreadPool& pool, const float minProgress) {
+    vector<TaskRow> rows = parallelScan(people, pool, vector<TaskRow>{},
+        [minProgress](const Person& person, vector<TaskRow>& partial) {
+            for (const Task* task = person.activeTasks.head; task; task = task->next) {
+                if (!task->subTasks.getLength() || task->getProgress() < minProgress) continue;
+                partial.push_back({&person, task});
+            }
+        },
+        appendRows<TaskRow>);
+    stable_sort(rows.begin(), rows.end(), [](const TaskRow& left, const TaskRow& right) {
+        return left.task->getProgress() > right.task->getProgress();
+    });
+    return rows;
+}
+
+/**
+ * @brief Conteo de tareas por tipo sobre una imagen: cuenta por índice de tipo y conserva el orden en que cada tipo
+ * apareció por primera vez, el mismo de `KeyCounts`.
+ */
+struct ImageTypeCounts {
+    vector<int> counts;
+    vector<size_t> order;
+
+    explicit ImageTypeCounts(const SnapshotImage& image) : counts(image.getHeader().typeCount, 0) {}
+
+    void add(const int32_t typeIndex) {
+        if (typeIndex < 0 || static_cast<size_t>(typeIndex) >= this->counts.size()) {
+            throw runtime_error("Instantanea corrupta: tipo de tarea inexistente");
+        }
+        if (this->counts[typeIndex]++ == 0) this->order.push_back(typeIndex);
+    }
+
+    [[nodiscard]] KeyCounts toKeyCounts(const SnapshotImage& image) const {
+        KeyCounts result;
+        for (const size_t index : this->order) {
+            result.add(string(image.text(image.type(index).name)), this->counts[index]);
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Recorre las tareas activas o completadas de cada persona de una imagen, en orden de cédula.
+ *
+ * @param image Instantánea a recorrer.
+ * @param completed Si es `true` recorre las tareas completadas, si no las activas.
+ * @param visit Función `(const SnapshotPersonRecord&, const SnapshotTaskRecord&)`.
+ * @author fabian
+ */
+template <class Visit>
+static void forEachImageTask(const SnapshotImage& image, const bool completed, Visit visit) {
+    for (uint64_t i = 0; i < image.getHeader().personCount; i++) {
+        const SnapshotPersonRecord person = image.person(i);
+        const uint64_t first = person.firstTask + (completed ? person.activeCount : 0);
+        const uint64_t count = completed ? person.completedCount : person.activeCount;
+        for (uint64_t j = 0; j < count; j++) visit(person, image.task(first + j));
+    }
+}
+
+/**
+ * @brief Encuentra en una imagen la persona con el mayor conteo; en caso de empate, la de menor cédula.
+ *
+ * @param image Instantánea a recorrer.
+ * @param count Función que recibe el `SnapshotPersonRecord` de cada persona y devuelve su conteo.
+ * @return La persona con el mayor conteo, o una sin encontrar si ningún conteo es mayor que 0.
+ * @author fabian
+ */
+template <class Count>
+static PersonSummary imagePersonArgMax(const SnapshotImage& image, Count count) {
+    PersonSummary best;
+    for (uint64_t i = 0; i < image.getHeader().personCount; i++) {
+        const SnapshotPersonRecord person = image.person(i);
+        const int candidate = count(person);
+        if (candidate <= best.count) continue;
+        best = {true, person.id, string(image.text(person.name)), candidate};
+    }
+    return best;
+}
+
+/**
+ * @brief Obtiene los índices de los tipos de tarea de una imagen que tienen un nombre.
+ *
+ * @param image Instantánea.
+ * @param typeName Nombre del tipo.
+ * @return Una marca por tipo, verdadera en los que tienen ese nombre.
+ * @author fabian
+ */
+static vector<bool> imageTypesNamed(const SnapshotImage& image, const string& typeName) {
+    vector<bool> matches(image.getHeader().typeCount, false);
+    for (uint64_t i = 0; i < matches.size(); i++) matches[i] = image.text(image.type(i).name) == typeName;
+    return matches;
+}
+
+/**
+ * @brief Determina si la fecha de una tarea de una imagen es anterior a otra, comparando solo año, mes y día.
+ * @author fabian
+ */
+static bool isRecordBefore(const SnapshotTaskRecord& task, const tm& limit) {
+    tm date = {};
+    date.tm_year = task.year;
+    date.tm_mon = task.month;
+    date.tm_mday = task.day;
+    return isDateBefore(date, limit);
+}
+
+/**
+ * @brief Encuentra la persona con más tareas activas, leyendo una instantánea en su lugar.
+ *
+ * @param image Instantánea, por ejemplo la de una memoria compartida.
+ * @return La persona con más tareas activas y su cantidad.
+ * @author fabian
+ */
+PersonSummary queryMostActiveTasks(const SnapshotImage& image) {
+    return imagePersonArgMax(image, [](const SnapshotPersonRecord& person) {
+        return static_cast<int>(person.activeCount);
+    });
+}
+
+/**
+ * @brief Encuentra la persona con más tareas activas de un tipo, leyendo una instantánea en su lugar.
+ *
+ * @param image Instantánea, por ejemplo la de una memoria compartida.
+ * @param typeName Nombre del tipo de tarea.
+ * @return La persona con más tareas activas del tipo y su cantidad.
+ * @author fabian
+ */
+PersonSummary queryMostActiveTasksOfType(const SnapshotImage& image, const string& typeName) {
+    const vector<bool> matches = imageTypesNamed(image, typeName);
+    return imagePersonArgMax(image, [&](const SnapshotPersonRecord& person) {
+        int tasks = 0;
+        for (uint64_t j = 0; j < person.activeCount; j++) {
+            const int32_t typeIndex = image.task(person.firstTask + j).typeIndex;
+            if (typeIndex >= 0 && static_cast<size_t>(typeIndex) < matches.size() && matches[typeIndex]) tasks++;
+        }
+        return tasks;
+    });
+}
+
+/**
+ * @brief Cuenta las tareas activas por tipo de tarea, leyendo una instantánea en su lugar.
+ *
+ * @param image Instantánea, por ejemplo la de una memoria compartida.
+ * @return Conteo de tareas activas por nombre de tipo.
+ * @author fabian
+ */
+KeyCounts queryActiveTaskTypes(const SnapshotImage& image) {
+    ImageTypeCounts counts(image);
+    forEachImageTask(image, false, [&counts](const SnapshotPersonRecord&, const SnapshotTaskRecord& task) {
+        counts.add(task.typeIndex);
+    });
+    return counts.toKeyCounts(image);
+}
+
+/**
+ * @brief Encuentra la persona con más tareas activas de un tipo vencidas antes de una fecha, leyendo una
+ * instantánea en su lugar.
+ *
+ * @param image Instantánea, por ejemplo la de una memoria compartida.
+ * @param typeName Nombre del tipo de tarea.
+ * @param limit Fecha límite.
+ * @return La persona con más tareas vencidas del tipo y su cantidad.
+ * @author fabian
+ */
+PersonSummary queryMostExpiredTasksOfType(const SnapshotImage& image, const string& typeName, const tm& limit) {
+    const vector<bool> matches = imageTypesNamed(image, typeName);
+    return imagePersonArgMax(image, [&](const SnapshotPersonRecord& person) {
+        int tasks = 0;
+        for (uint64_t j = 0; j < person.activeCount; j++) {
+            const SnapshotTaskRecord task = image.task(person.firstTask + j);
+            if (task.typeIndex < 0 || static_cast<size_t>(task.typeIndex) >= matches.size()) continue;
+            if (matches[task.typeIndex] && isRecordBefore(task, limit)) tasks++;
+        }
+        return tasks;
+    });
+}
+
+/**
+ * @brief Cuenta por tipo las tareas activas que vencen antes de una fecha, leyendo una instantánea en su lugar.
+ *
+ * @param image Instantánea, por ejemplo la de una memoria compartida.
+ * @param limit Fecha límite.
+ * @return Conteo de tareas vencidas por nombre de tipo.
+ * @author fabian
+ */
+KeyCounts queryExpiredTaskTypes(const SnapshotImage& image, const tm& limit) {
+    ImageTypeCounts counts(image);
+    forEachImageTask(image, false, [&](const SnapshotPersonRecord&, const SnapshotTaskRecord& task) {
+        if (isRecordBefore(task, limit)) counts.add(task.typeIndex);
+    });
+    return counts.toKeyCounts(image);
+}
+
+/**
+ * @brief Cuenta las tareas activas por nivel de importancia, leyendo una instantánea en su lugar.
+ *
+ * @param image Instantánea, por ejemplo la de una memoria compartida.
+ * @return Conteo por nivel de importancia, siempre con los tres niveles en ese orden.
+ * @author fabian
+ */
+KeyCounts queryActiveImportances(const SnapshotImage& image) {
+    KeyCounts levels;
+    levels.entries = {{"Alto", 0}, {"Medio", 0}, {"Bajo", 0}};
+    forEachImageTask(image, false, [&](const SnapshotPersonRecord&, const SnapshotTaskRecord& task) {
+        const string_view importance = image.text(task.importance);
+        for (auto& [level, count] : levels.entries) {
+            if (importance == level) {
+                count++;
+                break;
+            }
+        }
+    });
+    return levels;
+}
+
+/**
+ * @brief Cuenta por tipo las tareas activas o completadas de un nivel de importancia, leyendo una instantánea en
+ * su lugar.
+ *
+ * @param image Instantánea, por ejemplo la de una memoria compartida.
+ * @param completed Si es `true` recorre las tareas completadas, si no las activas.
+ * @param importance Nivel de importancia a filtrar.
+ * @return Conteo de tareas por nombre de tipo.
+ * @author fabian
+ */
+KeyCounts queryTaskTypesByImportance(const SnapshotImage& image, const bool completed, const string& importance) {
+    ImageTypeCounts counts(image);
+    forEachImageTask(image, completed, [&](const SnapshotPersonRecord&, const SnapshotTaskRecord& task) {
+        if (image.text(task.importance) == importance) counts.add(task.typeIndex);
+    });
+    return counts.toKeyCounts(image);
+}
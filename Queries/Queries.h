@@ -0,0 +1,65 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef QUERIES_H
+#define QUERIES_H
+
+#include <ctime>
+
+#include "ParallelScan.h"
+#include "../Storage/Snapshot.h"
+
+/**
+ * @brief Fila de un reporte: una tarea junto con la persona a la que pertenece.
+ */
+struct TaskRow {
+    const Person* person;
+    const Task* task;
+};
+
+/**
+ * @brief Fila del reporte de tareas completadas: una copia de la tarea, sin subtareas, descomprimida del archivo.
+ */
+struct CompletedTaskRow {
+    const Person* person;
+    Task task;
+};
+
+/**
+ * @brief Persona encontrada por una consulta sobre una `SnapshotImage`. Se copia porque la imagen puede cambiar
+ * en cuanto termina la consulta.
+ */
+struct PersonSummary {
+    bool found = false;
+    int32_t id = 0;
+    string name;
+    int count = 0;
+};
+
+PersonArgMax queryMostActiveTasks(const PeopleView& people, ThreadPool& pool);
+PersonArgMax queryMostActiveTasksOfType(const PeopleView& people, ThreadPool& pool, const string& typeName);
+KeyCounts queryActiveTaskTypes(const PeopleView& people, ThreadPool& pool);
+PersonArgMax queryMostExpiredTasksOfType(const PeopleView& people, ThreadPool& pool, const string& typeName, const tm& limit,
+                                         BlockScan* blocks = nullptr);
+KeyCounts queryExpiredTaskTypes(const PeopleView& people, ThreadPool& pool, const tm& limit, BlockScan* blocks = nullptr);
+KeyCounts queryActiveImportances(const PeopleView& people, ThreadPool& pool);
+KeyCounts queryTaskTypesByImportance(const PeopleView& people, ThreadPool& pool, bool completed, const string& importance,
+                                     BlockScan* blocks = nullptr);
+PersonTopK queryTopActivePeople(const PeopleView& people, ThreadPool& pool, int k);
+
+PersonSummary queryMostActiveTasks(const SnapshotImage& image);
+PersonSummary queryMostActiveTasksOfType(const SnapshotImage& image, const string& typeName);
+KeyCounts queryActiveTaskTypes(const SnapshotImage& image);
+PersonSummary queryMostExpiredTasksOfType(const SnapshotImage& image, const string& typeName, const tm& limit);
+KeyCounts queryExpiredTaskTypes(const SnapshotImage& image, const tm& limit);
+KeyCounts queryActiveImportances(const SnapshotImage& image);
+KeyCounts queryTaskTypesByImportance(const SnapshotImage& image, bool completed, const string& importance);
+
+vector<const Person*> reportPeopleWithoutActiveTasks(const PeopleView& people, ThreadPool& pool);
+vector<TaskRow> reportTasksDueWithinWeek(const PeopleView& people, ThreadPool& pool, const tm& from, BlockScan* blocks = nullptr);
+vector<CompletedTaskRow> reportCompletedTasks(const PeopleView& people, ThreadPool& pool);
+vector<TaskRow> reportTasksByProgress(const PeopleView& people, ThreadPool& pool, float minProgress = 0);
+
+#include "Queries.cpp"
+#endif //QUERIES_H
@@ -0,0 +1,309 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "ReportJobs.h"
+
+#include <sstream>
+
+/**
+ * @brief Recorre las personas por tramos de `REPORT_JOB_SLICE`, informando el avance del trabajo.
+ *
+ * @param people Personas a recorrer, de una versión que el trabajo mantiene fijada; así el menú puede seguir
+ *               modificando las listas mientras tanto.
+ * @param job Trabajo que hace el recorrido.
+ * @param visit Función `(const PeopleView&)` que procesa cada tramo.
+ * @author fabian
+ */
+template <class Visit>
+static void forEachSlice(const PeopleView& people, Job& job, Visit visit) {
+    const vector<const Person*>& persons = people.getPersons();
+    job.setTotal(persons.size());
+    for (size_t first = 0; first < persons.size() && !job.isCancelled(); first += REPORT_JOB_SLICE) {
+        const size_t last = min(persons.size(), first + REPORT_JOB_SLICE);
+        visit(PeopleView(vector<const Person*>(persons.begin() + static_cast<long>(first),
+                                               persons.begin() + static_cast<long>(last))));
+        job.advance(last - first);
+    }
+}
+
+/**
+ * @brief Crea un trabajo que ejecuta una consulta tramo por tramo y combina los resultados parciales.
+ *
+ * @param version Versión a consultar.
+ * @param pool Pool de hilos para recorrer cada tramo.
+ * @param query Función `(const PeopleView&, ThreadPool&)` que devuelve el resultado parcial de un tramo.
+ * @param describe Función `(const Partial&, const PeopleView&)` que describe el resultado combinado hasta el
+ *                 momento; se publica después de cada tramo.
+ * @return La función del trabajo.
+ * @author fabian
+ */
+template <class Partial, class Query, class Describe>
+static JobExecutor::Work slicedQueryJob(shared_ptr<const PeopleVersion> version, ThreadPool& pool, Query query,
+                                        Describe describe) {
+    return [version = std::move(version), &pool, query, describe](Job& job) {
+        const PeopleView people(*version);
+        Partial total{};
+        job.setResult(describe(total, people));
+        forEachSlice(people, job, [&](const PeopleView& slice) {
+            total.merge(query(slice, pool));
+            job.setResult(describe(total, people));
+        });
+    };
+}
+
+/**
+ * @brief Describe una persona encontrada por una consulta con los mismos textos del menú de consultas.
+ *
+ * @param result Persona y conteo.
+ * @param found Texto que antecede al nombre de la persona.
+ * @param countLabel Texto que antecede al conteo.
+ * @param missing Texto si ninguna persona tiene un conteo mayor que cero.
+ * @return La descripción.
+ * @author fabian
+ */
+static string describePerson(const PersonArgMax& result, const string& found, const string& countLabel,
+                             const string& missing) {
+    if (result.count <= 0) return missing;
+    return found + result.person->name + "\n" + countLabel + to_string(result.count);
+}
+
+/**
+ * @brief Describe las claves más comunes de un conteo con los mismos textos del menú de consultas.
+ *
+ * @param counts Conteo por clave.
+ * @param heading Texto que antecede a la cantidad de ocurrencias.
+ * @param missing Texto si no hay ninguna clave.
+ * @return La descripción, con una clave por línea.
+ * @author fabian
+ */
+static string describeCounts(const KeyCounts& counts, const string& heading, const string& missing) {
+    if (counts.entries.empty()) return missing;
+    const int maxCount = counts.maxCount();
+    string text = heading + " con " + to_string(maxCount) + " ocurrencia(s):";
+    for (const string& key : counts.keysWithCount(maxCount)) text += "\n- " + key;
+    return text;
+}
+
+/**
+ * @brief Formatea una tarea como la muestra el menú de reportes.
+ *
+ * @param number Número de la tarea en el reporte.
+ * @param person Persona a la que pertenece.
+ * @param task Tarea.
+ * @return El bloque de texto de la tarea, terminado en una línea vacía.
+ * @author fabian
+ */
+static string formatTaskRow(const uint64_t number, const Person& person, const Task& task) {
+    ostringstream row;
+    row << "Tarea #" << number << "\n";
+    row << "Usuario: " << person.name << "\n";
+    row << "Tipo: " << task.type->name << "\n";
+    row << "ID: " << task.id << "\n";
+    row << "Importancia: " << task.importance << "\n";
+    row << "Fecha: " << task.getDate() << "\n";
+    row << "Hora: " << task.getTime() << "\n";
+    row << "Descripcion: " << task.description << "\n\n";
+    return row.str();
+}
+
+/**
+ * @brief Obtiene el nombre con el que se muestra el trabajo de una consulta.
+ *
+ * @param request Consulta.
+ * @return El nombre, con el tipo y la fecha si la consulta los usa.
+ * @author fabian
+ */
+string queryJobName(const QueryJobRequest& request) {
+    string name = "Consulta " + to_string(request.query);
+    if (request.query == 2) name += " (" + request.typeName + ")";
+    if (request.query == 4) name += " (" + request.typeName + ", " + request.limitText + ")";
+    if (request.query == 5) name += " (" + request.limitText + ")";
+    return name;
+}
+
+/**
+ * @brief Obtiene la función de tramo y la de descripción de una consulta del menú de consultas, con los mismos
+ * textos del menú, y se las pasa a otra función.
+ *
+ * @param request Consulta y sus argumentos.
+ * @param visit Función `(Partial identity, Query query, Describe describe)`, donde `query` recibe
+ *              `(const PeopleView&, ThreadPool&)` y `describe` recibe `(const Partial&, const PeopleView&)`.
+ * @return Lo que devuelve `visit`.
+ * @throws runtime_error Si el número de consulta no existe.
+ * @author fabian
+ */
+template <class Visit>
+static auto visitQuery(const QueryJobRequest& request, Visit visit) {
+    const string typeName = request.typeName;
+    const string dateText = request.limitText;
+    const tm limit = request.limit;
+
+    switch (request.query) {
+        case 1:
+            return visit(PersonArgMax{},
+                [](const PeopleView& slice, ThreadPool& slicePool) { return queryMostActiveTasks(slice, slicePool); },
+                [](const PersonArgMax& result, const PeopleView& people) -> string {
+                    if (people.getPersons().empty()) return "No hay personas registradas";
+                    const Person* selected = result.person ? result.person : people.getPersons().front();
+                    return "Persona con mas tareas activas: " + selected->name + "\nTareas registradas: " +
+                           to_string(selected->activeTasks.getLength());
+                });
+        case 2:
+            return visit(PersonArgMax{},
+                [typeName](const PeopleView& slice, ThreadPool& slicePool) {
+                    return queryMostActiveTasksOfType(slice, slicePool, typeName);
+                },
+                [typeName](const PersonArgMax& result, const PeopleView&) {
+                    return describePerson(result, "Persona con mas tareas activas de tipo " + typeName + ": ",
+                                          "Tareas registradas: ", "No hay tareas activas de tipo " + typeName);
+                });
+        case 3:
+            return visit(KeyCounts{},
+                [](const PeopleView& slice, ThreadPool& slicePool) { return queryActiveTaskTypes(slice, slicePool); },
+                [](const KeyCounts& counts, const PeopleView&) {
+                    return describeCounts(counts, "Tipo(s) de tarea mas comun(es)", "No hay tareas activas");
+                });
+        case 4:
+            return visit(PersonArgMax{},
+                [typeName, limit](const PeopleView& slice, ThreadPool& slicePool) {
+                    return queryMostExpiredTasksOfType(slice, slicePool, typeName, limit);
+                },
+                [typeName, dateText](const PersonArgMax& result, const PeopleView&) {
+                    const string suffix = "de tipo " + typeName + " hasta la fecha " + dateText;
+                    return describePerson(result, "Persona con mas tareas vencidas " + suffix + ": ",
+                                          "Tareas vencidas: ", "No hay tareas vencidas " + suffix);
+                });
+        case 5:
+            return visit(KeyCounts{},
+                [limit](const PeopleView& slice, ThreadPool& slicePool) {
+                    return queryExpiredTaskTypes(slice, slicePool, limit);
+                },
+                [dateText](const KeyCounts& counts, const PeopleView&) {
+                    return describeCounts(counts, "Tipo(s) de tarea mas comun(es) que se vencen antes de la fecha " +
+                                                  dateText, "No hay tareas activas que se vencen antes de la fecha " +
+                                                  dateText);
+                });
+        case 6:
+            return visit(KeyCounts{},
+                [](const PeopleView& slice, ThreadPool& slicePool) { return queryActiveImportances(slice, slicePool); },
+                [](const KeyCounts& counts, const PeopleView&) {
+                    return describeCounts(counts, "Nivel(es) de importancia mas comun(es)", "No hay tareas activas");
+                });
+        case 7:
+            return visit(KeyCounts{},
+                [](const PeopleView& slice, ThreadPool& slicePool) {
+                    return queryTaskTypesByImportance(slice, slicePool, false, "Medio");
+                },
+                [](const KeyCounts& counts, const PeopleView&) {
+                    return describeCounts(counts, "Tipo(s) de tarea mas comun(es) con importancia 'Medio'",
+                                          "No hay tareas activas con importancia 'Medio'");
+                });
+        case 8:
+            return visit(KeyCounts{},
+                [](const PeopleView& slice, ThreadPool& slicePool) {
+                    return queryTaskTypesByImportance(slice, slicePool, true, "Alto");
+                },
+                [](const KeyCounts& counts, const PeopleView&) {
+                    return describeCounts(counts, "Tipo(s) de tarea mas comun(es) con importancia 'Alto' completadas",
+                                          "No hay tareas completadas con importancia 'Alto'");
+                });
+        default:
+            throw runtime_error("Consulta inexistente: " + to_string(request.query));
+    }
+}
+
+/**
+ * @brief Crea el trabajo de una consulta del menú de consultas.
+ *
+ * Recorre la versión por tramos y publica después de cada uno el resultado de las personas recorridas; los empates
+ * se resuelven igual que al consultar todo de una vez.
+ *
+ * @param version Versión a consultar.
+ * @param pool Pool de hilos para recorrer cada tramo.
+ * @param request Consulta y sus argumentos.
+ * @return La función del trabajo.
+ * @throws runtime_error Si el número de consulta no existe.
+ * @author fabian
+ */
+JobExecutor::Work queryJob(shared_ptr<const PeopleVersion> version, ThreadPool& pool, const QueryJobRequest& request) {
+    return visitQuery(request, [&version, &pool](auto identity, auto query, auto describe) -> JobExecutor::Work {
+        return slicedQueryJob<decltype(identity)>(std::move(version), pool, query, describe);
+    });
+}
+
+/**
+ * @brief Ejecuta de una vez, sin tramos, una consulta del menú de consultas y describe su resultado como lo
+ * describiría su trabajo.
+ *
+ * @param request Consulta y sus argumentos.
+ * @param people Personas a consultar.
+ * @param pool Pool de hilos para el recorrido.
+ * @return La descripción del resultado.
+ * @throws runtime_error Si el número de consulta no existe.
+ * @author fabian
+ */
+string describeQuery(const QueryJobRequest& request, const PeopleView& people, ThreadPool& pool) {
+    return visitQuery(request, [&people, &pool](auto, auto query, auto describe) -> string {
+        return describe(query(people, pool), people);
+    });
+}
+
+/**
+ * @brief Crea el trabajo del reporte de personas sin tareas activas; emite el nombre de cada una.
+ *
+ * @param version Versión a recorrer.
+ * @param pool Pool de hilos para recorrer cada tramo.
+ * @return La función del trabajo.
+ * @author fabian
+ */
+JobExecutor::Work peopleWithoutActiveTasksJob(shared_ptr<const PeopleVersion> version, ThreadPool& pool) {
+    return [version = std::move(version), &pool](Job& job) {
+        forEachSlice(PeopleView(*version), job, [&](const PeopleView& slice) {
+            for (const Person* person : reportPeopleWithoutActiveTasks(slice, pool)) job.emit(person->name + "\n");
+        });
+        job.setResult(to_string(job.getProgress().rows) + " usuario(s) sin tareas activas");
+    };
+}
+
+/**
+ * @brief Crea el trabajo del reporte de tareas que vencen dentro de la semana siguiente a una fecha; emite cada
+ * tarea como la muestra el menú de reportes.
+ *
+ * @param version Versión a recorrer.
+ * @param pool Pool de hilos para recorrer cada tramo.
+ * @param from Fecha desde la que se cuenta la semana.
+ * @return La función del trabajo.
+ * @author fabian
+ */
+JobExecutor::Work tasksDueWithinWeekJob(shared_ptr<const PeopleVersion> version, ThreadPool& pool, const tm& from) {
+    return [version = std::move(version), &pool, from](Job& job) {
+        uint64_t number = 0;
+        forEachSlice(PeopleView(*version), job, [&](const PeopleView& slice) {
+            for (const TaskRow& row : reportTasksDueWithinWeek(slice, pool, from)) {
+                job.emit(formatTaskRow(++number, *row.person, *row.task));
+            }
+        });
+        job.setResult(to_string(number) + " tarea(s) proximas a vencer");
+    };
+}
+
+/**
+ * @brief Crea el trabajo del reporte de tareas completadas; emite cada tarea como la muestra el menú de reportes.
+ *
+ * @param version Versión a recorrer.
+ * @param pool Pool de hilos para recorrer cada tramo.
+ * @return La función del trabajo.
+ * @author fabian
+ */
+JobExecutor::Work completedTasksJob(shared_ptr<const PeopleVersion> version, ThreadPool& pool) {
+    return [version = std::move(version), &pool](Job& job) {
+        uint64_t number = 0;
+        forEachSlice(PeopleView(*version), job, [&](const PeopleView& slice) {
+            for (const CompletedTaskRow& row : reportCompletedTasks(slice, pool)) {
+                job.emit(formatTaskRow(++number, *row.person, row.task));
+            }
+        });
+        job.setResult(to_string(number) + " tarea(s) completadas");
+    };
+}
@@ -0,0 +1,42 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef REPORTJOBS_H
+#define REPORTJOBS_H
+
+#include <ctime>
+#include <memory>
+#include <string>
+
+#include "Queries.h"
+#include "../utils/JobExecutor.h"
+
+/**
+ * @brief Cantidad de personas que recorre cada tramo de un trabajo; entre un tramo y otro se informa el avance, se
+ * publica el resultado parcial y se revisa si se canceló el trabajo.
+ */
+constexpr int REPORT_JOB_SLICE = 4096;
+
+/**
+ * @brief Consulta del menú de consultas que se ejecuta como trabajo en segundo plano.
+ */
+struct QueryJobRequest {
+    /** Número de la consulta en el menú, de 1 a 8. */
+    int query = 1;
+    /** Tipo de tarea de las consultas 2 y 4. */
+    string typeName;
+    /** Fecha límite de las consultas 4 y 5, y el texto con que la escribió el usuario. */
+    tm limit{};
+    string limitText;
+};
+
+string queryJobName(const QueryJobRequest& request);
+JobExecutor::Work queryJob(shared_ptr<const PeopleVersion> version, ThreadPool& pool, const QueryJobRequest& request);
+string describeQuery(const QueryJobRequest& request, const PeopleView& people, ThreadPool& pool);
+JobExecutor::Work peopleWithoutActiveTasksJob(shared_ptr<const PeopleVersion> version, ThreadPool& pool);
+JobExecutor::Work tasksDueWithinWeekJob(shared_ptr<const PeopleVersion> version, ThreadPool& pool, const tm& from);
+JobExecutor::Work completedTasksJob(shared_ptr<const PeopleVersion> version, ThreadPool& pool);
+
+#include "ReportJobs.cpp"
+#endif //REPORTJOBS_H
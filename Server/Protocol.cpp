@@ -0,0 +1,494 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "Protocol.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Indica si un tipo de solicitud modifica los datos.
+ *
+ * @param type Tipo de la solicitud.
+ * @return true si es una mutación.
+ * @author fabian
+ */
+bool isWriteRequest(const uint8_t type) {
+    return type >= static_cast<uint8_t>(RequestType::AddTaskType) && type <= static_cast<uint8_t>(RequestType::ShiftTasks);
+}
+
+/**
+ * @brief Constructor de la clase SocketConnection. Toma un socket ya conectado.
+ *
+ * @param handle Descriptor del socket; se cierra al destruir la conexión.
+ * @author fabian
+ */
+SocketConnection::SocketConnection(const intptr_t handle) : handle(handle) {}
+
+/**
+ * @brief Constructor de movimiento: toma el socket de la otra conexión.
+ *
+ * @param other Conexión a mover; queda cerrada.
+ * @author fabian
+ */
+SocketConnection::SocketConnection(SocketConnection&& other) noexcept
+    : handle(other.handle), buffer(std::move(other.buffer)) {
+    other.handle = -1;
+}
+
+/**
+ * @brief Cierra el socket actual y toma el de otra conexión.
+ *
+ * @param other Conexión a mover; queda cerrada.
+ * @return Esta conexión.
+ * @author fabian
+ */
+SocketConnection& SocketConnection::operator=(SocketConnection&& other) noexcept {
+    if (this != &other) {
+        close();
+        this->handle = other.handle;
+        this->buffer = std::move(other.buffer);
+        other.handle = -1;
+    }
+    return *this;
+}
+
+/**
+ * @brief Destructor de la clase SocketConnection. Cierra el socket.
+ * @author fabian
+ */
+SocketConnection::~SocketConnection() {
+    close();
+}
+
+/**
+ * @brief Obtiene el descriptor del socket.
+ *
+ * @return Descriptor, o -1 si la conexión está cerrada.
+ * @author fabian
+ */
+intptr_t SocketConnection::getHandle() const { return this->handle; }
+
+/**
+ * @brief Escribe un mensaje enmarcado: su longitud, el tipo o estado y el contenido.
+ *
+ * @param buffer Destino del mensaje; se reemplaza su contenido.
+ * @param kind Tipo de la solicitud o estado de la respuesta.
+ * @param payload Contenido del mensaje.
+ * @throws runtime_error Si el mensaje es demasiado grande.
+ * @author fabian
+ */
+static void frameMessage(string& buffer, const uint8_t kind, const string_view payload) {
+    if (payload.size() + 1 > SocketConnection::MAX_MESSAGE_SIZE) throw runtime_error("Mensaje demasiado grande");
+    const auto length = static_cast<uint32_t>(payload.size() + 1);
+    buffer.resize(5 + payload.size());
+    memcpy(buffer.data(), &length, 4);
+    buffer[4] = static_cast<char>(kind);
+    memcpy(buffer.data() + 5, payload.data(), payload.size());
+}
+
+/**
+ * @brief Obtiene el descriptor del socket que escucha.
+ *
+ * @return Descriptor del socket.
+ * @author fabian
+ */
+intptr_t SocketListener::getHandle() const { return this->handle; }
+
+/**
+ * @brief Constructor de movimiento: toma el socket y los datos pendientes de la otra conexión.
+ *
+ * @param other Conexión a mover; queda cerrada.
+ * @author fabian
+ */
+AsyncConnection::AsyncConnection(AsyncConnection&& other) noexcept
+    : reactor(other.reactor), socket(std::move(other.socket)), input(std::move(other.input)),
+      inputStart(other.inputStart), inputEnd(other.inputEnd), output(std::move(other.output)) {}
+
+/**
+ * @brief Destructor de la clase AsyncConnection. Quita el socket del reactor antes de cerrarlo.
+ * @author fabian
+ */
+AsyncConnection::~AsyncConnection() {
+    if (this->socket.getHandle() >= 0) this->reactor->forget(static_cast<int>(this->socket.getHandle()));
+}
+
+/**
+ * @brief Constructor de la clase AsyncTaskClient. Conecta con el servidor y registra la conexión en el reactor.
+ *
+ * @param reactor Reactor en el que esperan las llamadas.
+ * @param path Ruta del socket del servidor.
+ * @throws runtime_error Si no se puede conectar.
+ * @author fabian
+ */
+AsyncTaskClient::AsyncTaskClient(Reactor& reactor, const string& path)
+    : connection(reactor, SocketConnection::connect(path)) {}
+
+/**
+ * @brief Envía una solicitud y espera su respuesta sin bloquear el hilo del reactor.
+ *
+ * @param type Tipo de la solicitud.
+ * @param payload Campos de la solicitud.
+ * @return Lector del contenido de la respuesta; vale hasta la siguiente llamada.
+ * @throws runtime_error Con el mensaje del servidor si la solicitud falló, o si la conexión se cerró.
+ * @author fabian
+ */
+Async<LogPayloadReader> AsyncTaskClient::call(const RequestType type, const LogPayloadWriter& payload) {
+    co_await this->connection.send(static_cast<uint8_t>(type), payload.bytes);
+    uint8_t status;
+    if (!co_await this->connection.receive(status, this->response)) {
+        throw runtime_error("El servidor cerro la conexion");
+    }
+    LogPayloadReader reader{this->response};
+    if (static_cast<ResponseStatus>(status) != ResponseStatus::Ok) throw runtime_error(reader.text());
+    co_return reader;
+}
+
+#ifdef _WIN32
+
+SocketConnection SocketConnection::connect(const string&) {
+    throw runtime_error("El modo servidor requiere sockets de dominio Unix");
+}
+
+void SocketConnection::send(uint8_t, string_view) {
+    throw runtime_error("El modo servidor requiere sockets de dominio Unix");
+}
+
+bool SocketConnection::receive(uint8_t&, string&) {
+    throw runtime_error("El modo servidor requiere sockets de dominio Unix");
+}
+
+void SocketConnection::shutdown() {}
+
+void SocketConnection::close() {}
+
+SocketListener::SocketListener(const string&) {
+    throw runtime_error("El modo servidor requiere sockets de dominio Unix");
+}
+
+SocketListener::~SocketListener() = default;
+
+intptr_t SocketListener::accept(int) { return -1; }
+
+AsyncConnection::AsyncConnection(Reactor& reactor, SocketConnection) : reactor(&reactor) {
+    throw runtime_error("El modo servidor requiere sockets de dominio Unix");
+}
+
+Async<> AsyncConnection::send(uint8_t, string_view) {
+    throw runtime_error("El modo servidor requiere sockets de dominio Unix");
+    co_return;
+}
+
+Async<bool> AsyncConnection::receive(uint8_t&, string&) {
+    throw runtime_error("El modo servidor requiere sockets de dominio Unix");
+    co_return false;
+}
+
+#else
+
+/**
+ * @brief Llena la dirección de un socket de dominio Unix.
+ *
+ * @param path Ruta del socket.
+ * @return La dirección.
+ * @throws runtime_error Si la ruta es demasiado larga.
+ * @author fabian
+ */
+static sockaddr_un socketAddress(const string& path) {
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) throw runtime_error("Ruta de socket demasiado larga: " + path);
+    memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+/**
+ * @brief Conecta con un servidor que escucha en una ruta.
+ *
+ * @param path Ruta del socket del servidor.
+ * @return La conexión.
+ * @throws runtime_error Si no se puede conectar.
+ * @author fabian
+ */
+SocketConnection SocketConnection::connect(const string& path) {
+    const sockaddr_un address = socketAddress(path);
+    const int handle = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (handle < 0) throw runtime_error(string("No se pudo crear el socket: ") + strerror(errno));
+    SocketConnection connection(handle);
+    if (::connect(handle, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        throw runtime_error("No se pudo conectar con " + path + ": " + strerror(errno));
+    }
+    return connection;
+}
+
+/**
+ * @brief Envía un mensaje completo.
+ *
+ * @param kind Tipo de la solicitud o estado de la respuesta.
+ * @param payload Contenido del mensaje.
+ * @throws runtime_error Si el mensaje es demasiado grande o la conexión se cerró.
+ * @author fabian
+ */
+void SocketConnection::send(const uint8_t kind, const string_view payload) {
+    frameMessage(this->buffer, kind, payload);
+    const char* data = this->buffer.data();
+    size_t remaining = this->buffer.size();
+    while (remaining > 0) {
+        const ssize_t sent = ::send(static_cast<int>(this->handle), data, remaining, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            throw runtime_error(string("Error al enviar por el socket: ") + strerror(errno));
+        }
+        data += sent;
+        remaining -= static_cast<size_t>(sent);
+    }
+}
+
+/**
+ * @brief Lee exactamente `size` bytes del socket.
+ *
+ * @param handle Descriptor del socket.
+ * @param data Destino de los bytes.
+ * @param size Cantidad de bytes.
+ * @return false si la conexión se cerró antes del primer byte.
+ * @throws runtime_error Si la lectura falla o la conexión se cierra a la mitad.
+ * @author fabian
+ */
+static bool receiveAll(const intptr_t handle, char* data, size_t size) {
+    bool started = false;
+    while (size > 0) {
+        const ssize_t received = recv(static_cast<int>(handle), data, size, 0);
+        if (received < 0) {
+            if (errno == EINTR) continue;
+            throw runtime_error(string("Error al leer del socket: ") + strerror(errno));
+        }
+        if (received == 0) {
+            if (!started) return false;
+            throw runtime_error("Conexion cerrada a la mitad de un mensaje");
+        }
+        started = true;
+        data += received;
+        size -= static_cast<size_t>(received);
+    }
+    return true;
+}
+
+/**
+ * @brief Recibe un mensaje completo.
+ *
+ * @param kind Tipo de la solicitud o estado de la respuesta.
+ * @param payload Contenido del mensaje.
+ * @return false si el otro extremo cerró la conexión entre mensajes.
+ * @throws runtime_error Si el mensaje está mal formado o la conexión se cierra a la mitad.
+ * @author fabian
+ */
+bool SocketConnection::receive(uint8_t& kind, string& payload) {
+    uint32_t length;
+    if (!receiveAll(this->handle, reinterpret_cast<char*>(&length), 4)) return false;
+    if (length == 0 || length > MAX_MESSAGE_SIZE) throw runtime_error("Mensaje de longitud invalida");
+    char type;
+    if (!receiveAll(this->handle, &type, 1)) throw runtime_error("Conexion cerrada a la mitad de un mensaje");
+    kind = static_cast<uint8_t>(type);
+    payload.resize(length - 1);
+    if (length > 1 && !receiveAll(this->handle, payload.data(), length - 1)) {
+        throw runtime_error("Conexion cerrada a la mitad de un mensaje");
+    }
+    return true;
+}
+
+/**
+ * @brief Cierra la conexión en ambos sentidos sin liberar el descriptor, despertando a quien espera en `receive`.
+ * @author fabian
+ */
+void SocketConnection::shutdown() {
+    if (this->handle >= 0) ::shutdown(static_cast<int>(this->handle), SHUT_RDWR);
+}
+
+/**
+ * @brief Cierra el socket.
+ * @author fabian
+ */
+void SocketConnection::close() {
+    if (this->handle >= 0) ::close(static_cast<int>(this->handle));
+    this->handle = -1;
+}
+
+/**
+ * @brief Constructor de la clase SocketListener. Crea el socket y empieza a escuchar.
+ *
+ * Si ya existe un archivo en la ruta (por ejemplo, el socket de un servidor anterior que terminó mal), se elimina.
+ *
+ * @param path Ruta del socket.
+ * @throws runtime_error Si no se puede crear o enlazar el socket.
+ * @author fabian
+ */
+SocketListener::SocketListener(const string& path) : path(path) {
+    const sockaddr_un address = socketAddress(path);
+    this->handle = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (this->handle < 0) throw runtime_error(string("No se pudo crear el socket: ") + strerror(errno));
+    unlink(path.c_str());
+    if (bind(static_cast<int>(this->handle), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(static_cast<int>(this->handle), SOMAXCONN) != 0) {
+        const string error = strerror(errno);
+        ::close(static_cast<int>(this->handle));
+        throw runtime_error("No se pudo escuchar en " + path + ": " + error);
+    }
+}
+
+/**
+ * @brief Destructor de la clase SocketListener. Cierra el socket y elimina su ruta.
+ * @author fabian
+ */
+SocketListener::~SocketListener() {
+    ::close(static_cast<int>(this->handle));
+    unlink(this->path.c_str());
+}
+
+/**
+ * @brief Espera una conexión nueva.
+ *
+ * @param timeoutMillis Tiempo máximo de espera, en milisegundos.
+ * @return Descriptor de la conexión aceptada, o -1 si no llegó ninguna a tiempo.
+ * @throws runtime_error Si la espera falla.
+ * @author fabian
+ */
+intptr_t SocketListener::accept(const int timeoutMillis) {
+    pollfd waiting = {static_cast<int>(this->handle), POLLIN, 0};
+    const int ready = poll(&waiting, 1, timeoutMillis);
+    if (ready < 0 && errno != EINTR) throw runtime_error(string("Error al esperar conexiones: ") + strerror(errno));
+    if (ready <= 0) return -1;
+    return ::accept(static_cast<int>(this->handle), nullptr, nullptr);
+}
+
+/**
+ * @brief Constructor de la clase AsyncConnection. Pasa el socket a modo no bloqueante y lo registra en el reactor.
+ *
+ * @param reactor Reactor en el que esperan las operaciones.
+ * @param socket Socket conectado.
+ * @throws runtime_error Si el socket no se puede configurar o registrar.
+ * @author fabian
+ */
+AsyncConnection::AsyncConnection(Reactor& reactor, SocketConnection socket)
+    : reactor(&reactor), socket(std::move(socket)), input(READ_CHUNK, '\0') {
+    const int handle = static_cast<int>(this->socket.getHandle());
+    const int flags = fcntl(handle, F_GETFL);
+    if (flags < 0 || fcntl(handle, F_SETFL, flags | O_NONBLOCK) != 0) {
+        throw runtime_error(string("No se pudo configurar el socket: ") + strerror(errno));
+    }
+    this->reactor->watch(handle);
+}
+
+/**
+ * @brief Envía un mensaje completo; si el socket no admite más datos, espera en el reactor a que los admita.
+ *
+ * @param kind Tipo de la solicitud o estado de la respuesta.
+ * @param payload Contenido del mensaje; debe seguir válido hasta que termine el envío.
+ * @throws runtime_error Si el mensaje es demasiado grande o la conexión se cerró.
+ * @author fabian
+ */
+Async<> AsyncConnection::send(const uint8_t kind, const string_view payload) {
+    frameMessage(this->output, kind, payload);
+    const int handle = static_cast<int>(this->socket.getHandle());
+    size_t sent = 0;
+    while (sent < this->output.size()) {
+        const ssize_t written = ::send(handle, this->output.data() + sent, this->output.size() - sent, MSG_NOSIGNAL);
+        if (written >= 0) {
+            sent += static_cast<size_t>(written);
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            co_await this->reactor->writable(handle);
+        } else if (errno != EINTR) {
+            throw runtime_error(string("Error al enviar por el socket: ") + strerror(errno));
+        }
+    }
+}
+
+/**
+ * @brief Recibe un mensaje completo; si todavía no llegó, espera en el reactor a que haya datos.
+ *
+ * @param kind Tipo de la solicitud o estado de la respuesta.
+ * @param payload Contenido del mensaje.
+ * @return false si el otro extremo cerró la conexión entre mensajes.
+ * @throws runtime_error Si el mensaje está mal formado o la conexión se cierra a la mitad.
+ * @author fabian
+ */
+Async<bool> AsyncConnection::receive(uint8_t& kind, string& payload) {
+    const int handle = static_cast<int>(this->socket.getHandle());
+    while (true) {
+        const size_t available = this->inputEnd - this->inputStart;
+        uint32_t length = 0;
+        if (available >= 4) {
+            memcpy(&length, this->input.data() + this->inputStart, 4);
+            if (length == 0 || length > SocketConnection::MAX_MESSAGE_SIZE) {
+                throw runtime_error("Mensaje de longitud invalida");
+            }
+            if (available >= 4 + static_cast<size_t>(length)) {
+                const char* message = this->input.data() + this->inputStart + 4;
+                kind = static_cast<uint8_t>(message[0]);
+                payload.assign(message + 1, length - 1);
+                this->inputStart += 4 + static_cast<size_t>(length);
+                co_return true;
+            }
+        }
+
+        // Se mueve lo pendiente al inicio y, si el mensaje no cabe, se agranda el búfer
+        if (this->inputStart > 0) {
+            memmove(this->input.data(), this->input.data() + this->inputStart, available);
+            this->inputStart = 0;
+            this->inputEnd = available;
+        }
+        if (this->input.size() < 4 + static_cast<size_t>(length)) this->input.resize(4 + length);
+        if (this->inputEnd == this->input.size()) this->input.resize(this->input.size() + READ_CHUNK);
+
+        const ssize_t received = recv(handle, this->input.data() + this->inputEnd,
+                                      this->input.size() - this->inputEnd, 0);
+        if (received > 0) {
+            this->inputEnd += static_cast<size_t>(received);
+        } else if (received == 0) {
+            if (available == 0) co_return false;
+            throw runtime_error("Conexion cerrada a la mitad de un mensaje");
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            co_await this->reactor->readable(handle);
+        } else if (errno != EINTR) {
+            throw runtime_error(string("Error al leer del socket: ") + strerror(errno));
+        }
+    }
+}
+
+#endif
+
+/**
+ * @brief Constructor de la clase TaskClient. Conecta con el servidor.
+ *
+ * @param path Ruta del socket del servidor.
+ * @throws runtime_error Si no se puede conectar.
+ * @author fabian
+ */
+TaskClient::TaskClient(const string& path) : connection(SocketConnection::connect(path)) {}
+
+/**
+ * @brief Envía una solicitud y espera su respuesta.
+ *
+ * @param type Tipo de la solicitud.
+ * @param payload Campos de la solicitud.
+ * @return Lector del contenido de la respuesta; vale hasta la siguiente llamada.
+ * @throws runtime_error Con el mensaje del servidor si la solicitud falló, o si la conexión se cerró.
+ * @author fabian
+ */
+LogPayloadReader TaskClient::call(const RequestType type, const LogPayloadWriter& payload) {
+    this->connection.send(static_cast<uint8_t>(type), payload.bytes);
+    uint8_t status;
+    if (!this->connection.receive(status, this->response)) throw runtime_error("El servidor cerro la conexion");
+    LogPayloadReader reader{this->response};
+    if (static_cast<ResponseStatus>(status) != ResponseStatus::Ok) throw runtime_error(reader.text());
+    return reader;
+}
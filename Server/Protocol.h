@@ -0,0 +1,188 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "Reactor.h"
+#include "../Storage/MutationLog.h"
+
+using namespace std;
+
+/**
+ * @brief Tipos de solicitud del protocolo del servidor.
+ *
+ * Las mutaciones usan los mismos números que `MutationType`. Cada solicitud lleva sus campos codificados con
+ * `LogPayloadWriter`, en el orden de los argumentos de la operación; las fechas y horas van como texto
+ * ("dd-mm-YYYY" y "HH:MM:SS") y los tipos de tarea por nombre.
+ *
+ * - `AddTaskType`: nombre, descripción.
+ * - `AddPerson`: cédula, nombre, apellido, edad.
+ * - `DeletePerson`: cédula.
+ * - `AddTask`: cédula, completada (byte), tipo, descripción, importancia, fecha, hora. Responde el ID de la tarea.
+ * - `AddSubTask`: cédula, ID de la tarea, nombre, comentarios, progreso (decimal).
+ * - `ModifyActiveTask`: cédula, ID de la tarea, fecha, hora.
+ * - `CompleteTask` y `DeleteTask`: cédula, ID de la tarea.
+ * - `CompleteSubTask`: cédula, ID de la tarea, índice de la subtarea.
+ * - `SubTaskProgress`: cédula, ID de la tarea, índice de la subtarea, progreso (decimal).
+ * - `CompleteTasksBefore`: cédula, fecha; completa las tareas activas que vencen antes. Responde la cantidad.
+ * - `ShiftTasks`: cédula, tipo, días; mueve la fecha de las tareas activas del tipo. Responde la cantidad.
+ * - `Query`: número de consulta (byte) y sus argumentos como en `CommandInterpreter::runQuery`. Las consultas 1, 2 y
+ *   4 responden cédula (0 si no hay), nombre y cantidad; las demás, el máximo, la cantidad de claves y las claves.
+ * - `Describe`: responde la cantidad de personas, la cantidad de tipos de tarea y sus nombres.
+ * - `Report`: número de reporte (byte) del menú de reportes, máximo de filas a devolver y sus argumentos: el 3 y
+ *   el 8 no llevan, el 5 la fecha y el 7 la cédula. Responde la cantidad total de filas y las primeras filas: cédula
+ *   y nombre en el 3; cédula, ID, descripción, fecha y hora de la tarea en los demás.
+ * - `Status`: responde el rol (byte: 0 primario, 1 réplica), el LSN aplicado y el último LSN del registro (enteros
+ *   de 64 bits), el retraso de la réplica en milisegundos (decimal), las recargas de la instantánea y el último
+ *   error de la réplica (vacío si no hay). En el primario, los dos LSN son el último registrado y el retraso es 0.
+ */
+enum class RequestType : uint8_t {
+    AddTaskType = 1,
+    AddPerson,
+    DeletePerson,
+    AddTask,
+    AddSubTask,
+    ModifyActiveTask,
+    CompleteTask,
+    CompleteSubTask,
+    SubTaskProgress,
+    DeleteTask,
+    CompleteTasksBefore,
+    ShiftTasks,
+    Query = 32,
+    Describe,
+    Report,
+    Status
+};
+
+/**
+ * @brief Resultado de una solicitud. Las respuestas con error llevan el mensaje como texto.
+ */
+enum class ResponseStatus : uint8_t {
+    Ok = 0,
+    Error
+};
+
+bool isWriteRequest(uint8_t type);
+
+/**
+ * @brief Conexión por un socket de dominio Unix que envía y recibe mensajes enmarcados.
+ *
+ * Cada mensaje es su longitud (4 bytes, sin contar la longitud), un byte con el tipo o el estado y el contenido.
+ */
+class SocketConnection {
+public:
+    static constexpr size_t MAX_MESSAGE_SIZE = 1 << 20;
+
+    SocketConnection() = default;
+    explicit SocketConnection(intptr_t handle);
+    SocketConnection(SocketConnection&& other) noexcept;
+    SocketConnection& operator=(SocketConnection&& other) noexcept;
+    ~SocketConnection();
+
+    SocketConnection(const SocketConnection&) = delete;
+    SocketConnection& operator=(const SocketConnection&) = delete;
+
+    static SocketConnection connect(const string& path);
+
+    void send(uint8_t kind, string_view payload);
+    bool receive(uint8_t& kind, string& payload);
+    void shutdown();
+
+    [[nodiscard]] intptr_t getHandle() const;
+
+private:
+    intptr_t handle = -1;
+    string buffer;
+
+    void close();
+};
+
+/**
+ * @brief Socket de dominio Unix que escucha conexiones en una ruta; la elimina al destruirse.
+ */
+class SocketListener {
+public:
+    explicit SocketListener(const string& path);
+    ~SocketListener();
+
+    SocketListener(const SocketListener&) = delete;
+    SocketListener& operator=(const SocketListener&) = delete;
+
+    intptr_t accept(int timeoutMillis);
+
+    [[nodiscard]] intptr_t getHandle() const;
+
+private:
+    string path;
+    intptr_t handle = -1;
+};
+
+/**
+ * @brief Cliente del servidor: envía una solicitud y espera su respuesta.
+ */
+class TaskClient {
+public:
+    explicit TaskClient(const string& path);
+
+    LogPayloadReader call(RequestType type, const LogPayloadWriter& payload);
+
+private:
+    SocketConnection connection;
+    string response;
+};
+
+/**
+ * @brief Conexión con los mismos mensajes enmarcados que `SocketConnection`, pero no bloqueante: sus operaciones
+ * son corrutinas que esperan en un `Reactor` cuando el socket no está listo.
+ *
+ * Lee del socket por bloques de `READ_CHUNK` bytes, así que varios mensajes seguidos se reciben con una sola
+ * lectura. Se usa solo desde el hilo del reactor.
+ */
+class AsyncConnection {
+public:
+    static constexpr size_t READ_CHUNK = 4096;
+
+    AsyncConnection(Reactor& reactor, SocketConnection socket);
+    AsyncConnection(AsyncConnection&& other) noexcept;
+    ~AsyncConnection();
+
+    AsyncConnection(const AsyncConnection&) = delete;
+    AsyncConnection& operator=(const AsyncConnection&) = delete;
+    AsyncConnection& operator=(AsyncConnection&&) = delete;
+
+    Async<> send(uint8_t kind, string_view payload);
+    Async<bool> receive(uint8_t& kind, string& payload);
+
+private:
+    Reactor* reactor;
+    SocketConnection socket;
+    string input;
+    size_t inputStart = 0;
+    size_t inputEnd = 0;
+    string output;
+};
+
+/**
+ * @brief Cliente del servidor para corrutinas: como `TaskClient`, pero espera la respuesta en un `Reactor` sin
+ * bloquear su hilo, así que un solo hilo puede simular muchos clientes.
+ */
+class AsyncTaskClient {
+public:
+    AsyncTaskClient(Reactor& reactor, const string& path);
+
+    Async<LogPayloadReader> call(RequestType type, const LogPayloadWriter& payload);
+
+private:
+    AsyncConnection connection;
+    string response;
+};
+
+#include "Protocol.cpp"
+#endif //PROTOCOL_H
@@ -0,0 +1,331 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "Reactor.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Crea el objeto `Async` de una corrutina que devuelve un valor.
+ *
+ * @return La corrutina, suspendida antes de empezar.
+ * @author fabian
+ */
+template <class T>
+Async<T> AsyncPromise<T>::get_return_object() {
+    return Async<T>(coroutine_handle<AsyncPromise>::from_promise(*this));
+}
+
+/**
+ * @brief Crea el objeto `Async` de una corrutina que no devuelve nada.
+ *
+ * @return La corrutina, suspendida antes de empezar.
+ * @author fabian
+ */
+inline Async<void> AsyncPromise<void>::get_return_object() {
+    return Async<void>(coroutine_handle<AsyncPromise>::from_promise(*this));
+}
+
+/**
+ * @brief Corrutina raíz que inicia `Reactor::spawn`: empieza de inmediato y libera su marco al terminar, sin que
+ * nadie la espere.
+ */
+struct SpawnedTask {
+    struct promise_type {
+        SpawnedTask get_return_object() const noexcept { return {}; }
+        [[nodiscard]] suspend_never initial_suspend() const noexcept { return {}; }
+        [[nodiscard]] suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { terminate(); }
+    };
+};
+
+/**
+ * @brief Ejecuta una corrutina hasta que termine y descuenta las vivas del reactor. Una excepción termina solo
+ * esa corrutina.
+ *
+ * @param live Contador de corrutinas vivas del reactor.
+ * @param task Corrutina a ejecutar.
+ * @author fabian
+ */
+static SpawnedTask runSpawned(int& live, Async<> task) {
+    try {
+        co_await task;
+    } catch (...) {
+    }
+    live--;
+}
+
+/**
+ * @brief Envía la función al ejecutor; al terminar, guarda su excepción, si la hubo, y pide al reactor que reanude
+ * la corrutina.
+ *
+ * @param handle Corrutina que espera.
+ * @author fabian
+ */
+void Reactor::OffloadAwaiter::await_suspend(const coroutine_handle<> handle) {
+    this->executor.submit("solicitud", [this, handle](Job&) {
+        try {
+            this->work();
+        } catch (...) {
+            this->error = current_exception();
+        }
+        this->reactor.post(handle);
+    });
+}
+
+/**
+ * @brief Relanza en la corrutina la excepción de la función, si la hubo.
+ *
+ * @throws exception La excepción lanzada por la función.
+ * @author fabian
+ */
+void Reactor::OffloadAwaiter::await_resume() const {
+    if (this->error) rethrow_exception(this->error);
+}
+
+/**
+ * @brief Prepara la espera de un descriptor listo para leer.
+ *
+ * @param fd Descriptor registrado con `watch`.
+ * @return Objeto que se espera con `co_await`.
+ * @author fabian
+ */
+Reactor::ReadyAwaiter Reactor::readable(const int fd) {
+    return {*this, fd, false};
+}
+
+/**
+ * @brief Prepara la espera de un descriptor listo para escribir.
+ *
+ * @param fd Descriptor registrado con `watch`.
+ * @return Objeto que se espera con `co_await`.
+ * @author fabian
+ */
+Reactor::ReadyAwaiter Reactor::writable(const int fd) {
+    return {*this, fd, true};
+}
+
+/**
+ * @brief Prepara la ejecución de una función de CPU fuera del hilo del reactor.
+ *
+ * La función se ejecuta mientras la corrutina está suspendida, así que puede usar sus variables locales. El
+ * ejecutor no debe destruirse mientras queden funciones pendientes, porque las descartaría sin reanudar a nadie.
+ *
+ * @param executor Ejecutor donde se ejecuta.
+ * @param work Función a ejecutar.
+ * @return Objeto que se espera con `co_await`; relanza la excepción de la función, si la hubo.
+ * @author fabian
+ */
+Reactor::OffloadAwaiter Reactor::offload(JobExecutor& executor, function<void()> work) {
+    return {*this, executor, std::move(work), nullptr};
+}
+
+/**
+ * @brief Inicia una corrutina en el reactor. Se ejecuta hasta su primera espera antes de volver.
+ *
+ * @param task Corrutina a iniciar; sus excepciones se descartan.
+ * @author fabian
+ */
+void Reactor::spawn(Async<> task) {
+    this->live++;
+    runSpawned(this->live, std::move(task));
+}
+
+/**
+ * @brief Obtiene la cantidad de corrutinas iniciadas con `spawn` que todavía no terminan.
+ *
+ * @return Corrutinas vivas.
+ * @author fabian
+ */
+int Reactor::getLiveCount() const { return this->live; }
+
+#ifdef __linux__
+
+/**
+ * @brief Constructor de la clase Reactor. Crea el epoll y el eventfd con que otros hilos lo despiertan, y sube el
+ * límite de descriptores abiertos del proceso al máximo permitido, porque cada conexión ocupa uno.
+ *
+ * @throws runtime_error Si no se puede crear el epoll o el eventfd.
+ * @author fabian
+ */
+Reactor::Reactor() {
+    rlimit limit = {};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    this->epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (this->epollFd < 0) throw runtime_error(string("No se pudo crear el epoll: ") + strerror(errno));
+    this->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = this->wakeFd;
+    if (this->wakeFd < 0 || epoll_ctl(this->epollFd, EPOLL_CTL_ADD, this->wakeFd, &event) != 0) {
+        const string error = strerror(errno);
+        if (this->wakeFd >= 0) close(this->wakeFd);
+        close(this->epollFd);
+        throw runtime_error("No se pudo crear el eventfd del reactor: " + error);
+    }
+}
+
+/**
+ * @brief Destructor de la clase Reactor. Cierra el epoll y el eventfd; no destruye corrutinas suspendidas, así que
+ * quien lo usa debe esperar a que `getLiveCount()` sea 0.
+ * @author fabian
+ */
+Reactor::~Reactor() {
+    close(this->wakeFd);
+    close(this->epollFd);
+}
+
+/**
+ * @brief Pide, desde cualquier hilo, que el reactor reanude una corrutina suspendida.
+ *
+ * @param handle Corrutina a reanudar.
+ * @author fabian
+ */
+void Reactor::post(const coroutine_handle<> handle) {
+    bool wake;
+    {
+        lock_guard guard(this->postedLock);
+        wake = this->posted.empty();
+        this->posted.push_back(handle);
+    }
+    if (wake) {
+        const uint64_t one = 1;
+        [[maybe_unused]] const auto written = ::write(this->wakeFd, &one, sizeof(one));
+    }
+}
+
+/**
+ * @brief Registra un descriptor no bloqueante para esperar que esté listo para leer o escribir.
+ *
+ * @param fd Descriptor.
+ * @throws runtime_error Si epoll no lo acepta.
+ * @author fabian
+ */
+void Reactor::watch(const int fd) {
+    epoll_event event = {};
+    event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    event.data.fd = fd;
+    if (epoll_ctl(this->epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        throw runtime_error(string("No se pudo registrar el descriptor en el epoll: ") + strerror(errno));
+    }
+    this->waiters[fd] = {};
+}
+
+/**
+ * @brief Quita un descriptor del reactor; se llama antes de cerrarlo. Nadie debe estar esperándolo.
+ *
+ * @param fd Descriptor registrado con `watch`.
+ * @author fabian
+ */
+void Reactor::forget(const int fd) {
+    epoll_ctl(this->epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    this->waiters.erase(fd);
+}
+
+/**
+ * @brief Anota la corrutina que espera a un descriptor; la reanuda `runOnce` cuando epoll avise.
+ *
+ * @param fd Descriptor registrado con `watch`.
+ * @param write true si espera poder escribir, false si espera poder leer.
+ * @param handle Corrutina que espera.
+ * @throws runtime_error Si el descriptor no está registrado.
+ * @author fabian
+ */
+void Reactor::wait(const int fd, const bool write, const coroutine_handle<> handle) {
+    const auto found = this->waiters.find(fd);
+    if (found == this->waiters.end()) throw runtime_error("Descriptor no registrado en el reactor");
+    (write ? found->second.writer : found->second.reader) = handle;
+}
+
+/**
+ * @brief Espera eventos una vez y reanuda las corrutinas cuyos descriptores están listos y las que otros hilos
+ * pidieron reanudar con `post`.
+ *
+ * @param timeoutMillis Tiempo máximo de espera, en milisegundos; -1 espera sin límite.
+ * @throws runtime_error Si la espera falla.
+ * @author fabian
+ */
+void Reactor::runOnce(const int timeoutMillis) {
+    epoll_event events[MAX_EVENTS];
+    const int ready = epoll_wait(this->epollFd, events, MAX_EVENTS, timeoutMillis);
+    if (ready < 0 && errno != EINTR) throw runtime_error(string("Error al esperar eventos: ") + strerror(errno));
+
+    vector<coroutine_handle<>> resumed;
+    for (int i = 0; i < ready; i++) {
+        const int fd = events[i].data.fd;
+        if (fd == this->wakeFd) {
+            uint64_t count;
+            [[maybe_unused]] const auto read = ::read(this->wakeFd, &count, sizeof(count));
+            continue;
+        }
+        const auto found = this->waiters.find(fd);
+        if (found == this->waiters.end()) continue;
+        const uint32_t flags = events[i].events;
+        if ((flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) && found->second.reader) {
+            resumed.push_back(exchange(found->second.reader, nullptr));
+        }
+        if ((flags & (EPOLLOUT | EPOLLHUP | EPOLLERR)) && found->second.writer) {
+            resumed.push_back(exchange(found->second.writer, nullptr));
+        }
+    }
+    {
+        lock_guard guard(this->postedLock);
+        resumed.insert(resumed.end(), this->posted.begin(), this->posted.end());
+        this->posted.clear();
+    }
+    for (const coroutine_handle<> handle : resumed) handle.resume();
+}
+
+/**
+ * @brief Cierra en ambos sentidos todos los sockets registrados y reanuda a quienes los esperan, para que sus
+ * corrutinas vean la conexión cerrada y terminen.
+ * @author fabian
+ */
+void Reactor::shutdownAll() {
+    vector<coroutine_handle<>> resumed;
+    for (auto& [fd, waiting] : this->waiters) {
+        ::shutdown(fd, SHUT_RDWR);
+        if (waiting.reader) resumed.push_back(exchange(waiting.reader, nullptr));
+        if (waiting.writer) resumed.push_back(exchange(waiting.writer, nullptr));
+    }
+    for (const coroutine_handle<> handle : resumed) handle.resume();
+}
+
+#else
+
+Reactor::Reactor() {
+    throw runtime_error("El reactor del servidor requiere epoll (Linux)");
+}
+
+Reactor::~Reactor() = default;
+
+void Reactor::post(coroutine_handle<>) {}
+
+void Reactor::watch(int) {}
+
+void Reactor::forget(int) {}
+
+void Reactor::wait(int, bool, coroutine_handle<>) {}
+
+void Reactor::runOnce(int) {}
+
+void Reactor::shutdownAll() {}
+
+#endif
@@ -0,0 +1,194 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef REACTOR_H
+#define REACTOR_H
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../utils/JobExecutor.h"
+
+using namespace std;
+
+/**
+ * @brief Base de las promesas de `Async`: guarda la corrutina que espera el resultado y la excepción, si la hubo.
+ */
+struct AsyncPromiseBase {
+    coroutine_handle<> continuation;
+    exception_ptr error;
+
+    /**
+     * @brief Al terminar, continúa directamente con la corrutina que esperaba el resultado, sin pasar por el reactor.
+     */
+    struct FinalAwaiter {
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        template <class Promise>
+        coroutine_handle<> await_suspend(coroutine_handle<Promise> handle) noexcept {
+            const coroutine_handle<> next = handle.promise().continuation;
+            return next ? next : noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    [[nodiscard]] suspend_always initial_suspend() const noexcept { return {}; }
+    [[nodiscard]] FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() { this->error = current_exception(); }
+};
+
+template <class T>
+class Async;
+
+/**
+ * @brief Promesa de una corrutina `Async` que devuelve un valor.
+ */
+template <class T>
+struct AsyncPromise : AsyncPromiseBase {
+    optional<T> value;
+
+    Async<T> get_return_object();
+    void return_value(T result) { this->value.emplace(std::move(result)); }
+};
+
+/**
+ * @brief Promesa de una corrutina `Async` que no devuelve nada.
+ */
+template <>
+struct AsyncPromise<void> : AsyncPromiseBase {
+    Async<void> get_return_object();
+    void return_void() {}
+};
+
+/**
+ * @brief Corrutina perezosa: empieza a ejecutarse cuando otra corrutina la espera con `co_await`, que devuelve su
+ * resultado o relanza su excepción.
+ *
+ * Las corrutinas de una conexión se encadenan así desde la raíz que inicia `Reactor::spawn`; al suspenderse una,
+ * queda suspendida toda la cadena hasta que el reactor la reanude.
+ */
+template <class T = void>
+class [[nodiscard]] Async {
+public:
+    using promise_type = AsyncPromise<T>;
+
+    explicit Async(coroutine_handle<promise_type> handle) : handle(handle) {}
+    Async(Async&& other) noexcept : handle(exchange(other.handle, nullptr)) {}
+    ~Async() {
+        if (this->handle) this->handle.destroy();
+    }
+
+    Async(const Async&) = delete;
+    Async& operator=(const Async&) = delete;
+    Async& operator=(Async&&) = delete;
+
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+    coroutine_handle<> await_suspend(const coroutine_handle<> awaiting) noexcept {
+        this->handle.promise().continuation = awaiting;
+        return this->handle;
+    }
+
+    T await_resume() {
+        promise_type& promise = this->handle.promise();
+        if (promise.error) rethrow_exception(promise.error);
+        if constexpr (!is_void_v<T>) return std::move(*promise.value);
+    }
+
+private:
+    coroutine_handle<promise_type> handle;
+};
+
+/**
+ * @brief Reactor de E/S sobre epoll que ejecuta corrutinas en un solo hilo.
+ *
+ * Las corrutinas se ejecutan en el hilo que llama a `runOnce`. Una corrutina que no puede leer o escribir sin
+ * bloquearse espera con `co_await readable(fd)` o `co_await writable(fd)` a que epoll avise que el descriptor
+ * está listo; los descriptores se registran con `watch` en modo por flanco, así que quien espera debe haber
+ * intentado la operación hasta recibir `EAGAIN`. El trabajo largo de CPU se envía a un `JobExecutor` con
+ * `co_await offload(executor, función)`, que lo atiende en orden de llegada y reanuda la corrutina en el reactor
+ * cuando la función termina; otros hilos reanudan corrutinas con `post`, que despierta al reactor por un eventfd.
+ *
+ * Solo existe en Linux; en los demás sistemas el constructor lanza una excepción.
+ */
+class Reactor {
+public:
+    /**
+     * @brief Espera a que un descriptor esté listo para leer o escribir.
+     */
+    struct ReadyAwaiter {
+        Reactor& reactor;
+        int fd;
+        bool write;
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        void await_suspend(coroutine_handle<> handle) const { this->reactor.wait(this->fd, this->write, handle); }
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief Ejecuta una función en un `JobExecutor` y reanuda la corrutina en el reactor al terminar.
+     */
+    struct OffloadAwaiter {
+        Reactor& reactor;
+        JobExecutor& executor;
+        function<void()> work;
+        exception_ptr error;
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        void await_suspend(coroutine_handle<> handle);
+        void await_resume() const;
+    };
+
+    static constexpr int MAX_EVENTS = 256;
+
+    Reactor();
+    ~Reactor();
+
+    Reactor(const Reactor&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+
+    void watch(int fd);
+    void forget(int fd);
+    [[nodiscard]] ReadyAwaiter readable(int fd);
+    [[nodiscard]] ReadyAwaiter writable(int fd);
+    [[nodiscard]] OffloadAwaiter offload(JobExecutor& executor, function<void()> work);
+
+    void spawn(Async<> task);
+    void post(coroutine_handle<> handle);
+    void runOnce(int timeoutMillis);
+    void shutdownAll();
+
+    [[nodiscard]] int getLiveCount() const;
+
+private:
+    /**
+     * @brief Corrutinas que esperan a un descriptor registrado.
+     */
+    struct Waiters {
+        coroutine_handle<> reader;
+        coroutine_handle<> writer;
+    };
+
+    int epollFd = -1;
+    int wakeFd = -1;
+    unordered_map<int, Waiters> waiters;
+    int live = 0;
+
+    mutex postedLock;
+    vector<coroutine_handle<>> posted;
+
+    void wait(int fd, bool write, coroutine_handle<> handle);
+};
+
+#include "Reactor.cpp"
+#endif //REACTOR_H
@@ -0,0 +1,597 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "TaskServer.h"
+
+#include <algorithm>
+#include <chrono>
+
+/**
+ * @brief Constructor de la clase TaskServer. Empieza a escuchar en la ruta indicada.
+ *
+ * @param path Ruta del socket.
+ * @param pool Pool de hilos con el que se ejecutan las consultas.
+ * @param shardCount Cantidad de fragmentos en que se reparten las personas, cada uno con su hilo escritor.
+ * @throws runtime_error Si no se puede escuchar en la ruta.
+ * @author fabian
+ */
+TaskServer::TaskServer(const string& path, ThreadPool& pool, const int shardCount)
+    : listener(path), pool(pool), reads(pool.getThreadCount()), shardCount(shardCount) {}
+
+/**
+ * @brief Constructor de la clase TaskServer como réplica de lectura. Empieza a escuchar en la ruta indicada.
+ *
+ * @param path Ruta del socket.
+ * @param pool Pool de hilos con el que se ejecutan las consultas.
+ * @param replica Réplica cuyas versiones se leen; el servidor inicia y detiene su seguidor.
+ * @throws runtime_error Si no se puede escuchar en la ruta.
+ * @author fabian
+ */
+TaskServer::TaskServer(const string& path, ThreadPool& pool, LogReplica& replica)
+    : listener(path), pool(pool), reads(pool.getThreadCount()), shardCount(1), replica(&replica) {}
+
+/**
+ * @brief Destructor de la clase TaskServer. Detiene los hilos escritores si siguen activos y suelta las versiones.
+ * @author fabian
+ */
+TaskServer::~TaskServer() {
+    this->engine.reset();
+}
+
+/**
+ * @brief Crea el segmento de memoria compartida donde el servidor publicará sus datos mientras atiende conexiones.
+ *
+ * @param name Nombre del segmento.
+ * @param slotBytes Tamaño máximo de una instantánea de los datos.
+ * @throws runtime_error Si el segmento no se puede crear.
+ * @author fabian
+ */
+void TaskServer::publishTo(const string& name, const uint64_t slotBytes) {
+    this->shared = make_unique<SharedDatasetWriter>(name, slotBytes);
+}
+
+/**
+ * @brief Acepta y atiende conexiones hasta que `stop` sea verdadero.
+ *
+ * Reparte las personas en fragmentos y publica la primera versión de cada uno antes de aceptar conexiones, o,
+ * como réplica, inicia el seguidor del registro; luego inicia el hilo que publica en la memoria compartida, si la
+ * hay, y ejecuta el reactor en el hilo que llama. Al detenerse cierra las conexiones abiertas, espera a que sus
+ * corrutinas terminen, incluidas las que esperaban una consulta o una mutación, y a que los escritores apliquen y
+ * sincronicen las mutaciones pendientes, suelta las versiones, liberando las personas retiradas, y devuelve todas
+ * las personas a `people`.
+ *
+ * @param stop Bandera que detiene el servidor; se revisa al menos cada `ACCEPT_TIMEOUT_MILLIS`.
+ * @throws runtime_error Si la espera de conexiones falla.
+ * @author fabian
+ */
+void TaskServer::run(const atomic<bool>& stop) {
+    if (this->replica) this->replica->start();
+    else this->engine = make_unique<ShardedEngine>(this->shardCount, &TaskServer::applyWrite);
+    thread publisher;
+    if (this->shared) publisher = thread(&TaskServer::publishShared, this, cref(stop));
+
+    this->reactor.watch(static_cast<int>(this->listener.getHandle()));
+    this->reactor.spawn(acceptConnections());
+    while (!stop) this->reactor.runOnce(ACCEPT_TIMEOUT_MILLIS);
+
+    this->stopping = true;
+    this->reactor.shutdownAll();
+    while (this->reactor.getLiveCount() > 0) this->reactor.runOnce(ACCEPT_TIMEOUT_MILLIS);
+    this->reactor.forget(static_cast<int>(this->listener.getHandle()));
+    if (publisher.joinable()) publisher.join();
+    if (this->replica) {
+        this->replica->stop();
+        return;
+    }
+    this->engine->stop();
+    {
+        lock_guard guard(this->statsLock);
+        this->stats.writeBatches = this->engine->getStats().batches;
+    }
+    this->engine.reset();
+}
+
+/**
+ * @brief Corrutina que acepta las conexiones que llegan e inicia una corrutina `serve` por cada una, hasta que el
+ * servidor se detenga.
+ * @author fabian
+ */
+Async<> TaskServer::acceptConnections() {
+    const int handle = static_cast<int>(this->listener.getHandle());
+    while (!this->stopping) {
+        const intptr_t accepted = this->listener.accept(0);
+        if (accepted < 0) {
+            co_await this->reactor.readable(handle);
+            continue;
+        }
+        try {
+            this->reactor.spawn(serve(AsyncConnection(this->reactor, SocketConnection(accepted))));
+        } catch (const runtime_error&) {
+            continue;
+        }
+        lock_guard guard(this->statsLock);
+        this->stats.connections++;
+    }
+}
+
+/**
+ * @brief Publica los datos en la memoria compartida cada vez que cambian, hasta que `stop` sea verdadero.
+ *
+ * Conserva las versiones publicadas para notar si cambiaron; una publicación que falla (porque los datos no caben
+ * en el segmento) se cuenta como error y se vuelve a intentar con la siguiente versión.
+ *
+ * @param stop Bandera que detiene el servidor.
+ * @author fabian
+ */
+void TaskServer::publishShared(const atomic<bool>& stop) {
+    vector<shared_ptr<const PeopleVersion>> published;
+    while (!stop) {
+        vector<shared_ptr<const PeopleVersion>> versions = pinVersions();
+        if (versions != published) {
+            bool failed = false;
+            try {
+                this->shared->publish(PeopleView(versions).getPersons(), versions.front()->getTaskTypes(), 0);
+            } catch (const runtime_error&) {
+                failed = true;
+            }
+            published = std::move(versions);
+            lock_guard guard(this->statsLock);
+            if (failed) this->stats.errors++;
+            else this->stats.sharedPublishes++;
+        }
+        this_thread::sleep_for(chrono::milliseconds(SHARED_PUBLISH_MILLIS));
+    }
+}
+
+/**
+ * @brief Fija las versiones más recientes de todos los fragmentos, o la de la réplica.
+ *
+ * @return Las versiones, en orden de fragmento.
+ * @author fabian
+ */
+vector<shared_ptr<const PeopleVersion>> TaskServer::pinVersions() {
+    return this->replica ? vector{this->replica->pin()} : this->engine->pin();
+}
+
+/**
+ * @brief Obtiene las estadísticas del servidor.
+ *
+ * @return Conexiones aceptadas, solicitudes de lectura y escritura, lotes del escritor y errores.
+ * @author fabian
+ */
+ServerStats TaskServer::getStats() {
+    lock_guard guard(this->statsLock);
+    return this->stats;
+}
+
+/**
+ * @brief Corrutina que atiende las solicitudes de una conexión, en orden, hasta que el cliente la cierre.
+ *
+ * Las consultas y los reportes se ejecutan en el ejecutor de lecturas y las mutaciones en el escritor de su
+ * fragmento; mientras tanto la corrutina queda suspendida y el reactor atiende a las demás conexiones. Un mensaje
+ * mal formado cierra la conexión; una solicitud que falla responde con error y la conexión sigue.
+ *
+ * @param connection Conexión a atender.
+ * @author fabian
+ */
+Async<> TaskServer::serve(AsyncConnection connection) {
+    string request;
+    LogPayloadWriter response;
+    uint8_t type;
+    while (co_await connection.receive(type, request)) {
+        response.bytes.clear();
+        uint8_t status;
+        const auto requestType = static_cast<RequestType>(type);
+        if (isWriteRequest(type)) {
+            status = co_await executeWrite(type, request, response);
+        } else if (requestType == RequestType::Query || requestType == RequestType::Report) {
+            function<void()> read = [&] { status = executeRead(type, request, response); };
+            co_await this->reactor.offload(this->reads, std::move(read));
+        } else {
+            status = executeRead(type, request, response);
+        }
+        co_await connection.send(status, response.bytes);
+    }
+}
+
+/**
+ * @brief Busca un tipo de tarea por su nombre.
+ *
+ * @param name Nombre del tipo.
+ * @return El tipo de tarea.
+ * @throws runtime_error Si el tipo no existe.
+ * @author fabian
+ */
+static TaskType* findTaskTypeByName(const string& name) {
+    TaskType* current = taskTypes.head;
+    for (int i = 0; i < taskTypes.getLength(); i++) {
+        if (current->name == name) return current;
+        current = current->next;
+    }
+    throw runtime_error("Tipo de tarea no encontrado");
+}
+
+/**
+ * @brief Encola la mutación; el escritor llama a la función de respuesta desde su hilo después de sincronizar el
+ * lote, y esta pide al reactor que reanude la corrutina.
+ *
+ * @param handle Corrutina que espera.
+ * @author fabian
+ */
+void TaskServer::MutationAwaiter::await_suspend(const coroutine_handle<> handle) {
+    this->server.engine->submit(this->personId, this->type, std::move(this->payload),
+                                [this, handle](MutationResult&& result) {
+                                    this->result = std::move(result);
+                                    this->server.reactor.post(handle);
+                                });
+}
+
+/**
+ * @brief Entrega el resultado de la mutación a la corrutina.
+ *
+ * @return Resultado de la mutación.
+ * @author fabian
+ */
+MutationResult TaskServer::MutationAwaiter::await_resume() {
+    return std::move(this->result);
+}
+
+/**
+ * @brief Corrutina que atiende una solicitud de escritura: la encola en el fragmento de su persona y espera, sin
+ * ocupar el reactor, a que sea durable.
+ *
+ * La cédula es el primer campo de todas las mutaciones de una persona. Un tipo de tarea es común a todos los
+ * fragmentos y agregarlo espera a que terminen los lotes en curso (ver `ShardedEngine::addTaskType`), así que se
+ * agrega desde el ejecutor de lecturas. Una réplica rechaza todas las mutaciones.
+ *
+ * @param type Tipo de la solicitud.
+ * @param request Campos de la solicitud.
+ * @param response Campos de la respuesta, o el mensaje de error.
+ * @return Estado de la respuesta.
+ * @author fabian
+ */
+Async<uint8_t> TaskServer::executeWrite(const uint8_t type, const string& request, LogPayloadWriter& response) {
+    bool ok = true;
+    string error;
+    try {
+        if (this->replica) throw runtime_error("El servidor es una replica de solo lectura");
+        LogPayloadReader reader{request};
+        if (static_cast<RequestType>(type) == RequestType::AddTaskType) {
+            const string name = reader.text();
+            const string description = reader.text();
+            function<void()> add = [&] { this->engine->addTaskType(name, description); };
+            co_await this->reactor.offload(this->reads, std::move(add));
+        } else {
+            MutationAwaiter mutation{*this, reader.integer(), type, request, {}};
+            MutationResult result = co_await mutation;
+            response.bytes = std::move(result.response);
+            ok = result.ok;
+            error = std::move(result.error);
+        }
+    } catch (const exception& exception) {
+        ok = false;
+        error = exception.what();
+    }
+    if (!ok) {
+        response.bytes.clear();
+        response.text(error);
+    }
+    lock_guard guard(this->statsLock);
+    this->stats.writes++;
+    if (!ok) this->stats.errors++;
+    co_return static_cast<uint8_t>(ok ? ResponseStatus::Ok : ResponseStatus::Error);
+}
+
+/**
+ * @brief Aplica una mutación de una persona sobre la lista de su fragmento. Se llama desde el hilo escritor del
+ * fragmento.
+ *
+ * @param type Tipo de la solicitud.
+ * @param request Campos de la solicitud.
+ * @param response Campos de la respuesta.
+ * @throws runtime_error Si la solicitud no existe, está incompleta o la mutación no se puede aplicar.
+ * @author fabian
+ */
+void TaskServer::applyWrite(const uint8_t type, const string_view request, LogPayloadWriter& response) {
+    LogPayloadReader reader{request};
+    switch (static_cast<RequestType>(type)) {
+        case RequestType::AddPerson: {
+            const int id = reader.integer();
+            const string name = reader.text();
+            const string lastname = reader.text();
+            addPerson(id, name, lastname, reader.integer());
+            break;
+        }
+        case RequestType::DeletePerson:
+            deletePerson(reader.integer());
+            break;
+        case RequestType::AddTask: {
+            const int personId = reader.integer();
+            const bool completed = reader.byte();
+            TaskType* taskType = findTaskTypeByName(reader.text());
+            const string description = reader.text();
+            const string importance = reader.text();
+            const string date = reader.text();
+            auto* task = new Task(description, importance, date, reader.text(), taskType);
+            try {
+                response.integer(addTask(personId, task, completed));
+            } catch (...) {
+                delete task;
+                throw;
+            }
+            break;
+        }
+        case RequestType::AddSubTask: {
+            const int personId = reader.integer();
+            const int taskId = reader.integer();
+            const string name = reader.text();
+            const string comments = reader.text();
+            auto* subTask = new SubTask(name, comments, reader.decimal());
+            try {
+                addSubTask(personId, taskId, subTask);
+            } catch (...) {
+                delete subTask;
+                throw;
+            }
+            break;
+        }
+        case RequestType::ModifyActiveTask: {
+            const int personId = reader.integer();
+            const int taskId = reader.integer();
+            const string date = reader.text();
+            modifyActiveTask(personId, taskId, date, reader.text());
+            break;
+        }
+        case RequestType::CompleteTask: {
+            const int personId = reader.integer();
+            completeTask(personId, reader.integer());
+            break;
+        }
+        case RequestType::CompleteSubTask: {
+            const int personId = reader.integer();
+            const int taskId = reader.integer();
+            completeSubTask(personId, taskId, reader.integer());
+            break;
+        }
+        case RequestType::SubTaskProgress: {
+            const int personId = reader.integer();
+            const int taskId = reader.integer();
+            const int subTaskIndex = reader.integer();
+            subTaskProgress(personId, taskId, subTaskIndex, reader.decimal());
+            break;
+        }
+        case RequestType::DeleteTask: {
+            const int personId = reader.integer();
+            deleteTask(personId, reader.integer());
+            break;
+        }
+        case RequestType::CompleteTasksBefore: {
+            const int personId = reader.integer();
+            response.integer(completeTasksBefore(personId, reader.text()));
+            break;
+        }
+        case RequestType::ShiftTasks: {
+            const int personId = reader.integer();
+            TaskType* taskType = findTaskTypeByName(reader.text());
+            response.integer(shiftTasks(personId, taskType, reader.integer()));
+            break;
+        }
+        default:
+            throw runtime_error("Solicitud desconocida: " + to_string(type));
+    }
+}
+
+/**
+ * @brief Atiende una solicitud de lectura sobre la versión publicada más reciente de cada fragmento.
+ *
+ * @param type Tipo de la solicitud.
+ * @param request Campos de la solicitud.
+ * @param response Campos de la respuesta, o el mensaje de error.
+ * @return Estado de la respuesta.
+ * @author fabian
+ */
+uint8_t TaskServer::executeRead(const uint8_t type, const string_view request, LogPayloadWriter& response) {
+    LogPayloadReader reader{request};
+    try {
+        const vector<shared_ptr<const PeopleVersion>> versions = pinVersions();
+        switch (static_cast<RequestType>(type)) {
+            case RequestType::Query:
+                runQuery(PeopleView(versions), reader, response);
+                break;
+            case RequestType::Describe: {
+                int length = 0;
+                for (const auto& version : versions) length += version->getLength();
+                const vector<const TaskType*>& types = versions.front()->getTaskTypes();
+                response.integer(length);
+                response.integer(static_cast<int32_t>(types.size()));
+                for (const TaskType* taskType : types) response.text(taskType->name);
+                break;
+            }
+            case RequestType::Report:
+                runReport(versions, reader, response);
+                break;
+            case RequestType::Status:
+                writeStatus(response);
+                break;
+            default:
+                throw runtime_error("Solicitud desconocida: " + to_string(type));
+        }
+    } catch (const exception& error) {
+        response.bytes.clear();
+        response.text(error.what());
+        lock_guard guard(this->statsLock);
+        this->stats.reads++;
+        this->stats.errors++;
+        return static_cast<uint8_t>(ResponseStatus::Error);
+    }
+    lock_guard guard(this->statsLock);
+    this->stats.reads++;
+    return static_cast<uint8_t>(ResponseStatus::Ok);
+}
+
+/**
+ * @brief Escribe el estado de replicación del servidor, como lo describe `RequestType::Status`.
+ *
+ * @param response Campos de la respuesta.
+ * @author fabian
+ */
+void TaskServer::writeStatus(LogPayloadWriter& response) {
+    ReplicaStatus status;
+    if (this->replica) {
+        status = this->replica->getStatus();
+    } else if (mutationLog) {
+        status.appliedLsn = mutationLog->getLastLsn();
+        status.logLsn = status.appliedLsn;
+    }
+    response.byte(this->replica ? 1 : 0);
+    response.integer64(status.appliedLsn);
+    response.integer64(status.logLsn);
+    response.decimal(static_cast<float>(status.lagMillis));
+    response.integer(static_cast<int32_t>(status.reloads));
+    response.text(status.error);
+}
+
+/**
+ * @brief Escribe el resultado de una consulta que devuelve una persona: cédula (0 si no hay), nombre y cantidad.
+ *
+ * @param result Persona encontrada y su conteo.
+ * @param response Campos de la respuesta.
+ * @author fabian
+ */
+static void writePerson(const PersonArgMax& result, LogPayloadWriter& response) {
+    response.integer(result.person ? result.person->id : 0);
+    response.text(result.person ? result.person->name : string());
+    response.integer(result.count);
+}
+
+/**
+ * @brief Escribe el resultado de una consulta de conteos: el máximo, la cantidad de claves empatadas en él y las
+ * claves.
+ *
+ * @param counts Conteos por clave.
+ * @param response Campos de la respuesta.
+ * @author fabian
+ */
+static void writeCounts(const KeyCounts& counts, LogPayloadWriter& response) {
+    const int maxCount = counts.maxCount();
+    const vector<string> keys = counts.entries.empty() ? vector<string>() : counts.keysWithCount(maxCount);
+    response.integer(maxCount);
+    response.integer(static_cast<int32_t>(keys.size()));
+    for (const string& key : keys) response.text(key);
+}
+
+/**
+ * @brief Lee una fecha "dd-mm-YYYY" de una solicitud.
+ *
+ * @param reader Campos de la solicitud.
+ * @return La fecha.
+ * @throws runtime_error Si la fecha no tiene el formato correcto.
+ * @author fabian
+ */
+static tm readDate(LogPayloadReader& reader) {
+    tm result = {};
+    if (!parseDate(reader.text(), result)) throw runtime_error("Formato de fecha incorrecto. (dd-mm-YYYY)");
+    return result;
+}
+
+/**
+ * @brief Ejecuta una de las consultas del menú de consultas, con los mismos argumentos que
+ * `CommandInterpreter::runQuery`.
+ *
+ * @param people Versiones fijadas sobre las que se consulta.
+ * @param request Campos de la solicitud: el número de consulta y sus argumentos.
+ * @param response Campos de la respuesta.
+ * @throws runtime_error Si la consulta no existe o sus argumentos son inválidos.
+ * @author fabian
+ */
+void TaskServer::runQuery(const PeopleView& people, LogPayloadReader& request, LogPayloadWriter& response) {
+    switch (request.byte()) {
+        case 1: writePerson(queryMostActiveTasks(people, this->pool), response); break;
+        case 2: writePerson(queryMostActiveTasksOfType(people, this->pool, request.text()), response); break;
+        case 3: writeCounts(queryActiveTaskTypes(people, this->pool), response); break;
+        case 4: {
+            const string typeName = request.text();
+            writePerson(queryMostExpiredTasksOfType(people, this->pool, typeName, readDate(request)), response);
+            break;
+        }
+        case 5: writeCounts(queryExpiredTaskTypes(people, this->pool, readDate(request)), response); break;
+        case 6: writeCounts(queryActiveImportances(people, this->pool), response); break;
+        case 7: writeCounts(queryTaskTypesByImportance(people, this->pool, false, "Medio"), response); break;
+        case 8: writeCounts(queryTaskTypesByImportance(people, this->pool, true, "Alto"), response); break;
+        default: throw runtime_error("Consulta desconocida");
+    }
+}
+
+/**
+ * @brief Escribe una fila de un reporte de tareas: cédula, ID, descripción, fecha y hora de la tarea.
+ *
+ * @param person Persona dueña de la tarea.
+ * @param task Tarea.
+ * @param response Campos de la respuesta.
+ * @author fabian
+ */
+static void writeTaskRow(const Person& person, const Task& task, LogPayloadWriter& response) {
+    response.integer(person.id);
+    response.integer(task.id);
+    response.text(task.description);
+    response.text(string(task.getDate().view()));
+    response.text(string(task.getTime().view()));
+}
+
+/**
+ * @brief Ejecuta uno de los reportes largos del menú de reportes sobre las versiones fijadas de los fragmentos.
+ *
+ * El reporte recorre la versión completa aunque se devuelvan pocas filas, así que sirve para medir que un reporte
+ * largo no detiene a las mutaciones.
+ *
+ * @param versions Versión fijada de cada fragmento, en orden de fragmento.
+ * @param request Campos de la solicitud: el número de reporte, el máximo de filas y sus argumentos.
+ * @param response Campos de la respuesta: la cantidad total de filas y las primeras filas.
+ * @throws runtime_error Si el reporte no existe, sus argumentos son inválidos o la persona no se encuentra.
+ * @author fabian
+ */
+void TaskServer::runReport(const vector<shared_ptr<const PeopleVersion>>& versions, LogPayloadReader& request,
+                           LogPayloadWriter& response) {
+    const uint8_t report = request.byte();
+    const int maxRows = max(request.integer(), 0);
+    switch (report) {
+        case 3: {
+            const vector<const Person*> rows = reportPeopleWithoutActiveTasks(PeopleView(versions), this->pool);
+            response.integer(static_cast<int32_t>(rows.size()));
+            for (size_t i = 0; i < rows.size() && i < static_cast<size_t>(maxRows); i++) {
+                response.integer(rows[i]->id);
+                response.text(rows[i]->name);
+            }
+            break;
+        }
+        case 5: {
+            const vector<TaskRow> rows = reportTasksDueWithinWeek(PeopleView(versions), this->pool, readDate(request));
+            response.integer(static_cast<int32_t>(rows.size()));
+            for (size_t i = 0; i < rows.size() && i < static_cast<size_t>(maxRows); i++) {
+                writeTaskRow(*rows[i].person, *rows[i].task, response);
+            }
+            break;
+        }
+        case 7: {
+            const int id = request.integer();
+            const Person* person = versions[this->engine ? this->engine->shardFor(id) : 0]->findById(id);
+            if (!person) throw runtime_error("Persona no encontrada");
+            response.integer(person->completedTasks.getLength());
+            int written = 0;
+            person->completedTasks.forEach([&](const Task& task) {
+                if (written++ < maxRows) writeTaskRow(*person, task, response);
+            }, false);
+            break;
+        }
+        case 8: {
+            const vector<CompletedTaskRow> rows = reportCompletedTasks(PeopleView(versions), this->pool);
+            response.integer(static_cast<int32_t>(rows.size()));
+            for (size_t i = 0; i < rows.size() && i < static_cast<size_t>(maxRows); i++) {
+                writeTaskRow(*rows[i].person, rows[i].task, response);
+            }
+            break;
+        }
+        default: throw runtime_error("Reporte desconocido");
+    }
+}
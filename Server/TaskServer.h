@@ -0,0 +1,118 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef TASKSERVER_H
+#define TASKSERVER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Protocol.h"
+#include "../Engine/LogReplica.h"
+#include "../Engine/ShardedEngine.h"
+#include "../Queries/Queries.h"
+#include "../Storage/SharedDataset.h"
+
+/**
+ * @brief Estadísticas de un TaskServer.
+ */
+struct ServerStats {
+    uint64_t connections = 0;
+    uint64_t reads = 0;
+    uint64_t writes = 0;
+    uint64_t writeBatches = 0;
+    uint64_t errors = 0;
+    uint64_t sharedPublishes = 0;
+};
+
+/**
+ * @brief Servidor local que atiende solicitudes sobre `people` y `taskTypes` por un socket de dominio Unix.
+ *
+ * Un solo hilo atiende todas las conexiones con un `Reactor` de epoll: cada conexión es una corrutina que recibe
+ * sus solicitudes en orden (ver `RequestType`) y, mientras espera datos del cliente, no ocupa ningún hilo, así que
+ * miles de clientes inactivos solo cuestan un descriptor y un marco de corrutina cada uno. Las consultas y los
+ * reportes se atienden en orden de llegada en un `JobExecutor` con tantos hilos como el pool, y cada una se reparte
+ * a su vez en el pool; se ejecutan sobre la versión publicada más reciente (ver `VersionedPeople`), sin candados:
+ * las de varios clientes corren a la vez y un reporte largo no detiene a las mutaciones, ni ve ninguna a medias,
+ * ni demora al reactor. Las mutaciones de una persona se encolan sin candados
+ * en la `MutationQueue` de su fragmento (ver `ShardedEngine`), cuyo único hilo escritor aplica todas las pendientes
+ * sobre la lista del fragmento, las sincroniza juntas con el registro de mutaciones, publica una versión nueva y
+ * solo entonces reanuda la corrutina de cada cliente para responderle: un `ok` nunca llega antes de que su cambio
+ * sea durable y visible para las lecturas siguientes. Las lecturas recorren juntas las versiones de todos los
+ * fragmentos. Los escritores también inician las compactaciones, deteniendo a los demás entre un lote y otro.
+ *
+ * Como réplica de lectura (ver `LogReplica`), el servidor no acepta mutaciones: lee las versiones que publica el
+ * seguidor del registro del primario.
+ *
+ * Con `publishTo()`, el servidor publica además sus datos en un segmento de memoria compartida (ver
+ * `SharedDatasetWriter`) para que otros procesos los consulten sin conectarse: un hilo revisa cada
+ * `SHARED_PUBLISH_MILLIS` si hay versiones nuevas y, si las hay, escribe una instantánea de ellas en el segmento.
+ */
+class TaskServer {
+public:
+    TaskServer(const string& path, ThreadPool& pool, int shardCount = 1);
+    TaskServer(const string& path, ThreadPool& pool, LogReplica& replica);
+    ~TaskServer();
+
+    TaskServer(const TaskServer&) = delete;
+    TaskServer& operator=(const TaskServer&) = delete;
+
+    void publishTo(const string& name, uint64_t slotBytes);
+    void run(const atomic<bool>& stop);
+
+    [[nodiscard]] ServerStats getStats();
+
+private:
+    static constexpr int ACCEPT_TIMEOUT_MILLIS = 200;
+    static constexpr int SHARED_PUBLISH_MILLIS = 100;
+
+    /**
+     * @brief Encola una mutación en el escritor de su fragmento y reanuda la corrutina en el reactor cuando el
+     * escritor responde.
+     */
+    struct MutationAwaiter {
+        TaskServer& server;
+        int personId;
+        uint8_t type;
+        string payload;
+        MutationResult result;
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+        void await_suspend(coroutine_handle<> handle);
+        MutationResult await_resume();
+    };
+
+    SocketListener listener;
+    Reactor reactor;
+    bool stopping = false;
+    ThreadPool& pool;
+    JobExecutor reads;
+    int shardCount;
+    unique_ptr<ShardedEngine> engine;
+    LogReplica* replica = nullptr;
+    unique_ptr<SharedDatasetWriter> shared;
+
+    mutex statsLock;
+    ServerStats stats;
+
+    Async<> acceptConnections();
+    Async<> serve(AsyncConnection connection);
+    void publishShared(const atomic<bool>& stop);
+    [[nodiscard]] vector<shared_ptr<const PeopleVersion>> pinVersions();
+
+    uint8_t executeRead(uint8_t type, string_view request, LogPayloadWriter& response);
+    void writeStatus(LogPayloadWriter& response);
+    Async<uint8_t> executeWrite(uint8_t type, const string& request, LogPayloadWriter& response);
+    static void applyWrite(uint8_t type, string_view request, LogPayloadWriter& response);
+    void runQuery(const PeopleView& people, LogPayloadReader& request, LogPayloadWriter& response);
+    void runReport(const vector<shared_ptr<const PeopleVersion>>& versions, LogPayloadReader& request,
+                   LogPayloadWriter& response);
+};
+
+#include "TaskServer.cpp"
+#endif //TASKSERVER_H
@@ -0,0 +1,257 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "BufferPool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+/**
+ * @brief Constructor de la clase PageGuard.
+ *
+ * @param pool Pool dueño de la página.
+ * @param frame Marco de la página.
+ * @param page Número de página.
+ * @param data Contenido de la página.
+ * @author fabian
+ */
+PageGuard::PageGuard(BufferPool* pool, const uint32_t frame, const uint32_t page, char* data)
+    : pool(pool), frame(frame), page(page), bytes(data) {}
+
+/**
+ * @brief Constructor de movimiento: toma la fijación de la otra página.
+ *
+ * @param other Página a mover; queda vacía.
+ * @author fabian
+ */
+PageGuard::PageGuard(PageGuard&& other) noexcept
+    : pool(other.pool), frame(other.frame), page(other.page), bytes(other.bytes), dirty(other.dirty) {
+    other.pool = nullptr;
+}
+
+/**
+ * @brief Suelta la página actual y toma la fijación de otra.
+ *
+ * @param other Página a mover; queda vacía.
+ * @return Esta página.
+ * @author fabian
+ */
+PageGuard& PageGuard::operator=(PageGuard&& other) noexcept {
+    if (this != &other) {
+        release();
+        this->pool = other.pool;
+        this->frame = other.frame;
+        this->page = other.page;
+        this->bytes = other.bytes;
+        this->dirty = other.dirty;
+        other.pool = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * @brief Destructor de la clase PageGuard. Suelta la página.
+ * @author fabian
+ */
+PageGuard::~PageGuard() {
+    release();
+}
+
+/**
+ * @brief Obtiene el contenido de la página.
+ *
+ * @return Puntero a los `PAGE_SIZE` bytes de la página.
+ * @author fabian
+ */
+char* PageGuard::data() const { return this->bytes; }
+
+/**
+ * @brief Obtiene el número de la página.
+ *
+ * @return Número de página.
+ * @author fabian
+ */
+uint32_t PageGuard::id() const { return this->page; }
+
+/**
+ * @brief Marca la página como modificada, para escribirla en el archivo al desalojarla.
+ * @author fabian
+ */
+void PageGuard::markDirty() { this->dirty = true; }
+
+/**
+ * @brief Suelta la página antes de destruir el objeto.
+ * @author fabian
+ */
+void PageGuard::release() {
+    if (!this->pool) return;
+    this->pool->unpin(this->frame, this->dirty);
+    this->pool = nullptr;
+}
+
+/**
+ * @brief Constructor de la clase BufferPool. Crea el archivo de páginas y reserva los marcos.
+ *
+ * @param path Ruta del archivo de páginas, que se crea vacío.
+ * @param frameCount Cantidad de marcos; se usan al menos 16.
+ * @throws runtime_error Si el archivo no se puede crear.
+ * @author fabian
+ */
+BufferPool::BufferPool(const string& path, const size_t frameCount)
+    : file(path), memory(new char[max<size_t>(frameCount, 16) * PAGE_SIZE]), frames(max<size_t>(frameCount, 16)) {
+    this->pageTable.reserve(this->frames.size() * 2);
+}
+
+/**
+ * @brief Obtiene el contenido de un marco.
+ *
+ * @param frame Índice del marco.
+ * @return Puntero a los bytes del marco.
+ * @author fabian
+ */
+char* BufferPool::frameData(const uint32_t frame) const {
+    return this->memory.get() + static_cast<size_t>(frame) * PAGE_SIZE;
+}
+
+/**
+ * @brief Escoge un marco para una página nueva con el algoritmo del reloj, desalojando la página que tenía.
+ *
+ * @return Índice del marco, ya fuera de la tabla de páginas.
+ * @throws runtime_error Si todos los marcos están fijados.
+ * @author fabian
+ */
+uint32_t BufferPool::takeFrame() {
+    for (size_t step = 0; step < 2 * this->frames.size(); step++) {
+        const auto index = static_cast<uint32_t>(this->hand);
+        this->hand = (this->hand + 1) % this->frames.size();
+        Frame& frame = this->frames[index];
+        if (frame.pins > 0) continue;
+        if (frame.referenced) {
+            frame.referenced = false;
+            continue;
+        }
+
+        if (frame.page != NO_PAGE) {
+            if (frame.dirty) {
+                this->file.write(static_cast<uint64_t>(frame.page) * PAGE_SIZE, frameData(index), PAGE_SIZE);
+                this->stats.pagesWritten++;
+            }
+            this->pageTable.erase(frame.page);
+        }
+        frame = Frame();
+        return index;
+    }
+    throw runtime_error("Pool de paginas sin marcos libres");
+}
+
+/**
+ * @brief Fija una página, leyéndola del archivo si no está en el pool.
+ *
+ * @param page Número de página.
+ * @return La página fijada.
+ * @throws runtime_error Si la lectura falla o todos los marcos están fijados.
+ * @author fabian
+ */
+PageGuard BufferPool::pin(const uint32_t page) {
+    lock_guard guard(this->lock);
+    uint32_t index;
+    if (const auto found = this->pageTable.find(page); found != this->pageTable.end()) {
+        index = found->second;
+        this->stats.hits++;
+    } else {
+        index = takeFrame();
+        this->file.read(static_cast<uint64_t>(page) * PAGE_SIZE, frameData(index), PAGE_SIZE);
+        this->frames[index].page = page;
+        this->pageTable.emplace(page, index);
+        this->stats.misses++;
+        this->stats.pagesRead++;
+    }
+    Frame& frame = this->frames[index];
+    frame.pins++;
+    frame.referenced = true;
+    return PageGuard(this, index, page, frameData(index));
+}
+
+/**
+ * @brief Crea una página nueva al final del archivo, llena de ceros y ya fijada.
+ *
+ * @return La página fijada, marcada como modificada.
+ * @throws runtime_error Si todos los marcos están fijados.
+ * @author fabian
+ */
+PageGuard BufferPool::allocate() {
+    lock_guard guard(this->lock);
+    const uint32_t index = takeFrame();
+    const uint32_t page = this->pageCount++;
+    memset(frameData(index), 0, PAGE_SIZE);
+    Frame& frame = this->frames[index];
+    frame.page = page;
+    frame.pins = 1;
+    frame.dirty = true;
+    frame.referenced = true;
+    this->pageTable.emplace(page, index);
+
+    PageGuard result(this, index, page, frameData(index));
+    result.markDirty();
+    return result;
+}
+
+/**
+ * @brief Suelta una fijación de un marco.
+ *
+ * @param frame Índice del marco.
+ * @param dirty Si la página se modificó mientras estaba fijada.
+ * @author fabian
+ */
+void BufferPool::unpin(const uint32_t frame, const bool dirty) {
+    lock_guard guard(this->lock);
+    this->frames[frame].pins--;
+    this->frames[frame].dirty |= dirty;
+}
+
+/**
+ * @brief Escribe las páginas modificadas y vacía el pool, y pide al sistema descartar su caché del archivo.
+ *
+ * Deja el pool como al arrancar en frío: la siguiente lectura de cada página va al disco.
+ *
+ * @throws runtime_error Si alguna página está fijada o la escritura falla.
+ * @author fabian
+ */
+void BufferPool::evictAll() {
+    lock_guard guard(this->lock);
+    for (uint32_t index = 0; index < this->frames.size(); index++) {
+        Frame& frame = this->frames[index];
+        if (frame.page == NO_PAGE) continue;
+        if (frame.pins > 0) throw runtime_error("No se puede vaciar el pool con paginas fijadas");
+        if (frame.dirty) {
+            this->file.write(static_cast<uint64_t>(frame.page) * PAGE_SIZE, frameData(index), PAGE_SIZE);
+            this->stats.pagesWritten++;
+        }
+        frame = Frame();
+    }
+    this->pageTable.clear();
+    this->file.dropCache();
+}
+
+/**
+ * @brief Obtiene las estadísticas del pool.
+ *
+ * @return Aciertos, fallos, páginas leídas y escritas y páginas del archivo.
+ * @author fabian
+ */
+BufferPoolStats BufferPool::getStats() {
+    lock_guard guard(this->lock);
+    BufferPoolStats result = this->stats;
+    result.pageCount = this->pageCount;
+    return result;
+}
+
+/**
+ * @brief Obtiene la cantidad de marcos del pool.
+ *
+ * @return Cantidad de marcos.
+ * @author fabian
+ */
+size_t BufferPool::getFrameCount() const { return this->frames.size(); }
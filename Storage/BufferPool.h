@@ -0,0 +1,118 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef BUFFERPOOL_H
+#define BUFFERPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "File.h"
+
+using namespace std;
+
+/**
+ * @brief Estadísticas del pool de páginas.
+ */
+struct BufferPoolStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t pagesRead = 0;
+    uint64_t pagesWritten = 0;
+    uint64_t pageCount = 0;
+};
+
+class BufferPool;
+
+/**
+ * @brief Página fijada en el pool; la suelta al destruirse.
+ *
+ * Mientras exista, la página no se desaloja y su contenido se puede leer y, marcándola con `markDirty`, modificar.
+ */
+class PageGuard {
+public:
+    PageGuard() = default;
+    PageGuard(BufferPool* pool, uint32_t frame, uint32_t page, char* data);
+    PageGuard(PageGuard&& other) noexcept;
+    PageGuard& operator=(PageGuard&& other) noexcept;
+    ~PageGuard();
+
+    PageGuard(const PageGuard&) = delete;
+    PageGuard& operator=(const PageGuard&) = delete;
+
+    [[nodiscard]] char* data() const;
+    [[nodiscard]] uint32_t id() const;
+    void markDirty();
+    void release();
+
+private:
+    BufferPool* pool = nullptr;
+    uint32_t frame = 0;
+    uint32_t page = 0;
+    char* bytes = nullptr;
+    bool dirty = false;
+};
+
+/**
+ * @brief Caché de páginas de tamaño fijo de un archivo, con desalojo por reloj (CLOCK).
+ *
+ * Cada marco guarda una página, su cantidad de fijaciones, si fue modificada y un bit de referencia. Para traer una
+ * página que no está en memoria, la manecilla del reloj avanza por los marcos: los que tienen el bit de referencia
+ * lo pierden y el primero sin él y sin fijaciones se desaloja, escribiendo la página si fue modificada. Así las
+ * páginas usadas hace poco, como las de los niveles altos de un árbol, sobreviven a los recorridos largos.
+ *
+ * Un solo candado protege la tabla de páginas y los marcos, incluida la lectura desde el disco en un fallo: los
+ * aciertos son rápidos y los fallos se serializan.
+ */
+class BufferPool {
+public:
+    static constexpr size_t PAGE_SIZE = 8192;
+    static constexpr uint32_t NO_PAGE = UINT32_MAX;
+
+    BufferPool(const string& path, size_t frameCount);
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    PageGuard pin(uint32_t page);
+    PageGuard allocate();
+    void evictAll();
+
+    [[nodiscard]] BufferPoolStats getStats();
+    [[nodiscard]] size_t getFrameCount() const;
+
+private:
+    friend class PageGuard;
+
+    /**
+     * @brief Marco del pool: la página que guarda y su estado.
+     */
+    struct Frame {
+        uint32_t page = NO_PAGE;
+        uint32_t pins = 0;
+        bool dirty = false;
+        bool referenced = false;
+    };
+
+    PageFile file;
+    unique_ptr<char[]> memory;
+    vector<Frame> frames;
+    unordered_map<uint32_t, uint32_t> pageTable;
+    size_t hand = 0;
+    uint32_t pageCount = 0;
+    BufferPoolStats stats;
+    mutex lock;
+
+    uint32_t takeFrame();
+    char* frameData(uint32_t frame) const;
+    void unpin(uint32_t frame, bool dirty);
+};
+
+#include "BufferPool.cpp"
+#endif //BUFFERPOOL_H
@@ -0,0 +1,16 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+uint32_t crc32c(uint32_t crc, const void* data, size_t size);
+
+#include "Checksum.cpp"
+#endif //CHECKSUM_H
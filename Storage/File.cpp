@@ -0,0 +1,718 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "File.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+/**
+ * @brief Escribe todos los bytes en el archivo, reintentando escrituras parciales.
+ *
+ * @param handle Manejador del archivo.
+ * @param data Bytes a escribir.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la escritura falla.
+ * @author fabian
+ */
+static void writeAll(const intptr_t handle, const char* data, size_t size) {
+    while (size > 0) {
+        const DWORD chunk = size > (1u << 30) ? 1u << 30 : static_cast<DWORD>(size);
+        DWORD written = 0;
+        if (!WriteFile(reinterpret_cast<HANDLE>(handle), data, chunk, &written, nullptr)) {
+            throw runtime_error("Error al escribir el archivo");
+        }
+        data += written;
+        size -= written;
+    }
+}
+
+/**
+ * @brief Constructor de la clase FileWriter. Crea el archivo temporal.
+ *
+ * @param path Ruta del archivo destino.
+ * @param bufferSize Tamaño del búfer de escritura.
+ * @throws runtime_error Si no se puede crear el archivo temporal.
+ * @author fabian
+ */
+FileWriter::FileWriter(const string& path, const size_t bufferSize)
+    : path(path), temporaryPath(path + ".tmp"), buffer(bufferSize) {
+    const HANDLE file = CreateFileA(this->temporaryPath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw runtime_error("No se pudo crear " + this->temporaryPath);
+    this->handle = reinterpret_cast<intptr_t>(file);
+}
+
+/**
+ * @brief Destructor de la clase FileWriter. Si no se confirmó la escritura, elimina el archivo temporal.
+ * @author fabian
+ */
+FileWriter::~FileWriter() {
+    if (this->handle == -1) return;
+    CloseHandle(reinterpret_cast<HANDLE>(this->handle));
+    DeleteFileA(this->temporaryPath.c_str());
+}
+
+/**
+ * @brief Sobrescribe bytes ya escritos, por ejemplo un encabezado que se completa al final.
+ *
+ * @param offset Posición en el archivo.
+ * @param data Bytes a escribir.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la escritura falla.
+ * @author fabian
+ */
+void FileWriter::writeAt(const uint64_t offset, const void* data, const size_t size) {
+    flush();
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(offset);
+    SetFilePointerEx(reinterpret_cast<HANDLE>(this->handle), position, nullptr, FILE_BEGIN);
+    writeAll(this->handle, static_cast<const char*>(data), size);
+    position.QuadPart = static_cast<LONGLONG>(this->offset);
+    SetFilePointerEx(reinterpret_cast<HANDLE>(this->handle), position, nullptr, FILE_BEGIN);
+}
+
+/**
+ * @brief Vacía el búfer y sincroniza con el disco lo escrito hasta ahora, sin confirmar el archivo.
+ *
+ * Sirve para adelantar la parte lenta de `commit()` cuando después solo falta escribir poco.
+ *
+ * @throws runtime_error Si la escritura o la sincronización fallan.
+ * @author fabian
+ */
+void FileWriter::sync() {
+    flush();
+    if (!FlushFileBuffers(reinterpret_cast<HANDLE>(this->handle))) throw runtime_error("No se pudo sincronizar " + this->temporaryPath);
+}
+
+/**
+ * @brief Vacía el búfer, sincroniza el archivo con el disco y lo renombra sobre el destino.
+ *
+ * @throws runtime_error Si la sincronización o el renombrado fallan.
+ * @author fabian
+ */
+void FileWriter::commit() {
+    flush();
+    const auto file = reinterpret_cast<HANDLE>(this->handle);
+    const bool synced = FlushFileBuffers(file);
+    CloseHandle(file);
+    this->handle = -1;
+    if (!synced || !MoveFileExA(this->temporaryPath.c_str(), this->path.c_str(),
+                                MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        DeleteFileA(this->temporaryPath.c_str());
+        throw runtime_error("No se pudo guardar " + this->path);
+    }
+}
+
+/**
+ * @brief Constructor de la clase MappedFile. Mapea el archivo completo en memoria.
+ *
+ * @param path Ruta del archivo.
+ * @throws runtime_error Si el archivo no se puede abrir o mapear.
+ * @author fabian
+ */
+MappedFile::MappedFile(const string& path) {
+    const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                                    FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw runtime_error("No se pudo abrir " + path);
+
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    this->length = static_cast<size_t>(fileSize.QuadPart);
+    if (this->length == 0) {
+        CloseHandle(file);
+        return;
+    }
+
+    const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) throw runtime_error("No se pudo mapear " + path);
+    this->bytes = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (!this->bytes) throw runtime_error("No se pudo mapear " + path);
+}
+
+/**
+ * @brief Destructor de la clase MappedFile. Libera el mapeo.
+ * @author fabian
+ */
+MappedFile::~MappedFile() {
+    if (this->bytes) UnmapViewOfFile(this->bytes);
+}
+
+/**
+ * @brief Constructor de la clase AppendFile. Abre el archivo, o lo crea si no existe.
+ *
+ * @param path Ruta del archivo.
+ * @throws runtime_error Si el archivo no se puede abrir.
+ * @author fabian
+ */
+AppendFile::AppendFile(const string& path) : path(path) {
+    const HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw runtime_error("No se pudo abrir " + path);
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    this->size = static_cast<uint64_t>(fileSize.QuadPart);
+    LARGE_INTEGER end = {};
+    SetFilePointerEx(file, end, nullptr, FILE_END);
+    this->handle = reinterpret_cast<intptr_t>(file);
+}
+
+/**
+ * @brief Destructor de la clase AppendFile. Cierra el archivo.
+ * @author fabian
+ */
+AppendFile::~AppendFile() {
+    CloseHandle(reinterpret_cast<HANDLE>(this->handle));
+}
+
+/**
+ * @brief Escribe bytes al final del archivo, sin sincronizarlos con el disco.
+ *
+ * @param data Bytes a escribir.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la escritura falla.
+ * @author fabian
+ */
+void AppendFile::append(const void* data, const size_t size) {
+    writeAll(this->handle, static_cast<const char*>(data), size);
+    this->size += size;
+}
+
+/**
+ * @brief Sincroniza con el disco todo lo escrito en el archivo.
+ *
+ * @throws runtime_error Si la sincronización falla.
+ * @author fabian
+ */
+void AppendFile::sync() {
+    if (!FlushFileBuffers(reinterpret_cast<HANDLE>(this->handle))) throw runtime_error("No se pudo sincronizar " + this->path);
+}
+
+/**
+ * @brief Recorta el archivo a un tamaño dado y sincroniza el cambio.
+ *
+ * @param size Nuevo tamaño en bytes.
+ * @throws runtime_error Si el archivo no se puede recortar.
+ * @author fabian
+ */
+void AppendFile::truncate(const uint64_t size) {
+    const auto file = reinterpret_cast<HANDLE>(this->handle);
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(size);
+    if (!SetFilePointerEx(file, position, nullptr, FILE_BEGIN) || !SetEndOfFile(file)) {
+        throw runtime_error("No se pudo recortar " + this->path);
+    }
+    this->size = size;
+    sync();
+}
+
+/**
+ * @brief Constructor de la clase PageFile. Crea el archivo vacío, reemplazando uno anterior.
+ *
+ * @param path Ruta del archivo.
+ * @throws runtime_error Si el archivo no se puede crear.
+ * @author fabian
+ */
+PageFile::PageFile(const string& path) : path(path) {
+    const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                                    FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+    if (file == INVALID_HANDLE_VALUE) throw runtime_error("No se pudo crear " + path);
+    this->handle = reinterpret_cast<intptr_t>(file);
+}
+
+/**
+ * @brief Destructor de la clase PageFile. Cierra el archivo, que el sistema elimina al cerrarlo.
+ * @author fabian
+ */
+PageFile::~PageFile() {
+    CloseHandle(reinterpret_cast<HANDLE>(this->handle));
+}
+
+/**
+ * @brief Lee bytes desde una posición del archivo; lo que está más allá del final se lee como ceros.
+ *
+ * @param offset Posición de lectura.
+ * @param data Destino.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la lectura falla.
+ * @author fabian
+ */
+void PageFile::read(const uint64_t offset, void* data, const size_t size) {
+    OVERLAPPED position = {};
+    position.Offset = static_cast<DWORD>(offset);
+    position.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD read = 0;
+    if (!ReadFile(reinterpret_cast<HANDLE>(this->handle), data, static_cast<DWORD>(size), &read, &position) &&
+        GetLastError() != ERROR_HANDLE_EOF) {
+        throw runtime_error("Error al leer " + this->path);
+    }
+    memset(static_cast<char*>(data) + read, 0, size - read);
+}
+
+/**
+ * @brief Escribe bytes en una posición del archivo, agrandándolo si hace falta.
+ *
+ * @param offset Posición de escritura.
+ * @param data Bytes a escribir.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la escritura falla.
+ * @author fabian
+ */
+void PageFile::write(const uint64_t offset, const void* data, const size_t size) {
+    OVERLAPPED position = {};
+    position.Offset = static_cast<DWORD>(offset);
+    position.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD written = 0;
+    if (!WriteFile(reinterpret_cast<HANDLE>(this->handle), data, static_cast<DWORD>(size), &written, &position) ||
+        written != size) {
+        throw runtime_error("Error al escribir " + this->path);
+    }
+}
+
+/**
+ * @brief Pide al sistema que descarte de su caché las páginas del archivo. En Windows no hace nada.
+ * @author fabian
+ */
+void PageFile::dropCache() {}
+
+/**
+ * @brief Indica si existe un archivo.
+ *
+ * @param path Ruta del archivo.
+ * @return true si el archivo existe.
+ * @author fabian
+ */
+bool fileExists(const string& path) {
+    return GetFileAttributesA(path.c_str()) != INVALID_FILE_ATTRIBUTES;
+}
+
+#else
+
+/**
+ * @brief Escribe todos los bytes en el archivo, reintentando escrituras parciales e interrupciones.
+ *
+ * @param handle Descriptor del archivo.
+ * @param data Bytes a escribir.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la escritura falla.
+ * @author fabian
+ */
+static void writeAll(const intptr_t handle, const char* data, size_t size) {
+    while (size > 0) {
+        const ssize_t written = ::write(static_cast<int>(handle), data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw runtime_error(string("Error al escribir el archivo: ") + strerror(errno));
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+/**
+ * @brief Constructor de la clase FileWriter. Crea el archivo temporal.
+ *
+ * @param path Ruta del archivo destino.
+ * @param bufferSize Tamaño del búfer de escritura.
+ * @throws runtime_error Si no se puede crear el archivo temporal.
+ * @author fabian
+ */
+FileWriter::FileWriter(const string& path, const size_t bufferSize)
+    : path(path), temporaryPath(path + ".tmp"), buffer(bufferSize) {
+    this->handle = ::open(this->temporaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (this->handle < 0) throw runtime_error("No se pudo crear " + this->temporaryPath + ": " + strerror(errno));
+}
+
+/**
+ * @brief Destructor de la clase FileWriter. Si no se confirmó la escritura, elimina el archivo temporal.
+ * @author fabian
+ */
+FileWriter::~FileWriter() {
+    if (this->handle < 0) return;
+    ::close(static_cast<int>(this->handle));
+    ::unlink(this->temporaryPath.c_str());
+}
+
+/**
+ * @brief Sobrescribe bytes ya escritos, por ejemplo un encabezado que se completa al final.
+ *
+ * @param offset Posición en el archivo.
+ * @param data Bytes a escribir.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la escritura falla.
+ * @author fabian
+ */
+void FileWriter::writeAt(const uint64_t offset, const void* data, const size_t size) {
+    flush();
+    if (::pwrite(static_cast<int>(this->handle), data, size, static_cast<off_t>(offset)) != static_cast<ssize_t>(size)) {
+        throw runtime_error(string("Error al escribir el archivo: ") + strerror(errno));
+    }
+}
+
+/**
+ * @brief Vacía el búfer y sincroniza con el disco lo escrito hasta ahora, sin confirmar el archivo.
+ *
+ * Sirve para adelantar la parte lenta de `commit()` cuando después solo falta escribir poco.
+ *
+ * @throws runtime_error Si la escritura o la sincronización fallan.
+ * @author fabian
+ */
+void FileWriter::sync() {
+    flush();
+    if (::fsync(static_cast<int>(this->handle)) != 0) {
+        throw runtime_error("No se pudo sincronizar " + this->temporaryPath + ": " + strerror(errno));
+    }
+}
+
+/**
+ * @brief Vacía el búfer, sincroniza el archivo con el disco y lo renombra sobre el destino.
+ *
+ * También sincroniza el directorio para que el renombrado sobreviva a un corte de energía.
+ *
+ * @throws runtime_error Si la sincronización o el renombrado fallan.
+ * @author fabian
+ */
+void FileWriter::commit() {
+    flush();
+    const int file = static_cast<int>(this->handle);
+    const bool synced = ::fsync(file) == 0;
+    ::close(file);
+    this->handle = -1;
+    if (!synced || ::rename(this->temporaryPath.c_str(), this->path.c_str()) != 0) {
+        const string reason = strerror(errno);
+        ::unlink(this->temporaryPath.c_str());
+        throw runtime_error("No se pudo guardar " + this->path + ": " + reason);
+    }
+
+    const size_t slash = this->path.find_last_of('/');
+    const string directory = slash == string::npos ? "." : slash == 0 ? "/" : this->path.substr(0, slash);
+    const int directoryHandle = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+    if (directoryHandle >= 0) {
+        ::fsync(directoryHandle);
+        ::close(directoryHandle);
+    }
+}
+
+/**
+ * @brief Constructor de la clase MappedFile. Mapea el archivo completo en memoria.
+ *
+ * @param path Ruta del archivo.
+ * @throws runtime_error Si el archivo no se puede abrir o mapear.
+ * @author fabian
+ */
+MappedFile::MappedFile(const string& path) {
+    const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0) throw runtime_error("No se pudo abrir " + path + ": " + strerror(errno));
+
+    struct stat status{};
+    if (::fstat(file, &status) != 0) {
+        ::close(file);
+        throw runtime_error("No se pudo leer " + path + ": " + strerror(errno));
+    }
+    this->length = static_cast<size_t>(status.st_size);
+    if (this->length == 0) {
+        ::close(file);
+        return;
+    }
+
+    void* mapping = ::mmap(nullptr, this->length, PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (mapping == MAP_FAILED) throw runtime_error("No se pudo mapear " + path + ": " + strerror(errno));
+    ::madvise(mapping, this->length, MADV_SEQUENTIAL | MADV_WILLNEED);
+    this->bytes = static_cast<const char*>(mapping);
+}
+
+/**
+ * @brief Destructor de la clase MappedFile. Libera el mapeo.
+ * @author fabian
+ */
+MappedFile::~MappedFile() {
+    if (this->bytes) ::munmap(const_cast<char*>(this->bytes), this->length);
+}
+
+/**
+ * @brief Constructor de la clase AppendFile. Abre el archivo, o lo crea si no existe.
+ *
+ * @param path Ruta del archivo.
+ * @throws runtime_error Si el archivo no se puede abrir.
+ * @author fabian
+ */
+AppendFile::AppendFile(const string& path) : path(path) {
+    this->handle = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (this->handle < 0) throw runtime_error("No se pudo abrir " + path + ": " + strerror(errno));
+    struct stat status{};
+    ::fstat(static_cast<int>(this->handle), &status);
+    this->size = static_cast<uint64_t>(status.st_size);
+}
+
+/**
+ * @brief Destructor de la clase AppendFile. Cierra el archivo.
+ * @author fabian
+ */
+AppendFile::~AppendFile() {
+    ::close(static_cast<int>(this->handle));
+}
+
+/**
+ * @brief Escribe bytes al final del archivo, sin sincronizarlos con el disco.
+ *
+ * @param data Bytes a escribir.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la escritura falla.
+ * @author fabian
+ */
+void AppendFile::append(const void* data, const size_t size) {
+    writeAll(this->handle, static_cast<const char*>(data), size);
+    this->size += size;
+}
+
+/**
+ * @brief Sincroniza con el disco todo lo escrito en el archivo.
+ *
+ * Usa fdatasync donde existe, porque los metadatos que no afectan la lectura no necesitan sincronizarse.
+ *
+ * @throws runtime_error Si la sincronización falla.
+ * @author fabian
+ */
+void AppendFile::sync() {
+#ifdef __linux__
+    const int result = ::fdatasync(static_cast<int>(this->handle));
+#else
+    const int result = ::fsync(static_cast<int>(this->handle));
+#endif
+    if (result != 0) throw runtime_error("No se pudo sincronizar " + this->path + ": " + strerror(errno));
+}
+
+/**
+ * @brief Recorta el archivo a un tamaño dado y sincroniza el cambio.
+ *
+ * @param size Nuevo tamaño en bytes.
+ * @throws runtime_error Si el archivo no se puede recortar.
+ * @author fabian
+ */
+void AppendFile::truncate(const uint64_t size) {
+    if (::ftruncate(static_cast<int>(this->handle), static_cast<off_t>(size)) != 0) {
+        throw runtime_error("No se pudo recortar " + this->path + ": " + strerror(errno));
+    }
+    this->size = size;
+    if (::fsync(static_cast<int>(this->handle)) != 0) {
+        throw runtime_error("No se pudo sincronizar " + this->path + ": " + strerror(errno));
+    }
+}
+
+/**
+ * @brief Constructor de la clase PageFile. Crea el archivo vacío, reemplazando uno anterior.
+ *
+ * @param path Ruta del archivo.
+ * @throws runtime_error Si el archivo no se puede crear.
+ * @author fabian
+ */
+PageFile::PageFile(const string& path) : path(path) {
+    this->handle = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (this->handle < 0) throw runtime_error("No se pudo crear " + path + ": " + strerror(errno));
+}
+
+/**
+ * @brief Destructor de la clase PageFile. Cierra y elimina el archivo.
+ * @author fabian
+ */
+PageFile::~PageFile() {
+    ::close(static_cast<int>(this->handle));
+    ::unlink(this->path.c_str());
+}
+
+/**
+ * @brief Lee bytes desde una posición del archivo; lo que está más allá del final se lee como ceros.
+ *
+ * @param offset Posición de lectura.
+ * @param data Destino.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la lectura falla.
+ * @author fabian
+ */
+void PageFile::read(const uint64_t offset, void* data, const size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        const ssize_t read = ::pread(static_cast<int>(this->handle), static_cast<char*>(data) + done, size - done,
+                                     static_cast<off_t>(offset + done));
+        if (read < 0) {
+            if (errno == EINTR) continue;
+            throw runtime_error("Error al leer " + this->path + ": " + strerror(errno));
+        }
+        if (read == 0) break;
+        done += static_cast<size_t>(read);
+    }
+    memset(static_cast<char*>(data) + done, 0, size - done);
+}
+
+/**
+ * @brief Escribe bytes en una posición del archivo, agrandándolo si hace falta.
+ *
+ * @param offset Posición de escritura.
+ * @param data Bytes a escribir.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la escritura falla.
+ * @author fabian
+ */
+void PageFile::write(const uint64_t offset, const void* data, const size_t size) {
+    size_t done = 0;
+    while (done < size) {
+        const ssize_t written = ::pwrite(static_cast<int>(this->handle), static_cast<const char*>(data) + done,
+                                         size - done, static_cast<off_t>(offset + done));
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw runtime_error("Error al escribir " + this->path + ": " + strerror(errno));
+        }
+        done += static_cast<size_t>(written);
+    }
+}
+
+/**
+ * @brief Pide al sistema que descarte de su caché las páginas del archivo, para medir lecturas en frío.
+ *
+ * Las páginas modificadas se escriben primero, porque el sistema no descarta las que todavía no llegaron al disco.
+ *
+ * @author fabian
+ */
+void PageFile::dropCache() {
+#ifdef __linux__
+    ::fdatasync(static_cast<int>(this->handle));
+    ::posix_fadvise(static_cast<int>(this->handle), 0, 0, POSIX_FADV_DONTNEED);
+#endif
+}
+
+/**
+ * @brief Indica si existe un archivo.
+ *
+ * @param path Ruta del archivo.
+ * @return true si el archivo existe.
+ * @author fabian
+ */
+bool fileExists(const string& path) {
+    struct stat status{};
+    return ::stat(path.c_str(), &status) == 0;
+}
+
+#endif
+
+/**
+ * @brief Agrega bytes al búfer; si no caben, escribe el búfer en el archivo.
+ *
+ * @param data Bytes a escribir.
+ * @param size Cantidad de bytes.
+ * @throws runtime_error Si la escritura falla.
+ * @author fabian
+ */
+void FileWriter::write(const void* data, const size_t size) {
+    if (this->buffered + size > this->buffer.size()) {
+        flush();
+        if (size > this->buffer.size()) {
+            throttle(size);
+            writeAll(this->handle, static_cast<const char*>(data), size);
+            this->offset += size;
+            return;
+        }
+    }
+    memcpy(this->buffer.data() + this->buffered, data, size);
+    this->buffered += size;
+    this->offset += size;
+}
+
+/**
+ * @brief Agrega ceros hasta que la posición actual sea múltiplo de `alignment`.
+ *
+ * @param alignment Alineación deseada, en bytes.
+ * @author fabian
+ */
+void FileWriter::pad(const size_t alignment) {
+    static constexpr char zeros[64] = {};
+    const size_t missing = (alignment - this->offset % alignment) % alignment;
+    write(zeros, missing);
+}
+
+/**
+ * @brief Obtiene la cantidad de bytes escritos hasta ahora.
+ *
+ * @return Posición actual en el archivo.
+ * @author fabian
+ */
+uint64_t FileWriter::getOffset() const { return this->offset; }
+
+/**
+ * @brief Escribe en el archivo todo lo acumulado en el búfer.
+ *
+ * @throws runtime_error Si la escritura falla.
+ * @author fabian
+ */
+void FileWriter::flush() {
+    if (this->buffered == 0) return;
+    throttle(this->buffered);
+    writeAll(this->handle, this->buffer.data(), this->buffered);
+    this->buffered = 0;
+}
+
+/**
+ * @brief Obtiene el inicio del contenido mapeado.
+ *
+ * @return Puntero al primer byte del archivo.
+ * @author fabian
+ */
+const char* MappedFile::data() const { return this->bytes; }
+
+/**
+ * @brief Obtiene el tamaño del archivo mapeado.
+ *
+ * @return Tamaño en bytes.
+ * @author fabian
+ */
+size_t MappedFile::size() const { return this->length; }
+
+/**
+ * @brief Obtiene el tamaño actual del archivo.
+ *
+ * @return Tamaño en bytes.
+ * @author fabian
+ */
+uint64_t AppendFile::getSize() const { return this->size; }
+
+/**
+ * @brief Limita la velocidad de escritura del archivo.
+ *
+ * @param bytesPerSecond Bytes por segundo permitidos, o 0 para no limitar.
+ * @author fabian
+ */
+void FileWriter::setRateLimit(const uint64_t bytesPerSecond) {
+    this->bytesPerSecond = bytesPerSecond;
+    this->throttledBytes = 0;
+    this->throttleStart = chrono::steady_clock::now();
+}
+
+/**
+ * @brief Espera lo necesario antes de escribir para no pasar del límite de bytes por segundo.
+ *
+ * @param size Bytes que se van a escribir.
+ * @author fabian
+ */
+void FileWriter::throttle(const size_t size) {
+    if (this->bytesPerSecond == 0) return;
+    const auto allowedAt = this->throttleStart + chrono::microseconds(this->throttledBytes * 1000000 / this->bytesPerSecond);
+    this_thread::sleep_until(allowedAt);
+    this->throttledBytes += size;
+}
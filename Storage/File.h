@@ -0,0 +1,123 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef FILE_H
+#define FILE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Escritor de archivos con un búfer grande que reemplaza el archivo destino de forma atómica.
+ *
+ * Escribe en `ruta.tmp` y, al confirmar con `commit()`, vacía el búfer, sincroniza el archivo con el disco y lo
+ * renombra sobre el destino. Si el escritor se destruye sin confirmar, el archivo temporal se elimina y el destino
+ * queda intacto. Opcionalmente limita los bytes por segundo que escribe, para no competir por el disco con otros
+ * procesos o hilos.
+ */
+class FileWriter {
+public:
+    explicit FileWriter(const string& path, size_t bufferSize = 4 << 20);
+    ~FileWriter();
+
+    FileWriter(const FileWriter&) = delete;
+    FileWriter& operator=(const FileWriter&) = delete;
+
+    void write(const void* data, size_t size);
+    void writeAt(uint64_t offset, const void* data, size_t size);
+    void pad(size_t alignment);
+    void sync();
+    void commit();
+    void setRateLimit(uint64_t bytesPerSecond);
+
+    [[nodiscard]] uint64_t getOffset() const;
+
+private:
+    string path;
+    string temporaryPath;
+    vector<char> buffer;
+    size_t buffered = 0;
+    uint64_t offset = 0;
+    intptr_t handle = -1;
+    uint64_t bytesPerSecond = 0;
+    uint64_t throttledBytes = 0;
+    chrono::steady_clock::time_point throttleStart;
+
+    void flush();
+    void throttle(size_t size);
+};
+
+/**
+ * @brief Archivo mapeado en memoria en modo de solo lectura.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] const char* data() const;
+    [[nodiscard]] size_t size() const;
+
+private:
+    const char* bytes = nullptr;
+    size_t length = 0;
+};
+
+/**
+ * @brief Archivo abierto para agregar datos al final, con sincronización explícita al disco.
+ */
+class AppendFile {
+public:
+    explicit AppendFile(const string& path);
+    ~AppendFile();
+
+    AppendFile(const AppendFile&) = delete;
+    AppendFile& operator=(const AppendFile&) = delete;
+
+    void append(const void* data, size_t size);
+    void sync();
+    void truncate(uint64_t size);
+
+    [[nodiscard]] uint64_t getSize() const;
+
+private:
+    string path;
+    intptr_t handle = -1;
+    uint64_t size = 0;
+};
+
+/**
+ * @brief Archivo de lectura y escritura por posición, para guardar páginas de tamaño fijo.
+ *
+ * Se crea vacío al abrirlo y se elimina al destruirlo: guarda datos que solo valen mientras el proceso corre.
+ */
+class PageFile {
+public:
+    explicit PageFile(const string& path);
+    ~PageFile();
+
+    PageFile(const PageFile&) = delete;
+    PageFile& operator=(const PageFile&) = delete;
+
+    void read(uint64_t offset, void* data, size_t size);
+    void write(uint64_t offset, const void* data, size_t size);
+    void dropCache();
+
+private:
+    string path;
+    intptr_t handle = -1;
+};
+
+bool fileExists(const string& path);
+
+#include "File.cpp"
+#endif //FILE_H
@@ -0,0 +1,70 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "LogTailer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Constructor de la clase LogTailer. El archivo puede no existir todavía.
+ *
+ * @param path Ruta del registro de mutaciones.
+ * @author fabian
+ */
+LogTailer::LogTailer(const string& path) : path(path) {}
+
+/**
+ * @brief Aplica, en orden, los registros nuevos con LSN mayor que `appliedLsn`.
+ *
+ * Los LSN del registro son consecutivos, así que si el siguiente registro del archivo no es `appliedLsn + 1` el
+ * otro proceso ya descartó mutaciones que no se aplicaron: se detiene y avisa con `gap`, y hay que volver a cargar
+ * la instantánea.
+ *
+ * @param appliedLsn LSN de la última mutación aplicada; avanza con cada mutación que se aplica, aunque una
+ * posterior falle.
+ * @param apply Función que aplica una mutación a partir de su tipo y su contenido.
+ * @return Mutaciones aplicadas, LSN del último registro completo leído y si faltan mutaciones.
+ * @throws runtime_error Si el archivo no es un registro de mutaciones o si una mutación no se puede aplicar.
+ * @author fabian
+ */
+LogTailResult LogTailer::poll(uint64_t& appliedLsn, const function<void(uint8_t type, string_view payload)>& apply) {
+    LogTailResult result;
+    result.lastLsn = appliedLsn;
+    if (!fileExists(this->path)) return result;
+
+    const MappedFile mapped(this->path);
+    const char* data = mapped.data();
+    const size_t size = mapped.size();
+    if (size < MutationLog::FILE_HEADER_SIZE) return result;
+    if (!MutationLog::hasValidHeader(data, size)) {
+        throw runtime_error(this->path + " no es un registro de mutaciones compatible");
+    }
+
+    size_t first = MutationLog::FILE_HEADER_SIZE;
+    MutationLog::Record record;
+    const uint64_t firstLsn = MutationLog::readRecord(data, size, first, record) ? record.lsn : 0;
+    if (size < this->offset || firstLsn != this->firstLsn) this->offset = MutationLog::FILE_HEADER_SIZE;
+    this->firstLsn = firstLsn;
+
+    size_t offset = this->offset;
+    while (MutationLog::readRecord(data, size, offset, record)) {
+        if (record.lsn > appliedLsn) {
+            if (record.lsn != appliedLsn + 1) {
+                result.gap = true;
+                break;
+            }
+            try {
+                apply(record.type, record.payload);
+            } catch (const exception& error) {
+                throw runtime_error("No se pudo aplicar la mutacion " + to_string(record.lsn) + ": " + error.what());
+            }
+            appliedLsn = record.lsn;
+            result.applied++;
+        }
+        result.lastLsn = max(result.lastLsn, record.lsn);
+        this->offset = offset;
+    }
+    return result;
+}
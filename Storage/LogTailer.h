@@ -0,0 +1,48 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef LOGTAILER_H
+#define LOGTAILER_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "MutationLog.h"
+
+using namespace std;
+
+/**
+ * @brief Resultado de una lectura de `LogTailer::poll()`.
+ */
+struct LogTailResult {
+    uint64_t applied = 0;
+    uint64_t lastLsn = 0;
+    bool gap = false;
+};
+
+/**
+ * @brief Sigue un registro de mutaciones que otro proceso está escribiendo, sin modificarlo.
+ *
+ * Cada llamada a `poll()` mapea el archivo y aplica los registros completos que aparecieron desde la anterior,
+ * empezando donde quedó. Un registro incompleto o con el CRC equivocado al final es una escritura en curso del
+ * otro proceso: se deja para la siguiente llamada. Cuando el otro proceso compacta, reemplaza el archivo por uno
+ * que empieza en un LSN mayor; se nota porque el primer registro cambia y se vuelve a leer desde el principio,
+ * saltando los registros ya aplicados.
+ */
+class LogTailer {
+public:
+    explicit LogTailer(const string& path);
+
+    LogTailResult poll(uint64_t& appliedLsn, const function<void(uint8_t type, string_view payload)>& apply);
+
+private:
+    string path;
+    size_t offset = MutationLog::FILE_HEADER_SIZE;
+    uint64_t firstLsn = 0;
+};
+
+#include "LogTailer.cpp"
+#endif //LOGTAILER_H
@@ -0,0 +1,457 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "MutationLog.h"
+
+#include <cstring>
+#include <stdexcept>
+
+/**
+ * @brief Constructor de la clase MutationLog. Abre el archivo del registro, o lo crea si no existe.
+ *
+ * Antes de agregar registros hay que llamar a `recover()`.
+ *
+ * @param path Ruta del archivo.
+ * @throws runtime_error Si el archivo no se puede abrir.
+ * @author fabian
+ */
+MutationLog::MutationLog(const string& path) : path(path), file(make_unique<AppendFile>(path)) {}
+
+/**
+ * @brief Verifica que un archivo empiece con el encabezado de un registro de mutaciones compatible.
+ *
+ * @param data Contenido del archivo.
+ * @param size Tamaño del contenido.
+ * @return true si el encabezado está completo y es de esta versión.
+ * @author fabian
+ */
+bool MutationLog::hasValidHeader(const char* data, const size_t size) {
+    uint32_t version = 0;
+    if (size < FILE_HEADER_SIZE) return false;
+    memcpy(&version, data + 8, sizeof(version));
+    return memcmp(data, MAGIC, sizeof(MAGIC)) == 0 && version == VERSION;
+}
+
+/**
+ * @brief Lee el registro que empieza en una posición del archivo y verifica su CRC.
+ *
+ * @param data Contenido del archivo.
+ * @param size Tamaño del contenido.
+ * @param offset Posición del registro; si el registro es válido, avanza hasta el siguiente.
+ * @param record Recibe el registro leído.
+ * @return false si el registro está incompleto o corrupto, es decir, si ahí termina la parte válida del archivo.
+ * @author fabian
+ */
+bool MutationLog::readRecord(const char* data, const size_t size, size_t& offset, Record& record) {
+    if (size - offset < RECORD_HEADER_SIZE) return false;
+    uint32_t length;
+    uint32_t checksum;
+    memcpy(&length, data + offset, 4);
+    memcpy(&checksum, data + offset + 4, 4);
+    if (length > size - offset - RECORD_HEADER_SIZE) return false;
+
+    uint32_t expected = crc32c(0, data + offset, 4);
+    expected = crc32c(expected, data + offset + 8, RECORD_HEADER_SIZE - 8 + length);
+    if (expected != checksum) return false;
+
+    memcpy(&record.lsn, data + offset + 8, 8);
+    record.type = static_cast<uint8_t>(data[offset + 16]);
+    record.payload = string_view(data + offset + RECORD_HEADER_SIZE, length);
+    offset += RECORD_HEADER_SIZE + length;
+    return true;
+}
+
+/**
+ * @brief Lee el registro y aplica las mutaciones posteriores a un LSN dado.
+ *
+ * Recorre los registros en orden verificando su CRC. El primer registro incompleto o corrupto marca el final
+ * del registro: es lo que queda de una escritura interrumpida, que nunca se confirmó, así que el archivo se
+ * recorta en ese punto. Los registros con LSN menor o igual a `afterLsn` ya están en la instantánea y se omiten.
+ *
+ * @param afterLsn LSN de la última mutación incluida en la instantánea cargada.
+ * @param apply Función que aplica una mutación a partir de su tipo y su contenido.
+ * @return Cantidad de mutaciones aplicadas.
+ * @throws runtime_error Si el archivo no es un registro de mutaciones o si una mutación no se puede aplicar.
+ * @author fabian
+ */
+uint64_t MutationLog::recover(const uint64_t afterLsn, const function<void(uint8_t type, string_view payload)>& apply) {
+    lock_guard guard(this->lock);
+    this->lastLsn = afterLsn;
+    uint64_t applied = 0;
+
+    if (this->file->getSize() == 0) {
+        char header[FILE_HEADER_SIZE] = {};
+        memcpy(header, MAGIC, sizeof(MAGIC));
+        memcpy(header + 8, &VERSION, sizeof(VERSION));
+        this->file->append(header, sizeof(header));
+        this->file->sync();
+    } else {
+        uint64_t validEnd;
+        {
+            const MappedFile mapped(this->path);
+            const char* data = mapped.data();
+            const size_t size = mapped.size();
+            if (!hasValidHeader(data, size)) {
+                throw runtime_error(this->path + " no es un registro de mutaciones compatible");
+            }
+
+            size_t offset = FILE_HEADER_SIZE;
+            Record record;
+            while (readRecord(data, size, offset, record)) {
+                if (record.lsn > afterLsn) {
+                    try {
+                        apply(record.type, record.payload);
+                    } catch (const exception& error) {
+                        throw runtime_error("No se pudo aplicar la mutacion " + to_string(record.lsn) + ": " +
+                                            error.what());
+                    }
+                    ++applied;
+                }
+                if (record.lsn > this->lastLsn) this->lastLsn = record.lsn;
+            }
+            validEnd = offset;
+        }
+        if (validEnd < this->file->getSize()) this->file->truncate(validEnd);
+    }
+
+    this->durableLsn = this->lastLsn;
+    this->recovered = true;
+    return applied;
+}
+
+/**
+ * @brief Agrega una mutación al registro, sin esperar a que llegue al disco.
+ *
+ * @param type Tipo de la mutación.
+ * @param payload Contenido codificado de la mutación.
+ * @return El LSN asignado; se pasa a `sync()` para esperar a que la mutación sea durable.
+ * @throws runtime_error Si no se llamó a `recover()` antes.
+ * @author fabian
+ */
+uint64_t MutationLog::append(const uint8_t type, const string_view payload) {
+    lock_guard guard(this->lock);
+    if (!this->recovered) throw runtime_error("El registro de mutaciones no se ha recuperado");
+
+    const uint64_t lsn = ++this->lastLsn;
+    const auto length = static_cast<uint32_t>(payload.size());
+    char header[RECORD_HEADER_SIZE];
+    memcpy(header, &length, 4);
+    memcpy(header + 8, &lsn, 8);
+    header[16] = static_cast<char>(type);
+
+    uint32_t checksum = crc32c(0, header, 4);
+    checksum = crc32c(checksum, header + 8, RECORD_HEADER_SIZE - 8);
+    checksum = crc32c(checksum, payload.data(), payload.size());
+    memcpy(header + 4, &checksum, 4);
+
+    this->pending.append(header, RECORD_HEADER_SIZE);
+    this->pending.append(payload);
+    return lsn;
+}
+
+/**
+ * @brief Espera hasta que la mutación con el LSN indicado, y todas las anteriores, estén en el disco.
+ *
+ * Si nadie está escribiendo, este hilo toma todos los registros pendientes, de cualquier hilo, y los escribe con
+ * una sola sincronización; si otro hilo ya está escribiendo, espera a que termine y vuelve a revisar. Así, muchas
+ * mutaciones concurrentes o acumuladas en un lote cuestan una sola sincronización.
+ *
+ * @param lsn LSN que debe quedar durable.
+ * @throws runtime_error Si la escritura o la sincronización fallan.
+ * @author fabian
+ */
+void MutationLog::sync(const uint64_t lsn) {
+    unique_lock guard(this->lock);
+    while (this->durableLsn < lsn) {
+        if (!this->failure.empty()) throw runtime_error(this->failure);
+        if (this->flushing) {
+            this->synced.wait(guard);
+            continue;
+        }
+
+        this->flushing = true;
+        this->writingOffset = this->file->getSize();
+        swap(this->pending, this->writing);
+        const uint64_t target = this->lastLsn;
+        guard.unlock();
+
+        string error;
+        try {
+            this->file->append(this->writing.data(), this->writing.size());
+            this->file->sync();
+        } catch (const exception& exception) {
+            error = exception.what();
+        }
+
+        guard.lock();
+        this->writing.clear();
+        this->flushing = false;
+        if (error.empty()) {
+            this->durableLsn = target;
+            ++this->syncCount;
+        } else {
+            this->failure = error;
+        }
+        this->synced.notify_all();
+    }
+}
+
+/**
+ * @brief Espera hasta que todas las mutaciones agregadas estén en el disco.
+ *
+ * @throws runtime_error Si la escritura o la sincronización fallan.
+ * @author fabian
+ */
+void MutationLog::sync() {
+    sync(getLastLsn());
+}
+
+/**
+ * @brief Descarta del archivo los registros con LSN menor o igual al indicado.
+ *
+ * Copia los registros posteriores a un archivo nuevo, que reemplaza al actual de forma atómica. La copia se hace
+ * primero sin bloquear el registro; después, ya con el registro bloqueado, solo se copia lo que se escribió
+ * mientras tanto y se hace el reemplazo, así que las mutaciones nuevas esperan poco. Los registros pendientes en
+ * memoria no se tocan.
+ *
+ * @param lsn LSN de la última mutación que ya está en una instantánea durable.
+ * @param pauseMillis Si no es nulo, recibe el tiempo en milisegundos que el registro estuvo bloqueado.
+ * @return Cantidad de bytes descartados.
+ * @throws runtime_error Si el archivo nuevo no se puede escribir.
+ * @author fabian
+ */
+uint64_t MutationLog::truncateThrough(const uint64_t lsn, double* pauseMillis) {
+    unique_lock guard(this->lock);
+    this->synced.wait(guard, [this] { return !this->flushing; });
+    if (!this->failure.empty()) throw runtime_error(this->failure);
+    const uint64_t copiedEnd = this->file->getSize();
+    guard.unlock();
+
+    FileWriter writer(this->path);
+    {
+        const MappedFile mapped(this->path);
+        const char* data = mapped.data();
+        uint64_t offset = FILE_HEADER_SIZE;
+        while (offset + RECORD_HEADER_SIZE <= copiedEnd) {
+            uint32_t length;
+            uint64_t recordLsn;
+            memcpy(&length, data + offset, 4);
+            memcpy(&recordLsn, data + offset + 8, 8);
+            if (recordLsn > lsn) break;
+            offset += RECORD_HEADER_SIZE + length;
+        }
+        if (offset == FILE_HEADER_SIZE) return 0;
+
+        writer.write(data, FILE_HEADER_SIZE);
+        writer.write(data + offset, copiedEnd - offset);
+    }
+    writer.sync();
+
+    guard.lock();
+    const auto pauseStart = chrono::steady_clock::now();
+    this->synced.wait(guard, [this] { return !this->flushing; });
+    const uint64_t oldSize = this->file->getSize();
+    if (oldSize > copiedEnd) {
+        const MappedFile mapped(this->path);
+        writer.write(mapped.data() + copiedEnd, oldSize - copiedEnd);
+    }
+
+    this->file.reset();
+    try {
+        writer.commit();
+    } catch (...) {
+        this->file = make_unique<AppendFile>(this->path);
+        throw;
+    }
+    this->file = make_unique<AppendFile>(this->path);
+    if (pauseMillis) *pauseMillis = chrono::duration<double, milli>(chrono::steady_clock::now() - pauseStart).count();
+    return oldSize - this->file->getSize();
+}
+
+/**
+ * @brief Obtiene el LSN de la última mutación agregada.
+ *
+ * @return El último LSN.
+ * @author fabian
+ */
+uint64_t MutationLog::getLastLsn() {
+    lock_guard guard(this->lock);
+    return this->lastLsn;
+}
+
+/**
+ * @brief Obtiene el tamaño del registro, incluyendo lo que todavía no se escribe en el archivo.
+ *
+ * Mientras otro hilo escribe `writing`, el archivo crece sin el candado, así que se usa el tamaño que tenía antes.
+ *
+ * @return Tamaño en bytes.
+ * @author fabian
+ */
+uint64_t MutationLog::getSize() {
+    lock_guard guard(this->lock);
+    const uint64_t fileSize = this->flushing ? this->writingOffset : this->file->getSize();
+    return fileSize + this->pending.size() + this->writing.size();
+}
+
+/**
+ * @brief Obtiene cuántas sincronizaciones con el disco se han hecho.
+ *
+ * @return Cantidad de sincronizaciones.
+ * @author fabian
+ */
+uint64_t MutationLog::getSyncCount() {
+    lock_guard guard(this->lock);
+    return this->syncCount;
+}
+
+/**
+ * @brief Escribe un entero de 32 bits.
+ * @author fabian
+ */
+void LogPayloadWriter::integer(const int32_t value) { this->bytes.append(reinterpret_cast<const char*>(&value), 4); }
+
+/**
+ * @brief Escribe un entero sin signo de 64 bits.
+ * @author fabian
+ */
+void LogPayloadWriter::integer64(const uint64_t value) { this->bytes.append(reinterpret_cast<const char*>(&value), 8); }
+
+/**
+ * @brief Escribe un byte.
+ * @author fabian
+ */
+void LogPayloadWriter::byte(const uint8_t value) { this->bytes.push_back(static_cast<char>(value)); }
+
+/**
+ * @brief Escribe un número de punto flotante de 32 bits.
+ * @author fabian
+ */
+void LogPayloadWriter::decimal(const float value) { this->bytes.append(reinterpret_cast<const char*>(&value), 4); }
+
+/**
+ * @brief Escribe una cadena precedida por su longitud.
+ *
+ * @param value Cadena a escribir.
+ * @author fabian
+ */
+void LogPayloadWriter::text(const string& value) {
+    integer(static_cast<int32_t>(value.size()));
+    this->bytes.append(value);
+}
+
+/**
+ * @brief Escribe el año, el mes y el día de una fecha.
+ *
+ * @param value Fecha a escribir.
+ * @author fabian
+ */
+void LogPayloadWriter::date(const tm& value) {
+    integer(value.tm_year);
+    byte(static_cast<uint8_t>(value.tm_mon));
+    byte(static_cast<uint8_t>(value.tm_mday));
+}
+
+/**
+ * @brief Escribe la hora, los minutos y los segundos de una hora.
+ *
+ * @param value Hora a escribir.
+ * @author fabian
+ */
+void LogPayloadWriter::time(const tm& value) {
+    byte(static_cast<uint8_t>(value.tm_hour));
+    byte(static_cast<uint8_t>(value.tm_min));
+    byte(static_cast<uint8_t>(value.tm_sec));
+}
+
+/**
+ * @brief Consume bytes del contenido.
+ *
+ * @param size Cantidad de bytes.
+ * @return Puntero a los bytes consumidos.
+ * @throws runtime_error Si el contenido no tiene suficientes bytes.
+ * @author fabian
+ */
+const char* LogPayloadReader::take(const size_t size) {
+    if (this->bytes.size() < size) throw runtime_error("Registro de mutacion incompleto");
+    const char* data = this->bytes.data();
+    this->bytes.remove_prefix(size);
+    return data;
+}
+
+/**
+ * @brief Lee un entero de 32 bits.
+ * @throws runtime_error Si el contenido no tiene suficientes bytes.
+ * @author fabian
+ */
+int32_t LogPayloadReader::integer() {
+    int32_t value;
+    memcpy(&value, take(4), 4);
+    return value;
+}
+
+/**
+ * @brief Lee un entero sin signo de 64 bits.
+ * @throws runtime_error Si el contenido no tiene suficientes bytes.
+ * @author fabian
+ */
+uint64_t LogPayloadReader::integer64() {
+    uint64_t value;
+    memcpy(&value, take(8), 8);
+    return value;
+}
+
+/**
+ * @brief Lee un byte.
+ * @throws runtime_error Si el contenido no tiene suficientes bytes.
+ * @author fabian
+ */
+uint8_t LogPayloadReader::byte() { return static_cast<uint8_t>(*take(1)); }
+
+/**
+ * @brief Lee un número de punto flotante de 32 bits.
+ * @throws runtime_error Si el contenido no tiene suficientes bytes.
+ * @author fabian
+ */
+float LogPayloadReader::decimal() {
+    float value;
+    memcpy(&value, take(4), 4);
+    return value;
+}
+
+/**
+ * @brief Lee una cadena precedida por su longitud.
+ * @throws runtime_error Si el contenido no tiene suficientes bytes.
+ * @author fabian
+ */
+string LogPayloadReader::text() {
+    const auto length = static_cast<size_t>(integer());
+    return {take(length), length};
+}
+
+/**
+ * @brief Lee una fecha escrita con `LogPayloadWriter::date()`.
+ * @throws runtime_error Si el contenido no tiene suficientes bytes.
+ * @author fabian
+ */
+tm LogPayloadReader::date() {
+    tm value = {};
+    value.tm_year = integer();
+    value.tm_mon = byte();
+    value.tm_mday = byte();
+    fillDateFields(value);
+    return value;
+}
+
+/**
+ * @brief Lee una hora escrita con `LogPayloadWriter::time()`.
+ * @throws runtime_error Si el contenido no tiene suficientes bytes.
+ * @author fabian
+ */
+tm LogPayloadReader::time() {
+    tm value = {};
+    value.tm_hour = byte();
+    value.tm_min = byte();
+    value.tm_sec = byte();
+    return value;
+}
@@ -0,0 +1,121 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef MUTATIONLOG_H
+#define MUTATIONLOG_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "../utils/DateTime.h"
+#include "Checksum.h"
+#include "File.h"
+
+using namespace std;
+
+/**
+ * @brief Registro binario de mutaciones, de solo agregado, con confirmación en grupo.
+ *
+ * El archivo empieza con un encabezado de 16 bytes y sigue con registros
+ * `longitud (4) | CRC-32C (4) | LSN (8) | tipo (1) | contenido`. El CRC cubre todo el registro excepto el propio
+ * campo del CRC, y el LSN (número de secuencia) crece de uno en uno. Los registros se acumulan en memoria con
+ * `append()` y se escriben y sincronizan con el disco con `sync()`: si varios hilos esperan a la vez, el primero
+ * escribe todo lo pendiente con una sola sincronización y los demás solo esperan a que termine.
+ *
+ * Cuando una instantánea ya incluye las mutaciones hasta cierto LSN, `truncateThrough()` descarta esa parte del
+ * registro para que no crezca sin límite.
+ */
+class MutationLog {
+public:
+    static constexpr size_t FILE_HEADER_SIZE = 16;
+
+    /**
+     * @brief Registro leído del archivo; el contenido apunta a los bytes del archivo mapeado.
+     */
+    struct Record {
+        uint64_t lsn = 0;
+        uint8_t type = 0;
+        string_view payload;
+    };
+
+    explicit MutationLog(const string& path);
+
+    static bool hasValidHeader(const char* data, size_t size);
+    static bool readRecord(const char* data, size_t size, size_t& offset, Record& record);
+
+    MutationLog(const MutationLog&) = delete;
+    MutationLog& operator=(const MutationLog&) = delete;
+
+    uint64_t recover(uint64_t afterLsn, const function<void(uint8_t type, string_view payload)>& apply);
+    uint64_t append(uint8_t type, string_view payload);
+    void sync(uint64_t lsn);
+    void sync();
+    uint64_t truncateThrough(uint64_t lsn, double* pauseMillis = nullptr);
+
+    [[nodiscard]] uint64_t getLastLsn();
+    [[nodiscard]] uint64_t getSize();
+    [[nodiscard]] uint64_t getSyncCount();
+
+private:
+    static constexpr char MAGIC[8] = {'T', 'A', 'S', 'K', 'W', 'A', 'L', 0};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t RECORD_HEADER_SIZE = 17;
+
+    string path;
+    unique_ptr<AppendFile> file;
+    mutex lock;
+    condition_variable synced;
+    string pending;
+    string writing;
+    uint64_t lastLsn = 0;
+    uint64_t durableLsn = 0;
+    uint64_t syncCount = 0;
+    bool recovered = false;
+    bool flushing = false;
+    uint64_t writingOffset = 0;
+    string failure;
+};
+
+/**
+ * @brief Codifica el contenido de un registro de mutación.
+ */
+struct LogPayloadWriter {
+    string bytes;
+
+    void integer(int32_t value);
+    void integer64(uint64_t value);
+    void byte(uint8_t value);
+    void decimal(float value);
+    void text(const string& value);
+    void date(const tm& value);
+    void time(const tm& value);
+};
+
+/**
+ * @brief Decodifica el contenido de un registro de mutación, en el mismo orden en que se escribió.
+ */
+struct LogPayloadReader {
+    string_view bytes;
+
+    int32_t integer();
+    uint64_t integer64();
+    uint8_t byte();
+    float decimal();
+    string text();
+    tm date();
+    tm time();
+
+private:
+    const char* take(size_t size);
+};
+
+#include "MutationLog.cpp"
+#endif //MUTATIONLOG_H
@@ -0,0 +1,257 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "SharedDataset.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Obtiene el nombre POSIX de un segmento de memoria compartida, que empieza con una sola barra.
+ *
+ * @param name Nombre del segmento, con o sin la barra inicial.
+ * @return El nombre con la barra.
+ * @throws runtime_error Si el nombre está vacío o tiene otras barras.
+ * @author fabian
+ */
+static string sharedDatasetName(const string& name) {
+    const string normalized = name.starts_with('/') ? name : "/" + name;
+    if (normalized.size() < 2 || normalized.find('/', 1) != string::npos) {
+        throw runtime_error("Nombre de memoria compartida invalido: " + name);
+    }
+    return normalized;
+}
+
+/**
+ * @brief Lee la instantánea de la ranura actual y le aplica una función, repitiendo si la ranura cambió mientras
+ * tanto.
+ *
+ * La función recibe un `SnapshotImage` y no debe guardar punteros ni `string_view` de la imagen después de
+ * devolver: el escritor puede reutilizar la ranura. Si falla con `runtime_error` y la ranura no cambió, la
+ * excepción se propaga; si cambió, el error se debió a la escritura y la lectura se repite.
+ *
+ * @param function Función `(const SnapshotImage&)` que devuelve el resultado de la lectura.
+ * @return El resultado de la función sobre una imagen que no cambió durante la lectura.
+ * @throws runtime_error Si el segmento no tiene datos todavía o cambió en `MAX_ATTEMPTS` lecturas seguidas.
+ * @author fabian
+ */
+template <class Function>
+auto SharedDatasetReader::read(Function function) {
+    if (this->header->generation.load(memory_order_acquire) == 0) {
+        throw runtime_error("La memoria compartida todavia no tiene datos");
+    }
+
+    for (int attempt = 0; attempt < MAX_ATTEMPTS; attempt++) {
+        if (attempt > 0) {
+            this->retries++;
+            this_thread::yield();
+        }
+        const uint64_t slot = this->header->current.load(memory_order_acquire) & 1;
+        const uint64_t sequence = this->header->sequence[slot].load(memory_order_acquire);
+        const uint64_t size = this->header->size[slot].load(memory_order_relaxed);
+        if (sequence % 2 != 0 || size == 0) continue;
+
+        const auto unchanged = [&] {
+            atomic_thread_fence(memory_order_acquire);
+            return this->header->sequence[slot].load(memory_order_relaxed) == sequence;
+        };
+        const char* data = this->mapping + SHARED_DATASET_HEADER_BYTES + slot * this->header->slotBytes;
+        try {
+            auto result = function(SnapshotImage(data, min(size, this->header->slotBytes)));
+            if (unchanged()) return result;
+        } catch (const runtime_error&) {
+            if (unchanged()) throw;
+        }
+    }
+    throw runtime_error("La memoria compartida cambio demasiadas veces durante la lectura");
+}
+
+/**
+ * @brief Obtiene la cantidad de publicaciones del escritor.
+ *
+ * @return Generación actual del segmento; 0 si todavía no se publicó nada.
+ * @author fabian
+ */
+uint64_t SharedDatasetWriter::getGeneration() const {
+    return this->header ? this->header->generation.load(memory_order_acquire) : 0;
+}
+
+/**
+ * @brief Obtiene la cantidad de publicaciones que hizo el escritor del segmento.
+ *
+ * @return Generación actual del segmento; 0 si todavía no se publicó nada.
+ * @author fabian
+ */
+uint64_t SharedDatasetReader::getGeneration() const {
+    return this->header ? this->header->generation.load(memory_order_acquire) : 0;
+}
+
+/**
+ * @brief Obtiene cuántas lecturas se repitieron porque la ranura cambió mientras se leía.
+ *
+ * @return Cantidad de repeticiones desde que se abrió el segmento.
+ * @author fabian
+ */
+uint64_t SharedDatasetReader::getRetries() const { return this->retries; }
+
+#ifdef _WIN32
+
+SharedDatasetWriter::SharedDatasetWriter(const string&, uint64_t) {
+    throw runtime_error("La memoria compartida requiere un sistema POSIX");
+}
+
+SharedDatasetWriter::~SharedDatasetWriter() = default;
+
+SnapshotSummary SharedDatasetWriter::publish(const vector<const Person*>&, const vector<const TaskType*>&, uint64_t) {
+    throw runtime_error("La memoria compartida requiere un sistema POSIX");
+}
+
+SharedDatasetReader::SharedDatasetReader(const string&) {
+    throw runtime_error("La memoria compartida requiere un sistema POSIX");
+}
+
+SharedDatasetReader::~SharedDatasetReader() = default;
+
+#else
+
+/**
+ * @brief Constructor de la clase SharedDatasetWriter. Crea el segmento, reemplazando uno anterior con el mismo
+ * nombre.
+ *
+ * @param name Nombre del segmento.
+ * @param slotBytes Tamaño de cada una de las dos ranuras; se redondea a un múltiplo de la página.
+ * @throws runtime_error Si el nombre es inválido o el segmento no se puede crear o mapear.
+ * @author fabian
+ */
+SharedDatasetWriter::SharedDatasetWriter(const string& name, uint64_t slotBytes) : name(sharedDatasetName(name)) {
+    if (slotBytes < sizeof(SnapshotHeader)) throw runtime_error("Las ranuras de la memoria compartida son muy pequenas");
+    slotBytes = (slotBytes + SHARED_DATASET_HEADER_BYTES - 1) & ~(SHARED_DATASET_HEADER_BYTES - 1);
+    this->length = SHARED_DATASET_HEADER_BYTES + 2 * slotBytes;
+
+    shm_unlink(this->name.c_str());
+    const int segment = shm_open(this->name.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0644);
+    if (segment < 0) throw runtime_error("No se pudo crear la memoria compartida " + name + ": " + strerror(errno));
+    if (ftruncate(segment, static_cast<off_t>(this->length)) != 0) {
+        const string error = strerror(errno);
+        ::close(segment);
+        shm_unlink(this->name.c_str());
+        throw runtime_error("No se pudo reservar la memoria compartida " + name + ": " + error);
+    }
+    void* mapped = mmap(nullptr, this->length, PROT_READ | PROT_WRITE, MAP_SHARED, segment, 0);
+    ::close(segment);
+    if (mapped == MAP_FAILED) {
+        shm_unlink(this->name.c_str());
+        throw runtime_error("No se pudo mapear la memoria compartida " + name + ": " + strerror(errno));
+    }
+
+    this->mapping = static_cast<char*>(mapped);
+    this->header = new (this->mapping) SharedDatasetHeader();
+    memcpy(this->header->magic, SHARED_DATASET_MAGIC, sizeof(SHARED_DATASET_MAGIC));
+    this->header->version = SHARED_DATASET_VERSION;
+    this->header->slotBytes = slotBytes;
+}
+
+/**
+ * @brief Destructor de la clase SharedDatasetWriter. Libera el mapeo y elimina el nombre del segmento; los
+ * lectores que ya lo tienen mapeado conservan la última versión.
+ * @author fabian
+ */
+SharedDatasetWriter::~SharedDatasetWriter() {
+    munmap(this->mapping, this->length);
+    shm_unlink(this->name.c_str());
+}
+
+/**
+ * @brief Publica una versión de los datos en la ranura que no es la actual y la marca como actual.
+ *
+ * Si la instantánea no cabe, la ranura queda vacía y los lectores siguen leyendo la versión anterior.
+ *
+ * @param persons Personas, en orden de cédula.
+ * @param types Tipos de tarea, en el orden de la lista.
+ * @param lastLsn LSN de la última mutación incluida en los datos.
+ * @return Cantidades escritas y tamaño de la instantánea.
+ * @throws runtime_error Si la instantánea no cabe en una ranura.
+ * @author fabian
+ */
+SnapshotSummary SharedDatasetWriter::publish(const vector<const Person*>& persons, const vector<const TaskType*>& types,
+                                             const uint64_t lastLsn) {
+    const uint64_t slot = (this->header->current.load(memory_order_relaxed) + 1) & 1;
+    const uint64_t sequence = this->header->sequence[slot].load(memory_order_relaxed);
+    char* data = this->mapping + SHARED_DATASET_HEADER_BYTES + slot * this->header->slotBytes;
+
+    this->header->sequence[slot].store(sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    SnapshotSummary summary;
+    try {
+        summary = writeSnapshotImage(data, this->header->slotBytes, persons, types, lastLsn);
+    } catch (const runtime_error&) {
+        this->header->size[slot].store(0, memory_order_relaxed);
+        this->header->sequence[slot].store(sequence + 2, memory_order_release);
+        throw runtime_error("Los datos no caben en una ranura de la memoria compartida");
+    }
+    this->header->size[slot].store(summary.bytes, memory_order_relaxed);
+    this->header->sequence[slot].store(sequence + 2, memory_order_release);
+
+    this->header->current.store(slot, memory_order_release);
+    this->header->generation.fetch_add(1, memory_order_release);
+    return summary;
+}
+
+/**
+ * @brief Constructor de la clase SharedDatasetReader. Mapea un segmento existente solo para lectura.
+ *
+ * @param name Nombre del segmento.
+ * @throws runtime_error Si el segmento no existe o no lo creó un `SharedDatasetWriter` de esta versión.
+ * @author fabian
+ */
+SharedDatasetReader::SharedDatasetReader(const string& name) {
+    const int segment = shm_open(sharedDatasetName(name).c_str(), O_RDONLY | O_CLOEXEC, 0);
+    if (segment < 0) throw runtime_error("No se pudo abrir la memoria compartida " + name + ": " + strerror(errno));
+    struct stat status{};
+    if (fstat(segment, &status) != 0) {
+        const string error = strerror(errno);
+        ::close(segment);
+        throw runtime_error("No se pudo leer la memoria compartida " + name + ": " + error);
+    }
+    this->length = static_cast<uint64_t>(status.st_size);
+    if (this->length < SHARED_DATASET_HEADER_BYTES) {
+        ::close(segment);
+        throw runtime_error(name + " no es una memoria compartida del gestor de tareas");
+    }
+    void* mapped = mmap(nullptr, this->length, PROT_READ, MAP_SHARED, segment, 0);
+    ::close(segment);
+    if (mapped == MAP_FAILED) {
+        throw runtime_error("No se pudo mapear la memoria compartida " + name + ": " + strerror(errno));
+    }
+
+    this->mapping = static_cast<const char*>(mapped);
+    this->header = reinterpret_cast<const SharedDatasetHeader*>(this->mapping);
+    if (memcmp(this->header->magic, SHARED_DATASET_MAGIC, sizeof(SHARED_DATASET_MAGIC)) != 0 ||
+        this->header->version != SHARED_DATASET_VERSION ||
+        this->header->slotBytes > (this->length - SHARED_DATASET_HEADER_BYTES) / 2) {
+        munmap(mapped, this->length);
+        throw runtime_error(name + " no es una memoria compartida del gestor de tareas");
+    }
+}
+
+/**
+ * @brief Destructor de la clase SharedDatasetReader. Libera el mapeo.
+ * @author fabian
+ */
+SharedDatasetReader::~SharedDatasetReader() {
+    munmap(const_cast<char*>(this->mapping), this->length);
+}
+
+#endif
@@ -0,0 +1,100 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef SHAREDDATASET_H
+#define SHAREDDATASET_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Snapshot.h"
+
+using namespace std;
+
+/**
+ * @brief Formato del segmento de memoria compartida con el que un proceso publica sus datos a otros procesos.
+ *
+ * El segmento empieza con un SharedDatasetHeader de una página y sigue con dos ranuras de `slotBytes` bytes; cada
+ * ranura guarda una instantánea con el formato de `saveSnapshot`, que solo usa desplazamientos y se puede leer en
+ * cualquier dirección donde quede mapeada. Los campos atómicos se leen desde procesos que mapean el segmento solo
+ * para lectura, así que deben ser atómicos sin candados.
+ */
+constexpr char SHARED_DATASET_MAGIC[8] = {'T', 'A', 'S', 'K', 'S', 'H', 'M', '\0'};
+constexpr uint32_t SHARED_DATASET_VERSION = 1;
+constexpr uint64_t SHARED_DATASET_HEADER_BYTES = 4096;
+
+struct SharedDatasetHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t slotBytes;
+    atomic<uint64_t> current;
+    atomic<uint64_t> generation;
+    atomic<uint64_t> sequence[2];
+    atomic<uint64_t> size[2];
+};
+
+static_assert(atomic<uint64_t>::is_always_lock_free, "La memoria compartida requiere atomicos de 64 bits sin candados");
+static_assert(sizeof(SharedDatasetHeader) <= SHARED_DATASET_HEADER_BYTES, "El encabezado debe caber en una pagina");
+
+/**
+ * @brief Único escritor de un segmento de memoria compartida con los datos del proceso.
+ *
+ * Cada publicación escribe una instantánea completa en la ranura que los lectores no están usando, la marca como
+ * la actual e incrementa la generación. Mientras escribe, el contador de secuencia de la ranura es impar; los
+ * lectores que la estaban leyendo lo notan al terminar y vuelven a leer (un seqlock por ranura). Como hay dos
+ * ranuras, una lectura solo se repite si durante ella se publican dos versiones.
+ */
+class SharedDatasetWriter {
+public:
+    SharedDatasetWriter(const string& name, uint64_t slotBytes);
+    ~SharedDatasetWriter();
+
+    SharedDatasetWriter(const SharedDatasetWriter&) = delete;
+    SharedDatasetWriter& operator=(const SharedDatasetWriter&) = delete;
+
+    SnapshotSummary publish(const vector<const Person*>& persons, const vector<const TaskType*>& types,
+                            uint64_t lastLsn);
+    [[nodiscard]] uint64_t getGeneration() const;
+
+private:
+    string name;
+    char* mapping = nullptr;
+    uint64_t length = 0;
+    SharedDatasetHeader* header = nullptr;
+};
+
+/**
+ * @brief Lector de un segmento publicado por un `SharedDatasetWriter` de otro proceso.
+ *
+ * Mapea el segmento solo para lectura y consulta la instantánea de la ranura actual en su lugar, sin copiarla ni
+ * reconstruir las listas (ver `SnapshotImage`).
+ */
+class SharedDatasetReader {
+public:
+    static constexpr int MAX_ATTEMPTS = 64;
+
+    explicit SharedDatasetReader(const string& name);
+    ~SharedDatasetReader();
+
+    SharedDatasetReader(const SharedDatasetReader&) = delete;
+    SharedDatasetReader& operator=(const SharedDatasetReader&) = delete;
+
+    template <class Function>
+    auto read(Function function);
+
+    [[nodiscard]] uint64_t getGeneration() const;
+    [[nodiscard]] uint64_t getRetries() const;
+
+private:
+    const char* mapping = nullptr;
+    uint64_t length = 0;
+    const SharedDatasetHeader* header = nullptr;
+    uint64_t retries = 0;
+};
+
+#include "SharedDataset.cpp"
+#endif //SHAREDDATASET_H
@@ -0,0 +1,552 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "Snapshot.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Redondea un tamaño al siguiente múltiplo de 8.
+ *
+ * @param size Tamaño en bytes.
+ * @return El tamaño alineado.
+ * @author fabian
+ */
+static uint64_t alignSection(const uint64_t size) {
+    return (size + 7) & ~static_cast<uint64_t>(7);
+}
+
+/**
+ * @brief Posición de cada sección dentro del archivo, calculada a partir de las cantidades del encabezado.
+ */
+struct SnapshotLayout {
+    uint64_t types;
+    uint64_t persons;
+    uint64_t tasks;
+    uint64_t subTasks;
+    uint64_t strings;
+    uint64_t end;
+
+    SnapshotLayout(const SnapshotHeader& header, const uint64_t headerSize) {
+        this->types = headerSize;
+        this->persons = this->types + alignSection(header.typeCount * sizeof(SnapshotTaskTypeRecord));
+        this->tasks = this->persons + alignSection(header.personCount * sizeof(SnapshotPersonRecord));
+        this->subTasks = this->tasks + alignSection(header.taskCount * sizeof(SnapshotTaskRecord));
+        this->strings = this->subTasks + alignSection(header.subTaskCount * sizeof(SnapshotSubTaskRecord));
+        this->end = this->strings + header.stringBytes;
+    }
+};
+
+/**
+ * @brief Tabla de cadenas de una instantánea en construcción; guarda una sola copia de cada cadena repetida.
+ */
+struct SnapshotStringTable {
+    vector<char> bytes;
+    unordered_map<string_view, SnapshotStringRef> offsets;
+
+    SnapshotStringRef add(const string& value) {
+        const auto found = this->offsets.find(value);
+        if (found != this->offsets.end()) return found->second;
+        if (this->bytes.size() + value.size() > UINT32_MAX) throw runtime_error("La tabla de cadenas es demasiado grande");
+
+        const SnapshotStringRef ref = {static_cast<uint32_t>(this->bytes.size()), static_cast<uint32_t>(value.size())};
+        this->bytes.insert(this->bytes.end(), value.begin(), value.end());
+        this->offsets.emplace(value, ref);
+        return ref;
+    }
+};
+
+/**
+ * @brief Destino en memoria de una instantánea, con el mismo uso que `FileWriter`.
+ */
+struct SnapshotBuffer {
+    char* data;
+    uint64_t capacity;
+    uint64_t offset = 0;
+
+    void write(const void* bytes, const size_t size) {
+        writeAt(this->offset, bytes, size);
+        this->offset += size;
+    }
+
+    void writeAt(const uint64_t position, const void* bytes, const size_t size) {
+        if (position + size > this->capacity) throw runtime_error("La instantanea no cabe en el espacio disponible");
+        memcpy(this->data + position, bytes, size);
+    }
+
+    [[nodiscard]] uint64_t getOffset() const { return this->offset; }
+};
+
+/**
+ * @brief Escritor de secciones que acumula el CRC de todo lo que se escribe después del encabezado.
+ *
+ * `Sink` es un `FileWriter` o un `SnapshotBuffer`.
+ */
+template <class Sink>
+struct SnapshotSectionWriter {
+    Sink& file;
+    uint32_t checksum = 0;
+
+    template <class Record>
+    void write(const Record& record) {
+        this->file.write(&record, sizeof(Record));
+        this->checksum = crc32c(this->checksum, &record, sizeof(Record));
+    }
+
+    void write(const void* data, const size_t size) {
+        this->file.write(data, size);
+        this->checksum = crc32c(this->checksum, data, size);
+    }
+
+    void endSection() {
+        static constexpr char zeros[8] = {};
+        write(zeros, alignSection(this->file.getOffset()) - this->file.getOffset());
+    }
+};
+
+/**
+ * @brief Escribe todas las personas, tipos de tarea, tareas y subtareas en el formato de las instantáneas.
+ *
+ * Recorre los datos tres veces (personas, tareas y subtareas) escribiendo registros de tamaño fijo directamente
+ * en el destino; las cadenas se acumulan en una tabla sin repetidos que se escribe al final, y el encabezado se
+ * completa al terminar.
+ *
+ * @param file Destino, un `FileWriter` o un `SnapshotBuffer`.
+ * @param persons Personas, en orden de cédula.
+ * @param types Tipos de tarea, en el orden de la lista.
+ * @param lastLsn LSN de la última mutación incluida en los datos.
+ * @return Cantidades escritas y tamaño de la instantánea.
+ * @throws runtime_error Si el destino no se puede escribir.
+ * @author fabian
+ */
+template <class Sink>
+static SnapshotSummary writeSnapshot(Sink& file, const vector<const Person*>& persons,
+                                     const vector<const TaskType*>& types, const uint64_t lastLsn) {
+    SnapshotHeader header = {};
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.lastLsn = lastLsn;
+    header.createdAt = static_cast<uint64_t>(
+        chrono::duration_cast<chrono::seconds>(chrono::system_clock::now().time_since_epoch()).count());
+
+    unordered_map<const TaskType*, int32_t> typeIndexes;
+    for (const TaskType* type : types) typeIndexes.emplace(type, static_cast<int32_t>(header.typeCount++));
+
+    file.write(&header, sizeof(header));
+    SnapshotSectionWriter<Sink> writer{file};
+    SnapshotStringTable strings;
+
+    for (const TaskType* type : types) {
+        writer.write(SnapshotTaskTypeRecord{type->id, strings.add(type->name), strings.add(type->description)});
+    }
+    writer.endSection();
+
+    for (const Person* person : persons) {
+        SnapshotPersonRecord record = {};
+        record.id = person->id;
+        record.age = person->age;
+        record.name = strings.add(person->name);
+        record.lastname = strings.add(person->lastname);
+        record.firstTask = header.taskCount;
+        record.firstSubTask = header.subTaskCount;
+        for (const Task* task = person->activeTasks.head; task; task = task->next) {
+            ++record.activeCount;
+            for (const SubTask* subTask = task->subTasks.head; subTask; subTask = subTask->next) ++header.subTaskCount;
+        }
+        record.completedCount = static_cast<uint32_t>(person->completedTasks.getLength());
+        header.subTaskCount += person->completedTasks.getSubTaskCount();
+        header.taskCount += record.activeCount + record.completedCount;
+        writer.write(record);
+        ++header.personCount;
+    }
+    writer.endSection();
+
+    const auto writeTask = [&](const Task& task) {
+        SnapshotTaskRecord record = {};
+        record.id = task.id;
+        const auto typeIndex = typeIndexes.find(task.type);
+        record.typeIndex = typeIndex == typeIndexes.end() ? -1 : typeIndex->second;
+        record.description = strings.add(task.description);
+        record.importance = strings.add(task.importance);
+        record.year = static_cast<int16_t>(task.date.tm_year);
+        record.month = static_cast<uint8_t>(task.date.tm_mon);
+        record.day = static_cast<uint8_t>(task.date.tm_mday);
+        record.hour = static_cast<uint8_t>(task.time.tm_hour);
+        record.minute = static_cast<uint8_t>(task.time.tm_min);
+        record.second = static_cast<uint8_t>(task.time.tm_sec);
+        for (const SubTask* subTask = task.subTasks.head; subTask; subTask = subTask->next) ++record.subTaskCount;
+        writer.write(record);
+    };
+    for (const Person* person : persons) {
+        for (const Task* task = person->activeTasks.head; task; task = task->next) writeTask(*task);
+        person->completedTasks.forEach(writeTask);
+    }
+    writer.endSection();
+
+    const auto writeSubTasks = [&](const Task& task) {
+        for (const SubTask* subTask = task.subTasks.head; subTask; subTask = subTask->next) {
+            SnapshotSubTaskRecord record = {};
+            record.name = strings.add(subTask->name);
+            record.comments = strings.add(subTask->comments);
+            record.progress = subTask->progress;
+            record.completed = subTask->completed;
+            writer.write(record);
+        }
+    };
+    for (const Person* person : persons) {
+        for (const Task* task = person->activeTasks.head; task; task = task->next) writeSubTasks(*task);
+        if (person->completedTasks.getSubTaskCount() > 0) person->completedTasks.forEach(writeSubTasks);
+    }
+    writer.endSection();
+
+    writer.write(strings.bytes.data(), strings.bytes.size());
+    header.stringBytes = strings.bytes.size();
+    header.checksum = writer.checksum;
+    file.writeAt(0, &header, sizeof(header));
+
+    return {header.typeCount, header.personCount, header.taskCount, header.subTaskCount, file.getOffset(), lastLsn};
+}
+
+/**
+ * @brief Guarda todas las personas, tipos de tarea, tareas y subtareas en una instantánea binaria.
+ *
+ * El archivo se escribe en una ruta temporal y se renombra sobre `path` solo después de sincronizarlo con el
+ * disco, por lo que una instantánea anterior nunca queda a medio escribir.
+ *
+ * @param path Ruta del archivo.
+ * @param people Lista de personas.
+ * @param taskTypes Lista de tipos de tarea.
+ * @param lastLsn LSN de la última mutación incluida en los datos.
+ * @param bytesPerSecond Límite de velocidad de escritura, o 0 para escribir sin límite.
+ * @return Cantidades guardadas y tamaño del archivo.
+ * @throws runtime_error Si el archivo no se puede escribir.
+ * @author fabian
+ */
+SnapshotSummary saveSnapshot(const string& path, const PersonList& people, const TaskTypeList& taskTypes,
+                             const uint64_t lastLsn, const uint64_t bytesPerSecond) {
+    vector<const Person*> persons;
+    persons.reserve(people.getLength());
+    for (const Person* person = people.head; person; person = person->next) persons.push_back(person);
+    return saveSnapshot(path, persons, taskTypes, lastLsn, bytesPerSecond);
+}
+
+/**
+ * @brief Guarda las personas indicadas, con todos los tipos de tarea, en una instantánea binaria.
+ *
+ * Se usa cuando las personas están repartidas en varias listas, como los fragmentos de un ShardedEngine.
+ *
+ * @param path Ruta del archivo.
+ * @param persons Personas, en orden de cédula.
+ * @param taskTypes Lista de tipos de tarea.
+ * @param lastLsn LSN de la última mutación incluida en los datos.
+ * @param bytesPerSecond Límite de velocidad de escritura, o 0 para escribir sin límite.
+ * @return Cantidades guardadas y tamaño del archivo.
+ * @throws runtime_error Si el archivo no se puede escribir.
+ * @author fabian
+ */
+SnapshotSummary saveSnapshot(const string& path, const vector<const Person*>& persons, const TaskTypeList& taskTypes,
+                             const uint64_t lastLsn, const uint64_t bytesPerSecond) {
+    vector<const TaskType*> types;
+    if (TaskType* type = taskTypes.head) {
+        do {
+            types.push_back(type);
+            type = type->next;
+        } while (type && type != taskTypes.head);
+    }
+
+    FileWriter file(path);
+    file.setRateLimit(bytesPerSecond);
+    const SnapshotSummary summary = writeSnapshot(file, persons, types, lastLsn);
+    file.commit();
+    return summary;
+}
+
+/**
+ * @brief Escribe una instantánea en memoria, por ejemplo en un segmento de memoria compartida.
+ *
+ * @param buffer Inicio del espacio donde se escribe.
+ * @param capacity Tamaño del espacio en bytes.
+ * @param persons Personas, en orden de cédula.
+ * @param types Tipos de tarea, en el orden de la lista.
+ * @param lastLsn LSN de la última mutación incluida en los datos.
+ * @return Cantidades escritas y tamaño de la instantánea.
+ * @throws runtime_error Si la instantánea no cabe en el espacio.
+ * @author fabian
+ */
+SnapshotSummary writeSnapshotImage(char* buffer, const uint64_t capacity, const vector<const Person*>& persons,
+                                   const vector<const TaskType*>& types, const uint64_t lastLsn) {
+    SnapshotBuffer sink{buffer, capacity};
+    return writeSnapshot(sink, persons, types, lastLsn);
+}
+
+/**
+ * @brief Vista de solo lectura sobre una instantánea mapeada en memoria.
+ */
+struct SnapshotView {
+    const char* base;
+    SnapshotHeader header;
+    SnapshotLayout layout;
+
+    template <class Record>
+    [[nodiscard]] const Record* section(const uint64_t offset) const {
+        return reinterpret_cast<const Record*>(this->base + offset);
+    }
+
+    [[nodiscard]] string text(const SnapshotStringRef& ref) const {
+        if (static_cast<uint64_t>(ref.offset) + ref.length > this->header.stringBytes) {
+            throw runtime_error("Instantanea corrupta: cadena fuera de la tabla");
+        }
+        return {this->base + this->layout.strings + ref.offset, ref.length};
+    }
+};
+
+/**
+ * @brief Reconstruye las tareas activas y el archivo de tareas completadas de una persona a partir de sus registros.
+ *
+ * Las tareas se enlazan o se comprimen en el mismo orden en que se guardaron, en tiempo lineal y sin interpretar
+ * fechas.
+ *
+ * @param view Instantánea mapeada.
+ * @param record Registro de la persona.
+ * @param person Persona a llenar.
+ * @param types Tipos de tarea en el orden del archivo.
+ * @throws runtime_error Si algún registro hace referencia a datos inexistentes.
+ * @author fabian
+ */
+static void loadPersonTasks(const SnapshotView& view, const SnapshotPersonRecord& record, Person* person,
+                            const vector<TaskType*>& types) {
+    const auto* tasks = view.section<SnapshotTaskRecord>(view.layout.tasks) + record.firstTask;
+    const auto* subTasks = view.section<SnapshotSubTaskRecord>(view.layout.subTasks);
+    uint64_t nextSubTask = record.firstSubTask;
+
+    Task* last = nullptr;
+    for (uint32_t i = 0; i < record.activeCount + record.completedCount; i++) {
+        const SnapshotTaskRecord& taskRecord = *tasks++;
+        if (taskRecord.typeIndex < 0 || static_cast<size_t>(taskRecord.typeIndex) >= types.size()) {
+            throw runtime_error("Instantanea corrupta: tipo de tarea inexistente");
+        }
+        if (nextSubTask + taskRecord.subTaskCount > view.header.subTaskCount) {
+            throw runtime_error("Instantanea corrupta: subtarea fuera de la seccion");
+        }
+
+        tm date = {};
+        date.tm_year = taskRecord.year;
+        date.tm_mon = taskRecord.month;
+        date.tm_mday = taskRecord.day;
+        fillDateFields(date);
+        tm time = {};
+        time.tm_hour = taskRecord.hour;
+        time.tm_min = taskRecord.minute;
+        time.tm_sec = taskRecord.second;
+
+        auto* task = new Task(taskRecord.id, view.text(taskRecord.description), view.text(taskRecord.importance),
+                              date, time, types[taskRecord.typeIndex]);
+
+        SubTask* lastSubTask = nullptr;
+        for (uint32_t j = 0; j < taskRecord.subTaskCount; j++) {
+            const SnapshotSubTaskRecord& subTaskRecord = subTasks[nextSubTask++];
+            auto* subTask = new SubTask(view.text(subTaskRecord.name), view.text(subTaskRecord.comments),
+                                        subTaskRecord.progress);
+            subTask->completed = subTaskRecord.completed;
+            lastSubTask = task->subTasks.insertAfter(lastSubTask, subTask);
+            task->countSubTask(*subTask);
+        }
+
+        if (i < record.activeCount) {
+            last = person->activeTasks.insertAfter(last, task);
+            continue;
+        }
+        person->completedTasks.append(*task);
+        while (SubTask* subTask = task->subTasks.head) {
+            task->subTasks.head = subTask->next;
+            delete subTask;
+        }
+        delete task;
+    }
+}
+
+/**
+ * @brief Carga una instantánea binaria en listas vacías.
+ *
+ * Mapea el archivo en memoria, verifica el encabezado, el tamaño y el CRC, y reconstruye las listas directamente
+ * desde los registros de tamaño fijo, sin interpretar texto. Las personas se insertan en orden; las tareas y
+ * subtareas de cada persona se reconstruyen en paralelo con el pool de hilos.
+ *
+ * @param path Ruta del archivo.
+ * @param people Lista de personas, que debe estar vacía.
+ * @param taskTypes Lista de tipos de tarea, que debe estar vacía.
+ * @param pool Pool de hilos para la reconstrucción.
+ * @return Cantidades cargadas y tamaño del archivo.
+ * @throws runtime_error Si el archivo no existe, no es una instantánea, tiene otra versión o está corrupto.
+ * @author fabian
+ */
+SnapshotSummary loadSnapshot(const string& path, PersonList& people, TaskTypeList& taskTypes, ThreadPool& pool) {
+    if (people.head || taskTypes.head) throw runtime_error("La instantanea solo se puede cargar en listas vacias");
+
+    const MappedFile file(path);
+    if (file.size() < offsetof(SnapshotHeader, lastLsn)) throw runtime_error("Instantanea corrupta: archivo incompleto");
+
+    SnapshotHeader header = {};
+    memcpy(&header, file.data(), offsetof(SnapshotHeader, lastLsn));
+    if (memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) throw runtime_error(path + " no es una instantanea");
+    if (header.version != 1 && header.version != SNAPSHOT_VERSION) {
+        throw runtime_error("Version de instantanea no soportada: " + to_string(header.version));
+    }
+
+    const uint64_t headerSize = header.version == 1 ? offsetof(SnapshotHeader, lastLsn) : sizeof(SnapshotHeader);
+    if (file.size() < headerSize) throw runtime_error("Instantanea corrupta: archivo incompleto");
+    memcpy(&header, file.data(), headerSize);
+
+    const SnapshotLayout layout(header, headerSize);
+    if (layout.end != file.size()) throw runtime_error("Instantanea corrupta: tamano incorrecto");
+    if (crc32c(0, file.data() + headerSize, file.size() - headerSize) != header.checksum) {
+        throw runtime_error("Instantanea corrupta: el CRC no coincide");
+    }
+
+    const SnapshotView view{file.data(), header, layout};
+
+    const auto* typeRecords = view.section<SnapshotTaskTypeRecord>(layout.types);
+    for (uint64_t i = 0; i < header.typeCount; i++) {
+        taskTypes.insert(view.text(typeRecords[i].name), view.text(typeRecords[i].description));
+    }
+    vector<TaskType*> types;
+    types.reserve(header.typeCount);
+    for (uint64_t i = 0; i < header.typeCount; i++) {
+        types.push_back(i == 0 ? taskTypes.head : types.back()->next);
+    }
+
+    const auto* personRecords = view.section<SnapshotPersonRecord>(layout.persons);
+    vector<Person*> persons(header.personCount);
+    for (uint64_t i = 0; i < header.personCount; i++) {
+        const SnapshotPersonRecord& record = personRecords[i];
+        const uint64_t taskCount = static_cast<uint64_t>(record.activeCount) + record.completedCount;
+        if (record.firstTask + taskCount > header.taskCount || record.firstSubTask > header.subTaskCount) {
+            throw runtime_error("Instantanea corrupta: tarea fuera de la seccion");
+        }
+        try {
+            persons[i] = people.insert(record.id, view.text(record.name), view.text(record.lastname), record.age);
+        } catch (const runtime_error&) {
+            throw;
+        } catch (const exception&) {
+            throw runtime_error("Instantanea corrupta: cedula repetida");
+        }
+    }
+
+    const int chunkCount = static_cast<int>(min<uint64_t>(header.personCount, pool.getThreadCount() * 8ULL));
+    pool.parallelFor(chunkCount, [&](const int chunk) {
+        const uint64_t begin = header.personCount * chunk / chunkCount;
+        const uint64_t end = header.personCount * (chunk + 1) / chunkCount;
+        for (uint64_t i = begin; i < end; i++) loadPersonTasks(view, personRecords[i], persons[i], types);
+    });
+
+    return {header.typeCount, header.personCount, header.taskCount, header.subTaskCount, file.size(), header.lastLsn};
+}
+
+/**
+ * @brief Constructor de la clase SnapshotImage. Verifica el encabezado y que todas las secciones quepan.
+ *
+ * @param data Inicio de la instantánea, alineado a 8 bytes.
+ * @param size Bytes disponibles desde `data`.
+ * @throws runtime_error Si no es una instantánea de la versión actual o sus secciones no caben en `size`.
+ * @author fabian
+ */
+SnapshotImage::SnapshotImage(const char* data, const uint64_t size) : data(data) {
+    if (size < sizeof(SnapshotHeader)) throw runtime_error("Instantanea corrupta: archivo incompleto");
+    memcpy(&this->header, data, sizeof(SnapshotHeader));
+    if (memcmp(this->header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 ||
+        this->header.version != SNAPSHOT_VERSION) {
+        throw runtime_error("La imagen no es una instantanea de la version actual");
+    }
+
+    constexpr uint64_t limit = UINT64_MAX / 64;
+    if (this->header.typeCount > limit || this->header.personCount > limit || this->header.taskCount > limit ||
+        this->header.subTaskCount > limit || this->header.stringBytes > limit) {
+        throw runtime_error("Instantanea corrupta: tamano incorrecto");
+    }
+    const SnapshotLayout layout(this->header, sizeof(SnapshotHeader));
+    if (layout.end > size) throw runtime_error("Instantanea corrupta: tamano incorrecto");
+    this->types = layout.types;
+    this->persons = layout.persons;
+    this->tasks = layout.tasks;
+    this->subTasks = layout.subTasks;
+    this->strings = layout.strings;
+}
+
+/**
+ * @brief Obtiene el encabezado de la instantánea.
+ *
+ * @return El encabezado, copiado al construir la vista.
+ * @author fabian
+ */
+const SnapshotHeader& SnapshotImage::getHeader() const { return this->header; }
+
+/**
+ * @brief Copia un registro de una sección revisando que el índice esté dentro de ella.
+ *
+ * @param section Desplazamiento de la sección.
+ * @param index Índice del registro.
+ * @param count Cantidad de registros de la sección.
+ * @return Copia del registro.
+ * @throws runtime_error Si el índice está fuera de la sección.
+ * @author fabian
+ */
+template <class Record>
+Record SnapshotImage::record(const uint64_t section, const uint64_t index, const uint64_t count) const {
+    if (index >= count) throw runtime_error("Instantanea corrupta: registro fuera de la seccion");
+    Record value;
+    memcpy(&value, this->data + section + index * sizeof(Record), sizeof(Record));
+    return value;
+}
+
+/**
+ * @brief Obtiene un tipo de tarea por su posición.
+ * @author fabian
+ */
+SnapshotTaskTypeRecord SnapshotImage::type(const uint64_t index) const {
+    return record<SnapshotTaskTypeRecord>(this->types, index, this->header.typeCount);
+}
+
+/**
+ * @brief Obtiene una persona por su posición; las personas están en orden de cédula.
+ * @author fabian
+ */
+SnapshotPersonRecord SnapshotImage::person(const uint64_t index) const {
+    return record<SnapshotPersonRecord>(this->persons, index, this->header.personCount);
+}
+
+/**
+ * @brief Obtiene una tarea por su posición en la sección de tareas.
+ * @author fabian
+ */
+SnapshotTaskRecord SnapshotImage::task(const uint64_t index) const {
+    return record<SnapshotTaskRecord>(this->tasks, index, this->header.taskCount);
+}
+
+/**
+ * @brief Obtiene una subtarea por su posición en la sección de subtareas.
+ * @author fabian
+ */
+SnapshotSubTaskRecord SnapshotImage::subTask(const uint64_t index) const {
+    return record<SnapshotSubTaskRecord>(this->subTasks, index, this->header.subTaskCount);
+}
+
+/**
+ * @brief Obtiene una cadena de la tabla de cadenas, sin copiarla.
+ *
+ * @param ref Posición y longitud de la cadena.
+ * @return La cadena; es válida mientras lo sea la memoria de la imagen.
+ * @throws runtime_error Si la cadena está fuera de la tabla.
+ * @author fabian
+ */
+string_view SnapshotImage::text(const SnapshotStringRef& ref) const {
+    if (static_cast<uint64_t>(ref.offset) + ref.length > this->header.stringBytes) {
+        throw runtime_error("Instantanea corrupta: cadena fuera de la tabla");
+    }
+    return {this->data + this->strings + ref.offset, ref.length};
+}
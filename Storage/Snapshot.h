@@ -0,0 +1,149 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Lists/PersonList.h"
+#include "../Lists/TaskTypeList.h"
+#include "../utils/DateTime.h"
+#include "../utils/ThreadPool.h"
+#include "Checksum.h"
+#include "File.h"
+
+/**
+ * @brief Formato binario de las instantáneas del gestor de tareas.
+ *
+ * El archivo empieza con un SnapshotHeader y sigue con las secciones de tipos de tarea, personas, tareas y
+ * subtareas, cada una formada por registros de tamaño fijo y alineada a 8 bytes, y termina con la tabla de
+ * cadenas. Los registros se refieren a las cadenas con un desplazamiento y una longitud dentro de la tabla.
+ * Las tareas de cada persona (primero las activas y luego las completadas) son contiguas, igual que las
+ * subtareas de cada tarea. Los enteros se guardan en el orden de bytes del equipo (little-endian en x86 y ARM).
+ *
+ * Desde la versión 2 el encabezado incluye `lastLsn`, el LSN de la última mutación del registro de mutaciones que
+ * ya está incluida en la instantánea. Las instantáneas de la versión 1 tienen un encabezado de 64 bytes, sin ese
+ * campo, y se siguen pudiendo cargar.
+ */
+constexpr char SNAPSHOT_MAGIC[8] = {'T', 'A', 'S', 'K', 'S', 'N', 'A', 'P'};
+constexpr uint32_t SNAPSHOT_VERSION = 2;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t checksum;
+    uint64_t createdAt;
+    uint64_t typeCount;
+    uint64_t personCount;
+    uint64_t taskCount;
+    uint64_t subTaskCount;
+    uint64_t stringBytes;
+    uint64_t lastLsn;
+};
+
+struct SnapshotStringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct SnapshotTaskTypeRecord {
+    int32_t id;
+    SnapshotStringRef name;
+    SnapshotStringRef description;
+};
+
+struct SnapshotPersonRecord {
+    int32_t id;
+    int32_t age;
+    SnapshotStringRef name;
+    SnapshotStringRef lastname;
+    uint32_t activeCount;
+    uint32_t completedCount;
+    uint64_t firstTask;
+    uint64_t firstSubTask;
+};
+
+struct SnapshotTaskRecord {
+    int32_t id;
+    int32_t typeIndex;
+    SnapshotStringRef description;
+    SnapshotStringRef importance;
+    int16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint8_t reserved;
+    uint32_t subTaskCount;
+};
+
+struct SnapshotSubTaskRecord {
+    SnapshotStringRef name;
+    SnapshotStringRef comments;
+    float progress;
+    uint8_t completed;
+    uint8_t reserved[3];
+};
+
+static_assert(sizeof(SnapshotHeader) == 72 && sizeof(SnapshotPersonRecord) == 48 && sizeof(SnapshotTaskRecord) == 36,
+              "El formato de la instantánea depende del tamaño exacto de los registros");
+
+/**
+ * @brief Cantidades de elementos y bytes de una instantánea guardada o cargada.
+ */
+struct SnapshotSummary {
+    uint64_t taskTypes = 0;
+    uint64_t persons = 0;
+    uint64_t tasks = 0;
+    uint64_t subTasks = 0;
+    uint64_t bytes = 0;
+    uint64_t lastLsn = 0;
+};
+
+/**
+ * @brief Vista de solo lectura sobre una instantánea en memoria, que se consulta sin reconstruir las listas.
+ *
+ * Todos los accesos revisan que el índice o la cadena estén dentro de su sección, así que una imagen a medio
+ * escribir (ver `SharedDatasetReader`) produce como mucho una excepción, nunca un acceso fuera de la memoria. Los
+ * registros se devuelven por copia por la misma razón. No verifica el CRC: la imagen se lee mientras está en uso.
+ */
+class SnapshotImage {
+public:
+    SnapshotImage(const char* data, uint64_t size);
+
+    [[nodiscard]] const SnapshotHeader& getHeader() const;
+    [[nodiscard]] SnapshotTaskTypeRecord type(uint64_t index) const;
+    [[nodiscard]] SnapshotPersonRecord person(uint64_t index) const;
+    [[nodiscard]] SnapshotTaskRecord task(uint64_t index) const;
+    [[nodiscard]] SnapshotSubTaskRecord subTask(uint64_t index) const;
+    [[nodiscard]] string_view text(const SnapshotStringRef& ref) const;
+
+private:
+    const char* data;
+    SnapshotHeader header = {};
+    uint64_t types = 0;
+    uint64_t persons = 0;
+    uint64_t tasks = 0;
+    uint64_t subTasks = 0;
+    uint64_t strings = 0;
+
+    template <class Record>
+    [[nodiscard]] Record record(uint64_t section, uint64_t index, uint64_t count) const;
+};
+
+SnapshotSummary saveSnapshot(const string& path, const PersonList& people, const TaskTypeList& taskTypes,
+                             uint64_t lastLsn = 0, uint64_t bytesPerSecond = 0);
+SnapshotSummary saveSnapshot(const string& path, const vector<const Person*>& persons, const TaskTypeList& taskTypes,
+                             uint64_t lastLsn = 0, uint64_t bytesPerSecond = 0);
+SnapshotSummary loadSnapshot(const string& path, PersonList& people, TaskTypeList& taskTypes, ThreadPool& pool);
+SnapshotSummary writeSnapshotImage(char* buffer, uint64_t capacity, const vector<const Person*>& persons,
+                                   const vector<const TaskType*>& types, uint64_t lastLsn);
+
+#include "Snapshot.cpp"
+#endif //SNAPSHOT_H
@@ -0,0 +1,590 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "TaskTree.h"
+
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+/**
+ * @brief Constructor de la clase TaskTree. Crea el archivo de páginas vacío.
+ *
+ * @param path Ruta del archivo de páginas.
+ * @param cacheBytes Memoria para el pool de páginas.
+ * @throws runtime_error Si el archivo no se puede crear.
+ * @author fabian
+ */
+TaskTree::TaskTree(const string& path, const size_t cacheBytes) : pool(path, cacheBytes / BufferPool::PAGE_SIZE) {}
+
+/**
+ * @brief Codifica una clave en 16 bytes que se ordenan con `memcmp` igual que sus campos.
+ *
+ * @param key Clave.
+ * @return Los bytes de la clave.
+ * @author fabian
+ */
+TaskTree::EncodedKey TaskTree::encode(const TaskTreeKey& key) {
+    const uint32_t owner = static_cast<uint32_t>(key.owner) ^ 0x80000000u;
+    const uint64_t due = static_cast<uint64_t>(key.dueKey) ^ (uint64_t{1} << 63);
+    const uint32_t task = static_cast<uint32_t>(key.taskId) ^ 0x80000000u;
+
+    EncodedKey bytes;
+    for (int i = 0; i < 4; i++) bytes[i] = static_cast<uint8_t>(owner >> (24 - 8 * i));
+    for (int i = 0; i < 8; i++) bytes[4 + i] = static_cast<uint8_t>(due >> (56 - 8 * i));
+    for (int i = 0; i < 4; i++) bytes[12 + i] = static_cast<uint8_t>(task >> (24 - 8 * i));
+    return bytes;
+}
+
+/**
+ * @brief Decodifica los 16 bytes de una clave.
+ *
+ * @param key Bytes de la clave.
+ * @return La clave.
+ * @author fabian
+ */
+TaskTreeKey TaskTree::decode(const uint8_t* key) {
+    uint32_t owner = 0;
+    uint64_t due = 0;
+    uint32_t task = 0;
+    for (int i = 0; i < 4; i++) owner = owner << 8 | key[i];
+    for (int i = 0; i < 8; i++) due = due << 8 | key[4 + i];
+    for (int i = 0; i < 4; i++) task = task << 8 | key[12 + i];
+    return TaskTreeKey{static_cast<int32_t>(owner ^ 0x80000000u), static_cast<int64_t>(due ^ (uint64_t{1} << 63)),
+                       static_cast<int32_t>(task ^ 0x80000000u)};
+}
+
+/**
+ * @brief Obtiene el encabezado de una página.
+ *
+ * @param page Bytes de la página.
+ * @return El encabezado.
+ * @author fabian
+ */
+TaskTree::PageHeader& TaskTree::header(char* page) {
+    return *reinterpret_cast<PageHeader*>(page);
+}
+
+/**
+ * @brief Obtiene el arreglo de desplazamientos de los registros de una página, ordenado por clave.
+ *
+ * @param page Bytes de la página.
+ * @return El arreglo, que sigue al encabezado.
+ * @author fabian
+ */
+uint16_t* TaskTree::slots(char* page) {
+    return reinterpret_cast<uint16_t*>(page + sizeof(PageHeader));
+}
+
+/**
+ * @brief Obtiene un registro de una página: el resto de la clave sin el prefijo, seguido de su contenido.
+ *
+ * El contenido es la longitud del valor (2 bytes) y el valor en las hojas, y el hijo (4 bytes) en los nodos internos.
+ *
+ * @param page Bytes de la página.
+ * @param slot Posición del registro en el arreglo de desplazamientos.
+ * @return Puntero al registro.
+ * @author fabian
+ */
+uint8_t* TaskTree::record(char* page, const uint16_t slot) {
+    return reinterpret_cast<uint8_t*>(page) + slots(page)[slot];
+}
+
+/**
+ * @brief Calcula el tamaño de un registro de una página.
+ *
+ * @param page Bytes de la página.
+ * @param slot Posición del registro.
+ * @return Bytes del registro.
+ * @author fabian
+ */
+size_t TaskTree::recordSize(char* page, const uint16_t slot) {
+    const size_t suffix = KEY_SIZE - header(page).prefixLength;
+    if (!header(page).leaf) return suffix + sizeof(uint32_t);
+    uint16_t length;
+    memcpy(&length, record(page, slot) + suffix, sizeof(length));
+    return suffix + sizeof(length) + length;
+}
+
+/**
+ * @brief Calcula el espacio libre entre el arreglo de desplazamientos y los registros.
+ *
+ * @param page Bytes de la página.
+ * @return Bytes libres.
+ * @author fabian
+ */
+size_t TaskTree::freeSpace(char* page) {
+    const PageHeader& pageHeader = header(page);
+    return pageHeader.heapStart - sizeof(PageHeader) - pageHeader.count * sizeof(uint16_t);
+}
+
+/**
+ * @brief Reconstruye la clave completa de un registro, con el prefijo de la página.
+ *
+ * @param page Bytes de la página.
+ * @param slot Posición del registro.
+ * @param key Destino de los 16 bytes.
+ * @author fabian
+ */
+void TaskTree::fullKey(char* page, const uint16_t slot, uint8_t* key) {
+    const PageHeader& pageHeader = header(page);
+    memcpy(key, pageHeader.prefix, pageHeader.prefixLength);
+    memcpy(key + pageHeader.prefixLength, record(page, slot), KEY_SIZE - pageHeader.prefixLength);
+}
+
+/**
+ * @brief Busca la posición del primer registro con clave mayor o igual que otra.
+ *
+ * Compara primero el prefijo de la página: si difiere, la clave va antes o después de todos los registros. Si no,
+ * la búsqueda binaria solo compara el resto de las claves.
+ *
+ * @param page Bytes de la página.
+ * @param key Clave buscada.
+ * @return Posición en el arreglo de desplazamientos.
+ * @author fabian
+ */
+uint16_t TaskTree::lowerBound(char* page, const EncodedKey& key) {
+    const PageHeader& pageHeader = header(page);
+    const int prefixOrder = memcmp(pageHeader.prefix, key.data(), pageHeader.prefixLength);
+    if (prefixOrder > 0) return 0;
+    if (prefixOrder < 0) return pageHeader.count;
+
+    const size_t suffix = KEY_SIZE - pageHeader.prefixLength;
+    uint16_t low = 0;
+    uint16_t high = pageHeader.count;
+    while (low < high) {
+        const uint16_t middle = (low + high) / 2;
+        if (memcmp(record(page, middle), key.data() + pageHeader.prefixLength, suffix) < 0) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+/**
+ * @brief Busca la posición del primer registro con clave mayor que otra.
+ *
+ * @param page Bytes de la página.
+ * @param key Clave buscada.
+ * @return Posición en el arreglo de desplazamientos.
+ * @author fabian
+ */
+uint16_t TaskTree::upperBound(char* page, const EncodedKey& key) {
+    const PageHeader& pageHeader = header(page);
+    const int prefixOrder = memcmp(pageHeader.prefix, key.data(), pageHeader.prefixLength);
+    if (prefixOrder > 0) return 0;
+    if (prefixOrder < 0) return pageHeader.count;
+
+    const size_t suffix = KEY_SIZE - pageHeader.prefixLength;
+    uint16_t low = 0;
+    uint16_t high = pageHeader.count;
+    while (low < high) {
+        const uint16_t middle = (low + high) / 2;
+        if (memcmp(record(page, middle), key.data() + pageHeader.prefixLength, suffix) <= 0) low = middle + 1;
+        else high = middle;
+    }
+    return low;
+}
+
+/**
+ * @brief Obtiene un hijo de un nodo interno.
+ *
+ * @param page Bytes del nodo.
+ * @param index 0 para el hijo de las claves menores que la primera clave, o `i + 1` para el hijo del registro `i`.
+ * @return Número de página del hijo.
+ * @author fabian
+ */
+uint32_t TaskTree::childAt(char* page, const uint16_t index) {
+    if (index == 0) return header(page).link;
+    uint32_t child;
+    memcpy(&child, record(page, index - 1) + KEY_SIZE - header(page).prefixLength, sizeof(child));
+    return child;
+}
+
+/**
+ * @brief Escoge el hijo de un nodo interno por el que se baja para una clave.
+ *
+ * @param page Bytes del nodo.
+ * @param key Clave buscada.
+ * @param after Si es true baja después de las claves iguales, para insertar; si no, antes, para buscar la primera.
+ * @return Número de página del hijo.
+ * @author fabian
+ */
+uint32_t TaskTree::childFor(char* page, const EncodedKey& key, const bool after) {
+    return childAt(page, after ? upperBound(page, key) : lowerBound(page, key));
+}
+
+/**
+ * @brief Copia todos los registros de una página, con sus claves completas.
+ *
+ * @param page Bytes de la página.
+ * @return Los registros en orden.
+ * @author fabian
+ */
+vector<TaskTree::Entry> TaskTree::readEntries(char* page) {
+    const PageHeader& pageHeader = header(page);
+    const size_t suffix = KEY_SIZE - pageHeader.prefixLength;
+    vector<Entry> result(pageHeader.count);
+    for (uint16_t slot = 0; slot < pageHeader.count; slot++) {
+        fullKey(page, slot, result[slot].key.data());
+        result[slot].payload.assign(reinterpret_cast<const char*>(record(page, slot)) + suffix,
+                                    recordSize(page, slot) - suffix);
+    }
+    return result;
+}
+
+/**
+ * @brief Reescribe una página con un rango de registros, compactada y con el prefijo común más largo.
+ *
+ * Conserva el tipo de página y el enlace. Si los registros no caben, la página no se modifica.
+ *
+ * @param page Bytes de la página.
+ * @param entries Registros ordenados.
+ * @param begin Primer registro del rango.
+ * @param end Fin del rango, sin incluir.
+ * @return false si los registros no caben en la página.
+ * @author fabian
+ */
+bool TaskTree::writeEntries(char* page, const vector<Entry>& entries, const size_t begin, const size_t end) {
+    size_t prefixLength = 0;
+    if (begin < end) {
+        while (prefixLength < KEY_SIZE && entries[begin].key[prefixLength] == entries[end - 1].key[prefixLength]) {
+            prefixLength++;
+        }
+    }
+
+    size_t bytes = sizeof(PageHeader);
+    for (size_t i = begin; i < end; i++) {
+        bytes += sizeof(uint16_t) + KEY_SIZE - prefixLength + entries[i].payload.size();
+    }
+    if (bytes > BufferPool::PAGE_SIZE) return false;
+
+    PageHeader& pageHeader = header(page);
+    pageHeader.prefixLength = static_cast<uint8_t>(prefixLength);
+    if (begin < end) memcpy(pageHeader.prefix, entries[begin].key.data(), prefixLength);
+    pageHeader.count = static_cast<uint16_t>(end - begin);
+    pageHeader.heapStart = BufferPool::PAGE_SIZE;
+    for (size_t i = begin; i < end; i++) {
+        const size_t suffix = KEY_SIZE - prefixLength;
+        pageHeader.heapStart -= static_cast<uint16_t>(suffix + entries[i].payload.size());
+        memcpy(page + pageHeader.heapStart, entries[i].key.data() + prefixLength, suffix);
+        memcpy(page + pageHeader.heapStart + suffix, entries[i].payload.data(), entries[i].payload.size());
+        slots(page)[i - begin] = pageHeader.heapStart;
+    }
+    return true;
+}
+
+/**
+ * @brief Inserta un registro en una posición de una página.
+ *
+ * Si la clave comparte el prefijo de la página y hay espacio libre, escribe el registro y corre los
+ * desplazamientos siguientes. Si no, reescribe la página con el prefijo común nuevo y sin los huecos que dejaron
+ * los registros eliminados. Una página vacía toma la clave completa como prefijo.
+ *
+ * @param page Bytes de la página.
+ * @param position Posición del registro, que mantiene el orden.
+ * @param key Clave.
+ * @param payload Contenido del registro.
+ * @return false si el registro no cabe; en ese caso la página no se modifica.
+ * @author fabian
+ */
+bool TaskTree::insertAt(char* page, const uint16_t position, const EncodedKey& key, const string_view payload) {
+    PageHeader& pageHeader = header(page);
+    if (pageHeader.count == 0) {
+        pageHeader.prefixLength = KEY_SIZE;
+        memcpy(pageHeader.prefix, key.data(), KEY_SIZE);
+        pageHeader.heapStart = BufferPool::PAGE_SIZE;
+    }
+
+    const size_t suffix = KEY_SIZE - pageHeader.prefixLength;
+    if (memcmp(pageHeader.prefix, key.data(), pageHeader.prefixLength) == 0 &&
+        freeSpace(page) >= suffix + payload.size() + sizeof(uint16_t)) {
+        pageHeader.heapStart -= static_cast<uint16_t>(suffix + payload.size());
+        memcpy(page + pageHeader.heapStart, key.data() + pageHeader.prefixLength, suffix);
+        memcpy(page + pageHeader.heapStart + suffix, payload.data(), payload.size());
+        uint16_t* offsets = slots(page);
+        memmove(offsets + position + 1, offsets + position, (pageHeader.count - position) * sizeof(uint16_t));
+        offsets[position] = pageHeader.heapStart;
+        pageHeader.count++;
+        return true;
+    }
+
+    vector<Entry> all = readEntries(page);
+    all.insert(all.begin() + position, Entry{key, string(payload)});
+    return writeEntries(page, all, 0, all.size());
+}
+
+/**
+ * @brief Crea una página vacía del árbol.
+ *
+ * @param leaf Si es una hoja o un nodo interno.
+ * @return La página fijada.
+ * @author fabian
+ */
+PageGuard TaskTree::newPage(const bool leaf) {
+    PageGuard page = this->pool.allocate();
+    PageHeader& pageHeader = header(page.data());
+    pageHeader.leaf = leaf;
+    pageHeader.heapStart = BufferPool::PAGE_SIZE;
+    pageHeader.link = BufferPool::NO_PAGE;
+    (leaf ? this->leafPages : this->innerPages)++;
+    return page;
+}
+
+/**
+ * @brief Baja desde la raíz hasta la hoja donde está o iría una clave.
+ *
+ * @param key Clave buscada.
+ * @param after Si es true baja después de las claves iguales, para insertar; si no, antes, para buscar la primera.
+ * @param path Si no es nulo, recibe los nodos internos recorridos, desde la raíz.
+ * @return La hoja fijada, o una página vacía si el árbol no tiene páginas.
+ * @author fabian
+ */
+PageGuard TaskTree::findLeaf(const EncodedKey& key, const bool after, vector<uint32_t>* path) {
+    if (this->root == BufferPool::NO_PAGE) return {};
+    uint32_t page = this->root;
+    for (uint32_t level = 1; level < this->height; level++) {
+        const PageGuard node = this->pool.pin(page);
+        if (path) path->push_back(page);
+        page = childFor(node.data(), key, after);
+    }
+    return this->pool.pin(page);
+}
+
+/**
+ * @brief Inserta en los nodos internos el separador de una página recién dividida, dividiéndolos si hace falta.
+ *
+ * Si la raíz se divide, crea una raíz nueva y el árbol crece un nivel.
+ *
+ * @param path Nodos internos desde la raíz hasta el padre de la página dividida.
+ * @param separator Primera clave de la página nueva.
+ * @param child Página nueva, a la derecha de la dividida.
+ * @author fabian
+ */
+void TaskTree::insertSeparator(vector<uint32_t>& path, const EncodedKey& separator, const uint32_t child) {
+    EncodedKey key = separator;
+    uint32_t right = child;
+    while (!path.empty()) {
+        PageGuard parent = this->pool.pin(path.back());
+        path.pop_back();
+        char payload[sizeof(uint32_t)];
+        memcpy(payload, &right, sizeof(right));
+        const uint16_t position = upperBound(parent.data(), key);
+        parent.markDirty();
+        if (insertAt(parent.data(), position, key, string_view(payload, sizeof(payload)))) return;
+
+        vector<Entry> all = readEntries(parent.data());
+        all.insert(all.begin() + position, Entry{key, string(payload, sizeof(payload))});
+        const size_t middle = all.size() / 2;
+        PageGuard sibling = newPage(false);
+        memcpy(&header(sibling.data()).link, all[middle].payload.data(), sizeof(uint32_t));
+        writeEntries(sibling.data(), all, middle + 1, all.size());
+        writeEntries(parent.data(), all, 0, middle);
+        key = all[middle].key;
+        right = sibling.id();
+    }
+
+    PageGuard newRoot = newPage(false);
+    header(newRoot.data()).link = this->root;
+    char payload[sizeof(uint32_t)];
+    memcpy(payload, &right, sizeof(right));
+    insertAt(newRoot.data(), 0, key, string_view(payload, sizeof(payload)));
+    this->root = newRoot.id();
+    this->height++;
+}
+
+/**
+ * @brief Inserta un registro, después de los que tengan la misma clave.
+ *
+ * @param key Clave.
+ * @param value Valor, de hasta `MAX_VALUE_SIZE` bytes.
+ * @throws runtime_error Si el valor es muy grande o falla la escritura de una página.
+ * @author fabian
+ */
+void TaskTree::insert(const TaskTreeKey& key, const string_view value) {
+    if (value.size() > MAX_VALUE_SIZE) throw runtime_error("Registro demasiado grande para el arbol de tareas");
+    unique_lock guard(this->lock);
+    if (this->root == BufferPool::NO_PAGE) {
+        this->root = newPage(true).id();
+        this->height = 1;
+    }
+
+    const EncodedKey encoded = encode(key);
+    string payload(sizeof(uint16_t) + value.size(), '\0');
+    const auto length = static_cast<uint16_t>(value.size());
+    memcpy(payload.data(), &length, sizeof(length));
+    memcpy(payload.data() + sizeof(length), value.data(), value.size());
+
+    vector<uint32_t> path;
+    PageGuard leaf = findLeaf(encoded, true, &path);
+    const uint16_t position = upperBound(leaf.data(), encoded);
+    leaf.markDirty();
+    this->entries++;
+    if (insertAt(leaf.data(), position, encoded, payload)) return;
+
+    vector<Entry> all = readEntries(leaf.data());
+    all.insert(all.begin() + position, Entry{encoded, payload});
+    size_t total = 0;
+    for (const Entry& entry : all) total += KEY_SIZE + entry.payload.size();
+    size_t middle = 0;
+    for (size_t half = 0; middle + 1 < all.size() && half < total / 2; middle++) {
+        half += KEY_SIZE + all[middle].payload.size();
+    }
+    middle = max<size_t>(middle, 1);
+
+    PageGuard right = newPage(true);
+    header(right.data()).link = header(leaf.data()).link;
+    writeEntries(right.data(), all, middle, all.size());
+    header(leaf.data()).link = right.id();
+    writeEntries(leaf.data(), all, 0, middle);
+    insertSeparator(path, all[middle].key, right.id());
+}
+
+/**
+ * @brief Busca el primer registro con una clave.
+ *
+ * @param key Clave.
+ * @param value Destino del valor, si se encuentra.
+ * @return true si la clave está en el árbol.
+ * @author fabian
+ */
+bool TaskTree::find(const TaskTreeKey& key, string& value) {
+    shared_lock guard(this->lock);
+    const EncodedKey encoded = encode(key);
+    PageGuard leaf = findLeaf(encoded, false, nullptr);
+    if (!leaf.data()) return false;
+
+    uint16_t position = lowerBound(leaf.data(), encoded);
+    while (position == header(leaf.data()).count) {
+        const uint32_t next = header(leaf.data()).link;
+        if (next == BufferPool::NO_PAGE) return false;
+        leaf = this->pool.pin(next);
+        position = lowerBound(leaf.data(), encoded);
+    }
+
+    uint8_t found[KEY_SIZE];
+    fullKey(leaf.data(), position, found);
+    if (memcmp(found, encoded.data(), KEY_SIZE) != 0) return false;
+    const uint8_t* bytes = record(leaf.data(), position) + KEY_SIZE - header(leaf.data()).prefixLength;
+    uint16_t length;
+    memcpy(&length, bytes, sizeof(length));
+    value.assign(reinterpret_cast<const char*>(bytes) + sizeof(length), length);
+    return true;
+}
+
+/**
+ * @brief Elimina los registros con claves dentro de un rango.
+ *
+ * @param from Primera clave del rango.
+ * @param to Última clave del rango, incluida.
+ * @return Cantidad de registros eliminados.
+ * @throws runtime_error Si falla la lectura o escritura de una página.
+ * @author fabian
+ */
+uint64_t TaskTree::eraseRange(const TaskTreeKey& from, const TaskTreeKey& to) {
+    unique_lock guard(this->lock);
+    const EncodedKey low = encode(from);
+    const EncodedKey high = encode(to);
+    PageGuard leaf = findLeaf(low, false, nullptr);
+    if (!leaf.data()) return 0;
+
+    uint64_t removed = 0;
+    uint16_t position = lowerBound(leaf.data(), low);
+    while (true) {
+        char* page = leaf.data();
+        PageHeader& pageHeader = header(page);
+        uint16_t end = position;
+        uint8_t key[KEY_SIZE];
+        while (end < pageHeader.count) {
+            fullKey(page, end, key);
+            if (memcmp(key, high.data(), KEY_SIZE) > 0) break;
+            end++;
+        }
+        const bool finished = end < pageHeader.count;
+        if (end > position) {
+            uint16_t* offsets = slots(page);
+            memmove(offsets + position, offsets + end, (pageHeader.count - end) * sizeof(uint16_t));
+            pageHeader.count -= end - position;
+            removed += end - position;
+            leaf.markDirty();
+        }
+        if (finished || pageHeader.link == BufferPool::NO_PAGE) break;
+        const uint32_t next = pageHeader.link;
+        leaf = this->pool.pin(next);
+        position = 0;
+    }
+    this->entries -= removed;
+    return removed;
+}
+
+/**
+ * @brief Recorre en orden los registros con claves dentro de un rango.
+ *
+ * La función recibe la clave y el valor, que solo es válido durante la llamada, y no debe modificar el árbol.
+ *
+ * @param from Primera clave del rango.
+ * @param to Última clave del rango, incluida.
+ * @param callback Función `(const TaskTreeKey&, string_view)`.
+ * @return Cantidad de hojas leídas.
+ * @throws runtime_error Si falla la lectura de una página.
+ * @author fabian
+ */
+template <class Callback>
+uint64_t TaskTree::scan(const TaskTreeKey& from, const TaskTreeKey& to, Callback callback) {
+    shared_lock guard(this->lock);
+    const EncodedKey low = encode(from);
+    const EncodedKey high = encode(to);
+    PageGuard leaf = findLeaf(low, false, nullptr);
+    if (!leaf.data()) return 0;
+
+    uint64_t leaves = 0;
+    uint16_t position = lowerBound(leaf.data(), low);
+    uint8_t key[KEY_SIZE];
+    while (true) {
+        leaves++;
+        char* page = leaf.data();
+        const PageHeader& pageHeader = header(page);
+        const size_t suffix = KEY_SIZE - pageHeader.prefixLength;
+        memcpy(key, pageHeader.prefix, pageHeader.prefixLength);
+        for (; position < pageHeader.count; position++) {
+            const uint8_t* bytes = record(page, position);
+            memcpy(key + pageHeader.prefixLength, bytes, suffix);
+            if (memcmp(key, high.data(), KEY_SIZE) > 0) return leaves;
+            uint16_t length;
+            memcpy(&length, bytes + suffix, sizeof(length));
+            callback(decode(key), string_view(reinterpret_cast<const char*>(bytes) + suffix + sizeof(length), length));
+        }
+        const uint32_t next = pageHeader.link;
+        if (next == BufferPool::NO_PAGE) return leaves;
+        leaf = this->pool.pin(next);
+        position = 0;
+    }
+}
+
+/**
+ * @brief Escribe las páginas modificadas y vacía el pool y la caché del sistema, para medir lecturas en frío.
+ *
+ * @throws runtime_error Si falla la escritura de una página.
+ * @author fabian
+ */
+void TaskTree::dropCache() {
+    unique_lock guard(this->lock);
+    this->pool.evictAll();
+}
+
+/**
+ * @brief Obtiene las estadísticas del árbol.
+ *
+ * @return Registros, páginas, altura y estadísticas del pool.
+ * @author fabian
+ */
+TaskTreeStats TaskTree::getStats() {
+    shared_lock guard(this->lock);
+    TaskTreeStats stats;
+    stats.entries = this->entries;
+    stats.leafPages = this->leafPages;
+    stats.innerPages = this->innerPages;
+    stats.height = this->height;
+    stats.pool = this->pool.getStats();
+    return stats;
+}
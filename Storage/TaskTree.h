@@ -0,0 +1,134 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef TASKTREE_H
+#define TASKTREE_H
+
+#include <array>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BufferPool.h"
+
+using namespace std;
+
+/**
+ * @brief Clave de una tarea en el árbol: el archivo dueño (uno por persona), la clave de vencimiento y el ID de la
+ * tarea, en ese orden.
+ */
+struct TaskTreeKey {
+    int32_t owner;
+    int64_t dueKey;
+    int32_t taskId;
+};
+
+/**
+ * @brief Estadísticas del árbol y de su pool de páginas.
+ */
+struct TaskTreeStats {
+    uint64_t entries = 0;
+    uint64_t leafPages = 0;
+    uint64_t innerPages = 0;
+    uint32_t height = 0;
+    BufferPoolStats pool;
+};
+
+/**
+ * @brief Árbol B+ en disco de registros de tareas, con las páginas en un BufferPool.
+ *
+ * Las claves se guardan como 16 bytes en big-endian con el bit de signo invertido, de modo que compararlas con
+ * `memcmp` da el mismo orden que comparar sus campos. Cada página es una página con ranuras: un encabezado, un
+ * arreglo de desplazamientos ordenado por clave que crece hacia adelante y los registros, que crecen desde el
+ * final. Las claves de una página se guardan sin el prefijo que comparten todas, que va una sola vez en el
+ * encabezado; en las hojas de un mismo dueño ese prefijo incluye el número del dueño y la parte alta de la
+ * fecha. Las hojas están enlazadas en orden para recorrer rangos.
+ *
+ * Al eliminar, los registros se quitan de las hojas sin fusionar páginas: el espacio se recupera al reorganizar la
+ * página en la siguiente inserción que no quepa, y las hojas vacías siguen enlazadas y se reutilizan al insertar
+ * claves de su rango. Admite claves repetidas.
+ *
+ * Los recorridos toman el candado del árbol en modo compartido y las modificaciones en modo exclusivo.
+ */
+class TaskTree {
+public:
+    static constexpr size_t KEY_SIZE = 16;
+    static constexpr size_t MAX_VALUE_SIZE = 1536;
+
+    TaskTree(const string& path, size_t cacheBytes);
+
+    TaskTree(const TaskTree&) = delete;
+    TaskTree& operator=(const TaskTree&) = delete;
+
+    void insert(const TaskTreeKey& key, string_view value);
+    bool find(const TaskTreeKey& key, string& value);
+    uint64_t eraseRange(const TaskTreeKey& from, const TaskTreeKey& to);
+
+    template <class Callback>
+    uint64_t scan(const TaskTreeKey& from, const TaskTreeKey& to, Callback callback);
+
+    void dropCache();
+    [[nodiscard]] TaskTreeStats getStats();
+
+private:
+    using EncodedKey = array<uint8_t, KEY_SIZE>;
+
+    /**
+     * @brief Encabezado de una página del árbol.
+     *
+     * En las hojas `link` es la hoja siguiente; en los nodos internos, el hijo con las claves menores que la
+     * primera clave del nodo.
+     */
+    struct PageHeader {
+        uint8_t leaf;
+        uint8_t prefixLength;
+        uint16_t count;
+        uint16_t heapStart;
+        uint32_t link;
+        uint8_t prefix[KEY_SIZE];
+    };
+
+    /**
+     * @brief Registro de una página copiado fuera de ella, para reorganizarla o dividirla.
+     */
+    struct Entry {
+        EncodedKey key;
+        string payload;
+    };
+
+    BufferPool pool;
+    uint32_t root = BufferPool::NO_PAGE;
+    uint32_t height = 0;
+    uint64_t entries = 0;
+    uint64_t leafPages = 0;
+    uint64_t innerPages = 0;
+    shared_mutex lock;
+
+    static EncodedKey encode(const TaskTreeKey& key);
+    static TaskTreeKey decode(const uint8_t* key);
+
+    static PageHeader& header(char* page);
+    static uint16_t* slots(char* page);
+    static uint8_t* record(char* page, uint16_t slot);
+    static size_t recordSize(char* page, uint16_t slot);
+    static size_t freeSpace(char* page);
+    static void fullKey(char* page, uint16_t slot, uint8_t* key);
+    static uint16_t lowerBound(char* page, const EncodedKey& key);
+    static uint16_t upperBound(char* page, const EncodedKey& key);
+    static uint32_t childAt(char* page, uint16_t index);
+    static uint32_t childFor(char* page, const EncodedKey& key, bool after);
+
+    static vector<Entry> readEntries(char* page);
+    static bool writeEntries(char* page, const vector<Entry>& entries, size_t begin, size_t end);
+    static bool insertAt(char* page, uint16_t position, const EncodedKey& key, string_view payload);
+
+    PageGuard newPage(bool leaf);
+    PageGuard findLeaf(const EncodedKey& key, bool after, vector<uint32_t>* path);
+    void insertSeparator(vector<uint32_t>& path, const EncodedKey& separator, uint32_t child);
+};
+
+#include "TaskTree.cpp"
+#endif //TASKTREE_H
@@ -10,7 +10,7 @@
  *
  * Inicializa una nueva instancia de la clase `Person` con los valores especificados
  * para el identificador, nombre, apellido, y edad. También inicializa las listas de
- * tareas activas y completadas y los punteros de navegación a `nullptr`.
+ * tareas activas y el archivo de tareas completadas, y los punteros de navegación a `nullptr`.
  *
  * @param id Identificador único de la persona.
  * @param name Nombre de la persona.
@@ -26,5 +26,5 @@ Person::Person(const int id, const string & name, const string & lastname, const
     this->next = nullptr;
     this->prev = nullptr;
     this->activeTasks = TaskList();
-    this->completedTasks = TaskList();
+    this->completedTasks = TaskArchive::create();
 }
\ No newline at end of file
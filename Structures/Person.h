@@ -6,16 +6,22 @@
 #define PERSON_H
 
 #include "../Lists/TaskList.h"
+#include "../Lists/TaskArchive.h"
+#include "../utils/StringPool.h"
 
 struct Person {
     int id;
-    string name;
-    string lastname;
+    InternedString name;
+    InternedString lastname;
     int age;
     Person* next;
     Person* prev;
     TaskList activeTasks;
-    TaskList completedTasks;
+    TaskArchive completedTasks;
+    /** Está en una versión publicada de `VersionedPeople`: ya no se modifica, se copia. */
+    bool published = false;
+    /** Ya no está en la lista de personas: la última versión que la suelte la libera. */
+    bool retired = false;
 
     Person(int id, const string & name, const string & lastname, int age);
 };
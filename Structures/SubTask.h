@@ -5,12 +5,16 @@
 #ifndef SUBTASK_H
 #define SUBTASK_H
 
+#include "../utils/StringPool.h"
+
 struct SubTask {
-    string name{};
-    string comments{};
+    InternedString name{};
+    InternedString comments{};
     float progress;
     bool completed;
     SubTask *next;
+    uint32_t slot{};
+    uint32_t index{};
 
     SubTask(const string & name, const string & comments, float progress);
 };
@@ -39,54 +39,139 @@ Task::Task(const string & description, const string & importance, const string &
     setTime(time);
 }
 
+/**
+ * @brief Constructor de la clase Task a partir de una fecha y una hora ya convertidas.
+ *
+ * Se usa al reconstruir tareas desde un archivo, donde la fecha y la hora ya están validadas,
+ * para no tener que volver a interpretar cadenas.
+ *
+ * @param id Identificador de la tarea.
+ * @param description Descripción de la tarea.
+ * @param importance Nivel de importancia de la tarea.
+ * @param date Fecha de la tarea.
+ * @param time Hora de la tarea.
+ * @param type Puntero al tipo de tarea que describe la categoría de la misma.
+ * @author fabian
+ */
+Task::Task(const int id, const string & description, const string & importance, const tm & date, const tm & time, TaskType * type) {
+    this->id = id;
+    this->description = description;
+    this->importance = importance;
+    this->date = date;
+    this->time = time;
+    this->type = type;
+    this->next = nullptr;
+}
+
 /**
  * @brief Establece la fecha de la tarea a partir de una cadena.
  *
  * Convierte una cadena de texto con formato "dd-mm-YYYY" a una estructura `tm`
- * y la asigna al campo de fecha de la tarea.
+ * y la asigna al campo de fecha de la tarea. La fecha se valida con las mismas reglas
+ * que `validateDates`; si es inválida, la fecha de la tarea no cambia.
  *
  * @param date Fecha en formato "dd-mm-YYYY".
  * @throws std::runtime_error Si el formato de la fecha es incorrecto.
  * @author fabian
  */
-void Task::setDate(const string & date) {
-    istringstream dateStream(date);
-    dateStream >> get_time(&this->date, "%d-%m-%Y");
-    if (dateStream.fail()) throw runtime_error("Formato de fecha incorrecto. (dd-mm-YYYY)");
+void Task::setDate(const string_view date) {
+    if (!parseDate(date, this->date)) throw runtime_error("Formato de fecha incorrecto. (dd-mm-YYYY)");
 }
 
 /**
  * @brief Establece la hora de la tarea a partir de una cadena.
  *
  * Convierte una cadena de texto con formato "HH:MM:SS" a una estructura `tm`
- * y la asigna al campo de hora de la tarea.
+ * y la asigna al campo de hora de la tarea. Si es inválida, la hora de la tarea no cambia.
  *
  * @param time Hora en formato "HH:MM:SS".
  * @throws runtime_error Si el formato de la hora es incorrecto.
  * @author fabian
  */
-void Task::setTime(const string & time) {
-    istringstream timeStream(time);
-    timeStream >> get_time(&this->time, "%H:%M:%S");
-    if (timeStream.fail()) throw runtime_error("Formato de hora incorrecto. (HH:MM:SS)");
+void Task::setTime(const string_view time) {
+    if (!parseTime(time, this->time)) throw runtime_error("Formato de hora incorrecto. (HH:MM:SS)");
 }
 
 /**
  * @brief Obtiene la fecha de la tarea en formato "dd-mm-YYYY".
  *
- * @return Una cadena formateada con la fecha de la tarea.
+ * @return La fecha formateada, lista para imprimirse con `<<`.
  * @author fabian
  */
-[[nodiscard]] auto Task::getDate() const {
-    return put_time(&this->date, "%d-%m-%Y");
+DateTimeText Task::getDate() const {
+    return formatDate(this->date);
 }
 
 /**
  * @brief Obtiene la hora de la tarea en formato "HH:MM:SS".
  *
- * @return Una cadena formateada con la hora de la tarea.
+ * @return La hora formateada, lista para imprimirse con `<<`.
+ * @author fabian
+ */
+DateTimeText Task::getTime() const {
+    return formatTime(this->time);
+}
+
+/**
+ * @brief Suma una subtarea recién agregada al final de `subTasks` a los totales de la tarea y le asigna su índice.
+ *
+ * La tarea lleva la cantidad de subtareas completadas y la suma de sus progresos para conocer su avance sin
+ * recorrerlas; la cantidad de subtareas es la longitud de `subTasks`. Las subtareas solo se agregan al final y no
+ * se eliminan una por una, así que el índice de cada una no cambia. Quien agrega una subtarea a la lista debe
+ * llamar a esta función.
+ *
+ * @param subTask Subtarea agregada.
  * @author fabian
  */
-[[nodiscard]] auto Task::getTime() const  {
-    return put_time(&this->time, "%H:%M:%S");
-}
\ No newline at end of file
+void Task::countSubTask(SubTask& subTask) {
+    subTask.index = static_cast<uint32_t>(this->subTasks.getLength() - 1);
+    if (subTask.completed) this->completedSubTasks++;
+    this->progressSum += subTask.progress;
+}
+
+/**
+ * @brief Cambia el progreso de una de las subtareas de la tarea y actualiza los totales en tiempo constante.
+ *
+ * La subtarea queda completada si el progreso es 100, y pendiente si no.
+ *
+ * @param subTask Subtarea de la tarea.
+ * @param progress Nuevo progreso de la subtarea (0-100).
+ * @return true si la subtarea se completó con este cambio y con ella quedaron completadas todas las de la tarea.
+ * @author fabian
+ */
+bool Task::setSubTaskProgress(SubTask& subTask, const float progress) {
+    const bool wasCompleted = subTask.completed;
+    this->progressSum += static_cast<double>(progress) - subTask.progress;
+    subTask.progress = progress;
+    subTask.completed = progress == 100;
+    if (subTask.completed == wasCompleted) return false;
+
+    if (subTask.completed) this->completedSubTasks++;
+    else this->completedSubTasks--;
+    return subTask.completed && this->completedSubTasks == static_cast<uint32_t>(this->subTasks.getLength());
+}
+
+/**
+ * @brief Obtiene el avance de la tarea: el promedio del progreso de sus subtareas, sin recorrerlas.
+ *
+ * @return Avance de 0 a 100, o 0 si la tarea no tiene subtareas.
+ * @author fabian
+ */
+float Task::getProgress() const {
+    const int count = this->subTasks.getLength();
+    return count ? static_cast<float>(this->progressSum / count) : 0;
+}
+
+/**
+ * @brief Obtiene el bit de un nivel de importancia en las máscaras de importancia de los resúmenes de bloques.
+ *
+ * @param importance Nivel de importancia.
+ * @return 1 para "Alto", 2 para "Medio", 4 para "Bajo" y 8 para cualquier otro valor.
+ * @author fabian
+ */
+uint8_t importanceBit(const string_view importance) {
+    if (importance == "Alto") return 1;
+    if (importance == "Medio") return 2;
+    if (importance == "Bajo") return 4;
+    return 8;
+}
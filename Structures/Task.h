@@ -5,25 +5,40 @@
 #ifndef TASK_H
 #define TASK_H
 
+#include <string_view>
+
 #include "SubTask.h"
 #include "TaskType.h"
+#include "../utils/DateTime.h"
 
 struct Task {
     int id{};
-    string description;
+    InternedString description;
     string importance;
     tm date{};
     tm time{};
     TaskType* type{};
     List<SubTask> subTasks{};
+    uint32_t completedSubTasks{};
+    double progressSum{};
     Task* next;
+    Task* prev{};
+    uint32_t block{};
+    uint32_t slot{};
 
     Task(const string & description, const string & importance, const string & date, const string & time, TaskType * type);
-    void setDate(const string & date);
-    void setTime(const string & time);
-    [[nodiscard]] auto getDate() const;
-    [[nodiscard]] auto getTime() const;
+    Task(int id, const string & description, const string & importance, const tm & date, const tm & time, TaskType * type);
+    void setDate(string_view date);
+    void setTime(string_view time);
+    [[nodiscard]] DateTimeText getDate() const;
+    [[nodiscard]] DateTimeText getTime() const;
+
+    void countSubTask(SubTask& subTask);
+    bool setSubTaskProgress(SubTask& subTask, float progress);
+    [[nodiscard]] float getProgress() const;
 };
 
+uint8_t importanceBit(string_view importance);
+
 #include "Task.cpp"
 #endif //TASK_H
@@ -20,4 +20,18 @@ TaskType::TaskType(const int id, const string & name, const string & description
     this->name = name;
     this->description = description;
     this->next = nullptr;
+}
+
+/**
+ * @brief Obtiene el bit de un tipo de tarea en las máscaras de tipos de los resúmenes de bloques.
+ *
+ * El bit sale del hash del nombre internado, así que una consulta puede calcularlo con solo el nombre del tipo.
+ * Dos tipos pueden compartir bit; eso solo hace que se salten menos bloques.
+ *
+ * @param typeName Nombre del tipo.
+ * @return Máscara con un solo bit.
+ * @author fabian
+ */
+uint64_t taskTypeBit(const InternedString& typeName) {
+    return uint64_t{1} << (typeName.hash() & 63);
 }
\ No newline at end of file
@@ -5,14 +5,18 @@
 #ifndef TASKTYPE_H
 #define TASKTYPE_H
 
+#include "../utils/StringPool.h"
+
 struct TaskType {
     int id;
-    string name;
+    InternedString name;
     string description;
     TaskType* next;
 
     TaskType(int id, const string & name, const string & description);
 };
 
+uint64_t taskTypeBit(const InternedString& typeName);
+
 #include "TaskType.cpp"
 #endif //TASKTYPE_H
@@ -0,0 +1,289 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "DateTime.h"
+
+/**
+ * @brief Obtiene la cantidad de días de un mes, considerando los años bisiestos.
+ *
+ * @param month Mes, de 1 a 12.
+ * @param year Año completo, por ejemplo 2024.
+ * @return Cantidad de días del mes.
+ * @author fabian
+ */
+int daysInMonth(const int month, const int year) {
+    switch (month) {
+        case 4: case 6: case 9: case 11:
+            return 30;
+        case 2:
+            return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0 ? 29 : 28;
+        default:
+            return 31;
+    }
+}
+
+/**
+ * @brief Verifica que una fecha exista: el mes entre 1 y 12 y el día dentro de los días de ese mes.
+ *
+ * @param day Día del mes.
+ * @param month Mes, de 1 a 12.
+ * @param year Año completo.
+ * @return true si la fecha es válida.
+ * @author fabian
+ */
+bool isValidDate(const int day, const int month, const int year) {
+    return month >= 1 && month <= 12 && day >= 1 && day <= daysInMonth(month, year);
+}
+
+/**
+ * @brief Convierte una fecha en un número de día consecutivo, para poder restar fechas.
+ *
+ * @param date Fecha a convertir.
+ * @return Días transcurridos desde el 01-01-1970.
+ * @author fabian
+ */
+long dayNumber(const tm& date) {
+    long year = date.tm_year + 1900;
+    const long month = date.tm_mon + 1;
+    year -= month <= 2;
+    const long era = (year >= 0 ? year : year - 399) / 400;
+    const long yearOfEra = year - era * 400;
+    const long dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + date.tm_mday - 1;
+    const long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+/**
+ * @brief Mueve una fecha una cantidad de días hacia adelante o hacia atrás, cambiando de mes y de año si hace falta.
+ *
+ * Es la operación inversa de `dayNumber`; también actualiza `tm_yday` y `tm_wday`.
+ *
+ * @param date Fecha a mover.
+ * @param days Días a sumar; negativo para retroceder.
+ * @author fabian
+ */
+void addDays(tm& date, const long days) {
+    const long day = dayNumber(date) + days + 719468;
+    const long era = (day >= 0 ? day : day - 146096) / 146097;
+    const long dayOfEra = day - era * 146097;
+    const long yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const long dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const long monthIndex = (5 * dayOfYear + 2) / 153;
+    const long month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+
+    date.tm_mday = static_cast<int>(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+    date.tm_mon = static_cast<int>(month - 1);
+    date.tm_year = static_cast<int>(yearOfEra + era * 400 + (month <= 2) - 1900);
+    fillDateFields(date);
+}
+
+/**
+ * @brief Calcula el día del año (`tm_yday`) y el día de la semana (`tm_wday`) a partir del día, el mes y el año.
+ *
+ * `get_time` llena estos campos al leer una fecha, y el reporte de tareas pendientes ordena por `tm_yday`, así que
+ * toda fecha que no venga de `get_time` debe pasar por aquí.
+ *
+ * @param date Fecha con `tm_mday`, `tm_mon` y `tm_year` válidos.
+ * @author fabian
+ */
+void fillDateFields(tm& date) {
+    static const int daysBeforeMonth[] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+    static const int monthOffsets[] = {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
+
+    const int month = date.tm_mon;
+    int year = date.tm_year + 1900;
+    const bool leapYear = daysInMonth(2, year) == 29;
+    date.tm_yday = daysBeforeMonth[month] + date.tm_mday - 1 + (leapYear && month > 1 ? 1 : 0);
+
+    if (month < 2) --year;
+    date.tm_wday = (year + year / 4 - year / 100 + year / 400 + monthOffsets[month] + date.tm_mday) % 7;
+}
+
+/**
+ * @brief Lee un número de `minDigits` a `maxDigits` dígitos al inicio del texto y lo consume.
+ *
+ * @param text Texto a leer; se avanza hasta después del número.
+ * @param minDigits Mínimo de dígitos.
+ * @param maxDigits Máximo de dígitos.
+ * @param value Valor leído.
+ * @return true si había un número con esa cantidad de dígitos.
+ * @author fabian
+ */
+static bool readNumber(string_view& text, const size_t minDigits, const size_t maxDigits, int& value) {
+    size_t digits = 0;
+    value = 0;
+    while (digits < maxDigits && digits < text.size() && text[digits] >= '0' && text[digits] <= '9') {
+        value = value * 10 + (text[digits] - '0');
+        ++digits;
+    }
+    if (digits < minDigits) return false;
+    text.remove_prefix(digits);
+    return true;
+}
+
+/**
+ * @brief Consume un separador al inicio del texto.
+ *
+ * @param text Texto a leer.
+ * @param separator Carácter esperado.
+ * @return true si el texto empezaba con el separador.
+ * @author fabian
+ */
+static bool readSeparator(string_view& text, const char separator) {
+    if (text.empty() || text.front() != separator) return false;
+    text.remove_prefix(1);
+    return true;
+}
+
+/**
+ * @brief Interpreta una fecha "dd-mm-YYYY" sin usar flujos ni memoria dinámica.
+ *
+ * Acepta el día y el mes con uno o dos dígitos y valida con las mismas reglas que `validateDates`: el mes entre 1
+ * y 12 y el día dentro de los días del mes, con febrero de 29 días en los años bisiestos. Escribe `tm_mday`,
+ * `tm_mon`, `tm_year`, `tm_yday` y `tm_wday`, igual que `get_time`.
+ *
+ * @param text Texto con la fecha, sin espacios alrededor.
+ * @param date Estructura donde se guarda la fecha si es válida.
+ * @return true si la fecha es válida.
+ * @author fabian
+ */
+bool parseDate(string_view text, tm& date) {
+    int day;
+    int month;
+    int year;
+    if (!readNumber(text, 1, 2, day) || !readSeparator(text, '-') || !readNumber(text, 1, 2, month) ||
+        !readSeparator(text, '-') || !readNumber(text, 4, 4, year) || !text.empty()) {
+        return false;
+    }
+    if (!isValidDate(day, month, year)) return false;
+
+    date.tm_mday = day;
+    date.tm_mon = month - 1;
+    date.tm_year = year - 1900;
+    fillDateFields(date);
+    return true;
+}
+
+/**
+ * @brief Interpreta una hora "HH:MM:SS" sin usar flujos ni memoria dinámica.
+ *
+ * Acepta cada campo con uno o dos dígitos; la hora va de 0 a 23 y los minutos y segundos de 0 a 59. Solo escribe
+ * `tm_hour`, `tm_min` y `tm_sec`.
+ *
+ * @param text Texto con la hora, sin espacios alrededor.
+ * @param time Estructura donde se guarda la hora si es válida.
+ * @return true si la hora es válida.
+ * @author fabian
+ */
+bool parseTime(string_view text, tm& time) {
+    int hour;
+    int minute;
+    int second;
+    if (!readNumber(text, 1, 2, hour) || !readSeparator(text, ':') || !readNumber(text, 1, 2, minute) ||
+        !readSeparator(text, ':') || !readNumber(text, 1, 2, second) || !text.empty()) {
+        return false;
+    }
+    if (hour > 23 || minute > 59 || second > 59) return false;
+
+    time.tm_hour = hour;
+    time.tm_min = minute;
+    time.tm_sec = second;
+    return true;
+}
+
+/**
+ * @brief Escribe un número de dos dígitos, con cero a la izquierda.
+ *
+ * @param value Número de 0 a 99.
+ * @param buffer Donde se escriben los dos dígitos.
+ * @author fabian
+ */
+static void writeTwoDigits(const int value, char* buffer) {
+    buffer[0] = static_cast<char>('0' + value / 10 % 10);
+    buffer[1] = static_cast<char>('0' + value % 10);
+}
+
+/**
+ * @brief Escribe una fecha con el formato "dd-mm-YYYY" en un búfer, sin flujos ni memoria dinámica.
+ *
+ * @param date Fecha a escribir.
+ * @param buffer Búfer de al menos `DATE_TEXT_LENGTH + 1` caracteres; queda terminado en nulo.
+ * @return Cantidad de caracteres escritos, sin contar el nulo.
+ * @author fabian
+ */
+size_t formatDate(const tm& date, char* buffer) {
+    const int year = date.tm_year + 1900;
+    writeTwoDigits(date.tm_mday, buffer);
+    buffer[2] = '-';
+    writeTwoDigits(date.tm_mon + 1, buffer + 3);
+    buffer[5] = '-';
+    writeTwoDigits(year / 100, buffer + 6);
+    writeTwoDigits(year % 100, buffer + 8);
+    buffer[DATE_TEXT_LENGTH] = '\0';
+    return DATE_TEXT_LENGTH;
+}
+
+/**
+ * @brief Escribe una hora con el formato "HH:MM:SS" en un búfer, sin flujos ni memoria dinámica.
+ *
+ * @param time Hora a escribir.
+ * @param buffer Búfer de al menos `TIME_TEXT_LENGTH + 1` caracteres; queda terminado en nulo.
+ * @return Cantidad de caracteres escritos, sin contar el nulo.
+ * @author fabian
+ */
+size_t formatTime(const tm& time, char* buffer) {
+    writeTwoDigits(time.tm_hour, buffer);
+    buffer[2] = ':';
+    writeTwoDigits(time.tm_min, buffer + 3);
+    buffer[5] = ':';
+    writeTwoDigits(time.tm_sec, buffer + 6);
+    buffer[TIME_TEXT_LENGTH] = '\0';
+    return TIME_TEXT_LENGTH;
+}
+
+/**
+ * @brief Formatea una fecha "dd-mm-YYYY" en un valor que se puede imprimir directamente.
+ *
+ * @param date Fecha a formatear.
+ * @return La fecha formateada.
+ * @author fabian
+ */
+DateTimeText formatDate(const tm& date) {
+    DateTimeText result{};
+    result.length = formatDate(date, result.text);
+    return result;
+}
+
+/**
+ * @brief Formatea una hora "HH:MM:SS" en un valor que se puede imprimir directamente.
+ *
+ * @param time Hora a formatear.
+ * @return La hora formateada.
+ * @author fabian
+ */
+DateTimeText formatTime(const tm& time) {
+    DateTimeText result{};
+    result.length = formatTime(time, result.text);
+    return result;
+}
+
+/**
+ * @brief Obtiene el texto formateado.
+ *
+ * @return Vista al texto, sin el nulo final.
+ * @author fabian
+ */
+string_view DateTimeText::view() const { return {this->text, this->length}; }
+
+/**
+ * @brief Imprime una fecha u hora formateada.
+ *
+ * @param out Flujo de salida.
+ * @param value Texto a imprimir.
+ * @return El mismo flujo.
+ * @author fabian
+ */
+ostream& operator<<(ostream& out, const DateTimeText& value) {
+    return out.write(value.text, static_cast<streamsize>(value.length));
+}
@@ -0,0 +1,42 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef DATETIME_H
+#define DATETIME_H
+
+#include <ctime>
+#include <ostream>
+#include <string_view>
+
+using namespace std;
+
+constexpr size_t DATE_TEXT_LENGTH = 10;
+constexpr size_t TIME_TEXT_LENGTH = 8;
+
+/**
+ * @brief Fecha u hora ya formateada en un búfer fijo, para imprimirla sin memoria dinámica.
+ */
+struct DateTimeText {
+    char text[DATE_TEXT_LENGTH + 1];
+    size_t length;
+
+    [[nodiscard]] string_view view() const;
+};
+
+ostream& operator<<(ostream& out, const DateTimeText& value);
+
+int daysInMonth(int month, int year);
+bool isValidDate(int day, int month, int year);
+long dayNumber(const tm& date);
+void addDays(tm& date, long days);
+void fillDateFields(tm& date);
+bool parseDate(string_view text, tm& date);
+bool parseTime(string_view text, tm& time);
+size_t formatDate(const tm& date, char* buffer);
+size_t formatTime(const tm& time, char* buffer);
+DateTimeText formatDate(const tm& date);
+DateTimeText formatTime(const tm& time);
+
+#include "DateTime.cpp"
+#endif //DATETIME_H
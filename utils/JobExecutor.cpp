@@ -0,0 +1,280 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "JobExecutor.h"
+
+#include <algorithm>
+#include <exception>
+
+/**
+ * @brief Constructor de la clase Job.
+ *
+ * @param id Número del trabajo, único en su ejecutor.
+ * @param name Nombre que se muestra al usuario.
+ * @author fabian
+ */
+Job::Job(const uint64_t id, string name) : id(id), name(std::move(name)) {}
+
+/**
+ * @brief Obtiene el número del trabajo.
+ *
+ * @return Número asignado por el ejecutor, empezando en 1.
+ * @author fabian
+ */
+uint64_t Job::getId() const { return this->id; }
+
+/**
+ * @brief Obtiene el nombre del trabajo.
+ *
+ * @return Nombre del trabajo.
+ * @author fabian
+ */
+const string& Job::getName() const { return this->name; }
+
+/**
+ * @brief Obtiene el estado y el avance del trabajo.
+ *
+ * @return Avance en el momento de la llamada.
+ * @author fabian
+ */
+JobProgress Job::getProgress() const {
+    JobProgress progress;
+    progress.state = this->state.load(memory_order_acquire);
+    progress.done = this->done.load(memory_order_relaxed);
+    progress.total = this->total.load(memory_order_relaxed);
+    lock_guard guard(this->lock);
+    progress.rows = this->rows.size();
+    return progress;
+}
+
+/**
+ * @brief Copia las filas emitidas a partir de una posición, para mostrarlas a medida que llegan.
+ *
+ * Si el estado ya era final al consultarlo, las filas obtenidas después son todas las del trabajo.
+ *
+ * @param first Cantidad de filas que ya se leyeron.
+ * @param limit Cantidad máxima de filas a copiar.
+ * @return Las filas emitidas desde `first`, en orden.
+ * @author fabian
+ */
+vector<string> Job::getRows(const size_t first, const size_t limit) const {
+    lock_guard guard(this->lock);
+    if (first >= this->rows.size()) return {};
+    const size_t last = this->rows.size() - first > limit ? first + limit : this->rows.size();
+    return {this->rows.begin() + static_cast<long>(first), this->rows.begin() + static_cast<long>(last)};
+}
+
+/**
+ * @brief Obtiene el resultado publicado por el trabajo.
+ *
+ * @return El resultado final si terminó o el parcial más reciente si sigue ejecutándose o se canceló.
+ * @author fabian
+ */
+string Job::getResult() const {
+    lock_guard guard(this->lock);
+    return this->result;
+}
+
+/**
+ * @brief Obtiene el error de un trabajo fallido.
+ *
+ * @return Mensaje de la excepción que terminó el trabajo, o vacío si no falló.
+ * @author fabian
+ */
+string Job::getError() const {
+    lock_guard guard(this->lock);
+    return this->error;
+}
+
+/**
+ * @brief Indica si el trabajo ya no va a cambiar.
+ *
+ * @return true si terminó, se canceló o falló.
+ * @author fabian
+ */
+bool Job::isDone() const {
+    const JobState current = this->state.load(memory_order_acquire);
+    return current != JobState::Queued && current != JobState::Running;
+}
+
+/**
+ * @brief Pide cancelar el trabajo. Si todavía no empezó, no se ejecuta; si se está ejecutando, termina en cuanto
+ * revise `isCancelled()`.
+ * @author fabian
+ */
+void Job::cancel() {
+    this->cancelRequested.store(true, memory_order_release);
+}
+
+/**
+ * @brief Espera, sin consumir CPU, a que el trabajo termine, se cancele o falle.
+ * @author fabian
+ */
+void Job::wait() const {
+    unique_lock guard(this->lock);
+    this->finished.wait(guard, [this] { return this->isDone(); });
+}
+
+/**
+ * @brief Indica si se pidió cancelar el trabajo; lo revisa el propio trabajo entre un tramo y otro.
+ *
+ * @return true si se llamó a `cancel()`.
+ * @author fabian
+ */
+bool Job::isCancelled() const {
+    return this->cancelRequested.load(memory_order_acquire);
+}
+
+/**
+ * @brief Fija la cantidad de unidades que tiene que procesar el trabajo.
+ *
+ * @param total Cantidad de unidades, por ejemplo personas a recorrer.
+ * @author fabian
+ */
+void Job::setTotal(const uint64_t total) {
+    this->total.store(total, memory_order_relaxed);
+}
+
+/**
+ * @brief Suma unidades procesadas al avance del trabajo.
+ *
+ * @param amount Cantidad de unidades procesadas desde la última llamada.
+ * @author fabian
+ */
+void Job::advance(const uint64_t amount) {
+    this->done.fetch_add(amount, memory_order_relaxed);
+}
+
+/**
+ * @brief Agrega una fila al resultado del trabajo; quien lo sigue la puede mostrar de inmediato.
+ *
+ * @param row Texto de la fila.
+ * @author fabian
+ */
+void Job::emit(string row) {
+    lock_guard guard(this->lock);
+    this->rows.push_back(std::move(row));
+}
+
+/**
+ * @brief Publica el resultado del trabajo, reemplazando al anterior. Un trabajo que combina resultados por tramos
+ * lo publica después de cada uno para que se vea el resultado parcial.
+ *
+ * @param result Texto del resultado.
+ * @author fabian
+ */
+void Job::setResult(string result) {
+    lock_guard guard(this->lock);
+    this->result = std::move(result);
+}
+
+/**
+ * @brief Marca el trabajo con su estado final y despierta a quienes lo esperan.
+ *
+ * @param finalState Estado final.
+ * @param message Mensaje de error, si falló.
+ * @author fabian
+ */
+void Job::finish(const JobState finalState, string message) {
+    {
+        lock_guard guard(this->lock);
+        this->error = std::move(message);
+        this->state.store(finalState, memory_order_release);
+    }
+    this->finished.notify_all();
+}
+
+/**
+ * @brief Constructor de la clase JobExecutor. Inicia los hilos trabajadores.
+ *
+ * @param workers Cantidad de trabajos que se ejecutan a la vez; al menos 1.
+ * @author fabian
+ */
+JobExecutor::JobExecutor(const unsigned workers) {
+    for (unsigned i = 0; i < max(workers, 1u); i++) {
+        this->threads.emplace_back(&JobExecutor::workerLoop, this);
+    }
+}
+
+/**
+ * @brief Destructor de la clase JobExecutor. Cancela los trabajos pendientes y los que se están ejecutando, y
+ * espera a que los hilos terminen.
+ * @author fabian
+ */
+JobExecutor::~JobExecutor() {
+    {
+        lock_guard guard(this->lock);
+        this->stopping = true;
+        for (const Pending& queued : this->pending) queued.job->cancel();
+        for (const shared_ptr<Job>& job : this->running) job->cancel();
+    }
+    this->wakeUp.notify_all();
+    for (thread& worker : this->threads) worker.join();
+}
+
+/**
+ * @brief Envía un trabajo para ejecutarlo en segundo plano.
+ *
+ * @param name Nombre que se muestra al usuario.
+ * @param work Función que hace el trabajo; recibe el `Job` para informar su avance y sus resultados. Si lanza una
+ *             excepción, el trabajo queda fallido con su mensaje.
+ * @return El trabajo, para seguirlo o cancelarlo.
+ * @author fabian
+ */
+shared_ptr<Job> JobExecutor::submit(const string& name, Work work) {
+    shared_ptr<Job> job;
+    {
+        lock_guard guard(this->lock);
+        job = make_shared<Job>(this->nextId++, name);
+        this->pending.push_back({job, std::move(work)});
+    }
+    this->wakeUp.notify_one();
+    return job;
+}
+
+/**
+ * @brief Obtiene la cantidad de hilos trabajadores.
+ *
+ * @return Cantidad de trabajos que se ejecutan a la vez.
+ * @author fabian
+ */
+unsigned JobExecutor::getWorkerCount() const {
+    return static_cast<unsigned>(this->threads.size());
+}
+
+/**
+ * @brief Ciclo de cada hilo trabajador: toma el trabajo pendiente más antiguo y lo ejecuta, hasta que el ejecutor
+ * se destruye y no quedan pendientes.
+ * @author fabian
+ */
+void JobExecutor::workerLoop() {
+    while (true) {
+        Pending next;
+        {
+            unique_lock guard(this->lock);
+            this->wakeUp.wait(guard, [this] { return this->stopping || !this->pending.empty(); });
+            if (this->pending.empty()) return;
+            next = std::move(this->pending.front());
+            this->pending.pop_front();
+            if (!next.job->isCancelled()) this->running.push_back(next.job);
+        }
+
+        Job& job = *next.job;
+        if (job.isCancelled()) {
+            job.finish(JobState::Cancelled);
+            continue;
+        }
+        job.state.store(JobState::Running, memory_order_release);
+        try {
+            next.work(job);
+            job.finish(job.isCancelled() ? JobState::Cancelled : JobState::Finished);
+        } catch (const exception& error) {
+            job.finish(JobState::Failed, error.what());
+        }
+        next.work = nullptr;
+
+        lock_guard guard(this->lock);
+        this->running.erase(find(this->running.begin(), this->running.end(), next.job));
+    }
+}
@@ -0,0 +1,127 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef JOBEXECUTOR_H
+#define JOBEXECUTOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Estado de un trabajo en segundo plano.
+ */
+enum class JobState { Queued, Running, Finished, Cancelled, Failed };
+
+/**
+ * @brief Avance de un trabajo: unidades hechas de `total` (0 si todavía no se conoce) y filas emitidas.
+ */
+struct JobProgress {
+    JobState state = JobState::Queued;
+    uint64_t done = 0;
+    uint64_t total = 0;
+    uint64_t rows = 0;
+};
+
+/**
+ * @brief Trabajo enviado a un `JobExecutor`.
+ *
+ * Lo comparten el hilo que lo envió, que consulta su avance, lee sus filas y lo puede cancelar, y el hilo
+ * trabajador que lo ejecuta, que informa el avance con `setTotal` y `advance`, emite filas con `emit` y publica
+ * el resultado parcial o final con `setResult`. La cancelación es cooperativa: el trabajo revisa `isCancelled()`
+ * entre un tramo y otro y termina antes si se pidió.
+ */
+class Job {
+public:
+    Job(uint64_t id, string name);
+
+    Job(const Job&) = delete;
+    Job& operator=(const Job&) = delete;
+
+    [[nodiscard]] uint64_t getId() const;
+    [[nodiscard]] const string& getName() const;
+    [[nodiscard]] JobProgress getProgress() const;
+    [[nodiscard]] vector<string> getRows(size_t first, size_t limit = SIZE_MAX) const;
+    [[nodiscard]] string getResult() const;
+    [[nodiscard]] string getError() const;
+    [[nodiscard]] bool isDone() const;
+
+    void cancel();
+    void wait() const;
+
+    [[nodiscard]] bool isCancelled() const;
+    void setTotal(uint64_t total);
+    void advance(uint64_t amount);
+    void emit(string row);
+    void setResult(string result);
+
+private:
+    friend class JobExecutor;
+
+    const uint64_t id;
+    const string name;
+    atomic<JobState> state{JobState::Queued};
+    atomic<bool> cancelRequested{false};
+    atomic<uint64_t> done{0};
+    atomic<uint64_t> total{0};
+
+    mutable mutex lock;
+    mutable condition_variable finished;
+    vector<string> rows;
+    string result;
+    string error;
+
+    void finish(JobState finalState, string message = "");
+};
+
+/**
+ * @brief Ejecuta trabajos largos, como reportes y consultas, en unos pocos hilos propios para que el hilo que los
+ * envía siga atendiendo al usuario.
+ *
+ * Los trabajos se atienden en el orden en que se enviaron, tantos a la vez como hilos tenga el ejecutor; uno
+ * cancelado antes de empezar se descarta sin ejecutarse. Los trabajos pueden usar a su vez el `ThreadPool` de las
+ * consultas, así que los hilos del ejecutor solo esperan y coordinan, y conviene que sean pocos.
+ */
+class JobExecutor {
+public:
+    using Work = function<void(Job&)>;
+
+    explicit JobExecutor(unsigned workers = 2);
+    ~JobExecutor();
+
+    JobExecutor(const JobExecutor&) = delete;
+    JobExecutor& operator=(const JobExecutor&) = delete;
+
+    shared_ptr<Job> submit(const string& name, Work work);
+
+    [[nodiscard]] unsigned getWorkerCount() const;
+
+private:
+    struct Pending {
+        shared_ptr<Job> job;
+        Work work;
+    };
+
+    deque<Pending> pending;
+    vector<thread> threads;
+    vector<shared_ptr<Job>> running;
+    uint64_t nextId = 1;
+    bool stopping = false;
+    mutex lock;
+    condition_variable wakeUp;
+
+    void workerLoop();
+};
+
+#include "JobExecutor.cpp"
+#endif //JOBEXECUTOR_H
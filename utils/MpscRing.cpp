@@ -0,0 +1,74 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "MpscRing.h"
+
+/**
+ * @brief Constructor de la clase MpscRing.
+ *
+ * @param capacity Cantidad mínima de casillas; se redondea a la siguiente potencia de dos.
+ * @author fabian
+ */
+template <class T>
+MpscRing<T>::MpscRing(const size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) size *= 2;
+    this->slots = make_unique<Slot[]>(size);
+    this->mask = size - 1;
+    for (size_t i = 0; i < size; i++) this->slots[i].sequence.store(i, memory_order_relaxed);
+}
+
+/**
+ * @brief Agrega un valor al final de la cola. Se puede llamar desde cualquier hilo.
+ *
+ * @param value Valor a agregar.
+ * @return false si la cola está llena; el valor no se agrega.
+ * @author fabian
+ */
+template <class T>
+bool MpscRing<T>::tryPush(T value) {
+    size_t position = this->tail.load(memory_order_relaxed);
+    while (true) {
+        Slot& slot = this->slots[position & this->mask];
+        const size_t sequence = slot.sequence.load(memory_order_acquire);
+        const auto difference = static_cast<ptrdiff_t>(sequence - position);
+        if (difference == 0) {
+            if (this->tail.compare_exchange_weak(position, position + 1, memory_order_relaxed)) {
+                slot.value = std::move(value);
+                slot.sequence.store(position + 1, memory_order_release);
+                return true;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = this->tail.load(memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Saca el primer valor de la cola. Solo la puede llamar el hilo consumidor.
+ *
+ * @param value Destino del valor.
+ * @return false si la cola está vacía o el siguiente productor todavía no termina de escribir su valor.
+ * @author fabian
+ */
+template <class T>
+bool MpscRing<T>::tryPop(T& value) {
+    Slot& slot = this->slots[this->head & this->mask];
+    if (slot.sequence.load(memory_order_acquire) != this->head + 1) return false;
+    value = std::move(slot.value);
+    slot.sequence.store(this->head + this->mask + 1, memory_order_release);
+    this->head++;
+    return true;
+}
+
+/**
+ * @brief Obtiene la cantidad de casillas de la cola.
+ *
+ * @return Capacidad de la cola.
+ * @author fabian
+ */
+template <class T>
+size_t MpscRing<T>::getCapacity() const { return this->mask + 1; }
@@ -0,0 +1,50 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef MPSCRING_H
+#define MPSCRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+using namespace std;
+
+/**
+ * @brief Cola circular acotada y sin candados para varios productores y un solo consumidor.
+ *
+ * Cada casilla lleva un número de secuencia que indica de quién es el turno: un productor reserva la siguiente
+ * posición con una comparación e intercambio sobre `tail`, escribe el valor y publica la casilla avanzando su
+ * secuencia; el consumidor solo lee `head`, que nadie más toca. Los productores nunca esperan al consumidor salvo
+ * cuando la cola está llena, y en ese caso `tryPush` devuelve false en vez de bloquear.
+ *
+ * @tparam T Tipo de los valores; se copian o mueven dentro y fuera de las casillas.
+ */
+template <class T>
+class MpscRing {
+public:
+    explicit MpscRing(size_t capacity);
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    bool tryPush(T value);
+    bool tryPop(T& value);
+
+    [[nodiscard]] size_t getCapacity() const;
+
+private:
+    struct Slot {
+        atomic<size_t> sequence;
+        T value;
+    };
+
+    unique_ptr<Slot[]> slots;
+    size_t mask;
+    alignas(64) atomic<size_t> tail{0};
+    alignas(64) size_t head = 0;
+};
+
+#include "MpscRing.cpp"
+#endif //MPSCRING_H
@@ -0,0 +1,386 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "StringPool.h"
+
+StringPool stringPool;
+
+/**
+ * @brief Obtiene el fragmento de la tabla donde vive un valor.
+ *
+ * Usa los bits altos del hash; los bajos escogen la casilla dentro del fragmento.
+ *
+ * @param hash Hash del valor.
+ * @return El fragmento.
+ * @author fabian
+ */
+StringPool::Shard& StringPool::shardFor(const uint64_t hash) {
+    return this->shards[hash >> (64 - SHARD_BITS)];
+}
+
+/**
+ * @brief Busca la casilla de un valor, o la casilla libre donde debería ir.
+ *
+ * @param shard Fragmento, con su candado tomado y al menos una casilla libre.
+ * @param hash Hash del valor.
+ * @param value Valor.
+ * @return Índice de la casilla.
+ * @author fabian
+ */
+size_t StringPool::findSlot(const Shard& shard, const uint64_t hash, const string_view value) {
+    const size_t mask = shard.slots.size() - 1;
+    size_t index = hash & mask;
+    while (const Entry* entry = shard.slots[index].entry) {
+        if (shard.slots[index].hash == hash && entry->value == value) break;
+        index = (index + 1) & mask;
+    }
+    return index;
+}
+
+/**
+ * @brief Duplica las casillas de un fragmento y vuelve a ubicar sus entradas.
+ *
+ * @param shard Fragmento, con su candado tomado.
+ * @author fabian
+ */
+void StringPool::grow(Shard& shard) {
+    vector<Slot> slots(shard.slots.empty() ? 64 : shard.slots.size() * 2, Slot{0, nullptr});
+    const size_t mask = slots.size() - 1;
+    for (const Slot& slot : shard.slots) {
+        if (!slot.entry) continue;
+        size_t index = slot.hash & mask;
+        while (slots[index].entry) index = (index + 1) & mask;
+        slots[index] = slot;
+    }
+    shard.slots.swap(slots);
+}
+
+/**
+ * @brief Libera una casilla y corre hacia atrás las entradas siguientes que quedarían inalcanzables.
+ *
+ * @param shard Fragmento, con su candado tomado.
+ * @param index Casilla a liberar.
+ * @author fabian
+ */
+void StringPool::erase(Shard& shard, size_t index) {
+    const size_t mask = shard.slots.size() - 1;
+    size_t next = (index + 1) & mask;
+    while (shard.slots[next].entry) {
+        const size_t home = shard.slots[next].hash & mask;
+        if (((next - home) & mask) >= ((next - index) & mask)) {
+            shard.slots[index] = shard.slots[next];
+            index = next;
+        }
+        next = (next + 1) & mask;
+    }
+    shard.slots[index] = Slot{0, nullptr};
+    shard.count--;
+}
+
+/**
+ * @brief Obtiene una referencia a un valor, internándolo si todavía no está en el pool.
+ *
+ * @param value Valor a internar.
+ * @return Entrada del valor, con una referencia más que le pertenece a quien llama.
+ * @author fabian
+ */
+StringPool::Entry* StringPool::acquire(const string_view value) {
+    const uint64_t hash = std::hash<string_view>{}(value);
+    Shard& shard = shardFor(hash);
+    lock_guard guard(shard.lock);
+    if ((shard.count + 1) * 2 > shard.slots.size()) grow(shard);
+
+    Slot& slot = shard.slots[findSlot(shard, hash, value)];
+    if (slot.entry) {
+        slot.entry->references.fetch_add(1, memory_order_relaxed);
+        return slot.entry;
+    }
+    slot = Slot{hash, new Entry{string(value), hash}};
+    shard.count++;
+    return slot.entry;
+}
+
+/**
+ * @brief Obtiene una referencia a un valor solo si ya está en el pool.
+ *
+ * @param value Valor a buscar.
+ * @return Entrada del valor con una referencia más, o nullptr si el valor no está internado.
+ * @author fabian
+ */
+StringPool::Entry* StringPool::find(const string_view value) {
+    const uint64_t hash = std::hash<string_view>{}(value);
+    Shard& shard = shardFor(hash);
+    lock_guard guard(shard.lock);
+    if (shard.count == 0) return nullptr;
+
+    Entry* entry = shard.slots[findSlot(shard, hash, value)].entry;
+    if (entry) entry->references.fetch_add(1, memory_order_relaxed);
+    return entry;
+}
+
+/**
+ * @brief Suelta una referencia y elimina el valor cuando era la última.
+ *
+ * Las referencias se restan sin candado mientras quede más de una. La última se resta con el candado del
+ * fragmento tomado, el mismo que protege a `acquire`, así que un valor nunca se elimina mientras otro hilo lo
+ * está volviendo a internar.
+ *
+ * @param entry Entrada a soltar.
+ * @author fabian
+ */
+void StringPool::release(Entry* entry) {
+    uint32_t references = entry->references.load(memory_order_relaxed);
+    while (references > 1) {
+        if (entry->references.compare_exchange_weak(references, references - 1, memory_order_acq_rel)) return;
+    }
+
+    Shard& shard = shardFor(entry->hash);
+    {
+        lock_guard guard(shard.lock);
+        if (entry->references.fetch_sub(1, memory_order_acq_rel) != 1) return;
+        erase(shard, findSlot(shard, entry->hash, entry->value));
+    }
+    delete entry;
+}
+
+/**
+ * @brief Calcula las estadísticas del pool.
+ *
+ * Sin el pool, cada referencia sería un `std::string` con su propia copia en el heap cuando el texto no cabe en
+ * el búfer interno. Con el pool, cada referencia es un puntero y cada valor distinto cuesta su entrada y su copia,
+ * más las casillas de la tabla.
+ *
+ * @return Valores distintos, referencias y memoria estimada con y sin el pool.
+ * @author fabian
+ */
+StringPoolStats StringPool::getStats() {
+    static constexpr size_t SHORT_STRING = 15;
+
+    StringPoolStats stats;
+    for (Shard& shard : this->shards) {
+        lock_guard guard(shard.lock);
+        stats.pooledBytes += shard.slots.size() * sizeof(Slot);
+        for (const Slot& slot : shard.slots) {
+            if (!slot.entry) continue;
+            const size_t references = slot.entry->references.load(memory_order_relaxed);
+            const size_t heapBytes = slot.entry->value.size() > SHORT_STRING ? slot.entry->value.size() + 1 : 0;
+            stats.distinct++;
+            stats.references += references;
+            stats.pooledBytes += references * sizeof(InternedString) + sizeof(Entry) + heapBytes;
+            stats.plainBytes += references * (sizeof(string) + heapBytes);
+        }
+    }
+    return stats;
+}
+
+/**
+ * @brief Constructor de la clase InternedString a partir de un texto.
+ *
+ * @param value Texto a internar.
+ * @author fabian
+ */
+InternedString::InternedString(const string_view value)
+    : entry(value.empty() ? nullptr : stringPool.acquire(value)) {}
+
+/**
+ * @brief Constructor de copia: comparte la misma entrada del pool.
+ *
+ * @param other Cadena a copiar.
+ * @author fabian
+ */
+InternedString::InternedString(const InternedString& other) : entry(other.entry) {
+    if (this->entry) this->entry->references.fetch_add(1, memory_order_relaxed);
+}
+
+/**
+ * @brief Constructor de movimiento: toma la referencia de la otra cadena.
+ *
+ * @param other Cadena a mover; queda vacía.
+ * @author fabian
+ */
+InternedString::InternedString(InternedString&& other) noexcept : entry(other.entry) {
+    other.entry = nullptr;
+}
+
+/**
+ * @brief Destructor de la clase InternedString. Suelta su referencia.
+ * @author fabian
+ */
+InternedString::~InternedString() {
+    if (this->entry) stringPool.release(this->entry);
+}
+
+/**
+ * @brief Asigna otra cadena internada.
+ *
+ * @param other Cadena a copiar.
+ * @return Esta cadena.
+ * @author fabian
+ */
+InternedString& InternedString::operator=(const InternedString& other) {
+    if (this->entry == other.entry) return *this;
+    if (other.entry) other.entry->references.fetch_add(1, memory_order_relaxed);
+    if (this->entry) stringPool.release(this->entry);
+    this->entry = other.entry;
+    return *this;
+}
+
+/**
+ * @brief Asigna otra cadena internada tomando su referencia.
+ *
+ * @param other Cadena a mover; queda vacía.
+ * @return Esta cadena.
+ * @author fabian
+ */
+InternedString& InternedString::operator=(InternedString&& other) noexcept {
+    if (this != &other) {
+        if (this->entry) stringPool.release(this->entry);
+        this->entry = other.entry;
+        other.entry = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * @brief Asigna un texto, internándolo.
+ *
+ * @param value Texto.
+ * @return Esta cadena.
+ * @author fabian
+ */
+InternedString& InternedString::operator=(const string_view value) {
+    StringPool::Entry* previous = this->entry;
+    this->entry = value.empty() ? nullptr : stringPool.acquire(value);
+    if (previous) stringPool.release(previous);
+    return *this;
+}
+
+/**
+ * @brief Busca un texto en el pool sin internarlo.
+ *
+ * Sirve para convertir una vez el texto de una consulta y luego comparar por puntero: si el texto no está en el
+ * pool, ninguna cadena internada puede ser igual a él.
+ *
+ * @param value Texto a buscar.
+ * @return La cadena internada, o nada si el texto no está en el pool.
+ * @author fabian
+ */
+optional<InternedString> InternedString::find(const string_view value) {
+    InternedString result;
+    if (value.empty()) return result;
+    result.entry = stringPool.find(value);
+    if (!result.entry) return nullopt;
+    return result;
+}
+
+/**
+ * @brief Obtiene el texto.
+ *
+ * @return Referencia al texto guardado en el pool.
+ * @author fabian
+ */
+const string& InternedString::str() const {
+    static const string emptyString;
+    return this->entry ? this->entry->value : emptyString;
+}
+
+/**
+ * @brief Obtiene el texto como vista.
+ *
+ * @return Vista al texto.
+ * @author fabian
+ */
+string_view InternedString::view() const { return str(); }
+
+/**
+ * @brief Obtiene la longitud del texto.
+ *
+ * @return Cantidad de caracteres.
+ * @author fabian
+ */
+size_t InternedString::size() const { return str().size(); }
+
+/**
+ * @brief Indica si el texto está vacío.
+ *
+ * @return true si está vacío.
+ * @author fabian
+ */
+bool InternedString::empty() const { return this->entry == nullptr; }
+
+/**
+ * @brief Obtiene el hash del texto, calculado una sola vez al internarlo.
+ *
+ * @return El hash, o 0 para la cadena vacía.
+ * @author fabian
+ */
+uint64_t InternedString::hash() const { return this->entry ? this->entry->hash : 0; }
+
+/**
+ * @brief Convierte la cadena internada al texto que representa.
+ *
+ * @return Referencia al texto guardado en el pool.
+ * @author fabian
+ */
+InternedString::operator const string&() const { return str(); }
+
+/**
+ * @brief Compara dos cadenas internadas comparando sus entradas.
+ *
+ * @param other Otra cadena.
+ * @return true si tienen el mismo texto.
+ * @author fabian
+ */
+bool InternedString::operator==(const InternedString& other) const { return this->entry == other.entry; }
+
+/**
+ * @brief Compara con un texto que no está internado.
+ *
+ * @param other Texto.
+ * @return true si tienen el mismo texto.
+ * @author fabian
+ */
+bool InternedString::operator==(const string_view other) const { return view() == other; }
+
+/**
+ * @brief Imprime una cadena internada.
+ *
+ * @param out Flujo de salida.
+ * @param value Cadena.
+ * @return El mismo flujo.
+ * @author fabian
+ */
+ostream& operator<<(ostream& out, const InternedString& value) {
+    return out << value.str();
+}
+
+/**
+ * @brief Concatena un texto con una cadena internada.
+ *
+ * @param left Texto de la izquierda.
+ * @param right Cadena de la derecha.
+ * @return El texto concatenado.
+ * @author fabian
+ */
+string operator+(const string_view left, const InternedString& right) {
+    string result;
+    result.reserve(left.size() + right.size());
+    result.append(left).append(right.view());
+    return result;
+}
+
+/**
+ * @brief Concatena una cadena internada con un texto.
+ *
+ * @param left Cadena de la izquierda.
+ * @param right Texto de la derecha.
+ * @return El texto concatenado.
+ * @author fabian
+ */
+string operator+(const InternedString& left, const string_view right) {
+    string result;
+    result.reserve(left.size() + right.size());
+    result.append(left.view()).append(right);
+    return result;
+}
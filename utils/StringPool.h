@@ -0,0 +1,134 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Estadísticas del pool de cadenas.
+ *
+ * `pooledBytes` estima la memoria con el pool (un puntero por referencia más cada valor distinto con su entrada en
+ * la tabla) y `plainBytes` la que usarían las mismas referencias como `std::string` independientes.
+ */
+struct StringPoolStats {
+    size_t distinct = 0;
+    size_t references = 0;
+    size_t pooledBytes = 0;
+    size_t plainBytes = 0;
+};
+
+/**
+ * @brief Pool global de cadenas internadas con conteo de referencias.
+ *
+ * Cada valor distinto se guarda una sola vez; se libera cuando su última referencia desaparece. La tabla está
+ * dividida en fragmentos con su propio candado para que varios hilos puedan internar a la vez, por ejemplo al
+ * cargar una instantánea o al importar en paralelo.
+ */
+class StringPool {
+public:
+    /**
+     * @brief Valor internado y su cantidad de referencias.
+     */
+    struct Entry {
+        string value;
+        uint64_t hash;
+        atomic<uint32_t> references{1};
+    };
+
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    Entry* acquire(string_view value);
+    Entry* find(string_view value);
+    void release(Entry* entry);
+
+    [[nodiscard]] StringPoolStats getStats();
+
+private:
+    static constexpr size_t SHARD_BITS = 6;
+    static constexpr size_t SHARD_COUNT = size_t{1} << SHARD_BITS;
+
+    /**
+     * @brief Casilla de la tabla: el hash del valor y su entrada, o nullptr si está libre.
+     */
+    struct Slot {
+        uint64_t hash;
+        Entry* entry;
+    };
+
+    /**
+     * @brief Parte de la tabla protegida por su propio candado.
+     *
+     * Es una tabla de direccionamiento abierto con sondeo lineal y una cantidad de casillas potencia de dos. Guardar
+     * el hash junto a la entrada evita leer las entradas que no coinciden y volver a calcularlo al crecer.
+     */
+    struct Shard {
+        mutex lock;
+        vector<Slot> slots;
+        size_t count = 0;
+    };
+
+    Shard shards[SHARD_COUNT];
+
+    Shard& shardFor(uint64_t hash);
+    static size_t findSlot(const Shard& shard, uint64_t hash, string_view value);
+    static void grow(Shard& shard);
+    static void erase(Shard& shard, size_t index);
+};
+
+extern StringPool stringPool;
+
+/**
+ * @brief Referencia de 8 bytes a una cadena del pool global.
+ *
+ * Se usa como un `std::string` de solo lectura: se asigna desde texto, se convierte a `const string&` y se
+ * imprime con `<<`. Dos cadenas internadas son iguales si y solo si apuntan a la misma entrada, así que comparar
+ * dos de ellas es comparar punteros. La cadena vacía no ocupa ninguna entrada.
+ */
+class InternedString {
+public:
+    InternedString() = default;
+    explicit InternedString(string_view value);
+    InternedString(const InternedString& other);
+    InternedString(InternedString&& other) noexcept;
+    ~InternedString();
+
+    InternedString& operator=(const InternedString& other);
+    InternedString& operator=(InternedString&& other) noexcept;
+    InternedString& operator=(string_view value);
+
+    static optional<InternedString> find(string_view value);
+
+    [[nodiscard]] const string& str() const;
+    [[nodiscard]] string_view view() const;
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] bool empty() const;
+    [[nodiscard]] uint64_t hash() const;
+    operator const string&() const;
+
+    bool operator==(const InternedString& other) const;
+    bool operator==(string_view other) const;
+
+private:
+    StringPool::Entry* entry = nullptr;
+};
+
+ostream& operator<<(ostream& out, const InternedString& value);
+string operator+(string_view left, const InternedString& right);
+string operator+(const InternedString& left, string_view right);
+
+#include "StringPool.cpp"
+#endif //STRINGPOOL_H
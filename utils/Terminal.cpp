@@ -0,0 +1,385 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "Terminal.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <iostream>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <chrono>
+#include <poll.h>
+#include <termios.h>
+#include <thread>
+#include <unistd.h>
+#endif
+
+Terminal terminal;
+
+#ifdef _WIN32
+
+/**
+ * @brief Constructor de la clase Terminal.
+ *
+ * Determina si la entrada y la salida estándar están conectadas a una consola.
+ *
+ * @author fabian
+ */
+Terminal::Terminal() {
+    DWORD mode;
+    this->inputIsTerminal = GetConsoleMode(GetStdHandle(STD_INPUT_HANDLE), &mode);
+    this->outputIsTerminal = GetConsoleMode(GetStdHandle(STD_OUTPUT_HANDLE), &mode);
+}
+
+/**
+ * @brief Borra toda la pantalla y deja el cursor en la esquina superior izquierda.
+ * @author fabian
+ */
+void Terminal::clearScreen() {
+    cout.flush();
+    const HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    if (!GetConsoleScreenBufferInfo(output, &csbi)) return;
+
+    const DWORD cells = static_cast<DWORD>(csbi.dwSize.X) * csbi.dwSize.Y;
+    constexpr COORD home = {0, 0};
+    DWORD written;
+    FillConsoleOutputCharacterA(output, ' ', cells, home, &written);
+    FillConsoleOutputAttribute(output, csbi.wAttributes, cells, home, &written);
+    SetConsoleCursorPosition(output, home);
+}
+
+/**
+ * @brief Mueve el cursor a una posición de la pantalla.
+ *
+ * @param x Columna, empezando en 0.
+ * @param y Fila, empezando en 0.
+ * @author fabian
+ */
+void Terminal::moveCursor(const int x, const int y) {
+    cout.flush();
+    const COORD position = {static_cast<SHORT>(x), static_cast<SHORT>(y)};
+    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), position);
+}
+
+/**
+ * @brief Borra desde el cursor hasta el final de la línea, sin mover el cursor.
+ * @author fabian
+ */
+void Terminal::clearToEndOfLine() {
+    cout.flush();
+    const HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    if (!GetConsoleScreenBufferInfo(output, &csbi)) return;
+
+    DWORD written;
+    FillConsoleOutputCharacterA(output, ' ', csbi.dwSize.X - csbi.dwCursorPosition.X, csbi.dwCursorPosition, &written);
+}
+
+/**
+ * @brief Reemplaza el contenido de la línea actual por un texto, dejando el cursor al final del texto.
+ *
+ * @param text Texto a escribir.
+ * @author fabian
+ */
+void Terminal::rewriteLine(const string& text) {
+    const TerminalPosition position = getCursorPosition();
+    moveCursor(0, position.Y);
+    clearToEndOfLine();
+    cout << text << flush;
+}
+
+/**
+ * @brief Obtiene la posición actual del cursor.
+ *
+ * @return La posición del cursor, o (0, 0) si no se puede obtener.
+ * @author fabian
+ */
+TerminalPosition Terminal::getCursorPosition() {
+    cout.flush();
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &csbi)) {
+        return {csbi.dwCursorPosition.X, csbi.dwCursorPosition.Y};
+    }
+    return {0, 0};
+}
+
+/**
+ * @brief Cambia los colores del texto usando un atributo de consola de Windows.
+ *
+ * @param attribute Atributo de consola: color de letra en los 4 bits bajos y de fondo en los 4 siguientes.
+ * @author fabian
+ */
+void Terminal::setTextAttribute(const int attribute) {
+    cout.flush();
+    SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), static_cast<WORD>(attribute));
+}
+
+/**
+ * @brief Espera, sin consumir CPU, a que el usuario presione una tecla.
+ *
+ * @param timeoutMillis Tiempo máximo de espera en milisegundos, o -1 para esperar indefinidamente. Si la entrada no
+ *                      es una consola, con un tiempo máximo solo se espera ese tiempo, sin leer.
+ * @return La tecla presionada, `Key::None` si venció el tiempo o `Key::EndOfInput` si la entrada se cerró.
+ * @author fabian
+ */
+KeyEvent Terminal::readKey(const int timeoutMillis) {
+    cout.flush();
+    if (!this->inputIsTerminal) {
+        if (timeoutMillis >= 0) {
+            Sleep(static_cast<DWORD>(timeoutMillis));
+            return {Key::None, 0};
+        }
+        const int first = readByte(-1);
+        return first < 0 ? KeyEvent{Key::EndOfInput, 0} : decodeKey(first);
+    }
+
+    const HANDLE input = GetStdHandle(STD_INPUT_HANDLE);
+    while (true) {
+        const DWORD wait = timeoutMillis < 0 ? INFINITE : static_cast<DWORD>(timeoutMillis);
+        const DWORD waited = WaitForSingleObject(input, wait);
+        if (waited == WAIT_TIMEOUT) return {Key::None, 0};
+        if (waited != WAIT_OBJECT_0) return {Key::EndOfInput, 0};
+
+        INPUT_RECORD record;
+        DWORD read = 0;
+        if (!ReadConsoleInputA(input, &record, 1, &read) || read == 0) return {Key::EndOfInput, 0};
+        if (record.EventType != KEY_EVENT || !record.Event.KeyEvent.bKeyDown) continue;
+
+        switch (record.Event.KeyEvent.wVirtualKeyCode) {
+            case VK_UP: return {Key::Up, 0};
+            case VK_DOWN: return {Key::Down, 0};
+            case VK_LEFT: return {Key::Left, 0};
+            case VK_RIGHT: return {Key::Right, 0};
+            case VK_SPACE: return {Key::Space, ' '};
+            case VK_RETURN: return {Key::Enter, '\n'};
+            case VK_ESCAPE: return {Key::Escape, 0};
+            default: break;
+        }
+        if (const char character = record.Event.KeyEvent.uChar.AsciiChar) return {Key::Character, character};
+    }
+}
+
+/**
+ * @brief Lee un byte de la entrada estándar cuando no está conectada a una consola.
+ *
+ * @param timeoutMillis Ignorado; la lectura siempre bloquea.
+ * @return El byte leído, o -1 si la entrada terminó.
+ * @author fabian
+ */
+int Terminal::readByte(int) {
+    return getchar();
+}
+
+#else
+
+/**
+ * @brief Cambia la terminal a modo sin búfer de línea ni eco mientras el objeto existe.
+ */
+struct RawMode {
+    bool active = false;
+    termios original{};
+
+    explicit RawMode(const bool enable) {
+        if (!enable || tcgetattr(STDIN_FILENO, &this->original) != 0) return;
+        termios raw = this->original;
+        raw.c_lflag &= ~(ICANON | ECHO);
+        raw.c_cc[VMIN] = 1;
+        raw.c_cc[VTIME] = 0;
+        this->active = tcsetattr(STDIN_FILENO, TCSANOW, &raw) == 0;
+    }
+
+    ~RawMode() {
+        if (this->active) tcsetattr(STDIN_FILENO, TCSANOW, &this->original);
+    }
+};
+
+/**
+ * @brief Constructor de la clase Terminal.
+ *
+ * Determina si la entrada y la salida estándar están conectadas a una terminal.
+ *
+ * @author fabian
+ */
+Terminal::Terminal() {
+    this->inputIsTerminal = isatty(STDIN_FILENO);
+    this->outputIsTerminal = isatty(STDOUT_FILENO);
+}
+
+/**
+ * @brief Borra toda la pantalla y deja el cursor en la esquina superior izquierda.
+ * @author fabian
+ */
+void Terminal::clearScreen() {
+    if (this->outputIsTerminal) cout << "\x1b[2J\x1b[H" << flush;
+}
+
+/**
+ * @brief Mueve el cursor a una posición de la pantalla.
+ *
+ * @param x Columna, empezando en 0.
+ * @param y Fila, empezando en 0.
+ * @author fabian
+ */
+void Terminal::moveCursor(const int x, const int y) {
+    if (this->outputIsTerminal) cout << "\x1b[" << y + 1 << ';' << x + 1 << 'H' << flush;
+}
+
+/**
+ * @brief Borra desde el cursor hasta el final de la línea, sin mover el cursor.
+ * @author fabian
+ */
+void Terminal::clearToEndOfLine() {
+    if (this->outputIsTerminal) cout << "\x1b[K" << flush;
+}
+
+/**
+ * @brief Reemplaza el contenido de la línea actual por un texto, dejando el cursor al final del texto.
+ *
+ * @param text Texto a escribir.
+ * @author fabian
+ */
+void Terminal::rewriteLine(const string& text) {
+    if (this->outputIsTerminal) cout << "\r\x1b[K";
+    else cout << '\n';
+    cout << text << flush;
+}
+
+/**
+ * @brief Obtiene la posición actual del cursor.
+ *
+ * Pide la posición a la terminal con la secuencia ANSI `ESC[6n` y lee la respuesta `ESC[fila;columnaR`.
+ *
+ * @return La posición del cursor, o (0, 0) si no se puede obtener.
+ * @author fabian
+ */
+TerminalPosition Terminal::getCursorPosition() {
+    if (!this->inputIsTerminal || !this->outputIsTerminal) return {0, 0};
+
+    cout.flush();
+    RawMode raw(true);
+    if (write(STDOUT_FILENO, "\x1b[6n", 4) != 4) return {0, 0};
+
+    char response[32];
+    size_t length = 0;
+    while (length < sizeof(response) - 1) {
+        const int byte = readByte(100);
+        if (byte < 0) return {0, 0};
+        response[length++] = static_cast<char>(byte);
+        if (byte == 'R') break;
+    }
+    response[length] = '\0';
+
+    int row = 0;
+    int column = 0;
+    if (sscanf(response, "\x1b[%d;%dR", &row, &column) != 2) return {0, 0};
+    return {static_cast<short>(column - 1), static_cast<short>(row - 1)};
+}
+
+/**
+ * @brief Cambia los colores del texto usando un atributo de consola de Windows.
+ *
+ * Traduce el atributo a secuencias ANSI. El atributo 7 (gris sobre negro, el de Windows por defecto)
+ * restablece los colores de la terminal.
+ *
+ * @param attribute Atributo de consola: color de letra en los 4 bits bajos y de fondo en los 4 siguientes.
+ * @author fabian
+ */
+void Terminal::setTextAttribute(const int attribute) {
+    if (!this->outputIsTerminal) return;
+    if (attribute == 7) {
+        cout << "\x1b[0m";
+        return;
+    }
+
+    // Windows usa azul = 1, verde = 2 y rojo = 4; ANSI usa rojo = 1, verde = 2 y azul = 4
+    const auto toAnsi = [](const int color) { return (color & 4 ? 1 : 0) | (color & 2) | (color & 1 ? 4 : 0); };
+    const int foreground = attribute & 0x0F;
+    const int background = attribute >> 4 & 0x0F;
+    cout << "\x1b[0;" << (foreground & 8 ? 90 : 30) + toAnsi(foreground)
+         << ';' << (background & 8 ? 100 : 40) + toAnsi(background) << 'm';
+}
+
+/**
+ * @brief Espera, sin consumir CPU, a que el usuario presione una tecla.
+ *
+ * Pone la terminal en modo sin búfer de línea mientras espera y la restablece al terminar, para que las
+ * lecturas con `cin` sigan funcionando igual.
+ *
+ * @param timeoutMillis Tiempo máximo de espera en milisegundos, o -1 para esperar indefinidamente. Si la entrada no
+ *                      es una terminal, con un tiempo máximo solo se espera ese tiempo, sin leer.
+ * @return La tecla presionada, `Key::None` si venció el tiempo o `Key::EndOfInput` si la entrada se cerró.
+ * @author fabian
+ */
+KeyEvent Terminal::readKey(const int timeoutMillis) {
+    cout.flush();
+    if (!this->inputIsTerminal && timeoutMillis >= 0) {
+        this_thread::sleep_for(chrono::milliseconds(timeoutMillis));
+        return {Key::None, 0};
+    }
+    RawMode raw(this->inputIsTerminal);
+    const int first = readByte(timeoutMillis);
+    if (first == -2) return {Key::None, 0};
+    if (first < 0) return {Key::EndOfInput, 0};
+    return decodeKey(first);
+}
+
+/**
+ * @brief Lee un byte de la entrada estándar.
+ *
+ * Si la entrada es una terminal, bloquea en `poll` hasta que haya datos o venza el tiempo; si no, lee
+ * con `getchar` para respetar el búfer de `stdin`.
+ *
+ * @param timeoutMillis Tiempo máximo de espera en milisegundos, o -1 para esperar indefinidamente.
+ * @return El byte leído, -2 si venció el tiempo o -1 si la entrada terminó.
+ * @author fabian
+ */
+int Terminal::readByte(const int timeoutMillis) {
+    if (!this->inputIsTerminal) return getchar();
+
+    pollfd descriptor = {STDIN_FILENO, POLLIN, 0};
+    int ready;
+    do {
+        ready = poll(&descriptor, 1, timeoutMillis);
+    } while (ready < 0 && errno == EINTR);
+    if (ready == 0) return -2;
+    if (ready < 0) return -1;
+
+    unsigned char byte;
+    if (read(STDIN_FILENO, &byte, 1) != 1) return -1;
+    return byte;
+}
+
+#endif
+
+/**
+ * @brief Traduce el primer byte de una tecla, y las secuencias de escape que lo siguen, a un evento.
+ *
+ * @param first Primer byte leído.
+ * @return El evento de teclado correspondiente.
+ * @author fabian
+ */
+KeyEvent Terminal::decodeKey(const int first) {
+    if (first == ' ') return {Key::Space, ' '};
+    if (first == '\n' || first == '\r') return {Key::Enter, '\n'};
+    if (first != 27) return {Key::Character, static_cast<char>(first)};
+
+    const int second = readByte(50);
+    if (second != '[' && second != 'O') {
+        if (second >= 0 && !this->inputIsTerminal) ungetc(second, stdin);
+        return {Key::Escape, 0};
+    }
+
+    switch (readByte(50)) {
+        case 'A': return {Key::Up, 0};
+        case 'B': return {Key::Down, 0};
+        case 'C': return {Key::Right, 0};
+        case 'D': return {Key::Left, 0};
+        default: return {Key::Escape, 0};
+    }
+}
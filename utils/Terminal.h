@@ -0,0 +1,67 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef TERMINAL_H
+#define TERMINAL_H
+
+#include <string>
+
+using namespace std;
+
+/**
+ * @brief Posición del cursor en la terminal, con columna `X` y fila `Y` empezando en 0.
+ */
+struct TerminalPosition {
+    short X;
+    short Y;
+};
+
+/**
+ * @brief Teclas que reconoce la terminal.
+ */
+enum class Key { Up, Down, Left, Right, Space, Enter, Escape, Character, EndOfInput, None };
+
+/**
+ * @brief Evento de teclado; `character` solo es válido cuando `key` es `Key::Character`.
+ */
+struct KeyEvent {
+    Key key;
+    char character;
+};
+
+/**
+ * @brief Capa de acceso a la terminal independiente del sistema operativo.
+ *
+ * En Windows usa la API de consola; en sistemas POSIX usa termios, poll y secuencias de escape ANSI.
+ * La lectura de teclas bloquea hasta que llega un evento o vence el tiempo indicado, y el borrado de pantalla y de
+ * líneas se hace en el mismo proceso, sin ejecutar comandos externos.
+ */
+class Terminal {
+public:
+    Terminal();
+
+    Terminal(const Terminal&) = delete;
+    Terminal& operator=(const Terminal&) = delete;
+
+    void clearScreen();
+    void moveCursor(int x, int y);
+    void clearToEndOfLine();
+    void rewriteLine(const string& text);
+    [[nodiscard]] TerminalPosition getCursorPosition();
+    void setTextAttribute(int attribute);
+
+    KeyEvent readKey(int timeoutMillis = -1);
+
+private:
+    bool inputIsTerminal = false;
+    bool outputIsTerminal = false;
+
+    int readByte(int timeoutMillis);
+    KeyEvent decodeKey(int first);
+};
+
+extern Terminal terminal;
+
+#include "Terminal.cpp"
+#endif //TERMINAL_H
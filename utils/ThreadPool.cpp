@@ -0,0 +1,202 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#include "ThreadPool.h"
+
+thread_local const ThreadPool* ThreadPool::currentPool = nullptr;
+thread_local int ThreadPool::currentWorker = -1;
+
+/**
+ * @brief Constructor de la clase ThreadPool.
+ *
+ * Crea los hilos trabajadores, cada uno con su propia cola de trabajos.
+ *
+ * @param threads Cantidad de hilos. Si es 0 se usa la cantidad de núcleos disponibles.
+ * @author fabian
+ */
+ThreadPool::ThreadPool(unsigned threads) {
+    if (threads == 0) threads = thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+
+    for (unsigned i = 0; i < threads; i++) {
+        this->workers.push_back(make_unique<Worker>());
+    }
+    for (unsigned i = 0; i < threads; i++) {
+        this->threads.emplace_back(&ThreadPool::workerLoop, this, static_cast<int>(i));
+    }
+}
+
+/**
+ * @brief Destructor de la clase ThreadPool.
+ *
+ * Termina los trabajos pendientes y espera a que todos los hilos finalicen.
+ *
+ * @author fabian
+ */
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard guard(this->sleepLock);
+        this->stopping = true;
+    }
+    this->wakeUp.notify_all();
+    for (thread& worker : this->threads) worker.join();
+}
+
+/**
+ * @brief Encola un trabajo en el pool.
+ *
+ * Si se llama desde un hilo del pool, el trabajo va a la cola de ese hilo; de lo contrario se reparte
+ * entre los hilos en orden rotativo.
+ *
+ * @param job Trabajo a ejecutar.
+ * @author fabian
+ */
+void ThreadPool::submit(function<void()> job) {
+    int index = currentPool == this ? currentWorker
+        : static_cast<int>(this->nextWorker++ % this->workers.size());
+
+    {
+        lock_guard guard(this->workers[index]->lock);
+        this->workers[index]->jobs.push_back(std::move(job));
+    }
+    {
+        lock_guard guard(this->sleepLock);
+        ++this->queued;
+    }
+    this->wakeUp.notify_one();
+}
+
+/**
+ * @brief Ejecuta `body(i)` para cada i en [0, count) repartiendo las iteraciones entre los hilos del pool.
+ *
+ * Bloquea hasta que todas las iteraciones terminen. Si el llamador es un hilo del mismo pool, ayuda a
+ * ejecutar trabajos pendientes en lugar de bloquearse, evitando así interbloqueos en llamadas anidadas.
+ * Cada iteración descuenta su término con `doneLock` tomado, y el llamador lo toma antes de volver, así que
+ * ninguna iteración sigue usando el candado o la condición, que viven en la pila del llamador, cuando esta
+ * función termina.
+ *
+ * @param count Cantidad de iteraciones.
+ * @param body Función que procesa una iteración.
+ * @throws exception La primera excepción lanzada por alguna iteración.
+ * @author fabian
+ */
+void ThreadPool::parallelFor(const int count, const function<void(int)>& body) {
+    if (count <= 0) return;
+
+    atomic<int> remaining{count};
+    mutex doneLock;
+    condition_variable done;
+    exception_ptr error = nullptr;
+
+    for (int i = 0; i < count; i++) {
+        submit([&, i] {
+            try {
+                body(i);
+            } catch (...) {
+                lock_guard guard(doneLock);
+                if (!error) error = current_exception();
+            }
+            lock_guard guard(doneLock);
+            if (--remaining == 0) done.notify_all();
+        });
+    }
+
+    if (currentPool == this) {
+        while (remaining > 0) {
+            if (!runPendingJob()) this_thread::yield();
+        }
+        lock_guard guard(doneLock);
+    } else {
+        unique_lock guard(doneLock);
+        done.wait(guard, [&] { return remaining == 0; });
+    }
+
+    if (error) rethrow_exception(error);
+}
+
+/**
+ * @brief Obtiene la cantidad de hilos del pool.
+ *
+ * @return Número de hilos trabajadores.
+ * @author fabian
+ */
+unsigned ThreadPool::getThreadCount() const { return static_cast<unsigned>(this->workers.size()); }
+
+/**
+ * @brief Ciclo principal de cada hilo trabajador.
+ *
+ * Ejecuta trabajos de su cola o robados de otras colas, y duerme cuando no queda ninguno.
+ *
+ * @param index Índice del hilo dentro del pool.
+ * @author fabian
+ */
+void ThreadPool::workerLoop(const int index) {
+    currentPool = this;
+    currentWorker = index;
+
+    while (true) {
+        if (runPendingJob()) continue;
+
+        unique_lock guard(this->sleepLock);
+        this->wakeUp.wait(guard, [this] { return this->stopping || this->queued > 0; });
+        if (this->stopping && this->queued == 0) return;
+    }
+}
+
+/**
+ * @brief Saca el trabajo más reciente de la cola propia.
+ *
+ * @param index Índice del hilo.
+ * @param job Trabajo obtenido.
+ * @return `true` si se obtuvo un trabajo.
+ * @author fabian
+ */
+bool ThreadPool::tryPop(const int index, function<void()>& job) {
+    Worker& worker = *this->workers[index];
+    lock_guard guard(worker.lock);
+    if (worker.jobs.empty()) return false;
+    job = std::move(worker.jobs.back());
+    worker.jobs.pop_back();
+    return true;
+}
+
+/**
+ * @brief Roba el trabajo más antiguo de la cola de otro hilo.
+ *
+ * @param thief Índice del hilo que roba, o -1 si no es un hilo del pool.
+ * @param job Trabajo obtenido.
+ * @return `true` si se obtuvo un trabajo.
+ * @author fabian
+ */
+bool ThreadPool::trySteal(const int thief, function<void()>& job) {
+    const int total = static_cast<int>(this->workers.size());
+    for (int offset = 1; offset <= total; offset++) {
+        const int victim = (thief + offset + total) % total;
+        if (victim == thief) continue;
+
+        Worker& worker = *this->workers[victim];
+        lock_guard guard(worker.lock);
+        if (worker.jobs.empty()) continue;
+        job = std::move(worker.jobs.front());
+        worker.jobs.pop_front();
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Ejecuta un trabajo pendiente, propio o robado.
+ *
+ * @return `true` si se ejecutó algún trabajo.
+ * @author fabian
+ */
+bool ThreadPool::runPendingJob() {
+    const int index = currentPool == this ? currentWorker : -1;
+    function<void()> job;
+    if (!(index >= 0 && tryPop(index, job)) && !trySteal(index, job)) return false;
+
+    --this->queued;
+    job();
+    return true;
+}
@@ -0,0 +1,62 @@
+//
+// Created by fabian on 18/10/2026.
+//
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Pool de hilos con robo de trabajo.
+ *
+ * Cada hilo trabajador tiene su propia cola; toma trabajos del final de la suya y, cuando se queda sin
+ * trabajo, roba del inicio de las colas de los demás.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void submit(function<void()> job);
+    void parallelFor(int count, const function<void(int)>& body);
+
+    [[nodiscard]] unsigned getThreadCount() const;
+
+private:
+    struct Worker {
+        deque<function<void()>> jobs;
+        mutex lock;
+    };
+
+    vector<unique_ptr<Worker>> workers;
+    vector<thread> threads;
+    atomic<bool> stopping{false};
+    atomic<int> queued{0};
+    atomic<unsigned> nextWorker{0};
+    mutex sleepLock;
+    condition_variable wakeUp;
+
+    static thread_local const ThreadPool* currentPool;
+    static thread_local int currentWorker;
+
+    void workerLoop(int index);
+    bool tryPop(int index, function<void()>& job);
+    bool trySteal(int thief, function<void()>& job);
+    bool runPendingJob();
+};
+
+#include "ThreadPool.cpp"
+#endif //THREADPOOL_H
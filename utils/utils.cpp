@@ -6,81 +6,49 @@
 /**
  * @brief Obtiene la posición actual del cursor en la consola.
  *
- * Esta función utiliza las funciones de la API de Windows para recuperar la posición
- * actual del cursor en la consola. Si no puede obtener la posición, retorna (0, 0).
+ * Esta función le pide la posición del cursor a la terminal. Si no puede obtener la posición, retorna (0, 0).
  *
- * @param hConsole El handle de la consola obtenido con GetStdHandle.
- * @return COORD La posición actual del cursor en la consola.
+ * @return TerminalPosition La posición actual del cursor en la consola.
  *
  * @author Joseph
  */
-COORD getCursorPosition(HANDLE hConsole) {
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    if (GetConsoleScreenBufferInfo(hConsole, &csbi)) {
-        return csbi.dwCursorPosition;
-    }
-    // Retorna (0,0) si falla
-    return COORD{0, 0};
+TerminalPosition getCursorPosition() {
+    return terminal.getCursorPosition();
 }
 
 /**
- * @brief Mueve el cursor a una posición específica en la consola y borra la línea.
- *
- * Esta función mueve el cursor a las coordenadas proporcionadas (x, y), obtiene el ancho
- * de la consola, crea una cadena de espacios para sobrescribir la línea en esa posición,
- * imprime los espacios para borrar la línea y vuelve a mover el cursor al inicio de la línea borrada.
+ * @brief Mueve el cursor a una posición específica en la consola.
  *
  * @param x La coordenada X (columna) a la que se moverá el cursor.
  * @param y La coordenada Y (fila) a la que se moverá el cursor.
- * @param hConsole El handle de la consola obtenido con GetStdHandle.
  *
  * @author Joseph
  */
-void moveCursor(int x, int y,HANDLE hConsole) {
-    // Mover el cursor a (x, y)
-    COORD pos;
-    pos.X = x;
-    pos.Y = y;
-    if (!SetConsoleCursorPosition(hConsole, pos)) {
-        std::cerr << "Error al mover el cursor a la posición (" << x << ", " << y << ")." << std::endl;
-        return;
-    }
-    // Mover el cursor
-    if (!SetConsoleCursorPosition(hConsole, pos)) {
-        std::cerr << "Error al mover el cursor de vuelta a la posición (" << x << ", " << y << ")." << std::endl;
-        return;
-    }
+void moveCursor(int x, int y) {
+    terminal.moveCursor(x, y);
 }
 
-void deleteLine(HANDLE hConsole){
-    // Obtener el ancho de la consola para saber cuántos espacios usar
-        CONSOLE_SCREEN_BUFFER_INFO csbi;
-        if (!GetConsoleScreenBufferInfo(hConsole, &csbi)) {
-            std::cerr << "Error al obtener la información del buffer de la consola." << std::endl;
-            return;
-        }
-        int anchoConsola = csbi.dwSize.X;
-
-        // Crear una cadena de espacios para sobrescribir la línea
-        std::string espacios(anchoConsola, ' ');
-
-        // Imprimir los espacios para "borrar" la línea
-        std::cout << espacios;
+/**
+ * @brief Borra la línea desde la posición del cursor hasta el final, sin mover el cursor.
+ *
+ * @author Joseph
+ */
+void deleteLine(){
+    terminal.clearToEndOfLine();
 }
 /**
  * @brief Mueve el cursor a una posición específica y elimina la línea en esa posición.
  *
  * Esta función mueve el cursor de la consola a las coordenadas especificadas (x, y) y luego
- * elimina la línea en esa posición utilizando el manejador de consola proporcionado.
+ * elimina la línea desde esa posición.
  *
  * @param x Coordenada horizontal (columna) a la que se moverá el cursor.
  * @param y Coordenada vertical (fila) a la que se moverá el cursor.
- * @param hConsole Manejador de la consola en la que se realizará la operación.
  * @author Joseph
  */
-void moveCursorAndDeleteLine(int x, int y, HANDLE hConsole){
-    moveCursor(x, y, hConsole);
-    deleteLine(hConsole);
+void moveCursorAndDeleteLine(int x, int y){
+    moveCursor(x, y);
+    deleteLine();
 }
 /**
  * @brief Espera a que el usuario presione Enter para continuar.
@@ -152,20 +120,7 @@ bool validateDates(int &day,int &month,int &year,string dateStr){
         std::cout << "Mes invalido. Debe ser un numero entre 1 y 12." << endl;
         return false;
     }
-    int maxDaysInMonth;                 /*Determinar el número máximo de días en el mes dado*/
-    switch (month) {
-        case 4: case 6: case 9: case 11:
-            maxDaysInMonth = 30;
-            break;
-        case 2:
-            if ((year % 4 == 0 && year % 100 != 0) || (year % 400 == 0)){maxDaysInMonth = 29;}/*Determinar el número máximo de días en el mes dado*/
-            else{maxDaysInMonth = 28;}   
-            break;
-        default:
-            maxDaysInMonth = 31;
-            break;
-    }
-    if (day < 1 || day > maxDaysInMonth) {                              /*Validar que el día esté dentro del rango válido para el mes*/
+    if (!isValidDate(day, month, year)) {   /*Validar que el día esté dentro del rango válido para el mes*/
         std::cout << "Dia invalido para el mes especificado." << endl;
         return false;
     }
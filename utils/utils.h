@@ -1,39 +1,33 @@
 #ifndef UTILS_H
 #define UTILS_H
 
-#include <windows.h>
+#include "DateTime.h"
+#include "Terminal.h"
 
 /**
  * @brief Obtiene la posición actual del cursor en la consola.
  *
- * Esta función utiliza las funciones de la API de Windows para recuperar la posición
- * actual del cursor en la consola. Si no puede obtener la posición, retorna (0, 0).
+ * Esta función le pide la posición del cursor a la terminal. Si no puede obtener la posición, retorna (0, 0).
  *
- * @param hConsole El handle de la consola obtenido con GetStdHandle.
- * @return COORD La posición actual del cursor en la consola.
+ * @return TerminalPosition La posición actual del cursor en la consola.
  *
  * @author Joseph
  */
-COORD getCursorPosition(HANDLE hConsole);
+TerminalPosition getCursorPosition();
 
 /**
- * @brief Mueve el cursor a una posición específica en la consola y borra la línea.
- *
- * Esta función mueve el cursor a las coordenadas proporcionadas (x, y), obtiene el ancho
- * de la consola, crea una cadena de espacios para sobrescribir la línea en esa posición,
- * imprime los espacios para borrar la línea y vuelve a mover el cursor al inicio de la línea borrada.
+ * @brief Mueve el cursor a una posición específica en la consola.
  *
  * @param x La coordenada X (columna) a la que se moverá el cursor.
  * @param y La coordenada Y (fila) a la que se moverá el cursor.
- * @param hConsole El handle de la consola obtenido con GetStdHandle.
  *
  * @author Joseph
  */
-void moveCursor(int x, int y,HANDLE hConsole);
+void moveCursor(int x, int y);
 
-void deleteLine(HANDLE hConsole);
+void deleteLine();
 
-void moveCursorAndDeleteLine(int x, int y, HANDLE hConsole);
+void moveCursorAndDeleteLine(int x, int y);
 
 void waitEnter();
 